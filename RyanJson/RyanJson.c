@@ -68,6 +68,10 @@ RyanJsonInternalApi void *RyanJsonInternalExpandRealloc(void *block, uint32_t ol
 void RyanJsonDelete(RyanJson_t pJson)
 {
 	RyanJsonCheckCode(NULL != pJson, { return; });
+#if true == RyanJsonSnapshotShare
+	// 快照只能经 RyanJsonSnapshotRelease 释放
+	RyanJsonCheckCode(RyanJsonFalse == RyanJsonInternalIsSnapshot(pJson), { return; });
+#endif
 
 	RyanJson_t current = pJson;
 	RyanJson_t nextNode;
@@ -76,6 +80,10 @@ void RyanJsonDelete(RyanJson_t pJson)
 		// 容器优先下沉：如果有子节点，先剥离并优先处理子节点
 		if (_checkType(current, RyanJsonTypeArray) || _checkType(current, RyanJsonTypeObject))
 		{
+#if true == RyanJsonPackedArray
+			// 紧凑数组没有子节点链表，直接释放数据块
+			if (RyanJsonInternalIsPackedArray(current)) { RyanJsonInternalPackedFree(current); }
+#endif
 			nextNode = RyanJsonGetObjectValue(current);
 			if (nextNode)
 			{
@@ -92,7 +100,16 @@ void RyanJsonDelete(RyanJson_t pJson)
 
 		// 释放当前节点资源
 		// 如果 strValue 区采用指针模式存储，需先释放外部堆空间
-		if (RyanJsonTrue == RyanJsonGetPayloadStrIsPtrByFlag(current)) { jsonFree(RyanJsonInternalGetStrPtrModeBuf(current)); }
+		if (RyanJsonTrue == RyanJsonGetPayloadStrIsPtrByFlag(current))
+		{
+			RyanJsonInternalFreeStrBuf(RyanJsonInternalGetStrPtrModeBuf(current));
+		}
+#if true == RyanJsonContainerExtEnable
+		if (_checkType(current, RyanJsonTypeArray) || _checkType(current, RyanJsonTypeObject))
+		{
+			RyanJsonInternalFreeContainerExt(current);
+		}
+#endif
 		jsonFree(current);
 		current = nextNode;
 	}
@@ -109,6 +126,9 @@ uint32_t RyanJsonGetSize(RyanJson_t pJson)
 	RyanJsonCheckCode(NULL != pJson, { return 0; });
 
 	if (!_checkType(pJson, RyanJsonTypeArray) && !_checkType(pJson, RyanJsonTypeObject)) { return 1; }
+#if true == RyanJsonPackedArray
+	if (RyanJsonInternalIsPackedArray(pJson)) { return RyanJsonInternalGetPacked(pJson)->count; }
+#endif
 
 	RyanJson_t nextItem = RyanJsonGetObjectValue(pJson);
 	uint32_t size = 0;
@@ -121,61 +141,30 @@ uint32_t RyanJsonGetSize(RyanJson_t pJson)
 	return size;
 }
 
-/**
- * @brief 复制单个节点（不递归复制子节点）
- *
- * @param pJson 源节点
- * @return RyanJson_t 新节点，失败返回 NULL
- */
-static RyanJson_t RyanJsonDuplicateNode(RyanJson_t pJson)
-{
-	RyanJsonCheckAssert(NULL != pJson);
-
-	char *key = RyanJsonIsKey(pJson) ? RyanJsonGetKey(pJson) : NULL;
-	RyanJson_t newItem = NULL;
-
-	switch (RyanJsonGetType(pJson))
-	{
-	case RyanJsonTypeNull: newItem = RyanJsonCreateNull(key); break;
-	case RyanJsonTypeBool: // 创建节点时已写入 Bool 值
-		newItem = RyanJsonCreateBool(key, RyanJsonGetBoolValue(pJson));
-		break;
-
-	case RyanJsonTypeNumber:
-		if (RyanJsonIsInt(pJson)) { newItem = RyanJsonCreateInt(key, RyanJsonGetIntValue(pJson)); }
-		else
-		{
-			// Number 节点除 int32_t 外只可能是 Double
-			RyanJsonCheckAssert(RyanJsonIsDouble(pJson));
-			newItem = RyanJsonCreateDouble(key, RyanJsonGetDoubleValue(pJson));
-		}
-		break;
-	case RyanJsonTypeString: newItem = RyanJsonCreateString(key, RyanJsonGetStringValue(pJson)); break;
-	case RyanJsonTypeArray: newItem = RyanJsonInternalCreateArrayAndKey(key); break;
-	case RyanJsonTypeObject: newItem = RyanJsonInternalCreateObjectAndKey(key); break;
-	}
-	return newItem;
-}
-
 /**
  * @brief 深拷贝整棵 Json 树（迭代版）
  *
  * @param pJson 源 Json 根节点
  * @return RyanJson_t 拷贝后的根节点，失败返回 NULL
+ * @note 逐节点按字节复制，不经 RyanJsonCreate* 重新计算 key/strValue 长度与元信息。
  */
 RyanJson_t RyanJsonDuplicate(RyanJson_t pJson)
 {
 	RyanJsonCheckReturnNull(NULL != pJson);
 
 	// 先复制根节点
-	RyanJson_t root = RyanJsonDuplicateNode(pJson);
+	RyanJson_t root = RyanJsonInternalCloneNode(pJson);
 	RyanJsonCheckReturnNull(NULL != root);
 
 	// 初始化迭代状态
 	// sourceNode：当前遍历到的源节点，初始指向根节点的首个子节点
 	RyanJson_t sourceNode = NULL;
 
-	if (_checkType(pJson, RyanJsonTypeArray) || _checkType(pJson, RyanJsonTypeObject)) { sourceNode = RyanJsonGetObjectValue(pJson); }
+	// 紧凑数组已在 RyanJsonInternalCloneNode 中整体复制，不再下沉
+	if ((_checkType(pJson, RyanJsonTypeArray) || _checkType(pJson, RyanJsonTypeObject)) && !RyanJsonInternalIsPackedArray(pJson))
+	{
+		sourceNode = RyanJsonGetObjectValue(pJson);
+	}
 
 	// 如果根节点不是容器类型（Array 或 Object），或者容器为空（没有子节点），
 	// 则不需要进行后续的子节点复制，直接返回根节点副本即可。
@@ -191,7 +180,7 @@ RyanJson_t RyanJsonDuplicate(RyanJson_t pJson)
 	{
 		// 复制当前节点并插入目标树
 		{
-			RyanJson_t newItem = RyanJsonDuplicateNode(sourceNode);
+			RyanJson_t newItem = RyanJsonInternalCloneNode(sourceNode);
 			RyanJsonCheckCode(NULL != newItem, { goto error__; });
 
 			// 新节点插入到目标父节点下，位置在 lastSibling 之后
@@ -202,7 +191,8 @@ RyanJson_t RyanJsonDuplicate(RyanJson_t pJson)
 
 		// 当前节点是非空容器时下沉到子层
 		// 如果当前源节点是容器且非空，则进入下一层级
-		if (_checkType(sourceNode, RyanJsonTypeArray) || _checkType(sourceNode, RyanJsonTypeObject))
+		if ((_checkType(sourceNode, RyanJsonTypeArray) || _checkType(sourceNode, RyanJsonTypeObject)) &&
+		    !RyanJsonInternalIsPackedArray(sourceNode))
 		{
 			RyanJson_t child = RyanJsonGetObjectValue(sourceNode);
 			if (child)
@@ -250,6 +240,83 @@ error__:
 	return NULL;
 }
 
+#if true == RyanJsonSnapshotShare
+/**
+ * @brief 取得容器当前内容的只读快照
+ *
+ * @param pJson 容器节点（Array 或 Object），也可以是已有快照
+ * @return RyanJson_t 快照根节点，失败返回 NULL
+ * @note pJson 自上次快照以来未被修改时直接共享上次的副本，否则复制一份并记录在 pJson 上供后续快照共享。
+ * @note 记录失败（扩展信息申请失败）时快照照常返回，只是不参与共享。
+ */
+RyanJson_t RyanJsonSnapshot(RyanJson_t pJson)
+{
+	RyanJsonCheckReturnNull(NULL != pJson);
+	RyanJsonCheckReturnNull(_checkType(pJson, RyanJsonTypeArray) || _checkType(pJson, RyanJsonTypeObject));
+
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	if (NULL != ext)
+	{
+		// 快照本身只读，直接共享
+		if (RyanJsonInternalIsSnapshotRoot(ext))
+		{
+			RyanJsonInternalSetSnapshotRef(ext, RyanJsonInternalGetSnapshotRef(ext) + 1U);
+			return pJson;
+		}
+
+		RyanJson_t shared = RyanJsonInternalGetSnapshot(ext);
+		if (NULL != shared)
+		{
+			RyanJsonContainerExt_t *sharedExt = RyanJsonInternalGetContainerExt(shared);
+			RyanJsonInternalSetSnapshotRef(sharedExt, RyanJsonInternalGetSnapshotRef(sharedExt) + 1U);
+			return shared;
+		}
+	}
+
+	RyanJson_t snapshot = RyanJsonDuplicate(pJson);
+	RyanJsonCheckReturnNull(NULL != snapshot);
+	RyanJsonCheckAssert(0U == ((uintptr_t)snapshot & 1U));
+
+	RyanJsonContainerExt_t *snapshotExt = RyanJsonInternalEnsureContainerExt(snapshot);
+	RyanJsonCheckCode(NULL != snapshotExt, {
+		RyanJsonDelete(snapshot);
+		return NULL;
+	});
+	RyanJsonInternalSetSnapshotRef(snapshotExt, 1U);
+
+	ext = RyanJsonInternalEnsureContainerExt(pJson);
+	if (NULL != ext)
+	{
+		RyanJsonInternalSetSnapshot(ext, snapshot);
+		RyanJsonInternalSetSnapshotRef(snapshotExt, 2U); // pJson 持有一次引用
+	}
+	return snapshot;
+}
+
+/**
+ * @brief 释放一次快照引用，最后一个引用释放时删除副本
+ *
+ * @param snapshot RyanJsonSnapshot 返回的快照根节点
+ */
+void RyanJsonSnapshotRelease(RyanJson_t snapshot)
+{
+	RyanJsonCheckCode(NULL != snapshot, { return; });
+	RyanJsonCheckCode(_checkType(snapshot, RyanJsonTypeArray) || _checkType(snapshot, RyanJsonTypeObject), { return; });
+
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(snapshot);
+	RyanJsonCheckCode(NULL != ext && 0U != RyanJsonInternalGetSnapshotRef(ext), { return; });
+
+	uint32_t ref = RyanJsonInternalGetSnapshotRef(ext) - 1U;
+	if (0U == ref)
+	{
+		RyanJsonInternalSetSnapshot(ext, NULL); // 清除快照标记后才能删除
+		RyanJsonDelete(snapshot);
+		return;
+	}
+	RyanJsonInternalSetSnapshotRef(ext, ref);
+}
+#endif
+
 /**
  * @brief 原地压缩 Json 文本（移除空白与注释）
  *
@@ -319,6 +386,71 @@ uint32_t RyanJsonMinify(char *text, int32_t textLen)
 	return count; // 返回压缩后大小
 }
 
+/**
+ * @brief 在右侧 Object 中查找与 leftNext 对应的成员（同序快路径未命中时使用）
+ *
+ * @param leftCurrent leftNext 的前一个兄弟
+ * @param leftNext 左侧待匹配成员
+ * @param rightParent 右侧对应的 Object
+ * @return RyanJson_t 匹配成员，不存在返回 NULL
+ * @note strict 模式按 key 查找；non-strict 模式按“同 key + 相同出现序号”精确匹配，需扫描左右两侧。
+ */
+static RyanJson_t RyanJsonCompareFindSibling(RyanJson_t leftCurrent, RyanJson_t leftNext, RyanJson_t rightParent)
+{
+#if true == RyanJsonStrictObjectKeyCheck
+	// strict 模式下 key 唯一，直接按 key 查找即可。
+	(void)leftCurrent;
+	return RyanJsonGetObjectByKeyLen(rightParent, RyanJsonGetKey(leftNext), RyanJsonInternalGetKeyLen(leftNext));
+#else
+	RyanJson_t leftParent = RyanJsonInternalGetParent(leftCurrent);
+	RyanJsonCheckAssert(NULL != leftParent && RyanJsonTrue == RyanJsonIsObject(leftParent));
+
+	// 先在左父节点里统计 leftNext 是该 key 的第几次出现（0-based）。
+	// 例如 leftParent 子节点是 a,b,a,c，则第二个 a 的序号是 1。
+	uint32_t leftSameKeyIndex = 0;
+	RyanJson_t leftScan = RyanJsonGetObjectValue(leftParent);
+	RyanJsonCheckAssert(NULL != leftScan);
+	while (leftScan != leftNext)
+	{
+		RyanJsonCheckAssert(RyanJsonTrue == RyanJsonIsKey(leftScan));
+		if (RyanJsonTrue == RyanJsonInternalKeyEqNode(leftNext, leftScan)) { leftSameKeyIndex++; }
+		leftScan = RyanJsonGetNext(leftScan);
+		RyanJsonCheckAssert(NULL != leftScan);
+	}
+
+	// 再在右父节点里找到“同 key 的同序号节点”。
+	// 这样重复 key 的比较就不是“命中任意一个同名节点”，而是稳定地按出现次序对齐。
+	uint32_t rightSameKeyIndex = 0;
+	for (RyanJson_t rightScan = RyanJsonGetObjectValue(rightParent); NULL != rightScan; rightScan = RyanJsonGetNext(rightScan))
+	{
+		RyanJsonCheckAssert(RyanJsonTrue == RyanJsonIsKey(rightScan));
+		if (RyanJsonTrue == RyanJsonInternalKeyEqNode(leftNext, rightScan))
+		{
+			if (rightSameKeyIndex == leftSameKeyIndex) { return rightScan; }
+			rightSameKeyIndex++;
+		}
+	}
+	return NULL;
+#endif
+}
+
+#if true == RyanJsonHashCache
+/**
+ * @brief 两侧容器都持有子树哈希缓存且哈希不同时，内容必然不同
+ * @note 含 Double 的子树按容差比较，哈希不同也可能相等，不参与判定；哈希相同时仍需逐节点比较。
+ */
+static RyanJsonBool_e RyanJsonCompareHashMismatch(RyanJson_t leftJson, RyanJson_t rightJson)
+{
+	uint32_t leftHash;
+	uint32_t rightHash;
+	RyanJsonBool_e leftHasDouble;
+	RyanJsonBool_e rightHasDouble;
+	if (RyanJsonTrue != RyanJsonInternalGetHashCache(leftJson, &leftHash, &leftHasDouble)) { return RyanJsonFalse; }
+	if (RyanJsonTrue != RyanJsonInternalGetHashCache(rightJson, &rightHash, &rightHasDouble)) { return RyanJsonFalse; }
+	return RyanJsonMakeBool(!leftHasDouble && !rightHasDouble && leftHash != rightHash);
+}
+#endif
+
 /**
  * @brief Json 内部比较函数（支持全量比较/仅 Key 比较）
  *
@@ -336,11 +468,20 @@ static RyanJsonBool_e RyanJsonInternalCompare(RyanJson_t leftJson, RyanJson_t ri
 	RyanJson_t leftCurrent = leftJson;
 	RyanJson_t rightCurrent = rightJson;
 
+	// rightParent：右侧当前层的父节点，回溯与按 key 查找兄弟时使用，避免每一步都沿兄弟链走到尾部找父节点；
+	// ordered：当前层至今为止左右两侧逐个位置 key 一致，此时右侧下一个兄弟就是候选匹配（重复 key 的出现序号也必然对齐）。
+	// 祖先层的这两项缓存在定长数组中，深度超出缓存时回溯退回 RyanJsonInternalGetParent，且该层按乱序处理，结果不变。
+	RyanJson_t rightParent = NULL;
+	RyanJsonBool_e ordered = RyanJsonTrue;
+	RyanJson_t rightAncestors[RyanJsonCompareAncestorCacheDepth] = {NULL};
+	uint32_t ancestorOrderedBits = 0;
+	uint32_t depth = 0;
+
 	while (1)
 	{
 		// 比较当前节点的类型、值与规模
-		RyanJsonType_e leftType = RyanJsonGetType(leftCurrent);
-		RyanJsonCheckReturnFalse(leftType == RyanJsonGetType(rightCurrent));
+		RyanJsonType_e leftType = RyanJsonGetPayloadTypeByFlag(leftCurrent);
+		RyanJsonCheckReturnFalse(leftType == RyanJsonGetPayloadTypeByFlag(rightCurrent));
 
 #if defined(__clang__)
 #pragma clang diagnostic push
@@ -358,61 +499,119 @@ static RyanJsonBool_e RyanJsonInternalCompare(RyanJson_t leftJson, RyanJson_t ri
 		case RyanJsonTypeNumber:
 			if (fullCompare)
 			{
-				if (RyanJsonIsInt(leftCurrent))
-				{
-					RyanJsonCheckReturnFalse(RyanJsonGetIntValue(leftCurrent) == RyanJsonGetIntValue(rightCurrent));
-				}
+				// Int/Double 种类需一致（与紧凑数组比较语义相同）；懒数值局部解析，节点保持不变
+				RyanJsonBool_e leftIsInt, rightIsInt;
+				double leftNumber = RyanJsonInternalGetNumber(leftCurrent, &leftIsInt);
+				double rightNumber = RyanJsonInternalGetNumber(rightCurrent, &rightIsInt);
+				RyanJsonCheckReturnFalse(leftIsInt == rightIsInt);
+				if (leftIsInt) { RyanJsonCheckReturnFalse(leftNumber == rightNumber); }
 				else
 				{
-					RyanJsonCheckReturnFalse(RyanJsonCompareDouble(RyanJsonGetDoubleValue(leftCurrent),
-										       RyanJsonGetDoubleValue(rightCurrent)));
+					RyanJsonCheckReturnFalse(RyanJsonCompareDouble(leftNumber, rightNumber));
 				}
 			}
 			break;
 		case RyanJsonTypeString:
+			// 按解码后的内容比较；懒字符串逐字节流式解码，不改动节点
 			if (fullCompare)
+			{
+				RyanJsonBool_e leftLazy = RyanJsonInternalIsLazyString(leftCurrent);
+				RyanJsonBool_e rightLazy = RyanJsonInternalIsLazyString(rightCurrent);
+				const char *leftStr = RyanJsonInternalGetStrValue(leftCurrent);
+				const char *rightStr = RyanJsonInternalGetStrValue(rightCurrent);
+				if (leftLazy || rightLazy)
+				{
+					RyanJsonCheckReturnFalse(RyanJsonInternalUnescapedEq(leftStr, leftLazy, rightStr, rightLazy));
+				}
+				else
+				{
+					RyanJsonCheckReturnFalse(RyanJsonInternalStrEq(leftStr, rightStr));
+				}
+			}
+			break;
+		case RyanJsonTypeBlob:
+			// Raw 与 Blob 共用类型，Raw 按文本逐字节比较，不解析语义
+			RyanJsonCheckReturnFalse(RyanJsonIsRaw(leftCurrent) == RyanJsonIsRaw(rightCurrent));
+			if (fullCompare && RyanJsonIsRaw(leftCurrent))
 			{
 				RyanJsonCheckReturnFalse(
 					RyanJsonInternalStrEq(RyanJsonGetStringValue(leftCurrent), RyanJsonGetStringValue(rightCurrent)));
 			}
+			else if (fullCompare)
+			{
+				uint32_t leftLen;
+				uint32_t rightLen;
+				const uint8_t *leftData = RyanJsonGetBlobValue(leftCurrent, &leftLen);
+				const uint8_t *rightData = RyanJsonGetBlobValue(rightCurrent, &rightLen);
+				RyanJsonCheckReturnFalse(leftLen == rightLen);
+				RyanJsonCheckReturnFalse(leftData == rightData || 0 == RyanJsonMemcmp(leftData, rightData, leftLen));
+			}
 			break;
 		case RyanJsonTypeArray:
-		case RyanJsonTypeObject: RyanJsonCheckReturnFalse(RyanJsonGetSize(leftCurrent) == RyanJsonGetSize(rightCurrent)); break;
+		case RyanJsonTypeObject:
+			RyanJsonCheckReturnFalse(RyanJsonGetSize(leftCurrent) == RyanJsonGetSize(rightCurrent));
+#if true == RyanJsonHashCache
+			if (fullCompare) { RyanJsonCheckReturnFalse(RyanJsonTrue != RyanJsonCompareHashMismatch(leftCurrent, rightCurrent)); }
+#endif
+			break;
 		default: return RyanJsonFalse;
 		}
 #if defined(__clang__)
 #pragma clang diagnostic pop
 #endif
 
+		// 任一侧为紧凑数组时整体逐元素比较，按叶子处理，不展开
+		RyanJsonBool_e isPackedPair = RyanJsonFalse;
+#if true == RyanJsonPackedArray
+		if (RyanJsonInternalIsPackedArray(leftCurrent) || RyanJsonInternalIsPackedArray(rightCurrent))
+		{
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalPackedCompare(leftCurrent, rightCurrent, fullCompare));
+			isPackedPair = RyanJsonTrue;
+		}
+#endif
+
 		// 容器节点尝试下沉到子节点继续比较
-		if (_checkType(leftCurrent, RyanJsonTypeArray) || _checkType(leftCurrent, RyanJsonTypeObject))
+		if (!isPackedPair && (_checkType(leftCurrent, RyanJsonTypeArray) || _checkType(leftCurrent, RyanJsonTypeObject)))
 		{
 			RyanJson_t leftChild = RyanJsonGetObjectValue(leftCurrent);
 			if (leftChild)
 			{
 				RyanJson_t rightChild = NULL;
+				RyanJsonBool_e childOrdered = RyanJsonTrue;
 
 				if (RyanJsonIsArray(leftCurrent)) { rightChild = RyanJsonGetObjectValue(rightCurrent); }
 				else
 				{
 					RyanJsonCheckAssert(RyanJsonTrue == RyanJsonIsKey(leftChild));
-					const char *leftChildKey = RyanJsonGetKey(leftChild);
 
 					// 同序快路径：首子节点 key 一致时直接下沉，避免一次 O(n) 查找
 					RyanJson_t rightFirstChild = RyanJsonGetObjectValue(rightCurrent);
 					RyanJsonCheckAssert(NULL != rightFirstChild && RyanJsonTrue == RyanJsonIsKey(rightFirstChild));
-					if (RyanJsonTrue == RyanJsonInternalStrEq(leftChildKey, RyanJsonGetKey(rightFirstChild)))
-					{
-						rightChild = rightFirstChild;
-					}
+					if (RyanJsonTrue == RyanJsonInternalKeyEqNode(leftChild, rightFirstChild)) { rightChild = rightFirstChild; }
 					else
 					{
-						rightChild = RyanJsonGetObjectByKey(rightCurrent, leftChildKey);
+						childOrdered = RyanJsonFalse;
+						rightChild = RyanJsonGetObjectByKeyLen(rightCurrent, RyanJsonGetKey(leftChild),
+										       RyanJsonInternalGetKeyLen(leftChild));
 					}
 				}
 
 				RyanJsonCheckReturnFalse(NULL != rightChild);
 
+				// 保存本层状态后进入子层
+				if (depth < RyanJsonCompareAncestorCacheDepth)
+				{
+					rightAncestors[depth] = rightParent;
+					if (RyanJsonTrue == ordered) { ancestorOrderedBits |= (uint32_t)1U << depth; }
+					else
+					{
+						ancestorOrderedBits &= ~((uint32_t)1U << depth);
+					}
+				}
+				depth++;
+				rightParent = rightCurrent;
+				ordered = childOrdered;
+
 				leftCurrent = leftChild;
 				rightCurrent = rightChild;
 				continue;
@@ -436,67 +635,25 @@ static RyanJsonBool_e RyanJsonInternalCompare(RyanJson_t leftJson, RyanJson_t ri
 			RyanJson_t leftNext = RyanJsonGetNext(leftCurrent);
 			if (leftNext)
 			{
-				RyanJson_t rightNext = NULL;
-				if (RyanJsonFalse == RyanJsonIsKey(leftNext))
+				// 无 key 节点只会出现在 Array 路径上，Array 比较是严格按顺序进行的，
+				// 因而右侧可以直接取当前节点的 next 兄弟，不需要额外查找。
+				RyanJson_t rightNext = RyanJsonGetNext(rightCurrent);
+				if (RyanJsonTrue == RyanJsonIsKey(leftNext))
 				{
-					// 无 key 节点只会出现在 Array 路径上，Array 比较是严格按顺序进行的，
-					// 因而右侧可以直接取当前节点的 next 兄弟，不需要额外查找。
-					rightNext = RyanJsonGetNext(rightCurrent);
-				}
-				else
-				{
-					RyanJsonCheckAssert(RyanJsonTrue == RyanJsonIsKey(leftNext));
-					const char *leftNextKey = RyanJsonGetKey(leftNext);
-					RyanJson_t rightParent = RyanJsonInternalGetParent(rightCurrent);
-
 					// Object 比较是“同层无序、同 key 对齐”语义，不能像 Array 那样直接依赖 rightCurrent->next：
-					// - strict 模式下 key 唯一，按 key 找即可；
+					// - strict 模式下 key 唯一，右侧下一个兄弟 key 一致即为唯一匹配，否则按 key 找；
 					// - non-strict 模式下允许重复 key，必须继续保证“同 key 的第 N 次出现”彼此对齐，
 					//   否则会把后一个重复 key 错配到右侧第一个同名节点，导致 Compare/CompareOnlyKey 语义漂移。
-					RyanJsonCheckAssert(NULL != rightParent && RyanJsonTrue == RyanJsonIsObject(rightParent));
-#if true == RyanJsonStrictObjectKeyCheck
-					// strict 模式下 key 唯一，直接按 key 查找即可。
-					rightNext = RyanJsonGetObjectByKey(rightParent, leftNextKey);
-#else
-					// 非严格模式下允许重复 key，按“同 key + 相同出现序号”精确匹配。
-					RyanJson_t leftParent = RyanJsonInternalGetParent(leftCurrent);
-					RyanJsonCheckAssert(NULL != leftParent && RyanJsonTrue == RyanJsonIsObject(leftParent));
-
-					// 先在左父节点里统计 leftNext 是该 key 的第几次出现（0-based）。
-					// 例如 leftParent 子节点是 a,b,a,c，则第二个 a 的序号是 1。
-					uint32_t leftSameKeyIndex = 0;
-					RyanJson_t leftScan = RyanJsonGetObjectValue(leftParent);
-					RyanJsonCheckAssert(NULL != leftScan);
-					while (leftScan != leftNext)
-					{
-						RyanJsonCheckAssert(RyanJsonTrue == RyanJsonIsKey(leftScan));
-						if (RyanJsonTrue == RyanJsonInternalStrEq(leftNextKey, RyanJsonGetKey(leftScan)))
-						{
-							leftSameKeyIndex++;
-						}
-						leftScan = RyanJsonGetNext(leftScan);
-						RyanJsonCheckAssert(NULL != leftScan);
-					}
-
-					// 再在右父节点里找到“同 key 的同序号节点”。
-					// 这样重复 key 的比较就不是“命中任意一个同名节点”，而是稳定地按出现次序对齐。
-					uint32_t rightSameKeyIndex = 0;
-					RyanJson_t rightScan = RyanJsonGetObjectValue(rightParent);
-					while (rightScan)
+					//   只有本层此前逐位置对齐时，下一个兄弟的出现序号才与左侧一致，可以直接采用。
+#if true != RyanJsonStrictObjectKeyCheck
+					if (RyanJsonTrue != ordered) { rightNext = NULL; }
+#endif
+					if (NULL == rightNext || RyanJsonTrue != RyanJsonInternalKeyEqNode(leftNext, rightNext))
 					{
-						RyanJsonCheckAssert(RyanJsonTrue == RyanJsonIsKey(rightScan));
-						if (RyanJsonTrue == RyanJsonInternalStrEq(leftNextKey, RyanJsonGetKey(rightScan)))
-						{
-							if (rightSameKeyIndex == leftSameKeyIndex)
-							{
-								rightNext = rightScan;
-								break;
-							}
-							rightSameKeyIndex++;
-						}
-						rightScan = RyanJsonGetNext(rightScan);
+						ordered = RyanJsonFalse;
+						RyanJsonCheckAssert(NULL != rightParent && RyanJsonTrue == RyanJsonIsObject(rightParent));
+						rightNext = RyanJsonCompareFindSibling(leftCurrent, leftNext, rightParent);
 					}
-#endif
 				}
 
 				RyanJsonCheckReturnFalse(NULL != rightNext);
@@ -513,14 +670,19 @@ static RyanJsonBool_e RyanJsonInternalCompare(RyanJson_t leftJson, RyanJson_t ri
 			//   正是这里做迭代式 DFS 回溯所需要的那条内部回链。
 			leftCurrent = leftCurrent->next;
 
-			// leftCurrent 此时已经被抬回父节点，所以这里按“父节点类型”决定右侧如何回溯。
-			// - Array：左右两边始终按相同 sibling 顺序推进，rightCurrent->next 正好也挂回父节点；
-			// - Object：右侧当前节点可能是按 key/序号匹配得到的任意兄弟，未必处在链表尾部，
-			//   这时不能假设 rightCurrent->next 是父节点，只能显式调用 RyanJsonInternalGetParent。
-			if (RyanJsonIsArray(leftCurrent)) { rightCurrent = rightCurrent->next; }
+			// 右侧当前节点可能是按 key/序号匹配得到的任意兄弟，未必处在链表尾部，
+			// 因而不能假设 rightCurrent->next 是父节点，直接取下沉时记录的 rightParent。
+			rightCurrent = rightParent;
+			depth--;
+			if (depth < RyanJsonCompareAncestorCacheDepth)
+			{
+				rightParent = rightAncestors[depth];
+				ordered = RyanJsonMakeBool(0U != (ancestorOrderedBits & ((uint32_t)1U << depth)));
+			}
 			else
 			{
-				rightCurrent = RyanJsonInternalGetParent(rightCurrent);
+				rightParent = RyanJsonInternalGetParent(rightCurrent);
+				ordered = RyanJsonFalse;
 			}
 		}
 	}
@@ -549,3 +711,219 @@ RyanJsonBool_e RyanJsonCompareOnlyKey(RyanJson_t leftJson, RyanJson_t rightJson)
 {
 	return RyanJsonInternalCompare(leftJson, rightJson, RyanJsonFalse);
 }
+
+#if true == RyanJsonHashCache
+typedef struct
+{
+	uint32_t sum;         // 进入该容器前的累加值
+	uint32_t nodeCount;   // 进入该容器前已访问的节点数
+	uint32_t doubleCount; // 进入该容器前已访问的 Double 数
+} RyanJsonHashFrame_t;
+#endif
+
+/**
+ * @brief 叶子节点（含空容器）的内容哈希
+ */
+static uint32_t RyanJsonHashLeaf(RyanJson_t pJson)
+{
+	RyanJsonType_e type = RyanJsonGetPayloadTypeByFlag(pJson);
+	if (RyanJsonTypeNumber == type)
+	{
+		RyanJsonBool_e isInt;
+		double number = RyanJsonInternalGetNumber(pJson, &isInt);
+		if (isInt) { return RyanJsonInternalHashInt((int32_t)number); }
+		return RyanJsonInternalHashDouble(number);
+	}
+	if (RyanJsonTypeString == type)
+	{
+		// 懒字符串按解码结果流式哈希，与解码后再哈希结果一致，节点保持不变
+		const char *strValue = RyanJsonInternalGetStrValue(pJson);
+		uint32_t hash;
+		if (RyanJsonInternalIsLazyString(pJson)) { hash = RyanJsonInternalUnescapedHash(strValue, NULL); }
+		else
+		{
+			uint32_t len;
+			(void)RyanJsonInternalGetStrValueInfo(pJson, &len);
+			hash = RyanJsonInternalKeyHash(strValue, len);
+		}
+		return RyanJsonInternalHashMix(RyanJsonInternalHashTag(type) ^ hash);
+	}
+	if (RyanJsonTypeBool == type)
+	{
+		return RyanJsonInternalHashMix(RyanJsonInternalHashTag(type) ^ (uint32_t)RyanJsonGetBoolValue(pJson));
+	}
+	if (RyanJsonInternalIsRaw(pJson))
+	{
+		// 扩展位参与标签，区分同内容的 Raw 与 Blob
+		uint32_t len;
+		(void)RyanJsonInternalGetStrValueInfo(pJson, &len);
+		return RyanJsonInternalHashMix(RyanJsonInternalHashTag((uint32_t)type | 0x08U) ^
+					       RyanJsonInternalKeyHash(RyanJsonGetStringValue(pJson), len));
+	}
+	if (RyanJsonTypeBlob == type)
+	{
+		uint32_t len;
+		const uint8_t *data = RyanJsonGetBlobValue(pJson, &len);
+		return RyanJsonInternalHashMix(RyanJsonInternalHashTag(type) ^ RyanJsonInternalKeyHash((const char *)data, len));
+	}
+	return RyanJsonInternalHashTag(type);
+}
+
+/**
+ * @brief 计算子树内容哈希
+ *
+ * @param pJson 子树根节点
+ * @return uint32_t 哈希值，pJson 为 NULL 时返回 0
+ * @note 内容相同的子树哈希必然相同：Object 成员顺序、紧凑数组与普通 Array 的存储差异、根节点自身的 key 均不影响结果；
+ *       Array 元素顺序、key、值与类型（Int/Double 区分）都参与计算。哈希不同则内容必然不同，哈希相同仍可能碰撞。
+ * @note 迭代遍历，栈占用固定。每个节点的贡献为“节点内容哈希 * 路径权重”，路径权重为可逆奇数，
+ *       兄弟间切换与回溯只需乘上对应权重的逆元，无需逐层保存。
+ * @note 启用 RyanJsonHashCache 时会为足够大的容器记录子树哈希，下次计算直接复用，修改接口会沿父链作废缓存。
+ */
+uint32_t RyanJsonHash(RyanJson_t pJson)
+{
+	RyanJsonCheckCode(NULL != pJson, return 0;);
+
+	const uint32_t stepInverse = RyanJsonInternalHashInverse(RyanJsonHashArrayStep);
+	uint32_t sum = 0;
+	uint32_t weight = 1U; // 当前节点的路径权重
+
+	// 逐层记录父容器是否为 Array（Array 内也可能出现带 key 的子节点，不能按 key 判断），超出缓存深度时现场查找父节点
+	uint32_t parentIsArrayBits = 0;
+	uint32_t depth = 0;
+#if true == RyanJsonHashCache
+	RyanJsonHashFrame_t frames[RyanJsonCompareAncestorCacheDepth] = {{0}};
+	uint32_t nodeCount = 0;
+	uint32_t doubleCount = 0;
+#endif
+
+	RyanJson_t current = pJson;
+	while (1)
+	{
+		RyanJson_t child = NULL;
+#if true == RyanJsonHashCache
+		uint32_t sumBefore = sum;
+		uint32_t cachedHash;
+		RyanJsonBool_e cachedHasDouble;
+		nodeCount++;
+#endif
+
+		if (!_checkType(current, RyanJsonTypeArray) && !_checkType(current, RyanJsonTypeObject))
+		{
+			sum += weight * RyanJsonHashLeaf(current);
+#if true == RyanJsonHashCache
+			if (RyanJsonIsNumber(current) && !RyanJsonIsInt(current)) { doubleCount++; }
+#endif
+		}
+#if true == RyanJsonHashCache
+		else if (RyanJsonTrue == RyanJsonInternalGetHashCache(current, &cachedHash, &cachedHasDouble))
+		{
+			// 缓存只记录在足够大的子树上，按阈值计入节点数，保证祖先仍可被缓存
+			sum += weight * cachedHash;
+			nodeCount += RyanJsonHashCacheMinSize;
+			if (cachedHasDouble) { doubleCount++; }
+		}
+#endif
+#if true == RyanJsonPackedArray
+		else if (RyanJsonInternalIsPackedArray(current))
+		{
+			RyanJsonBool_e packedHasDouble;
+			sum += weight * RyanJsonInternalPackedHash(current, &packedHasDouble);
+#if true == RyanJsonHashCache
+			nodeCount += RyanJsonInternalGetPacked(current)->count;
+			if (packedHasDouble) { doubleCount++; }
+#else
+			(void)packedHasDouble;
+#endif
+		}
+#endif
+		else
+		{
+			sum += weight * RyanJsonInternalHashTag(RyanJsonGetPayloadTypeByFlag(current));
+			child = RyanJsonGetObjectValue(current);
+		}
+
+		// 非空容器下沉到首个子节点
+		if (NULL != child)
+		{
+			RyanJsonBool_e isArray = RyanJsonIsArray(current);
+			if (depth < RyanJsonCompareAncestorCacheDepth)
+			{
+				if (isArray) { parentIsArrayBits |= (uint32_t)1U << depth; }
+				else
+				{
+					parentIsArrayBits &= ~((uint32_t)1U << depth);
+				}
+#if true == RyanJsonHashCache
+				frames[depth].sum = sumBefore;
+				frames[depth].nodeCount = nodeCount - 1U;
+				frames[depth].doubleCount = doubleCount;
+#endif
+			}
+			depth++;
+
+			// Array 首元素权重 B * A^(n-1)，之后每个兄弟乘 A 的逆元，末元素恰为 B
+			if (isArray)
+			{
+				uint32_t size = RyanJsonGetSize(current);
+				weight *= RyanJsonHashArrayLast * RyanJsonInternalHashPow(RyanJsonHashArrayStep, size - 1U);
+			}
+			else
+			{
+				weight *= RyanJsonInternalHashKeyWeight(RyanJsonGetKey(child), RyanJsonInternalGetKeyLen(child));
+			}
+			current = child;
+			continue;
+		}
+
+		// 寻找下一个待访问节点：优先同层兄弟，否则逐层回溯
+		while (1)
+		{
+			if (current == pJson) { return RyanJsonInternalHashMix(sum); }
+
+			RyanJsonBool_e parentIsArray;
+			if (depth <= RyanJsonCompareAncestorCacheDepth)
+			{
+				parentIsArray = RyanJsonMakeBool(0U != (parentIsArrayBits & ((uint32_t)1U << (depth - 1U))));
+			}
+			else
+			{
+				parentIsArray = RyanJsonIsArray(RyanJsonInternalGetParent(current));
+			}
+
+			uint32_t currentKeyWeight = 1U;
+			if (!parentIsArray)
+			{
+				currentKeyWeight = RyanJsonInternalHashKeyWeight(RyanJsonGetKey(current), RyanJsonInternalGetKeyLen(current));
+			}
+
+			RyanJson_t next = RyanJsonGetNext(current);
+			if (NULL != next)
+			{
+				if (parentIsArray) { weight *= stepInverse; }
+				else
+				{
+					weight *= RyanJsonInternalHashInverse(currentKeyWeight) *
+						  RyanJsonInternalHashKeyWeight(RyanJsonGetKey(next), RyanJsonInternalGetKeyLen(next));
+				}
+				current = next;
+				break;
+			}
+
+			// 最后一个兄弟的 next 在内部链表中指向父节点，正是回溯所需
+			weight *= RyanJsonInternalHashInverse(parentIsArray ? RyanJsonHashArrayLast : currentKeyWeight);
+			current = current->next;
+			depth--;
+
+#if true == RyanJsonHashCache
+			// 子树贡献为 weight * 子树哈希，乘 weight 的逆元即得与位置无关的子树哈希
+			if (depth < RyanJsonCompareAncestorCacheDepth && nodeCount - frames[depth].nodeCount >= RyanJsonHashCacheMinSize)
+			{
+				uint32_t subtreeHash = (sum - frames[depth].sum) * RyanJsonInternalHashInverse(weight);
+				RyanJsonBool_e hasDouble = RyanJsonMakeBool(doubleCount != frames[depth].doubleCount);
+				RyanJsonInternalSetHashCache(current, subtreeHash, hasDouble);
+			}
+#endif
+		}
+	}
+}
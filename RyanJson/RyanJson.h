@@ -60,7 +60,9 @@ struct RyanJsonNode
 	 *
 	 * Flag Bits（bit7..bit0）:
 	 * - bit0-2: Type（Null/Bool/Number/String/Array/Object）
-	 * - bit3  : Bool/Number 扩展位（Bool: true/false；Number: Int/Double）
+	 * - bit3  : 各类型扩展位（Bool: true/false；Number: Int/Double；String: 保留转义文本的懒字符串，
+	 *           见 RyanJsonParseFlagLazyString；Array: 紧凑数值数组，见 RyanJsonPackedArray；
+	 *           Object: 子树内有增量记录，见 RyanJsonDeltaTracking；类型 7: Blob/Raw）
 	 * - bit4-5: keyLenField 编码（0/1/2/4 字节）
 	 * - bit6  : strMode（inline/ptr）
 	 * - bit7  : IsLast（1 表示 next 指向 Parent 线索）
@@ -89,9 +91,17 @@ struct RyanJsonNode
 	 *   条件：key/strValue 字节总和 + keyLenField 宽度 <= `RyanJsonInlineStringSize`。
 	 *   说明：无 key 时 keyLenField 宽度为 0。
 	 *
+	 * - strValue 元信息（仅 ptr 模式的 String 节点）：
+	 *   位置：指针槽之后的内联区剩余空间（最多 4 字节），不额外占用内存。
+	 *   内容：strValue 长度 + “无需转义”标记，详见 RyanJsonStrValueMetaOffset。
+	 *
+	 * - key 指纹（仅 ptr 模式且 keyLenField 宽度不足 4 字节）：
+	 *   位置：指针槽之前的最后一个字节（keyLenField 与指针槽之间的空闲字节）。
+	 *   内容：key 哈希的 1 字节指纹，按 key 查找时先比较长度与指纹，详见 RyanJsonKeyFingerprintOffset。
+	 *
 	 * Value 存储位置（与 key 是否存在相关）:
 	 * - Number/Array/Object 的 value 位于 payload 中固定偏移处。
-	 * - String 的 value 存在于 key/strValue 区域，不使用 value 偏移。
+	 * - String/Blob 的 value 存在于 key/strValue 区域，不使用 value 偏移。
 	 * - 如果节点带 key，则 value 放在 flag + RyanJsonInlineStringSize 之后；
 	 *   这样无论 inline/ptr 模式，value 偏移都稳定。
 	 * - 若节点无 key，则 value 紧跟 flag。
@@ -107,6 +117,8 @@ struct RyanJsonNode
 	 *   key + strValue: [ flag | keyLenField | (pad) | ptr | ... ]  ptr -> [ key\\0 | strValue\\0 ]
 	 *   key only (非 String): [ flag | keyLenField | (pad) | ptr | ... ]  ptr -> [ key\\0 ]
 	 *   strValue only (key 为空): [ flag | keyLenField | (pad) | ptr | ... ]  ptr -> [ strValue\\0 ]
+	 *   Blob（固定 ptr 模式）: [ flag | keyLenField | (pad) | ptr | ... ]  ptr -> [ key\\0 | len(4B LE) | data ]
+	 *   Raw 与 String 布局相同，strValue 为原始 Json 文本。
 	 *   padding 表示内联区未使用的剩余空间或对齐填充。
 	 *
 	 * Threaded List（线索化链表）:
@@ -152,13 +164,15 @@ typedef struct RyanJsonNode *RyanJson_t;
 
 typedef enum
 {
-	// 类型标志占用 3 bit（共 8 种，1 个保留）
+	// 类型标志占用 3 bit（共 8 种，0 表示无效）
 	RyanJsonTypeNull = 1,
 	RyanJsonTypeBool = 2,
 	RyanJsonTypeNumber = 3,
 	RyanJsonTypeString = 4,
 	RyanJsonTypeArray = 5,
 	RyanJsonTypeObject = 6,
+	RyanJsonTypeBlob = 7, // 二进制数据，序列化为 base64 字符串
+	RyanJsonTypeRaw = 8,  // 原始 Json 文本，原样输出；节点内按 Blob 存储并置位扩展位，仅由 RyanJsonGetType 返回
 } RyanJsonType_e;
 
 typedef RyanJsonType_e RyanjsonType_e;
@@ -190,8 +204,14 @@ typedef void *(*RyanJsonRealloc_t)(void *block, size_t size);
 	((*RyanJsonGetPayloadPtr(pJson)) =                                                                                                 \
 		 ((*RyanJsonGetPayloadPtr(pJson)) & ~((mask) << (shift))) | ((uint8_t)(((value) & (mask)) << (shift))))
 
-#define RyanJsonGetType(pJson)       ((RyanjsonType_e)RyanJsonGetPayloadFlagField((pJson), 0, RyanJsonGetMask(3)))
-#define RyanJsonSetType(pJson, type) (RyanJsonSetPayloadFlagField((pJson), 0, RyanJsonGetMask(3), (RyanjsonType_e)(type)))
+// 节点内存储的 3 位类型字段，Raw 存为 RyanJsonTypeBlob
+#define RyanJsonGetPayloadTypeByFlag(pJson) ((RyanjsonType_e)RyanJsonGetPayloadFlagField((pJson), 0, RyanJsonGetMask(3)))
+#define RyanJsonSetType(pJson, type)        (RyanJsonSetPayloadFlagField((pJson), 0, RyanJsonGetMask(3), (RyanjsonType_e)(type)))
+// 对外类型：Raw 节点返回 RyanJsonTypeRaw，switch 中不会与 Blob 混淆
+#define RyanJsonGetType(pJson)                                                                                                             \
+	((RyanJsonTypeBlob == RyanJsonGetPayloadTypeByFlag(pJson) && RyanJsonGetPayloadFlagField((pJson), 3, RyanJsonGetMask(1)))         \
+		 ? RyanJsonTypeRaw                                                                                                         \
+		 : RyanJsonGetPayloadTypeByFlag(pJson))
 
 // Bool 跟 Number 共用一个字段，因为 Bool 和 Number 类型不会同时存在
 #define RyanJsonGetPayloadBoolValueByFlag(pJson)             RyanJsonGetPayloadFlagField((pJson), 3, RyanJsonGetMask(1))
@@ -227,6 +247,31 @@ extern RyanJson_t RyanJsonParseOptions(const char *text, uint32_t size, RyanJson
 				       const char **parseEndPtr); // 需用户释放内存
 extern RyanJson_t RyanJsonParse(const char *text);                // 需用户释放内存
 
+/**
+ * @brief 解析标志（可按位组合）
+ */
+typedef enum
+{
+	RyanJsonParseFlagNone = 0,
+	// Number 只做语法扫描并保留源文本，首次判型或取值时原地转换为普通 Int/Double，转换前打印原样输出；
+	// 未访问过的数值（含超出 Double 精度的大整数）可逐字节往返。
+	RyanJsonParseFlagLazyNumber = 1 << 0,
+	// 含转义的 String 值只做语法校验并保留转义文本，首次 RyanJsonGetStringValue 时原地解码，解码前打印原样输出；
+	// key 与不含转义的 String 不受影响。启用 RyanJsonStringIntern 时缓冲可能共享，不能原地解码，该标志无效。
+	RyanJsonParseFlagLazyString = 1 << 1,
+} RyanJsonParseFlag_e;
+
+/**
+ * @brief 按标志解析 Json 文本，其余参数同 RyanJsonParseOptions
+ * @note 懒数值类型即 RyanJsonTypeNumber；RyanJsonGetIntValue/GetDoubleValue 与 Change*Value 首次调用时原地转换，
+ *       不申请内存，此后与普通解析结果无异，按普通 Number 打印。IsInt/IsDouble、比较、哈希与二进制编码只在局部解析，
+ *       节点保持不变；懒字符串的比较、哈希与 RyanJsonGetStringLength 同样不解码节点。
+ *       数值范围与普通解析一致，超出 Double 范围时解析失败。
+ * @note 启用 RyanJsonPackedArray 时懒数值数组不转为紧凑存储。
+ */
+extern RyanJson_t RyanJsonParseWithFlags(const char *text, uint32_t size, RyanJsonBool_e requireNullTerminator, uint32_t flags,
+					 const char **parseEndPtr); // 需用户释放内存
+
 extern void RyanJsonDelete(RyanJson_t pJson);
 extern void RyanJsonFree(void *block);
 
@@ -248,14 +293,57 @@ extern char *RyanJsonPrintPreallocatedWithStyle(RyanJson_t pJson, char *buffer,
 extern char *RyanJsonPrint(RyanJson_t pJson, uint32_t preset, RyanJsonBool_e format, uint32_t *len);
 extern char *RyanJsonPrintPreallocated(RyanJson_t pJson, char *buffer, uint32_t length, RyanJsonBool_e format, uint32_t *len);
 
+/**
+ * @brief 分散输出片段，字段顺序与 POSIX struct iovec 一致
+ */
+typedef struct
+{
+	const void *base; // 片段起始地址
+	size_t len;       // 片段长度（字节）
+} RyanJsonIoVec_t;
+
+/**
+ * @brief 以 iovec 列表形式打印（零拷贝引用长字符串）
+ * @note 标点、数字、需转义的字符串等写入 scratch，长度不小于 RyanJsonPrintIoVecRefMinSize
+ *       且无需转义的 ptr 模式 strValue 直接引用节点存储，不拷贝。
+ * @note 输出不含 '\0'；iov 中的地址在 scratch 与 Json 树均未修改/释放前有效。
+ * @note scratch 或 iov 容量不足时返回失败。
+ */
+extern RyanJsonBool_e RyanJsonPrintIoVec(RyanJson_t pJson, char *scratch, uint32_t scratchSize, RyanJsonBool_e format,
+					 RyanJsonIoVec_t *iov, uint32_t iovCap, uint32_t *iovCount);
+
+#if true == RyanJsonDeltaTracking
+/**
+ * @brief 增量打印（需启用 RyanJsonDeltaTracking）
+ * @note 输出自上次 RyanJsonCheckpoint 以来的 JSON Merge Patch（紧凑格式），无变化时输出 "{}"。
+ * @note Merge Patch 中 null 表示删除 key，无法表示“成员值为 null”：以 Add/Insert/Replace 写入的成员值为 null，
+ *       或写入的 Object 内（不经数组）含 null 成员时返回 NULL，调用方需改用完整打印；数组内的 null 不受影响。
+ * @note pJson 不是 Object 时 Merge Patch 只能整体替换，始终输出完整内容。
+ */
+extern char *RyanJsonPrintDelta(RyanJson_t pJson, uint32_t preset, uint32_t *len); // 需用户释放内存
+extern void RyanJsonCheckpoint(RyanJson_t pJson);
+#endif
+
 /**
  * @brief Json 杂项函数
  */
 extern RyanJson_t RyanJsonDuplicate(RyanJson_t pJson); // 需用户释放内存
+#if true == RyanJsonSnapshotShare
+/**
+ * @brief 共享只读快照（需启用 RyanJsonSnapshotShare）
+ * @note 快照是带引用计数的缓存副本，不是写时复制：容器自上次快照以来未被修改时直接返回同一份副本并增加引用计数，
+ *       否则完整复制一份（与 RyanJsonDuplicate 代价相同）。
+ * @note 快照只读，需用 RyanJsonSnapshotRelease 释放；修改快照内节点、RyanJsonDelete 快照或把快照挂到其他容器
+ *       都会在运行时失败。
+ */
+extern RyanJson_t RyanJsonSnapshot(RyanJson_t pJson); // 需用户调用 RyanJsonSnapshotRelease 释放
+extern void RyanJsonSnapshotRelease(RyanJson_t snapshot);
+#endif
 extern uint32_t RyanJsonMinify(char *text, int32_t textLen);
 extern RyanJsonBool_e RyanJsonCompare(RyanJson_t leftJson, RyanJson_t rightJson);
 extern RyanJsonBool_e RyanJsonCompareOnlyKey(RyanJson_t leftJson, RyanJson_t rightJson);
 extern RyanJsonBool_e RyanJsonCompareDouble(double a, double b);
+extern uint32_t RyanJsonHash(RyanJson_t pJson); // 子树内容哈希，与 Object 成员顺序无关，不含根节点 key
 extern uint32_t RyanJsonGetSize(RyanJson_t pJson);
 #define RyanJsonGetArraySize(pJson) RyanJsonGetSize(pJson)
 
@@ -269,6 +357,19 @@ extern RyanJson_t RyanJsonCreateInt(const char *key, int32_t number);          /
 extern RyanJson_t RyanJsonCreateDouble(const char *key, double number);        // 如果没有添加到父 Json，则需释放内存
 extern RyanJson_t RyanJsonCreateString(const char *key, const char *string);   // 如果没有添加到父 Json，则需释放内存
 extern RyanJson_t RyanJsonCreateArray(void);                                   // 如果没有添加到父 Json，则需释放内存
+
+/**
+ * @brief Blob 节点：按原始字节保存二进制数据，打印为标准 base64 字符串；len 为 0 时 data 可为 NULL
+ */
+extern RyanJson_t RyanJsonCreateBlob(const char *key, const void *data, uint32_t len); // 如果没有添加到父 Json，则需释放内存
+
+/**
+ * @brief Raw 节点：保存已序列化的 Json 文本，打印时原样输出，适合转发不关心内部结构的载荷
+ * @note 创建时校验 text 恰为一个合法 Json 值（只校验不建树），首尾空白不保存；
+ *       比较按文本逐字节进行，CBOR/MessagePack 编码与二进制镜像不支持 Raw（返回失败）。
+ */
+extern RyanJson_t RyanJsonCreateRaw(const char *key, const char *text, uint32_t len); // 如果没有添加到父 Json，则需释放内存
+
 /**
  * @brief 语法糖
  */
@@ -276,6 +377,90 @@ extern RyanJson_t RyanJsonCreateIntArray(const int32_t *numbers, uint32_t count)
 extern RyanJson_t RyanJsonCreateDoubleArray(const double *numbers, uint32_t count);
 extern RyanJson_t RyanJsonCreateStringArray(const char **strings, uint32_t count);
 
+#if true == RyanJsonPackedArray
+/**
+ * @brief 紧凑数值数组（需启用 RyanJsonPackedArray）
+ * @note 元素连续存储，不再是独立节点；Print/Compare/Duplicate/GetSize 与等价的普通 Array 结果一致。
+ * @note ForEach、按索引访问、Insert 等需要子节点的接口会先自动展开为普通 Array；
+ *       展开需要为每个元素申请节点，内存不足时展开失败，此时 ForEach 视为无子节点、修改接口返回失败。
+ */
+typedef enum
+{
+	RyanJsonPackedTypeInt = 0,    // int32_t，展开为 Int 节点
+	RyanJsonPackedTypeFloat = 1,  // float，按 Double 打印/比较，展开为 Double 节点
+	RyanJsonPackedTypeDouble = 2, // double，展开为 Double 节点
+} RyanJsonPackedType_e;
+extern RyanJson_t RyanJsonCreatePackedIntArray(const int32_t *numbers, uint32_t count);
+extern RyanJson_t RyanJsonCreatePackedFloatArray(const float *numbers, uint32_t count);
+extern RyanJson_t RyanJsonCreatePackedDoubleArray(const double *numbers, uint32_t count);
+extern RyanJsonBool_e RyanJsonIsPackedArray(RyanJson_t pJson); // 一维紧凑数组与列存表均返回 true
+extern const void *RyanJsonGetPackedArrayData(RyanJson_t pJson, RyanJsonPackedType_e *elemType, uint32_t *count); // 非一维紧凑返回 NULL
+extern RyanJsonBool_e RyanJsonExpandPackedArray(RyanJson_t pJson);
+
+/**
+ * @brief 列存表：元素为同形 Object 的紧凑 Array，key 整表只存一份，每列是一段连续数值
+ * @note 对外表现与 [{"k0":..,"k1":..}, ...] 完全一致，需要子节点时同样自动展开。
+ */
+extern RyanJson_t RyanJsonCreatePackedTable(const char *const *keys, const RyanJsonPackedType_e *types, const void *const *columns,
+					    uint32_t colCount, uint32_t rowCount);
+extern RyanJsonBool_e RyanJsonIsPackedTable(RyanJson_t pJson);
+extern const void *RyanJsonGetPackedTableColumn(RyanJson_t pJson, const char *key, RyanJsonPackedType_e *elemType, uint32_t *count);
+#endif
+
+/**
+ * @brief 扁平只读文档（tape）：整个文档是一块连续内存，按先序存放定长条目与字符串池，解析只需少量几次内存申请
+ * @note 同层前进与按 key/索引查找可整段跳过子树，适合只读、查找密集的场景；需要修改时用 RyanJsonTapeToTree 转为普通树。
+ * @note RyanJsonTapeVal_t 指向文档内部，文档释放后失效；取值接口调用前应先判空并判断类型。
+ */
+typedef struct RyanJsonTape *RyanJsonTape_t;
+typedef const struct RyanJsonTapeEntry *RyanJsonTapeVal_t;
+extern RyanJsonTape_t RyanJsonParseTape(const char *text); // 需用户调用 RyanJsonTapeDelete 释放
+extern RyanJsonTape_t RyanJsonParseTapeOptions(const char *text, uint32_t size, RyanJsonBool_e requireNullTerminator,
+					       const char **parseEndPtr); // 需用户调用 RyanJsonTapeDelete 释放
+extern void RyanJsonTapeDelete(RyanJsonTape_t tape);
+extern RyanJsonTapeVal_t RyanJsonTapeGetRoot(RyanJsonTape_t tape);
+extern RyanjsonType_e RyanJsonTapeGetType(RyanJsonTapeVal_t val);
+extern RyanJsonBool_e RyanJsonTapeIsInt(RyanJsonTapeVal_t val);
+extern RyanJsonBool_e RyanJsonTapeIsDouble(RyanJsonTapeVal_t val);
+extern const char *RyanJsonTapeGetKey(RyanJsonTapeVal_t val); // 无 key 返回 NULL
+extern uint32_t RyanJsonTapeGetKeyLength(RyanJsonTapeVal_t val);
+extern const char *RyanJsonTapeGetStringValue(RyanJsonTapeVal_t val);
+extern uint32_t RyanJsonTapeGetStringLength(RyanJsonTapeVal_t val);
+extern int32_t RyanJsonTapeGetIntValue(RyanJsonTapeVal_t val);
+extern double RyanJsonTapeGetDoubleValue(RyanJsonTapeVal_t val);
+extern RyanJsonBool_e RyanJsonTapeGetBoolValue(RyanJsonTapeVal_t val);
+extern uint32_t RyanJsonTapeGetSize(RyanJsonTapeVal_t val); // 容器返回直接子节点数（O(1)），标量返回 1
+extern RyanJsonTapeVal_t RyanJsonTapeGetObjectValue(RyanJsonTapeVal_t val); // 首个子节点
+extern RyanJsonTapeVal_t RyanJsonTapeGetNext(RyanJsonTapeVal_t val);
+extern RyanJsonTapeVal_t RyanJsonTapeGetObjectByKey(RyanJsonTapeVal_t val, const char *key);
+extern RyanJsonTapeVal_t RyanJsonTapeGetObjectByIndex(RyanJsonTapeVal_t val, uint32_t index);
+extern RyanJson_t RyanJsonTapeToTree(RyanJsonTapeVal_t val); // 需用户释放内存
+#define RyanJsonTapeForEach(val, item) for ((item) = RyanJsonTapeGetObjectValue(val); NULL != (item); (item) = RyanJsonTapeGetNext(item))
+
+/**
+ * @brief 二进制镜像：把树保存为 [头部 | tape 文档]，内部只有相对偏移，带校验和与格式/配置版本
+ * @note 镜像可直接存入文件或 flash，RyanJsonLoadBinary 校验后原地返回只读 tape，不申请内存、不解析文本；
+ *       data 需按 4 字节对齐，返回的文档与 data 同生命周期，不能 RyanJsonTapeDelete；含 Raw 节点的树保存失败。
+ */
+extern uint8_t *RyanJsonSaveBinary(RyanJson_t pJson, uint32_t *len); // 需用户调用 RyanJsonFree 释放
+extern RyanJsonTape_t RyanJsonLoadBinary(const void *data, uint32_t size);
+
+/**
+ * @brief 二进制交换格式：树与 CBOR（RFC 8949）/ MessagePack 直接互转，不经过文本
+ * @note 编码：Int 按最短整数编码；Double 能无损放入 float32 时编码为 float32，否则为 float64；Blob 编码为字节串，Raw 无法编码；
+ *       Array/Object 为定长容器，key 一律为文本字符串；紧凑数组直接从数据块编码，不展开。
+ * @note 解码：超出 int32 的整数转为 Double（与文本解析一致）；定长字节串（CBOR 主类型 2、MessagePack bin）解码为 Blob；
+ *       扩展类型、非字符串 key、含 '\0' 的字符串与 CBOR undefined 视为失败；CBOR 的 tag 被忽略，接受不定长 Array/Map 与半精度浮点。
+ */
+typedef enum
+{
+	RyanJsonCodecCbor = 0,    // CBOR（RFC 8949）
+	RyanJsonCodecMsgPack = 1, // MessagePack
+} RyanJsonCodec_e;
+extern uint8_t *RyanJsonPrintCodec(RyanJson_t pJson, RyanJsonCodec_e codec, uint32_t preset, uint32_t *len); // 需用户释放内存
+extern uint8_t *RyanJsonPrintCodecPreallocated(RyanJson_t pJson, RyanJsonCodec_e codec, uint8_t *buffer, uint32_t length, uint32_t *len);
+extern RyanJson_t RyanJsonParseCodec(const void *data, uint32_t size, RyanJsonCodec_e codec, uint32_t *usedLen); // 需用户释放内存
+
 /**
  * @brief 分离相关函数
  */
@@ -292,6 +477,7 @@ extern RyanJsonBool_e RyanJsonDeleteByKey(RyanJson_t pJson, const char *key);
  * @brief 查询函数
  */
 extern RyanJson_t RyanJsonGetObjectByKey(RyanJson_t pJson, const char *key);
+extern RyanJson_t RyanJsonGetObjectByKeyLen(RyanJson_t pJson, const char *key, uint32_t keyLen); // key 无需 '\0' 结尾
 extern RyanJson_t RyanJsonGetObjectByIndex(RyanJson_t pJson, uint32_t index);
 
 /**
@@ -302,8 +488,9 @@ extern RyanJson_t RyanJsonGetObjectByIndex(RyanJson_t pJson, uint32_t index);
 /**
  * @brief 查询函数
  */
-#define RyanJsonHasObjectByKey(pJson, key)     RyanJsonMakeBool(RyanJsonGetObjectByKey(pJson, key))
-#define RyanJsonHasObjectByIndex(pJson, index) RyanJsonMakeBool(RyanJsonGetObjectByIndex(pJson, index))
+#define RyanJsonHasObjectByKey(pJson, key)            RyanJsonMakeBool(RyanJsonGetObjectByKey(pJson, key))
+#define RyanJsonHasObjectByKeyLen(pJson, key, keyLen) RyanJsonMakeBool(RyanJsonGetObjectByKeyLen(pJson, key, keyLen))
+#define RyanJsonHasObjectByIndex(pJson, index)        RyanJsonMakeBool(RyanJsonGetObjectByIndex(pJson, index))
 
 /**
  * @brief RyanJson 类型判断接口
@@ -317,6 +504,8 @@ extern RyanJsonBool_e RyanJsonIsArray(RyanJson_t pJson);
 extern RyanJsonBool_e RyanJsonIsObject(RyanJson_t pJson);
 extern RyanJsonBool_e RyanJsonIsInt(RyanJson_t pJson);
 extern RyanJsonBool_e RyanJsonIsDouble(RyanJson_t pJson);
+extern RyanJsonBool_e RyanJsonIsBlob(RyanJson_t pJson);
+extern RyanJsonBool_e RyanJsonIsRaw(RyanJson_t pJson);
 extern RyanJsonBool_e RyanJsonIsDetachedItem(RyanJson_t item);
 
 /**
@@ -324,12 +513,16 @@ extern RyanJsonBool_e RyanJsonIsDetachedItem(RyanJson_t item);
  * @note 调用前应先判空并使用 `RyanJsonIsXXX` 做类型判断。
  */
 extern char *RyanJsonGetKey(RyanJson_t pJson);
-extern char *RyanJsonGetStringValue(RyanJson_t pJson);
+extern char *RyanJsonGetStringValue(RyanJson_t pJson); // 懒字符串首次读取时原地解码，返回地址不变
+extern uint32_t RyanJsonGetKeyLength(RyanJson_t pJson);    // 无 key 返回 0
+extern uint32_t RyanJsonGetStringLength(RyanJson_t pJson); // 非 String 返回 0
 extern int32_t RyanJsonGetIntValue(RyanJson_t pJson);
 extern double RyanJsonGetDoubleValue(RyanJson_t pJson);
 extern RyanJson_t RyanJsonGetObjectValue(RyanJson_t pJson);
 extern RyanJson_t RyanJsonGetArrayValue(RyanJson_t pJson);
 extern RyanJsonBool_e RyanJsonGetBoolValue(RyanJson_t pJson);
+extern const uint8_t *RyanJsonGetBlobValue(RyanJson_t pJson, uint32_t *len); // 非 Blob 返回 NULL 且 len 为 0
+extern const char *RyanJsonGetRawValue(RyanJson_t pJson, uint32_t *len);     // 非 Raw 返回 NULL，len 可为 NULL
 
 /**
  * @brief 变参路径查询底层接口。
@@ -342,6 +535,52 @@ extern RyanJson_t RyanJsonGetObjectByKeys(RyanJson_t pJson, const char *key, ...
 #define RyanJsonHasObjectToKey(pJson, key, ...)     RyanJsonMakeBool(RyanJsonGetObjectToKey(pJson, key, ##__VA_ARGS__))
 #define RyanJsonHasObjectToIndex(pJson, index, ...) RyanJsonMakeBool(RyanJsonGetObjectToIndex(pJson, index, ##__VA_ARGS__))
 
+/**
+ * @brief 预编译 JSON Pointer（RFC 6901）：路径编译一次，之后可对任意多个文档反复求值
+ * @note 编译时完成分段、~0/~1 反转义、key 哈希与数组下标解析，句柄为一次申请的连续内存；求值不申请内存。
+ * @note Object 一律按 key 匹配（含 "0" 这类数字 key）；Array 只接受 "0" 或无前导零的十进制下标，"-" 视为不存在。
+ */
+typedef struct RyanJsonPath *RyanJsonPath_t;
+extern RyanJsonPath_t RyanJsonPathCompile(const char *pointer); // 需用户调用 RyanJsonPathDelete 释放，语法错误返回 NULL
+extern void RyanJsonPathDelete(RyanJsonPath_t path);
+extern uint32_t RyanJsonPathGetCount(RyanJsonPath_t path);
+extern RyanJson_t RyanJsonPathGet(RyanJson_t pJson, RyanJsonPath_t path);
+#define RyanJsonHasPath(pJson, path) RyanJsonMakeBool(RyanJsonPathGet(pJson, path))
+
+/**
+ * @brief JSONPath 查询子集：编译为段程序，按文档顺序逐个产出命中节点，不申请结果数组
+ * @note 支持 `$`、`.name`、`['name']`、`.*`/`[*]`、`..` 递归下降、`[n]`（负数从尾部计）、`[start:end:step]`（step 不能为负）
+ *       与 `[?@.a.b op 字面量]` / `[?(@.a)]` 过滤；op 为 == != < <= > >=，字面量为数值、带引号的字符串、true、false、null。
+ * @note 求值为迭代实现：每段在迭代器中保存一个游标，`..` 沿线索链表遍历子树，不递归、不申请内存（紧凑数组按需展开除外）；
+ *       段数上限为 RyanJsonQueryMaxSteps。迭代期间不能增删文档节点。
+ */
+typedef struct RyanJsonQuery *RyanJsonQuery_t;
+typedef RyanJsonBool_e (*RyanJsonQueryCallback_t)(RyanJson_t item, void *userData); // 返回 false 停止遍历
+typedef struct
+{
+	RyanJson_t input; // 本段输入节点
+	RyanJson_t walk;  // 选择器作用的节点，递归下降时为 input 的某个后代
+	RyanJson_t child; // 选择器游标
+	uint32_t pos;     // 切片当前下标
+	uint32_t limit;   // 切片上界（不含）
+	uint32_t phase;   // 选择器状态
+} RyanJsonQueryFrame_t;
+typedef struct
+{
+	RyanJsonQuery_t query;
+	uint32_t depth; // 活动游标数
+	RyanJsonQueryFrame_t frames[RyanJsonQueryMaxSteps];
+} RyanJsonQueryIter_t; // 内部状态，只通过下方接口访问
+extern RyanJsonQuery_t RyanJsonQueryCompile(const char *expr); // 需用户调用 RyanJsonQueryDelete 释放，语法错误返回 NULL
+extern void RyanJsonQueryDelete(RyanJsonQuery_t query);
+extern RyanJsonBool_e RyanJsonQueryIterInit(RyanJsonQueryIter_t *iter, RyanJson_t pJson, RyanJsonQuery_t query);
+extern RyanJson_t RyanJsonQueryIterNext(RyanJsonQueryIter_t *iter);
+extern uint32_t RyanJsonQueryEach(RyanJson_t pJson, RyanJsonQuery_t query, RyanJsonQueryCallback_t callback, void *userData); // 返回命中数
+extern RyanJson_t RyanJsonQueryFirst(RyanJson_t pJson, RyanJsonQuery_t query);
+#define RyanJsonQueryForEach(iter, pJson, query, item)                                                                                     \
+	for ((item) = RyanJsonQueryIterInit(&(iter), pJson, query) ? RyanJsonQueryIterNext(&(iter)) : NULL; NULL != (item);                \
+	     (item) = RyanJsonQueryIterNext(&(iter)))
+
 /**
  * @brief Add 系列接口与便捷宏。
  * @note 建议调用前先用 `RyanJsonIsObject/RyanJsonIsArray` 做类型校验。
@@ -350,19 +589,36 @@ extern RyanJson_t RyanJsonGetObjectByKeys(RyanJson_t pJson, const char *key, ...
  * @note 严格模式下 Object key 必须唯一；非严格模式允许重复 key，但按 key 的 API 通常只命中首个节点。
  * @note `AddItem` 仅接受 Array/Object 节点；标量请使用 `AddInt/AddString` 等接口。
  */
-#define RyanJsonAddNullToObject(pJson, key)           RyanJsonInsert(pJson, RyanJsonAddPosition, RyanJsonCreateNull(key))
-#define RyanJsonAddBoolToObject(pJson, key, boolean)  RyanJsonInsert(pJson, RyanJsonAddPosition, RyanJsonCreateBool(key, boolean))
-#define RyanJsonAddIntToObject(pJson, key, number)    RyanJsonInsert(pJson, RyanJsonAddPosition, RyanJsonCreateInt(key, number))
-#define RyanJsonAddDoubleToObject(pJson, key, number) RyanJsonInsert(pJson, RyanJsonAddPosition, RyanJsonCreateDouble(key, number))
-#define RyanJsonAddStringToObject(pJson, key, string) RyanJsonInsert(pJson, RyanJsonAddPosition, RyanJsonCreateString(key, string))
+#define RyanJsonAddNullToObject(pJson, key)            RyanJsonInsert(pJson, RyanJsonAddPosition, RyanJsonCreateNull(key))
+#define RyanJsonAddBoolToObject(pJson, key, boolean)   RyanJsonInsert(pJson, RyanJsonAddPosition, RyanJsonCreateBool(key, boolean))
+#define RyanJsonAddIntToObject(pJson, key, number)     RyanJsonInsert(pJson, RyanJsonAddPosition, RyanJsonCreateInt(key, number))
+#define RyanJsonAddDoubleToObject(pJson, key, number)  RyanJsonInsert(pJson, RyanJsonAddPosition, RyanJsonCreateDouble(key, number))
+#define RyanJsonAddStringToObject(pJson, key, string)  RyanJsonInsert(pJson, RyanJsonAddPosition, RyanJsonCreateString(key, string))
+#define RyanJsonAddBlobToObject(pJson, key, data, len) RyanJsonInsert(pJson, RyanJsonAddPosition, RyanJsonCreateBlob(key, data, len))
+#define RyanJsonAddRawToObject(pJson, key, text, len)  RyanJsonInsert(pJson, RyanJsonAddPosition, RyanJsonCreateRaw(key, text, len))
 extern RyanJsonBool_e RyanJsonAddItemToObject(RyanJson_t pJson, const char *key, RyanJson_t item);
 
-#define RyanJsonAddNullToArray(pJson)           RyanJsonAddNullToObject(pJson, NULL)
-#define RyanJsonAddBoolToArray(pJson, boolean)  RyanJsonAddBoolToObject(pJson, NULL, boolean)
-#define RyanJsonAddIntToArray(pJson, number)    RyanJsonAddIntToObject(pJson, NULL, number)
-#define RyanJsonAddDoubleToArray(pJson, number) RyanJsonAddDoubleToObject(pJson, NULL, number)
-#define RyanJsonAddStringToArray(pJson, string) RyanJsonAddStringToObject(pJson, NULL, string)
-#define RyanJsonAddItemToArray(pJson, item)     RyanJsonAddItemToObject(pJson, NULL, item)
+#define RyanJsonAddNullToArray(pJson)            RyanJsonAddNullToObject(pJson, NULL)
+#define RyanJsonAddBoolToArray(pJson, boolean)   RyanJsonAddBoolToObject(pJson, NULL, boolean)
+#define RyanJsonAddIntToArray(pJson, number)     RyanJsonAddIntToObject(pJson, NULL, number)
+#define RyanJsonAddDoubleToArray(pJson, number)  RyanJsonAddDoubleToObject(pJson, NULL, number)
+#define RyanJsonAddStringToArray(pJson, string)  RyanJsonAddStringToObject(pJson, NULL, string)
+#define RyanJsonAddBlobToArray(pJson, data, len) RyanJsonAddBlobToObject(pJson, NULL, data, len)
+#define RyanJsonAddRawToArray(pJson, text, len)  RyanJsonAddRawToObject(pJson, NULL, text, len)
+#define RyanJsonAddItemToArray(pJson, item)      RyanJsonAddItemToObject(pJson, NULL, item)
+
+/**
+ * @brief 尾部追加器：记录容器当前尾节点，批量构建时每次追加为 O(1)。
+ * @note 追加顺序即输出顺序，不受 RyanJsonDefaultAddAtHead 影响。
+ * @note item 所有权规则与 RyanJsonInsert 一致。
+ */
+typedef struct
+{
+	RyanJson_t container; // 目标容器（Array 或 Object）
+	RyanJson_t last;      // 当前尾节点，NULL 表示容器为空
+} RyanJsonAppender_t;
+extern RyanJsonBool_e RyanJsonAppenderInit(RyanJsonAppender_t *appender, RyanJson_t pJson);
+extern RyanJsonBool_e RyanJsonAppenderAdd(RyanJsonAppender_t *appender, RyanJson_t item);
 
 #define RyanJsonArrayForEach(pJson, item)                                                                                                  \
 	for ((item) = RyanJsonIsArray(pJson) ? RyanJsonGetArrayValue(pJson) : NULL; NULL != (item); (item) = RyanJsonGetNext(item))
@@ -379,6 +635,16 @@ extern RyanJsonBool_e RyanJsonChangeStringValue(RyanJson_t pJson, const char *st
 extern RyanJsonBool_e RyanJsonChangeIntValue(RyanJson_t pJson, int32_t number);
 extern RyanJsonBool_e RyanJsonChangeDoubleValue(RyanJson_t pJson, double number);
 extern RyanJsonBool_e RyanJsonChangeBoolValue(RyanJson_t pJson, RyanJsonBool_e boolean);
+extern RyanJsonBool_e RyanJsonChangeBlobValue(RyanJson_t pJson, const void *data, uint32_t len);
+
+/**
+ * @brief base64 String 节点原地转换为 Blob 节点（数据按原始字节保存，比 base64 文本少约 1/4 内存）
+ * @note 节点地址、key 与在父容器中的位置不变，打印结果与原字符串一致；失败时节点保持不变。
+ * @note 只接受标准字母表、带 '=' 填充、无空白的规范编码。
+ * @note 示例：`RyanJsonDecodeBase64ToKey(root, "ota", "chunk");`
+ */
+extern RyanJsonBool_e RyanJsonDecodeBase64(RyanJson_t pJson);
+#define RyanJsonDecodeBase64ToKey(pJson, key, ...) RyanJsonDecodeBase64(RyanJsonGetObjectToKey(pJson, key, ##__VA_ARGS__))
 
 /**
  * @brief 节点替换接口（用于修改 value 类型）
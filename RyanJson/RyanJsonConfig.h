@@ -20,8 +20,10 @@ extern "C" {
 #include "rtthread.h"
 #define RyanJsonMemset             rt_memset
 #define RyanJsonMemcpy             rt_memcpy
+#define RyanJsonMemmove            rt_memmove
 #define RyanJsonStrlen             rt_strlen
 #define RyanJsonStrcmp             rt_strcmp
+#define RyanJsonMemcmp             rt_memcmp
 #define RyanJsonSnprintf           rt_snprintf
 #define RyanJsonPlatformAssert(EX) RT_ASSERT(EX)
 #define RyanJsonMallocHeaderSize   12U
@@ -30,8 +32,10 @@ extern "C" {
 #include <assert.h>
 #define RyanJsonMemset             memset
 #define RyanJsonMemcpy             memcpy
+#define RyanJsonMemmove            memmove
 #define RyanJsonStrlen             strlen
 #define RyanJsonStrcmp             strcmp
+#define RyanJsonMemcmp             memcmp
 #define RyanJsonSnprintf           snprintf
 #define RyanJsonPlatformAssert(EX) assert(EX)
 #define RyanJsonMallocHeaderSize   8U
@@ -99,6 +103,218 @@ extern "C" {
 #define RyanJsonDefaultAddAtHead false
 #endif
 
+/**
+ * @brief RyanJsonPrintCache: 为容器节点缓存紧凑打印片段。
+ * @note true 时 RyanJsonPrint（format=false）会为片段长度在 [RyanJsonPrintCacheMinSize, RyanJsonPrintCacheMaxSize]
+ *       内的容器保存序列化片段，后续打印遇到未修改的容器直接整段拷贝；
+ *       Change/Insert/Replace/Detach 系列接口会沿父链使缓存失效。
+ * @note 容器生成缓存时会丢弃直接子容器的缓存，缓存之间互不嵌套，总量不超过一份紧凑文本；
+ *       修改后重新生成的代价不超过 RyanJsonPrintCacheMaxSize 加上其上层的容器骨架。
+ * @note 代价：每个 Array/Object 节点多一个指针槽，适合读多写少、反复整体打印的大文档。
+ * @note 仅通过公共 API 修改的树才能保证缓存一致，直接改写节点内存不会触发失效。
+ * @note 默认值为 false（节点布局与打印行为与历史版本一致）。
+ */
+#ifndef RyanJsonPrintCache
+#define RyanJsonPrintCache false
+#endif
+
+/**
+ * @brief RyanJsonPrintCacheMinSize: 容器片段达到该长度（字节）才会被缓存。
+ * @note 过小的片段重新生成的代价低于一次 malloc，缓存收益有限。
+ * @note 默认值为 64。
+ */
+#ifndef RyanJsonPrintCacheMinSize
+#define RyanJsonPrintCacheMinSize (64U)
+#endif
+
+/**
+ * @brief RyanJsonPrintCacheMaxSize: 容器片段超过该长度（字节）不缓存，改为缓存其内部的子容器。
+ * @note 决定修改后单个失效片段的最大重建代价。
+ * @note 默认值为 1024。
+ */
+#ifndef RyanJsonPrintCacheMaxSize
+#define RyanJsonPrintCacheMaxSize (1024U)
+#endif
+
+/**
+ * @brief RyanJsonDeltaTracking: 记录自上次检查点以来的修改，支持增量打印。
+ * @note true 时 Change/Insert/Replace/Detach 系列接口会在所属 Object 上记录变化成员与被删除的 key，
+ *       RyanJsonPrintDelta 只输出这些路径（JSON Merge Patch，RFC 7396），RyanJsonCheckpoint 清除记录。
+ * @note 代价：每个 Array/Object 节点多一个指针槽；记录只保存在变化成员所属的 Object 上，占用与变化成员数成正比，
+ *       祖先 Object 只置 flag 位标记路径，不随深度申请内存；增量打印与检查点需逐个检查路径上 Object 的直接成员；
+ *       修改接口需沿父链回溯，且在记录所需内存申请失败时返回失败（不做修改）。
+ * @note 移除 Object 成员时会保存其检查点时的 key 骨架（与子树 key 数成正比），
+ *       以便该 key 再次以 Object 写入时为新值中不存在的旧 key 输出 null。
+ * @note Merge Patch 无法寻址数组元素，数组内部的任何变化都按“整个最外层数组”输出。
+ * @note Merge Patch 以 null 表示删除 key，无法表示“成员值为 null”：写入的成员值为 null，或写入的 Object 内
+ *       （不经数组）含 null 成员时 RyanJsonPrintDelta 返回 NULL，需改用完整打印。
+ * @note 默认值为 false。
+ */
+#ifndef RyanJsonDeltaTracking
+#define RyanJsonDeltaTracking false
+#endif
+
+/**
+ * @brief RyanJsonObjectHashIndex: 为大 Object 按需建立 key 哈希索引。
+ * @note true 时按 key 查找在同一 Object 中连续扫描超过 RyanJsonObjectHashIndexMinSize 个成员后，
+ *       为该 Object 建立开放寻址哈希表，之后 GetObjectByKey 等接口按哈希定位；
+ *       Insert/Replace/Detach/ChangeKey 增量维护索引，出现重复 key 时丢弃索引退回线性扫描。
+ * @note 代价：每个 Array/Object 节点多一个指针槽；索引占用约 16 字节 * 成员数（32 位平台约 8 字节）。
+ *       成员数低于阈值的 Object 不会建立索引，索引申请失败只退回线性扫描，不影响接口结果。
+ * @note ReplaceByKey/DetachByKey 仍需按指针回溯前驱节点，但不再逐个比较 key。
+ * @note 默认值为 false。
+ */
+#ifndef RyanJsonObjectHashIndex
+#define RyanJsonObjectHashIndex false
+#endif
+
+/**
+ * @brief RyanJsonObjectHashIndexMinSize: 单次按 key 扫描的成员数达到该值时为 Object 建立索引。
+ * @note 默认值为 32。
+ */
+#ifndef RyanJsonObjectHashIndexMinSize
+#define RyanJsonObjectHashIndexMinSize (32U)
+#endif
+
+/**
+ * @brief RyanJsonArrayIndex: 为大 Array 按需建立子节点指针表，加速按索引访问。
+ * @note true 时按索引访问 Array 连续遍历超过 RyanJsonArrayIndexMinSize 个元素后，为该 Array 建立子节点指针表，
+ *       之后 GetObjectByIndex/ReplaceByIndex/DetachByIndex/Insert 按下标直接定位（O(1)），
+ *       插入/分离只需搬移指针表（memmove），不再逐个遍历兄弟节点。
+ * @note 线索化链表保持不变，RyanJsonGetNext/RyanJsonArrayForEach 等遍历方式不受影响。
+ * @note 代价：每个 Array/Object 节点多一个指针槽；指针表占用约 sizeof(void *) * 元素数。
+ *       指针表申请失败只退回链表遍历，不影响接口结果。
+ * @note 默认值为 false。
+ */
+#ifndef RyanJsonArrayIndex
+#define RyanJsonArrayIndex false
+#endif
+
+/**
+ * @brief RyanJsonArrayIndexMinSize: 单次按索引遍历的元素数达到该值时为 Array 建立指针表。
+ * @note 默认值为 32。
+ */
+#ifndef RyanJsonArrayIndexMinSize
+#define RyanJsonArrayIndexMinSize (32U)
+#endif
+
+/**
+ * @brief RyanJsonPackedArray: 支持紧凑数值数组（int32_t/float/double 连续存储）。
+ * @note true 时可通过 RyanJsonCreatePackedIntArray 等接口创建紧凑 Array，解析器也会把足够长的同类数值 Array
+ *       转为紧凑存储；每个元素只占 4/8 字节，不再是独立节点。
+ * @note Print/Compare/Duplicate/GetSize 直接处理紧凑数据，输出与比较结果和普通 Array 一致；
+ *       其余需要子节点的接口（ForEach、GetObjectByIndex、Insert 等）会先将其展开为普通节点链表。
+ * @note 复用 Array 节点 flag 的 bit3（Bool/Number 扩展位），不增加节点大小。
+ * @note 默认值为 false。
+ */
+#ifndef RyanJsonPackedArray
+#define RyanJsonPackedArray false
+#endif
+
+/**
+ * @brief RyanJsonPackedArrayParseMinSize: 解析时元素全为 Int（或全为 Double）且数量达到该值的 Array 转为紧凑存储。
+ * @note 为 0 时解析器不做转换，只有显式创建的 Array 使用紧凑存储。
+ * @note 默认值为 16。
+ */
+#ifndef RyanJsonPackedArrayParseMinSize
+#define RyanJsonPackedArrayParseMinSize (16U)
+#endif
+
+/**
+ * @brief RyanJsonPackedTableParseMaxColumns: 解析时转为列存表的 Object 最大成员数。
+ * @note 元素全为同形 Object（成员全为 Number、key 顺序一致且不重复）且行数达到 RyanJsonPackedArrayParseMinSize 的 Array
+ *       会转为列存表，key 整表只存一份；为 0 时解析器不做列存转换。
+ * @note 默认值为 16，最大 255。
+ */
+#ifndef RyanJsonPackedTableParseMaxColumns
+#define RyanJsonPackedTableParseMaxColumns (16U)
+#endif
+
+/**
+ * @brief RyanJsonStringIntern: ptr 模式的字符串缓冲按内容去重（字符串驻留）。
+ * @note true 时 ptr 模式节点的 key/strValue 缓冲（内容为 "key\0strValue\0"）登记到全局驻留表，
+ *       内容完全相同的节点共享同一块带引用计数的缓冲，删除节点只减少引用计数；
+ *       Duplicate 与解析重复结构的文档（如对象数组中重复出现的长 key、枚举式长字符串）时不再重复申请内存，
+ *       相同内容的 key/strValue 地址相同，比较时直接命中 RyanJsonInternalStrEq 的地址相等分支。
+ * @note 内联模式的短字符串本就不申请堆内存，不参与驻留。
+ * @note 代价：每块 ptr 缓冲多一个约 16 字节的头（32 位平台约 12 字节），驻留表占用约 sizeof(void *) * 缓冲数；
+ *       驻留表扩容失败只影响去重效果，不影响接口结果；缓冲全部释放后驻留表随之释放。
+ * @note 驻留表为全局共享，多线程同时创建/删除含 ptr 模式字符串的节点需由调用方加锁；
+ *       启用后 RyanJsonGetKey/RyanJsonGetStringValue 返回的缓冲可能被多个节点共享，不得原地修改；
+ *       同理 RyanJsonParseFlagLazyString 不生效（懒字符串需要原地解码）。
+ * @note 默认值为 false。
+ */
+#ifndef RyanJsonStringIntern
+#define RyanJsonStringIntern false
+#endif
+
+/**
+ * @brief RyanJsonCompareAncestorCacheDepth: Compare/Hash 在栈上缓存的祖先层数。
+ * @note Compare 为迭代实现，下沉时记录右侧父节点，回溯与按 key 匹配兄弟时无需沿兄弟链查找父节点；
+ *       嵌套深度超过该值的层级退回查找父节点，结果不变，只是宽 Object 的比较变慢。
+ *       RyanJsonHash 同样按该深度记录父容器类型与子树起点，更深的层级不缓存子树哈希。
+ * @note 栈占用约 sizeof(void *) * 该值。默认值为 16，范围 1~32。
+ */
+#ifndef RyanJsonCompareAncestorCacheDepth
+#define RyanJsonCompareAncestorCacheDepth (16U)
+#endif
+
+/**
+ * @brief RyanJsonQueryMaxSteps: RyanJsonQueryCompile 接受的最大段数。
+ * @note 查询迭代器为每段保存一个游标（3 个指针与 3 个 uint32），迭代器大小与该值成正比，段数更多的查询编译失败。
+ * @note 默认值为 8。
+ */
+#ifndef RyanJsonQueryMaxSteps
+#define RyanJsonQueryMaxSteps (8U)
+#endif
+
+/**
+ * @brief RyanJsonHashCache: 为容器节点缓存 RyanJsonHash 计算出的子树内容哈希。
+ * @note true 时 RyanJsonHash 会为子树节点数不少于 RyanJsonHashCacheMinSize 的容器记录子树哈希，
+ *       再次计算时直接复用未修改的子树；修改接口会沿父链作废缓存，修改后重新计算只需重走被修改的路径。
+ * @note RyanJsonCompare 在两侧容器都持有缓存且哈希不同时直接判定不等（含 Double 的子树除外，因其按容差比较）；
+ *       哈希相同不代表内容相同，此时仍逐节点比较。
+ * @note 代价：与其他容器侧特性共用扩展槽，每个容器多一个指针，缓存的容器约多 8 字节；缓存申请失败只影响复用。
+ * @note 启用后 RyanJsonHash 会写入缓存，不能与其他读写操作并发调用。
+ * @note 默认值为 false。
+ */
+#ifndef RyanJsonHashCache
+#define RyanJsonHashCache false
+#endif
+
+/**
+ * @brief RyanJsonHashCacheMinSize: 子树节点数（含容器自身）达到该值才缓存其哈希。
+ * @note 过小的子树重新计算比查缓存更便宜，默认值为 16。
+ */
+#ifndef RyanJsonHashCacheMinSize
+#define RyanJsonHashCacheMinSize (16U)
+#endif
+
+/**
+ * @brief RyanJsonSnapshotShare: 提供共享只读快照接口 RyanJsonSnapshot / RyanJsonSnapshotRelease。
+ * @note 快照是带引用计数的缓存副本，不是写时复制：节点经线索化链表指回父节点，同一节点无法同时挂在两棵树上，
+ *       未修改的子树也不与原树共享，每份新快照都是一次完整的 RyanJsonDuplicate；
+ *       只有容器自上次快照以来未被修改时，再次快照才直接共享同一份副本，修改接口沿父链解除共享。
+ * @note 快照只读，必须通过 RyanJsonSnapshotRelease 释放；对快照再取快照同样只增加引用计数。
+ *       修改接口（Change/Insert/Replace/Detach/ChangeKey）作用于快照内节点时返回失败，
+ *       RyanJsonDelete 快照、把快照挂到其他容器同样失败（不依赖断言）。
+ * @note 代价：与其他容器侧特性共用扩展槽，扩展信息只多一个指针宽的字段；被快照的容器持有副本的一次引用，直到下次修改或被删除。
+ * @note 启用后取快照会写入被快照容器的扩展信息，不能与其他读写操作并发调用。
+ * @note 默认值为 false。
+ */
+#ifndef RyanJsonSnapshotShare
+#define RyanJsonSnapshotShare false
+#endif
+
+/**
+ * @brief RyanJsonPrintIoVecRefMinSize: RyanJsonPrintIoVec 直接引用节点存储的字符串最小长度（字节）。
+ * @note 仅 ptr 模式且已知无需转义的 strValue 会被引用，其余内容写入暂存区。
+ * @note 过短的字符串单独占一个 iovec 条目得不偿失，默认值为 64。
+ */
+#ifndef RyanJsonPrintIoVecRefMinSize
+#define RyanJsonPrintIoVecRefMinSize (64U)
+#endif
+
 /**
  * @brief RyanJsonSnprintfSupportScientific: 声明目标平台 snprintf 是否支持科学计数法（%g/%e）。
  * @note 该配置会影响 Double 序列化策略与 RyanJsonDoubleBufferSize 默认值。
@@ -160,6 +376,74 @@ extern "C" {
 #error "RyanJsonDefaultAddAtHead 必须是 true 或 false"
 #endif
 
+#if true != RyanJsonPrintCache && false != RyanJsonPrintCache
+#error "RyanJsonPrintCache 必须是 true 或 false"
+#endif
+
+#if true != RyanJsonDeltaTracking && false != RyanJsonDeltaTracking
+#error "RyanJsonDeltaTracking 必须是 true 或 false"
+#endif
+
+#if RyanJsonPrintCacheMinSize < 2
+#error "RyanJsonPrintCacheMinSize 必须大于等于2"
+#endif
+
+#if RyanJsonPrintCacheMaxSize < RyanJsonPrintCacheMinSize
+#error "RyanJsonPrintCacheMaxSize 必须大于等于 RyanJsonPrintCacheMinSize"
+#endif
+
+#if true != RyanJsonObjectHashIndex && false != RyanJsonObjectHashIndex
+#error "RyanJsonObjectHashIndex 必须是 true 或 false"
+#endif
+
+#if RyanJsonObjectHashIndexMinSize < 1
+#error "RyanJsonObjectHashIndexMinSize 必须大于等于1"
+#endif
+
+#if true != RyanJsonArrayIndex && false != RyanJsonArrayIndex
+#error "RyanJsonArrayIndex 必须是 true 或 false"
+#endif
+
+#if RyanJsonArrayIndexMinSize < 1
+#error "RyanJsonArrayIndexMinSize 必须大于等于1"
+#endif
+
+#if true != RyanJsonPackedArray && false != RyanJsonPackedArray
+#error "RyanJsonPackedArray 必须是 true 或 false"
+#endif
+
+#if RyanJsonPackedTableParseMaxColumns > 255
+#error "RyanJsonPackedTableParseMaxColumns 不能大于255"
+#endif
+
+#if true != RyanJsonStringIntern && false != RyanJsonStringIntern
+#error "RyanJsonStringIntern 必须是 true 或 false"
+#endif
+
+#if RyanJsonCompareAncestorCacheDepth < 1 || RyanJsonCompareAncestorCacheDepth > 32
+#error "RyanJsonCompareAncestorCacheDepth 必须在 1~32 之间"
+#endif
+
+#if RyanJsonQueryMaxSteps < 1
+#error "RyanJsonQueryMaxSteps 必须大于等于1"
+#endif
+
+#if true != RyanJsonHashCache && false != RyanJsonHashCache
+#error "RyanJsonHashCache 必须是 true 或 false"
+#endif
+
+#if RyanJsonHashCacheMinSize < 2
+#error "RyanJsonHashCacheMinSize 必须大于等于2"
+#endif
+
+#if true != RyanJsonSnapshotShare && false != RyanJsonSnapshotShare
+#error "RyanJsonSnapshotShare 必须是 true 或 false"
+#endif
+
+#if RyanJsonPrintIoVecRefMinSize < 1
+#error "RyanJsonPrintIoVecRefMinSize 必须大于等于1"
+#endif
+
 /**
  * @brief RyanJsonInlineStringSize: key/短字符串内联阈值（单位：字节）。
  * @note 用户可在包含 RyanJson.h 前自行定义。
@@ -15,7 +15,7 @@ extern "C" {
 #define RyanJsonKeyFeidLenMaxSize      sizeof(uint32_t)
 #define RyanJsonAlign(size, align)     (((size) + (align) - 1) & ~((align) - 1))
 #define RyanJsonAlignDown(size, align) ((size) & ~((align) - 1))
-#define _checkType(info, type)         (RyanJsonGetType(info) == (type))
+#define _checkType(info, type)         (RyanJsonGetPayloadTypeByFlag(info) == (type))
 #define RyanJsonUnused(x)              (void)(x)
 
 #ifndef RyanJsonInlineStringSize
@@ -71,6 +71,108 @@ extern "C" {
 // }
 #endif
 
+/**
+ * @brief ptr 模式下 strValue 元信息字段（长度 + 无需转义标记）。
+ * @details
+ * ptr 模式只占用内联区中的 keyLenField 槽与指针槽，其后剩余空间原本闲置，
+ * 这里复用其中最多 4 字节记录 strValue 元信息，不额外占用内存：
+ * - 最高位：strValue 不含需要转义的字节（打印时可直接整段拷贝）
+ * - 其余位：strValue 字节长度；超出可表示范围时写全 1，读取时回退 strlen
+ * inline 模式不记录元信息（字符串不超过内联区，现场计算的代价可忽略）。
+ * 剩余空间为 0 的配置下该字段宽度为 0，行为退化为历史实现。
+ */
+#define RyanJsonStrValueMetaOffset (RyanJsonFlagSize + RyanJsonKeyFeidLenMaxSize + sizeof(void *))
+#define RyanJsonStrValueMetaSpare                                                                                                          \
+	((RyanJsonInlineStringSize > RyanJsonKeyFeidLenMaxSize + sizeof(void *))                                                           \
+		 ? (RyanJsonInlineStringSize - RyanJsonKeyFeidLenMaxSize - sizeof(void *))                                                 \
+		 : 0U)
+#define RyanJsonStrValueMetaSize (RyanJsonStrValueMetaSpare > sizeof(uint32_t) ? sizeof(uint32_t) : RyanJsonStrValueMetaSpare)
+
+/**
+ * @brief ptr 模式下的 key 指纹字节。
+ * @details
+ * ptr 模式的指针槽固定在 flag + RyanJsonKeyFeidLenMaxSize，keyLenField 实际宽度不足 4 字节时
+ * 二者之间存在空闲字节，这里复用最后一个记录 key 哈希的 1 字节指纹，不额外占用内存。
+ * 按 key 查找时先比较长度再比较指纹，不匹配的兄弟无需解引用堆缓冲；
+ * inline 模式的 key 本就位于节点内，只比较长度。
+ * 取哈希最高字节，与 Object key 索引使用的低位槽位相互独立。
+ */
+#define RyanJsonKeyFingerprintOffset   (RyanJsonFlagSize + RyanJsonKeyFeidLenMaxSize - 1U)
+#define RyanJsonKeyFingerprintOf(hash) ((uint8_t)((hash) >> 24))
+
+/**
+ * @brief 容器扩展槽：启用容器侧可选特性时，Array/Object 节点在 children 指针后追加一个指针槽，
+ * 指向按需分配的 RyanJsonContainerExt_t；未启用时节点布局与历史版本一致。
+ */
+#if true == RyanJsonPrintCache || true == RyanJsonDeltaTracking || true == RyanJsonObjectHashIndex || true == RyanJsonArrayIndex ||        \
+	true == RyanJsonHashCache || true == RyanJsonSnapshotShare
+#define RyanJsonContainerExtEnable true
+#else
+#define RyanJsonContainerExtEnable false
+#endif
+
+#if true == RyanJsonContainerExtEnable
+#define RyanJsonContainerExtSize sizeof(void *)
+
+#if true == RyanJsonDeltaTracking
+typedef struct
+{
+	RyanJson_t node;     // 整体变化的直接成员
+	RyanJson_t baseline; // 该 key 在检查点时为 Object 的 key 骨架（见 RyanJsonInternalDeltaRecord），否则为 NULL
+} RyanJsonDeltaEntry_t;
+#endif
+
+#if true == RyanJsonObjectHashIndex
+typedef struct
+{
+	uint32_t hash;   // key 哈希值，探测时先比较哈希再比较 key
+	RyanJson_t node; // 成员节点，NULL 表示空槽
+} RyanJsonKeyIndexSlot_t;
+#endif
+
+typedef struct
+{
+#if true == RyanJsonPrintCache
+	uint8_t *printCache;    // 紧凑打印片段（仅容器自身，不含 key），NULL 表示无缓存
+	uint32_t printCacheLen; // 片段字节数
+	uint32_t printStart;    // 打印过程中该容器片段在输出缓冲中的起始偏移
+#endif
+#if true == RyanJsonDeltaTracking
+	RyanJsonDeltaEntry_t *deltaEntries; // 自上次检查点以来整体变化的直接成员（仅 Object 使用）
+	RyanJson_t *deltaRemoved;           // 自上次检查点以来被移除成员的 key 骨架，增量输出为 null
+	uint32_t deltaEntryCount;
+	uint32_t deltaEntryCap;
+	uint32_t deltaRemovedCount;
+	uint32_t deltaRemovedCap;
+#endif
+#if true == RyanJsonObjectHashIndex || true == RyanJsonArrayIndex
+	// 容器类型决定使用哪个成员，两类索引不会同时存在，共用存储以减少每个扩展信息的占用
+	union
+	{
+#if true == RyanJsonObjectHashIndex
+		RyanJsonKeyIndexSlot_t *keyIndex; // Object 成员的开放寻址哈希表（线性探测），NULL 表示未建立
+#endif
+#if true == RyanJsonArrayIndex
+		RyanJson_t *childIndex; // Array 子节点指针表（与链表顺序一致），NULL 表示未建立
+#endif
+	} index;
+	uint32_t indexCap;   // Object：槽位数量（2 的幂）；Array：指针表容量
+	uint32_t indexCount; // Object：已登记成员数量；Array：子节点数量
+#endif
+#if true == RyanJsonHashCache
+	uint32_t subtreeHash; // 子树内容哈希（未做最终混合），hashState 为 0 时无效
+	uint8_t hashState;    // RyanJsonHashCacheValid | RyanJsonHashCacheHasDouble
+#endif
+#if true == RyanJsonSnapshotShare
+	// 快照根（只读，再次快照直接共享自身）与被快照的容器两种角色互斥，共用一个字，按最低位区分：
+	// 1 表示快照根，其余位为引用计数；0 表示被快照容器，其余位为共享快照指针（持有其一次引用），整体为 0 表示无
+	uintptr_t snapshotLink;
+#endif
+} RyanJsonContainerExt_t;
+#else
+#define RyanJsonContainerExtSize 0U
+#endif
+
 // 该结构字段语义需与 struct RyanJsonNode 保持一致
 typedef struct
 {
@@ -80,12 +182,30 @@ typedef struct
 	RyanjsonType_e type;
 	RyanJsonBool_e boolIsTrueFlag;
 	RyanJsonBool_e numberIsDoubleFlag;
+
+	uint32_t strValueLen;           // strValue 字节长度，仅 hasStrValueLen 为 true 时有效
+	RyanJsonBool_e hasStrValueLen;  // 调用方已知 strValue 长度，可省去 strlen
+	RyanJsonBool_e strValueIsClean; // 调用方已确认 strValue 无需转义（如解析阶段源文本不含转义）
+	uint32_t extraSize;             // 节点本体之后追加的字节数（懒数值源文本），已清零
 } RyanJsonNodeInfo_t;
 
+RyanJsonInternalApi const uint8_t RyanJsonInternalEscapeTable[256];
+
 RyanJsonInternalApi RyanJsonMalloc_t jsonMalloc;
 RyanJsonInternalApi RyanJsonFree_t jsonFree;
 RyanJsonInternalApi RyanJsonRealloc_t jsonRealloc;
 
+/**
+ * @brief 内部接口：释放 ptr 模式的字符串缓冲。
+ * @note 启用 RyanJsonStringIntern 时缓冲可能被多个节点共享，只减少引用计数，归零后才真正释放。
+ */
+#if true == RyanJsonStringIntern
+RyanJsonInternalApi void RyanJsonInternalInternRelease(uint8_t *buf);
+#define RyanJsonInternalFreeStrBuf(buf) RyanJsonInternalInternRelease(buf)
+#else
+#define RyanJsonInternalFreeStrBuf(buf) jsonFree(buf)
+#endif
+
 RyanJsonInternalApi uint8_t *RyanJsonInternalGetStrPtrModeBuf(RyanJson_t pJson);
 RyanJsonInternalApi void RyanJsonInternalSetStrPtrModeBuf(RyanJson_t pJson, uint8_t *heapPtr);
 RyanJsonInternalApi uint8_t *RyanJsonInternalGetStrPtrModeBufAt(RyanJson_t pJson, uint32_t index);
@@ -95,21 +215,365 @@ RyanJsonInternalApi uint32_t RyanJsonInternalGetKeyLen(RyanJson_t pJson);
 RyanJsonInternalApi void *RyanJsonInternalGetValue(RyanJson_t pJson);
 
 RyanJsonInternalApi RyanJson_t RyanJsonInternalNewNode(RyanJsonNodeInfo_t *info);
+RyanJsonInternalApi RyanJson_t RyanJsonInternalCloneNode(RyanJson_t pJson);
 RyanJsonInternalApi void RyanJsonInternalListInsertAfter(RyanJson_t parent, RyanJson_t prev, RyanJson_t item);
 RyanJsonInternalApi RyanJson_t RyanJsonInternalGetParent(RyanJson_t pJson);
 RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalChangeString(RyanJson_t pJson, RyanJsonBool_e isNew, const char *key,
 								const char *strValue);
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalChangeStringWithLen(RyanJson_t pJson, RyanJsonBool_e isNew, const char *key,
+								       const char *strValue, uint32_t strValueLen,
+								       RyanJsonBool_e strValueIsClean);
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalGetStrValueInfo(RyanJson_t pJson, uint32_t *lenPtr);
+RyanJsonInternalApi char *RyanJsonInternalGetStrValue(RyanJson_t pJson);
+RyanJsonInternalApi RyanJson_t RyanJsonInternalCreateStringWithLen(const char *key, const char *string, uint32_t len,
+								  RyanJsonBool_e isClean);
 RyanJsonInternalApi RyanJson_t RyanJsonInternalCreateObjectAndKey(const char *key);
 RyanJsonInternalApi RyanJson_t RyanJsonInternalCreateArrayAndKey(const char *key);
+
+/**
+ * @brief 内部接口：Blob 节点存储。
+ * @details Blob 节点与 String 节点尺寸相同，固定使用 ptr 模式，缓冲布局为 "key\0" + 4 字节小端长度 + 数据，
+ * 因此 String 节点可原地转换为 Blob，节点地址与父容器中的索引均不受影响。
+ * 缓冲与 String 共用释放路径（RyanJsonInternalFreeStrBuf）。
+ */
+#define RyanJsonBlobLenSize (4U)
+RyanJsonInternalApi uint8_t *RyanJsonInternalNewBlobBuf(const char *key, uint32_t keyLen, uint32_t len, uint8_t **data);
+RyanJsonInternalApi void RyanJsonInternalSetBlobBuf(RyanJson_t pJson, uint8_t *buf, RyanJsonBool_e hasKey, uint32_t keyLen);
+
+/**
+ * @brief 内部接口：Raw 节点（原始 Json 文本）。
+ * @details Raw 与 Blob 共用存储类型 7，以扩展位区分，RyanJsonGetType 对外返回 RyanJsonTypeRaw，内部判型一律用
+ * RyanJsonGetPayloadTypeByFlag/_checkType；存储与 String 节点相同（短文本内联，长文本 ptr 模式），
+ * 文本在创建时校验为单个合法 Json 值，打印时原样输出。
+ */
+#define RyanJsonGetPayloadIsRawByFlag(pJson)        RyanJsonGetPayloadFlagField((pJson), 3, RyanJsonGetMask(1))
+#define RyanJsonSetPayloadIsRawByFlag(pJson, value) RyanJsonSetPayloadFlagField((pJson), 3, RyanJsonGetMask(1), (value))
+#define RyanJsonInternalIsRaw(pJson)                (_checkType((pJson), RyanJsonTypeBlob) && RyanJsonGetPayloadIsRawByFlag(pJson))
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalValidateValue(const char *text, uint32_t size, uint32_t *startPtr, uint32_t *lenPtr);
+
+/**
+ * @brief 内部接口：懒数值。
+ * @details RyanJsonParseFlagLazyNumber 解析出的 Number 按 Double 节点分配，值区写入保留的 NaN 位型作标记，
+ * 源文本（已完整校验，'\0' 结尾）紧跟在值区之后。Number 没有空闲的扩展位，RyanJsonChangeDoubleValue 把所有 NaN
+ * 统一写成 NAN，因此普通 Double 的值区不会与标记相同。
+ * 转换前打印直接输出源文本；RyanJsonGetIntValue/GetDoubleValue 与 Change 系列首次调用时原地转换为普通 Int/Double，
+ * 之后源文本闲置，节点与普通解析结果无异。RyanJsonIsInt/IsDouble、比较、哈希与编码等只读路径经
+ * RyanJsonInternalGetNumber 局部解析，不改动节点。
+ */
+#define RyanJsonLazyNumberTag UINT64_C(0x7FF4C0DE4C4E554D)
+#define RyanJsonInternalIsLazyNumber(pJson)                                                                                                \
+	(_checkType((pJson), RyanJsonTypeNumber) && RyanJsonGetPayloadNumberIsDoubleByFlag(pJson) &&                                       \
+	 RyanJsonInternalHasLazyNumberTag(pJson))
+#define RyanJsonInternalGetLazyNumberText(pJson) ((char *)RyanJsonInternalGetValue(pJson) + sizeof(double))
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalHasLazyNumberTag(RyanJson_t pJson);
+RyanJsonInternalApi RyanJson_t RyanJsonInternalCreateLazyNumber(const char *key, const char *text, uint32_t len);
+RyanJsonInternalApi double RyanJsonInternalGetNumber(RyanJson_t pJson, RyanJsonBool_e *isIntPtr);
+
+/**
+ * @brief 内部接口：懒字符串（保留转义文本的 String 节点）。
+ * @details RyanJsonParseFlagLazyString 解析出的含转义 String 置位扩展位，strValue 为引号内的源文本（已完整校验），
+ * 元信息按“无需转义”记录，打印路径直接整段输出；RyanJsonGetStringValue 首次读取时原地解码并清除扩展位。
+ * 解码结果不长于源文本，缓冲无需重新申请，因此读取不会失败；需要连续 strValue 的路径（编码、二进制导出）须先解码，
+ * 比较、哈希与取长度经 RyanJsonInternalUnescapedHash/UnescapedEq 流式解码，打印、ChangeKey、复制直接使用源文本，
+ * 均不改动节点。
+ */
+#define RyanJsonGetPayloadStrIsEscapedByFlag(pJson)        RyanJsonGetPayloadFlagField((pJson), 3, RyanJsonGetMask(1))
+#define RyanJsonSetPayloadStrIsEscapedByFlag(pJson, value) RyanJsonSetPayloadFlagField((pJson), 3, RyanJsonGetMask(1), (value))
+#define RyanJsonInternalIsLazyString(pJson)                                                                                                \
+	(_checkType((pJson), RyanJsonTypeString) && RyanJsonGetPayloadStrIsEscapedByFlag(pJson))
+RyanJsonInternalApi uint32_t RyanJsonInternalUnescapeString(char *text);
+RyanJsonInternalApi void RyanJsonInternalUnescapeLazyString(RyanJson_t pJson);
+RyanJsonInternalApi uint32_t RyanJsonInternalUnescapedHash(const char *text, uint32_t *lenPtr);
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalUnescapedEq(const char *left, RyanJsonBool_e leftEscaped, const char *right,
+							       RyanJsonBool_e rightEscaped);
+
+/**
+ * @brief 内部接口：标准 base64（RFC 4648，带 '=' 填充）编解码。
+ * @note 编码长度为 4 * ceil(len / 3)，len 不超过 RyanJsonBase64MaxRawLen 时不会溢出。
+ * @note 解码只接受规范编码：长度为 4 的倍数、无空白、填充仅在末尾且未使用的尾部比特为 0，
+ *       因此解码后再编码与原文逐字节一致。
+ */
+#define RyanJsonBase64MaxRawLen       ((UINT32_MAX / 4U) * 3U)
+#define RyanJsonBase64EncodedLen(len) (((len) + 2U) / 3U * 4U)
+RyanJsonInternalApi uint32_t RyanJsonInternalBase64Encode(const uint8_t *src, uint32_t len, uint8_t *dst);
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalBase64DecodedLen(const char *src, uint32_t len, uint32_t *outLen);
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalBase64Decode(const char *src, uint32_t len, uint8_t *dst);
+
 /**
  * @brief 内部接口：仅用于容器 children 指针改写。
  * @note 调用方需保证 pJson 为 Array/Object 且非 NULL。
  */
 RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalChangeObjectValue(RyanJson_t pJson, RyanJson_t objValue);
 RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalStrEq(const char *s1, const char *s2);
+RyanJsonInternalApi uint32_t RyanJsonInternalKeyHash(const char *key, uint32_t len);
+#define RyanJsonKeyHashSeed             2166136261U
+#define RyanJsonKeyHashStep(hash, byte) (((hash) ^ (uint8_t)(byte)) * 16777619U)
+
+/**
+ * @brief 内部接口：内容哈希（RyanJsonHash）基础运算。
+ * @details 子树哈希 = Σ(节点权重 * 节点内容哈希)（模 2^32），节点权重为子树根到该节点路径上各条边权重之积：
+ * - Object 成员的边权重只由 key 决定，成员顺序不影响结果；
+ * - Array 共 n 个元素时第 i 个的边权重为 B * A^(n-1-i)（Horner 形式），回溯到父节点只需乘 B 的逆元。
+ * 边权重均为奇数，路径权重可逆，迭代遍历无需逐层保存状态；容器子树哈希可独立缓存并按权重在父树中复用。
+ */
+#define RyanJsonHashArrayStep         (0x9E3779B1U) // A
+#define RyanJsonHashArrayLast         (0x85EBCA77U) // B
+#define RyanJsonInternalHashTag(type) RyanJsonInternalHashMix(0x8EBC6AF1U ^ (uint32_t)(type))
+RyanJsonInternalApi uint32_t RyanJsonInternalHashMix(uint32_t hash);
+RyanJsonInternalApi uint32_t RyanJsonInternalHashInverse(uint32_t odd);
+RyanJsonInternalApi uint32_t RyanJsonInternalHashPow(uint32_t base, uint32_t exp);
+RyanJsonInternalApi uint32_t RyanJsonInternalHashKeyWeight(const char *key, uint32_t keyLen);
+RyanJsonInternalApi uint32_t RyanJsonInternalHashInt(int32_t number);
+RyanJsonInternalApi uint32_t RyanJsonInternalHashDouble(double number);
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalKeyEq(RyanJson_t pJson, const char *key, uint32_t keyLen, uint32_t hash);
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalKeyEqNode(RyanJson_t left, RyanJson_t right);
+RyanJsonInternalApi RyanJson_t RyanJsonInternalGetObjectByKeyHash(RyanJson_t pJson, const char *key, uint32_t keyLen, uint32_t hash);
 RyanJsonInternalApi void *RyanJsonInternalExpandRealloc(void *block, uint32_t oldSize, uint32_t newSize); // 跨模块使用时保留
 
-RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalParseDoubleRaw(const uint8_t *currentPtr, uint32_t remainSize, double *numberValuePtr);
+#if true == RyanJsonContainerExtEnable
+RyanJsonInternalApi RyanJsonContainerExt_t *RyanJsonInternalGetContainerExt(RyanJson_t pJson);
+RyanJsonInternalApi RyanJsonContainerExt_t *RyanJsonInternalEnsureContainerExt(RyanJson_t pJson);
+RyanJsonInternalApi void RyanJsonInternalFreeContainerExt(RyanJson_t pJson);
+RyanJsonInternalApi void RyanJsonInternalTrimContainerExt(RyanJson_t pJson);
+#endif
+
+#if true == RyanJsonPrintCache
+RyanJsonInternalApi void RyanJsonInternalDropPrintCache(RyanJson_t pJson);
+#endif
+
+/**
+ * @brief 内部接口：pJson 的序列化结果即将改变，沿父链使容器缓存失效并解除共享快照。
+ * @return RyanJsonBool_e pJson 位于只读快照内时返回 RyanJsonFalse，调用方须放弃修改
+ * @note pJson 可为 NULL 或游离节点；未启用任何容器缓存时为空操作。
+ */
+#if true == RyanJsonPrintCache || true == RyanJsonHashCache || true == RyanJsonSnapshotShare
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalMarkDirty(RyanJson_t pJson);
+#else
+#define RyanJsonInternalMarkDirty(pJson) (RyanJsonTrue)
+#endif
+
+/**
+ * @brief 内部接口：解除容器与共享快照的关联（快照根节点带 key，改 key 时也需调用）。
+ */
+#if true == RyanJsonSnapshotShare
+RyanJsonInternalApi void RyanJsonInternalDropSnapshotLink(RyanJson_t pJson);
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalIsSnapshot(RyanJson_t pJson);
+
+// snapshotLink 读写（节点由 jsonMalloc 分配，指针最低位恒为 0）
+#define RyanJsonInternalIsSnapshotRoot(ext)         (0U != ((ext)->snapshotLink & 1U))
+#define RyanJsonInternalGetSnapshotRef(ext)         (RyanJsonInternalIsSnapshotRoot(ext) ? (uint32_t)((ext)->snapshotLink >> 1) : 0U)
+#define RyanJsonInternalSetSnapshotRef(ext, ref)    ((ext)->snapshotLink = ((uintptr_t)(ref) << 1) | 1U)
+#define RyanJsonInternalGetSnapshot(ext)            (RyanJsonInternalIsSnapshotRoot(ext) ? NULL : (RyanJson_t)(ext)->snapshotLink)
+#define RyanJsonInternalSetSnapshot(ext, snapshot)  ((ext)->snapshotLink = (uintptr_t)(snapshot))
+#endif
+
+#if true == RyanJsonHashCache
+#define RyanJsonHashCacheValid     (0x01U)
+#define RyanJsonHashCacheHasDouble (0x02U) // 子树含 Double：Compare 按容差比较，哈希不同不能判定不等
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalGetHashCache(RyanJson_t pJson, uint32_t *hash, RyanJsonBool_e *hasDouble);
+RyanJsonInternalApi void RyanJsonInternalSetHashCache(RyanJson_t pJson, uint32_t hash, RyanJsonBool_e hasDouble);
+#endif
+
+/**
+ * @brief 内部接口：记录一次成员变化，供增量打印使用。
+ * @details removed 为即将离开 container 的成员（其 key 记为删除），added 为即将以 addedKey
+ * （为 NULL 时取 added 自身 key）出现在 container 中、或值即将改变的成员，二者均可为 NULL。
+ * 需在真正修改之前调用；返回 RyanJsonFalse 表示内存不足，此时记录状态保持不变，调用方应放弃修改。
+ * @details Merge Patch 中 Object 值会与原值逐 key 合并，整体替换一个原为 Object 的成员时必须为原有而新值中没有的 key
+ * 输出 null。因此移除成员时保存其检查点时的 key 骨架（只含 key 与 Object 嵌套，其余成员为同名 Null 节点），
+ * 同名 key 重新出现时骨架转为该成员的基线，打印时据此补齐 null。
+ * @note 记录只保存在直接所属的 Object 上；该 Object 及其祖先以 flag bit3 标记“子树内有记录”，
+ *       标记不占内存，增量打印与检查点只进入带标记的成员，深层修改无需在每级祖先上申请记录。
+ */
+#if true == RyanJsonDeltaTracking
+#define RyanJsonGetPayloadDeltaPathByFlag(pJson)        RyanJsonGetPayloadFlagField((pJson), 3, RyanJsonGetMask(1))
+#define RyanJsonSetPayloadDeltaPathByFlag(pJson, value) RyanJsonSetPayloadFlagField((pJson), 3, RyanJsonGetMask(1), (value))
+#define RyanJsonInternalIsDeltaPath(pJson)              (_checkType((pJson), RyanJsonTypeObject) && RyanJsonGetPayloadDeltaPathByFlag(pJson))
+// ReplaceByKey 包装标量时会产生不带 key 的 Object 成员，增量记录与打印统一经此取 key，无 key 时为 NULL
+#define RyanJsonInternalDeltaKey(pJson)                 (RyanJsonIsKey(pJson) ? RyanJsonGetKey(pJson) : NULL)
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalDeltaRecord(RyanJson_t container, RyanJson_t removed, RyanJson_t added,
+								const char *addedKey);
+RyanJsonInternalApi RyanJsonDeltaEntry_t *RyanJsonInternalDeltaFindEntry(const RyanJsonContainerExt_t *ext, RyanJson_t node);
+#endif
+
+/**
+ * @brief 内部接口：Object key 哈希索引。
+ * @details 索引存在时保证登记的 key 互不重复，Find 返回 RyanJsonFalse 表示未建立索引、调用方需线性扫描；
+ * Add/Remove 在成员进出 Object 或 key 改变时维护索引（pJson 可为 NULL 或 Array，此时为空操作），
+ * 无法保持一致（重复 key、扩容失败）时直接丢弃索引。
+ */
+#if true == RyanJsonObjectHashIndex
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalKeyIndexFind(RyanJson_t pJson, const char *key, uint32_t keyLen, uint32_t hash,
+								RyanJson_t *found);
+RyanJsonInternalApi void RyanJsonInternalKeyIndexBuild(RyanJson_t pJson);
+RyanJsonInternalApi void RyanJsonInternalKeyIndexAdd(RyanJson_t pJson, RyanJson_t item);
+RyanJsonInternalApi void RyanJsonInternalKeyIndexRemove(RyanJson_t pJson, RyanJson_t item);
+#endif
+
+/**
+ * @brief 内部接口：Array 子节点指针表。
+ * @details 指针表存在时与链表顺序严格一致，Find 返回 RyanJsonFalse 表示未建立、调用方需遍历链表；
+ * Insert/Remove/Replace 在子节点按位置进出 Array 时维护指针表（pJson 为 Object 或未建立时为空操作），
+ * 扩容失败时直接丢弃指针表。
+ */
+#if true == RyanJsonArrayIndex
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalArrayIndexFind(RyanJson_t pJson, uint32_t index, RyanJson_t *found, RyanJson_t *prevOut);
+RyanJsonInternalApi void RyanJsonInternalArrayIndexBuild(RyanJson_t pJson);
+RyanJsonInternalApi void RyanJsonInternalArrayIndexInsert(RyanJson_t pJson, uint32_t pos, RyanJson_t item);
+RyanJsonInternalApi void RyanJsonInternalArrayIndexRemove(RyanJson_t pJson, uint32_t pos);
+RyanJsonInternalApi void RyanJsonInternalArrayIndexReplace(RyanJson_t pJson, uint32_t pos, RyanJson_t item);
+#endif
+
+/**
+ * @brief 内部接口：紧凑数值数组与列存表。
+ * @details Array 节点 flag bit3 置位时，value 槽保存的不是首子节点，而是数据块指针：
+ * - 一维数组：[ RyanJsonPackedHead_t | (pad) | 元素 0 | 元素 1 | ... ]，元素按 elemType 紧密排列；
+ * - 列存表（elemType 为 RyanJsonPackedTypeTable）：每行是一个同形 Object，
+ *   [ RyanJsonPackedHead_t | (pad) | 列描述 x colCount | 列 0 数据 | 列 1 数据 | ... | key0 '\0' key1 '\0' ... ]，
+ *   每列数据按 8 字节对齐，key 在整表只存一份且互不重复。
+ * count（行数）不为 0。一维数组按“1 列、无 key”处理，统一通过 Column 接口读取。
+ * 读取子节点前必须先 Expand（RyanJsonGetObjectValue 已自动处理），直接改写 value 槽前必须确认不是紧凑数组。
+ */
+#if true == RyanJsonPackedArray
+typedef struct
+{
+	uint32_t count;     // 元素（行）数量
+	uint32_t blockSize; // 整个数据块字节数（含头部）
+	uint8_t elemType;   // RyanJsonPackedType_e 或 RyanJsonPackedTypeTable
+	uint8_t colCount;   // 列数（仅列存表）
+} RyanJsonPackedHead_t;
+
+typedef struct
+{
+	uint32_t dataOffset; // 列数据相对数据块起点的偏移
+	uint32_t keyOffset;  // key 相对数据块起点的偏移
+	uint32_t keyLen;
+	uint8_t elemType; // RyanJsonPackedTypeInt/Float/Double
+} RyanJsonPackedColumn_t;
+
+#define RyanJsonPackedTypeTable (3U)
+
+// 数据区按 8 字节对齐，double 元素也能自然对齐（读写仍统一用 memcpy）
+#define RyanJsonPackedAlign8(size)              (((size) + 7U) & ~(size_t)7U)
+#define RyanJsonPackedDataOffset                RyanJsonPackedAlign8(sizeof(RyanJsonPackedHead_t))
+#define RyanJsonPackedData(head)                ((uint8_t *)(head) + RyanJsonPackedDataOffset)
+#define RyanJsonPackedElemSize(elemType)        (RyanJsonPackedTypeDouble == (elemType) ? sizeof(double) : sizeof(int32_t))
+#define RyanJsonPackedIsTable(head)             (RyanJsonPackedTypeTable == (head)->elemType)
+#define RyanJsonGetPayloadIsPackedByFlag(pJson) RyanJsonGetPayloadFlagField((pJson), 3, RyanJsonGetMask(1))
+#define RyanJsonSetPayloadIsPackedByFlag(pJson, value) RyanJsonSetPayloadFlagField((pJson), 3, RyanJsonGetMask(1), (value))
+#define RyanJsonInternalIsPackedArray(pJson)    (_checkType((pJson), RyanJsonTypeArray) && RyanJsonGetPayloadIsPackedByFlag(pJson))
+
+RyanJsonInternalApi RyanJsonPackedHead_t *RyanJsonInternalGetPacked(RyanJson_t pJson);
+RyanJsonInternalApi uint32_t RyanJsonInternalPackedColumnCount(const RyanJsonPackedHead_t *head);
+RyanJsonInternalApi const char *RyanJsonInternalPackedColumnKey(const RyanJsonPackedHead_t *head, uint32_t col, uint32_t *keyLen);
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalPackedColumnIsDouble(const RyanJsonPackedHead_t *head, uint32_t col);
+RyanJsonInternalApi int32_t RyanJsonInternalPackedGetInt(const RyanJsonPackedHead_t *head, uint32_t col, uint32_t row);
+RyanJsonInternalApi double RyanJsonInternalPackedGetDouble(const RyanJsonPackedHead_t *head, uint32_t col, uint32_t row);
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalPackedExpand(RyanJson_t pJson);
+RyanJsonInternalApi void RyanJsonInternalPackedFree(RyanJson_t pJson);
+RyanJsonInternalApi void RyanJsonInternalPackedMove(RyanJson_t dst, RyanJson_t src);
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalPackedDuplicate(RyanJson_t dst, RyanJson_t src);
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalPackedCompare(RyanJson_t leftJson, RyanJson_t rightJson, RyanJsonBool_e fullCompare);
+RyanJsonInternalApi uint32_t RyanJsonInternalPackedHash(RyanJson_t pJson, RyanJsonBool_e *hasDouble);
+RyanJsonInternalApi void RyanJsonInternalPackedTryPack(RyanJson_t pJson, uint32_t minCount);
+#else
+#define RyanJsonInternalIsPackedArray(pJson) (RyanJsonFalse)
+#endif
+
+/**
+ * @brief 内部接口：扁平只读文档（tape）。
+ * @details 文档是一整块内存：[RyanJsonTape 头部 | 条目数组 | 字符串池]。条目按文档先序排列，
+ * 每个容器后紧跟其子树条目并以一个结束标记收尾，末尾另有一个结束标记作为哨兵；
+ * key/strValue 以 '\0' 结尾存放在字符串池中，条目只记录相对自身地址的偏移，不含任何指针。
+ * - 同层前进：当前条目 + span（标量为 1，容器为含结束标记在内的子树条目数），遇到结束标记即无后继；
+ * - 首个子节点：容器条目的下一条目（子节点数为 0 时没有）。
+ */
+struct RyanJsonTape
+{
+	uint32_t entryCount; // 条目数量（含结束标记与哨兵）
+	uint32_t poolSize;   // 字符串池字节数
+};
+
+struct RyanJsonTapeEntry
+{
+	uint32_t tag;    // bit0-2 类型（RyanJsonTapeTypeEnd 为结束标记），bit3 见 RyanJsonTapeTagFlag，bit4 有 key，bit5-31 key 长度
+	uint32_t keyOff; // key 相对本条目起始地址的偏移（构建期间为字符串池内偏移）
+	union
+	{
+		int32_t intValue;
+		uint32_t doubleBits[2]; // double 按字节存放、读写统一用 memcpy，条目因此只需 4 字节对齐
+		struct
+		{
+			uint32_t off; // strValue 偏移，规则同 keyOff
+			uint32_t len; // strValue 字节数（不含 '\0'）
+		} str;
+		struct
+		{
+			uint32_t span;  // 子树条目数（含容器自身与结束标记），构建期间暂存父容器下标
+			uint32_t count; // 直接子节点数量
+		} container;
+	} value;
+};
+typedef struct RyanJsonTapeEntry RyanJsonTapeEntry_t;
+
+#define RyanJsonTapeTypeEnd        (7U)
+#define RyanJsonTapeTagFlag        (1U << 3) // Bool 值 / Number 为 Double / String 无需转义
+#define RyanJsonTapeTagHasKey      (1U << 4)
+#define RyanJsonTapeTagKeyLenShift (5U)
+#define RyanJsonTapeKeyLenMax      (0xFFFFFFFFU >> RyanJsonTapeTagKeyLenShift)
+#define RyanJsonTapeEntryType(e)   ((e)->tag & RyanJsonGetMask(3))
+#define RyanJsonTapeEntryIsContainer(e)                                                                                                    \
+	(RyanJsonTypeArray == RyanJsonTapeEntryType(e) || RyanJsonTypeObject == RyanJsonTapeEntryType(e))
+#define RyanJsonTapeEntrySpan(e)   (RyanJsonTapeEntryIsContainer(e) ? (e)->value.container.span : 1U)
+#define RyanJsonTapeEntries(tape)  ((RyanJsonTapeEntry_t *)(void *)((uint8_t *)(tape) + sizeof(struct RyanJsonTape)))
+
+/**
+ * @brief tape 构建器：条目与字符串池各自按倍增扩容，完成时合并成一整块并把池内偏移改写为相对偏移。
+ */
+typedef struct
+{
+	RyanJsonTapeEntry_t *entries;
+	uint8_t *pool;
+	uint32_t entryCount;
+	uint32_t entryCap;
+	uint32_t poolSize;
+	uint32_t poolCap;
+} RyanJsonTapeBuilder_t;
+
+RyanJsonInternalApi RyanJsonTapeEntry_t *RyanJsonInternalTapePush(RyanJsonTapeBuilder_t *builder, uint32_t tag);
+RyanJsonInternalApi uint8_t *RyanJsonInternalTapeReservePool(RyanJsonTapeBuilder_t *builder, uint32_t size);
+RyanJsonInternalApi RyanJsonTape_t RyanJsonInternalTapeFinish(RyanJsonTapeBuilder_t *builder, uint32_t headroom);
+RyanJsonInternalApi void RyanJsonInternalTapeBuilderFree(RyanJsonTapeBuilder_t *builder);
+
+/**
+ * @brief 二进制镜像头部，紧跟其后的是一份完整的 tape 文档。
+ * @details 文档内只有相对偏移，镜像可原样存入 flash/文件，加载时校验后直接在原地使用。
+ * magic 按本机字节序写入，字节序不同的镜像会因 magic 不符被拒绝；
+ * version 编入格式版本、条目大小与影响文档语义的配置宏，任一不同都视为不兼容。
+ */
+typedef struct
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t totalSize; // 镜像总字节数（含头部）
+	uint32_t checksum;  // 头部之后全部字节的校验和，见 RyanJsonInternalBinaryChecksum
+} RyanJsonBinaryHead_t;
+
+#define RyanJsonBinaryMagic         (0x424A5952U) // 小端存储为 "RYJB"
+#define RyanJsonBinaryFormatVersion (1U)
+#define RyanJsonBinaryAlign         (4U) // 条目只含 uint32_t 字段，镜像起始地址按 4 字节对齐即可
+#if true == RyanJsonStrictObjectKeyCheck
+#define RyanJsonBinaryConfigBits (1U)
+#else
+#define RyanJsonBinaryConfigBits (0U)
+#endif
+#define RyanJsonBinaryVersion                                                                                                              \
+	((RyanJsonBinaryFormatVersion << 16) | ((uint32_t)sizeof(RyanJsonTapeEntry_t) << 8) | RyanJsonBinaryConfigBits)
+
+RyanJsonInternalApi uint32_t RyanJsonInternalBinaryChecksum(const uint8_t *data, uint32_t size);
+
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalParseDoubleRaw(const uint8_t *currentPtr, uint32_t remainSize, double *numberValuePtr,
+								  RyanJsonBool_e *isIntPtr);
 
 #ifdef RyanJsonLinuxTestEnv
 #undef RyanJsonSnprintf
@@ -4,32 +4,117 @@
  * @brief 在 Object 节点中按 key 查找子节点
  *
  * @param pJson Object 节点
- * @param key 目标 key
+ * @param key 目标 key，无需 '\0' 结尾
+ * @param keyLen 目标 key 字节长度
+ * @param hash 目标 key 的 RyanJsonInternalKeyHash 结果
  * @param prevOut 输出前驱节点，可为 NULL
  * @return RyanJson_t 命中节点，未命中返回 NULL
+ * @note 逐个兄弟先比较 key 长度与指纹，再比较 key 字节。
  */
-static RyanJson_t RyanJsonFindNodeByKey(RyanJson_t pJson, const char *key, RyanJson_t *prevOut)
+static RyanJson_t RyanJsonFindNodeByKeyHash(RyanJson_t pJson, const char *key, uint32_t keyLen, uint32_t hash, RyanJson_t *prevOut)
 {
 	RyanJsonCheckAssert(NULL != pJson && NULL != key);
 	RyanJsonCheckReturnNull(_checkType(pJson, RyanJsonTypeObject));
 
 	RyanJson_t prev = NULL;
-	RyanJson_t nextItem = RyanJsonGetObjectValue(pJson);
+	RyanJson_t nextItem = NULL;
 
+#if true == RyanJsonObjectHashIndex
+	// 已建立索引：按哈希定位，前驱只需按指针回溯，不再逐个比较 key
+	if (RyanJsonTrue == RyanJsonInternalKeyIndexFind(pJson, key, keyLen, hash, &nextItem))
+	{
+		if (NULL != nextItem && prevOut)
+		{
+			for (RyanJson_t item = RyanJsonGetObjectValue(pJson); item != nextItem; item = RyanJsonGetNext(item))
+			{
+				prev = item;
+			}
+			*prevOut = prev;
+		}
+		return nextItem;
+	}
+	uint32_t scanned = 0;
+#endif
+
+	nextItem = RyanJsonGetObjectValue(pJson);
 	while (nextItem)
 	{
 		// Object 子节点按约定必须带 key，异常场景下直接返回，避免继续访问无效数据
 		RyanJsonCheckAssert(RyanJsonIsKey(nextItem));
-		if (RyanJsonTrue == RyanJsonInternalStrEq(RyanJsonGetKey(nextItem), key))
-		{
-			if (prevOut) { *prevOut = prev; }
-			return nextItem;
-		}
+		if (RyanJsonTrue == RyanJsonInternalKeyEq(nextItem, key, keyLen, hash)) { break; }
+		prev = nextItem;
+		nextItem = RyanJsonGetNext(nextItem);
+#if true == RyanJsonObjectHashIndex
+		scanned++;
+#endif
+	}
+
+#if true == RyanJsonObjectHashIndex
+	// 单次扫描已足够长，为后续查找建立索引（失败不影响本次结果）
+	if (scanned >= RyanJsonObjectHashIndexMinSize) { RyanJsonInternalKeyIndexBuild(pJson); }
+#endif
+
+	if (NULL != nextItem && prevOut) { *prevOut = prev; }
+	return nextItem;
+}
+
+static RyanJson_t RyanJsonFindNodeByKey(RyanJson_t pJson, const char *key, uint32_t keyLen, RyanJson_t *prevOut)
+{
+	return RyanJsonFindNodeByKeyHash(pJson, key, keyLen, RyanJsonInternalKeyHash(key, keyLen), prevOut);
+}
+
+/**
+ * @brief 内部接口：按预先算好哈希的 key 查找 Object 子节点
+ * @note 供预编译路径使用，重复查找同一 key 时省去哈希计算；pJson 非 Object 时返回 NULL。
+ */
+RyanJsonInternalApi RyanJson_t RyanJsonInternalGetObjectByKeyHash(RyanJson_t pJson, const char *key, uint32_t keyLen, uint32_t hash)
+{
+	return RyanJsonFindNodeByKeyHash(pJson, key, keyLen, hash, NULL);
+}
+
+/**
+ * @brief 在容器中按索引查找子节点
+ *
+ * @param pJson 父节点（Array 或 Object）
+ * @param index 子节点索引（Object 场景为插入顺序）
+ * @param prevOut 输出前驱节点（越界时为尾节点，供插入使用），可为 NULL
+ * @return RyanJson_t 命中节点，越界返回 NULL
+ */
+static RyanJson_t RyanJsonFindNodeByIndex(RyanJson_t pJson, uint32_t index, RyanJson_t *prevOut)
+{
+	RyanJsonCheckAssert(NULL != pJson);
+
+	RyanJson_t prev = NULL;
+	RyanJson_t nextItem = NULL;
+
+#if true == RyanJsonArrayIndex
+	// 已建立指针表：按下标直接定位
+	if (RyanJsonTrue == RyanJsonInternalArrayIndexFind(pJson, index, &nextItem, &prev))
+	{
+		if (prevOut) { *prevOut = prev; }
+		return nextItem;
+	}
+	uint32_t walked = 0;
+#endif
+
+	nextItem = RyanJsonGetObjectValue(pJson);
+	while (NULL != nextItem && index > 0)
+	{
 		prev = nextItem;
 		nextItem = RyanJsonGetNext(nextItem);
+		index--;
+#if true == RyanJsonArrayIndex
+		walked++;
+#endif
 	}
 
-	return NULL;
+#if true == RyanJsonArrayIndex
+	// 单次遍历已足够长，为后续访问建立指针表（失败不影响本次结果）
+	if (walked >= RyanJsonArrayIndexMinSize && _checkType(pJson, RyanJsonTypeArray)) { RyanJsonInternalArrayIndexBuild(pJson); }
+#endif
+
+	if (prevOut) { *prevOut = prev; }
+	return nextItem;
 }
 
 /**
@@ -74,6 +159,8 @@ static RyanJsonBool_e RyanJsonReplaceNode(RyanJson_t prev, RyanJson_t oldItem, R
  */
 static RyanJsonBool_e RyanJsonObjectHasKeyConflict(RyanJson_t pJson, const char *key, RyanJson_t skipItem)
 {
+	uint32_t keyLen = (uint32_t)RyanJsonStrlen(key);
+	uint32_t hash = RyanJsonInternalKeyHash(key, keyLen);
 	RyanJson_t item = RyanJsonGetObjectValue(pJson);
 	while (NULL != item)
 	{
@@ -81,7 +168,7 @@ static RyanJsonBool_e RyanJsonObjectHasKeyConflict(RyanJson_t pJson, const char
 		{
 			// Object 节点理论上必须带 key，容错处理避免 Release 模式下异常访问
 			RyanJsonCheckAssert(RyanJsonTrue == RyanJsonIsKey(item));
-			if (RyanJsonTrue == RyanJsonInternalStrEq(RyanJsonGetKey(item), key)) { return RyanJsonTrue; }
+			if (RyanJsonTrue == RyanJsonInternalKeyEq(item, key, keyLen, hash)) { return RyanJsonTrue; }
 		}
 		item = RyanJsonGetNext(item);
 	}
@@ -97,7 +184,7 @@ static RyanJson_t RyanJsonCreateItem(const char *key, RyanJson_t item)
 {
 	RyanJsonCheckAssert(NULL != item);
 
-	RyanjsonType_e type = RyanJsonGetType(item);
+	RyanjsonType_e type = RyanJsonGetPayloadTypeByFlag(item);
 	RyanJsonNodeInfo_t nodeInfo = {
 		.type = (RyanJsonTypeArray == type) ? RyanJsonTypeArray : RyanJsonTypeObject,
 		.key = key,
@@ -108,10 +195,18 @@ static RyanJson_t RyanJsonCreateItem(const char *key, RyanJson_t item)
 
 	if (RyanJsonTypeArray == type || RyanJsonTypeObject == type)
 	{
-		// 转移子节点所有权
-		RyanJson_t children = RyanJsonGetObjectValue(item);
-		RyanJsonInternalChangeObjectValue(newItem, children);
-		RyanJsonInternalChangeObjectValue(item, NULL);
+		RyanJson_t children = NULL;
+#if true == RyanJsonPackedArray
+		// 紧凑数组直接转移数据块，无需展开
+		if (RyanJsonInternalIsPackedArray(item)) { RyanJsonInternalPackedMove(newItem, item); }
+		else
+#endif
+		{
+			// 转移子节点所有权
+			children = RyanJsonGetObjectValue(item);
+			RyanJsonInternalChangeObjectValue(newItem, children);
+			RyanJsonInternalChangeObjectValue(item, NULL);
+		}
 
 		// 更新线索化链表：最后一个子节点的 next 指向新父节点 (newItem)
 		if (children)
@@ -183,6 +278,30 @@ RyanJson_t RyanJsonCreateString(const char *key, const char *string)
 	RyanJsonNodeInfo_t nodeInfo = {.type = RyanJsonTypeString, .key = key, .strValue = string};
 	return RyanJsonInternalNewNode(&nodeInfo);
 }
+
+/**
+ * @brief 创建 String 节点（strValue 长度与转义信息由调用方给出）
+ *
+ * @param key key，可为 NULL
+ * @param string strValue
+ * @param len strValue 字节长度（不含 '\0'）
+ * @param isClean 调用方已确认 strValue 无需转义
+ * @return RyanJson_t String 节点
+ * @note 供解析路径复用已知信息，避免重复 strlen 与转义扫描。
+ */
+RyanJsonInternalApi RyanJson_t RyanJsonInternalCreateStringWithLen(const char *key, const char *string, uint32_t len,
+								  RyanJsonBool_e isClean)
+{
+	RyanJsonCheckReturnNull(NULL != string);
+
+	RyanJsonNodeInfo_t nodeInfo = {.type = RyanJsonTypeString,
+				       .key = key,
+				       .strValue = string,
+				       .strValueLen = len,
+				       .hasStrValueLen = RyanJsonTrue,
+				       .strValueIsClean = isClean};
+	return RyanJsonInternalNewNode(&nodeInfo);
+}
 RyanJsonInternalApi RyanJson_t RyanJsonInternalCreateObjectAndKey(const char *key)
 {
 	RyanJsonNodeInfo_t nodeInfo = {.type = RyanJsonTypeObject, .key = key};
@@ -202,6 +321,154 @@ RyanJson_t RyanJsonCreateArray(void)
 	return RyanJsonInternalCreateArrayAndKey(NULL);
 }
 
+/**
+ * @brief 创建 Blob 节点
+ *
+ * @param key key，可为 NULL
+ * @param data 数据，len 为 0 时可为 NULL
+ * @param len 数据字节数
+ * @return RyanJson_t Blob 节点，失败返回 NULL
+ * @note 数据会被拷贝进节点，输入指针不会被保存。
+ */
+RyanJson_t RyanJsonCreateBlob(const char *key, const void *data, uint32_t len)
+{
+	RyanJsonCheckReturnNull(NULL != data || 0 == len);
+
+	RyanJsonNodeInfo_t nodeInfo = {.type = RyanJsonTypeBlob, .key = key};
+	RyanJson_t item = RyanJsonInternalNewNode(&nodeInfo);
+	RyanJsonCheckReturnNull(NULL != item);
+
+	RyanJsonCheckCode(RyanJsonTrue == RyanJsonChangeBlobValue(item, data, len), {
+		RyanJsonDelete(item);
+		return NULL;
+	});
+	return item;
+}
+
+/**
+ * @brief 创建 Raw 节点（原始 Json 文本）
+ *
+ * @param key key，可为 NULL
+ * @param text Json 文本，无需 '\0' 结尾
+ * @param len 文本字节长度
+ * @return RyanJson_t Raw 节点，文本不是单个合法 Json 值或内存不足时返回 NULL
+ * @note 只校验不建树；首尾空白不保存，其余内容原样拷贝进节点，打印时原样输出。
+ */
+RyanJson_t RyanJsonCreateRaw(const char *key, const char *text, uint32_t len)
+{
+	RyanJsonCheckReturnNull(NULL != text);
+
+	uint32_t start = 0;
+	uint32_t valueLen = 0;
+	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonInternalValidateValue(text, len, &start, &valueLen));
+
+	// Raw 原样输出，不需要转义扫描
+	RyanJsonNodeInfo_t nodeInfo = {.type = RyanJsonTypeBlob,
+				       .key = key,
+				       .strValue = text + start,
+				       .strValueLen = valueLen,
+				       .hasStrValueLen = RyanJsonTrue,
+				       .strValueIsClean = RyanJsonTrue};
+	RyanJson_t item = RyanJsonInternalNewNode(&nodeInfo);
+	RyanJsonCheckReturnNull(NULL != item);
+
+	RyanJsonSetPayloadIsRawByFlag(item, RyanJsonTrue);
+	return item;
+}
+
+/**
+ * @brief 创建懒数值节点：按 Double 分配，值区写入标记，源文本拷贝到值区之后
+ * @note 调用方需保证 text 为已校验的 Number 文本（语法与范围）。
+ */
+RyanJsonInternalApi RyanJson_t RyanJsonInternalCreateLazyNumber(const char *key, const char *text, uint32_t len)
+{
+	// 源文本及 '\0'，节点整块清零后无需另写结尾
+	RyanJsonNodeInfo_t nodeInfo = {.type = RyanJsonTypeNumber, .key = key, .numberIsDoubleFlag = RyanJsonTrue, .extraSize = len + 1U};
+	RyanJson_t item = RyanJsonInternalNewNode(&nodeInfo);
+	RyanJsonCheckReturnNull(NULL != item);
+
+	uint64_t tag = RyanJsonLazyNumberTag;
+	RyanJsonMemcpy(RyanJsonInternalGetValue(item), &tag, sizeof(tag));
+	RyanJsonMemcpy(RyanJsonInternalGetLazyNumberText(item), text, len);
+	return item;
+}
+
+/**
+ * @brief 判断 Double 节点的值区是否为懒数值标记
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalHasLazyNumberTag(RyanJson_t pJson)
+{
+	uint64_t bits;
+	RyanJsonMemcpy(&bits, RyanJsonInternalGetValue(pJson), sizeof(bits));
+	return RyanJsonMakeBool(RyanJsonLazyNumberTag == bits);
+}
+
+/**
+ * @brief 解析懒数值源文本，不修改节点
+ *
+ * @param pJson 懒数值节点
+ * @param numberPtr 输出数值
+ * @return RyanJsonBool_e 是否按 Int 处理，与解析时一致：整数写法且在 int32 范围内为 Int，否则为 Double
+ * @note 源文本解析时已校验语法与范围，这里不会失败，也不申请内存。
+ */
+static RyanJsonBool_e RyanJsonLazyNumberParse(RyanJson_t pJson, double *numberPtr)
+{
+	const char *text = RyanJsonInternalGetLazyNumberText(pJson);
+	RyanJsonBool_e isInt = RyanJsonFalse;
+	RyanJsonAssertAlwaysEval(RyanJsonTrue == RyanJsonInternalParseDoubleRaw((const uint8_t *)text, (uint32_t)RyanJsonStrlen(text),
+										numberPtr, &isInt));
+	return RyanJsonMakeBool(RyanJsonTrue == isInt && *numberPtr >= INT32_MIN && *numberPtr <= INT32_MAX);
+}
+
+/**
+ * @brief 懒数值原地转换为普通 Int/Double，仅由取值接口调用
+ */
+static void RyanJsonLazyNumberConvert(RyanJson_t pJson)
+{
+	double number = 0;
+	if (RyanJsonLazyNumberParse(pJson, &number))
+	{
+		int32_t intValue = (int32_t)number;
+		RyanJsonSetPayloadNumberIsDoubleByFlag(pJson, RyanJsonFalse);
+		RyanJsonMemcpy(RyanJsonInternalGetValue(pJson), &intValue, sizeof(intValue));
+	}
+	else
+	{
+		RyanJsonMemcpy(RyanJsonInternalGetValue(pJson), &number, sizeof(number));
+	}
+}
+
+/**
+ * @brief 只读取 Number 节点的数值，懒数值在局部解析、节点保持不变（比较、哈希、编码等只读路径使用）
+ *
+ * @param pJson Number 节点
+ * @param isIntPtr 输出是否为 Int，可为 NULL
+ * @return double 数值，Int 节点转换为 double（int32 可精确表示）
+ */
+RyanJsonInternalApi double RyanJsonInternalGetNumber(RyanJson_t pJson, RyanJsonBool_e *isIntPtr)
+{
+	RyanJsonCheckAssert(NULL != pJson);
+
+	double number;
+	RyanJsonBool_e isInt;
+	if (RyanJsonInternalIsLazyNumber(pJson)) { isInt = RyanJsonLazyNumberParse(pJson, &number); }
+	else if (RyanJsonGetPayloadNumberIsDoubleByFlag(pJson))
+	{
+		isInt = RyanJsonFalse;
+		RyanJsonMemcpy(&number, RyanJsonInternalGetValue(pJson), sizeof(number));
+	}
+	else
+	{
+		int32_t intValue;
+		RyanJsonMemcpy(&intValue, RyanJsonInternalGetValue(pJson), sizeof(intValue));
+		isInt = RyanJsonTrue;
+		number = intValue;
+	}
+
+	if (NULL != isIntPtr) { *isIntPtr = isInt; }
+	return number;
+}
+
 /**
  * @brief 类型/属性判断接口（语义直观，统一说明）
  *
@@ -238,11 +505,25 @@ RyanJsonBool_e RyanJsonIsObject(RyanJson_t pJson)
 }
 RyanJsonBool_e RyanJsonIsInt(RyanJson_t pJson)
 {
-	return RyanJsonMakeBool(RyanJsonIsNumber(pJson) && (RyanJsonFalse == RyanJsonGetPayloadNumberIsDoubleByFlag(pJson)));
+	if (RyanJsonFalse == RyanJsonIsNumber(pJson)) { return RyanJsonFalse; }
+	RyanJsonBool_e isInt;
+	(void)RyanJsonInternalGetNumber(pJson, &isInt);
+	return isInt;
 }
 RyanJsonBool_e RyanJsonIsDouble(RyanJson_t pJson)
 {
-	return RyanJsonMakeBool(RyanJsonIsNumber(pJson) && (RyanJsonTrue == RyanJsonGetPayloadNumberIsDoubleByFlag(pJson)));
+	if (RyanJsonFalse == RyanJsonIsNumber(pJson)) { return RyanJsonFalse; }
+	RyanJsonBool_e isInt;
+	(void)RyanJsonInternalGetNumber(pJson, &isInt);
+	return RyanJsonMakeBool(!isInt);
+}
+RyanJsonBool_e RyanJsonIsBlob(RyanJson_t pJson)
+{
+	return RyanJsonMakeBool(NULL != pJson && RyanJsonTypeBlob == RyanJsonGetType(pJson));
+}
+RyanJsonBool_e RyanJsonIsRaw(RyanJson_t pJson)
+{
+	return RyanJsonMakeBool(NULL != pJson && RyanJsonInternalIsRaw(pJson));
 }
 
 /**
@@ -250,12 +531,17 @@ RyanJsonBool_e RyanJsonIsDouble(RyanJson_t pJson)
  *
  * @param item 待检查节点
  * @return RyanJsonBool_e 是否为游离节点
+ * @note 启用 RyanJsonSnapshotShare 时快照根节点不算游离节点。
  */
 RyanJsonBool_e RyanJsonIsDetachedItem(RyanJson_t item)
 {
 	RyanJsonCheckReturnFalse(NULL != item);
 	RyanJsonCheckReturnFalse(NULL == item->next);
 	RyanJsonCheckReturnFalse(!RyanJsonGetPayloadIsLastByFlag(item));
+#if true == RyanJsonSnapshotShare
+	// 快照只读且由引用计数管理，不能挂到其他容器
+	RyanJsonCheckReturnFalse(RyanJsonFalse == RyanJsonInternalIsSnapshot(item));
+#endif
 	return RyanJsonTrue;
 }
 
@@ -291,6 +577,19 @@ char *RyanJsonGetStringValue(RyanJson_t pJson)
 {
 	RyanJsonCheckAssert(NULL != pJson);
 
+	// 懒字符串首次读取时原地解码，返回地址不变
+	if (RyanJsonInternalIsLazyString(pJson)) { RyanJsonInternalUnescapeLazyString(pJson); }
+	return RyanJsonInternalGetStrValue(pJson);
+}
+
+/**
+ * @brief 获取 strValue 存储地址（String/Blob/Raw 共用）
+ * @note 不触发懒字符串解码，返回的可能是转义源文本。
+ */
+RyanJsonInternalApi char *RyanJsonInternalGetStrValue(RyanJson_t pJson)
+{
+	RyanJsonCheckAssert(NULL != pJson);
+
 	uint32_t len = 0;
 
 	if (RyanJsonFalse == RyanJsonGetPayloadStrIsPtrByFlag(pJson))
@@ -307,6 +606,42 @@ char *RyanJsonGetStringValue(RyanJson_t pJson)
 
 	return (char *)RyanJsonInternalGetStrPtrModeBufAt(pJson, len);
 }
+
+/**
+ * @brief 获取 key 字节长度
+ *
+ * @param pJson 目标节点
+ * @return uint32_t key 字节长度（不含 '\0'），无 key 或 pJson 为 NULL 时返回 0
+ * @note 直接读取 keyLenField，O(1)。
+ */
+uint32_t RyanJsonGetKeyLength(RyanJson_t pJson)
+{
+	if (RyanJsonFalse == RyanJsonIsKey(pJson)) { return 0; }
+	return RyanJsonInternalGetKeyLen(pJson);
+}
+
+/**
+ * @brief 获取 String 节点 strValue 字节长度
+ *
+ * @param pJson String 节点
+ * @return uint32_t strValue 字节长度（不含 '\0'），非 String 或 pJson 为 NULL 时返回 0
+ * @note ptr 模式读取节点内缓存的长度，O(1)；inline 模式字符串不超过内联区，计算代价可忽略。
+ *       未解码的懒字符串逐字节计算解码后的长度，O(n)，节点保持不变。
+ */
+uint32_t RyanJsonGetStringLength(RyanJson_t pJson)
+{
+	if (RyanJsonFalse == RyanJsonIsString(pJson)) { return 0; }
+
+	uint32_t len = 0;
+	// 懒字符串流式计算解码后的长度，节点保持不变
+	if (RyanJsonInternalIsLazyString(pJson))
+	{
+		(void)RyanJsonInternalUnescapedHash(RyanJsonInternalGetStrValue(pJson), &len);
+		return len;
+	}
+	RyanJsonInternalGetStrValueInfo(pJson, &len);
+	return len;
+}
 RyanJsonBool_e RyanJsonGetBoolValue(RyanJson_t pJson)
 {
 	RyanJsonCheckAssert(NULL != pJson);
@@ -316,6 +651,8 @@ int32_t RyanJsonGetIntValue(RyanJson_t pJson)
 {
 	RyanJsonCheckAssert(NULL != pJson);
 
+	if (RyanJsonInternalIsLazyNumber(pJson)) { RyanJsonLazyNumberConvert(pJson); }
+
 	int32_t intValue;
 	RyanJsonMemcpy(&intValue, RyanJsonInternalGetValue(pJson), sizeof(intValue));
 	return intValue;
@@ -324,6 +661,8 @@ double RyanJsonGetDoubleValue(RyanJson_t pJson)
 {
 	RyanJsonCheckAssert(NULL != pJson);
 
+	if (RyanJsonInternalIsLazyNumber(pJson)) { RyanJsonLazyNumberConvert(pJson); }
+
 	double doubleValue;
 	RyanJsonMemcpy(&doubleValue, RyanJsonInternalGetValue(pJson), sizeof(doubleValue));
 	return doubleValue;
@@ -332,6 +671,11 @@ RyanJson_t RyanJsonGetObjectValue(RyanJson_t pJson)
 {
 	RyanJsonCheckAssert(NULL != pJson);
 
+#if true == RyanJsonPackedArray
+	// 紧凑数组按需展开为子节点链表，展开失败时视为无子节点
+	if (RyanJsonInternalIsPackedArray(pJson)) { RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonInternalPackedExpand(pJson)); }
+#endif
+
 	RyanJson_t objValue;
 	RyanJsonMemcpy((void *)&objValue, RyanJsonInternalGetValue(pJson), sizeof(void *));
 	return objValue;
@@ -341,13 +685,72 @@ RyanJson_t RyanJsonGetArrayValue(RyanJson_t pJson)
 	return RyanJsonGetObjectValue(pJson);
 }
 
+/**
+ * @brief 获取 Blob 节点数据
+ *
+ * @param pJson Blob 节点
+ * @param len 输出数据字节数
+ * @return const uint8_t* 数据首地址，非 Blob 节点返回 NULL（len 置 0）
+ * @note 返回内部存储指针，节点修改/释放后即失效；启用驻留时复制出的节点可能共享同一块数据，不能原地改写。
+ */
+const uint8_t *RyanJsonGetBlobValue(RyanJson_t pJson, uint32_t *len)
+{
+	RyanJsonCheckReturnNull(NULL != len);
+	*len = 0;
+	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonIsBlob(pJson));
+
+	// 长度字段紧跟 key 之后，与 String 节点 strValue 的位置相同
+	const uint8_t *buf = (const uint8_t *)RyanJsonGetStringValue(pJson);
+	uint32_t value = 0;
+	for (uint8_t i = 0; i < RyanJsonBlobLenSize; i++)
+	{
+		value |= ((uint32_t)buf[i]) << (i * 8U);
+	}
+	*len = value;
+	return buf + RyanJsonBlobLenSize;
+}
+
+/**
+ * @brief 获取 Raw 节点的 Json 文本
+ *
+ * @param pJson Raw 节点
+ * @param len 输出文本字节数（不含 '\0'），可为 NULL
+ * @return const char* '\0' 结尾的文本，非 Raw 节点返回 NULL（len 置 0）
+ * @note 返回内部存储指针，节点修改/释放后即失效；需要访问内部结构时可交给 RyanJsonParseOptions 按需解析。
+ */
+const char *RyanJsonGetRawValue(RyanJson_t pJson, uint32_t *len)
+{
+	if (NULL != len) { *len = 0; }
+	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonIsRaw(pJson));
+
+	if (NULL != len) { (void)RyanJsonInternalGetStrValueInfo(pJson, len); }
+	return RyanJsonGetStringValue(pJson);
+}
+
+/**
+ * @brief 按给定 key 与数据重建 Blob 节点的缓冲
+ *
+ * @note key/data 可以指向节点当前的缓冲，新缓冲写好后才释放旧缓冲。
+ */
+static RyanJsonBool_e RyanJsonRebuildBlob(RyanJson_t pJson, const char *key, const void *data, uint32_t len)
+{
+	uint32_t keyLen = (NULL != key) ? (uint32_t)RyanJsonStrlen(key) : 0U;
+	uint8_t *dst = NULL;
+	uint8_t *buf = RyanJsonInternalNewBlobBuf(key, keyLen, len, &dst);
+	RyanJsonCheckReturnFalse(NULL != buf);
+
+	if (0 != len) { RyanJsonMemcpy(dst, data, len); }
+	RyanJsonInternalSetBlobBuf(pJson, buf, RyanJsonMakeBool(NULL != key), keyLen);
+	return RyanJsonTrue;
+}
+
 /**
  * @brief 公共值修改接口（语义直观，统一说明）
  *
  * 约定：
  * - 公共 Change 接口会做基础参数/类型校验，失败返回 RyanJsonFalse
  * - Number/Bool 修改为原位写入
- * - key/String 修改会触发字符串存储布局更新
+ * - key/String/Blob 修改会触发字符串存储布局更新
  */
 RyanJsonBool_e RyanJsonChangeKey(RyanJson_t pJson, const char *key)
 {
@@ -366,7 +769,50 @@ RyanJsonBool_e RyanJsonChangeKey(RyanJson_t pJson, const char *key)
 	}
 #endif
 
-	return RyanJsonInternalChangeString(pJson, RyanJsonFalse, key, RyanJsonIsString(pJson) ? RyanJsonGetStringValue(pJson) : NULL);
+#if true == RyanJsonSnapshotShare
+	RyanJsonCheckReturnFalse(RyanJsonFalse == RyanJsonInternalIsSnapshot(pJson));
+#endif
+	// key 属于父容器的序列化内容
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalMarkDirty(RyanJsonInternalGetParent(pJson)));
+#if true == RyanJsonSnapshotShare
+	// 快照根节点保留了取快照时的 key
+	if (_checkType(pJson, RyanJsonTypeArray) || _checkType(pJson, RyanJsonTypeObject)) { RyanJsonInternalDropSnapshotLink(pJson); }
+#endif
+#if true == RyanJsonDeltaTracking
+	// 旧 key 记为删除，节点以新 key 整体输出
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalDeltaRecord(RyanJsonInternalGetParent(pJson), pJson, pJson, key));
+#endif
+
+#if true == RyanJsonObjectHashIndex
+	// 索引按 key 定位槽位：改 key 前移除，改完（无论成败）按当前 key 重新登记
+	RyanJson_t indexParent = RyanJsonInternalGetParent(pJson);
+	RyanJsonInternalKeyIndexRemove(indexParent, pJson);
+#endif
+
+	RyanJsonBool_e result;
+	if (RyanJsonTrue == RyanJsonIsBlob(pJson))
+	{
+		uint32_t len;
+		const uint8_t *data = RyanJsonGetBlobValue(pJson, &len);
+		result = RyanJsonRebuildBlob(pJson, key, data, len);
+	}
+	else if (RyanJsonFalse == RyanJsonIsString(pJson) && RyanJsonFalse == RyanJsonIsRaw(pJson))
+	{
+		result = RyanJsonInternalChangeString(pJson, RyanJsonFalse, key, NULL);
+	}
+	else
+	{
+		// strValue（Raw 为文本）不变，沿用已知的长度与转义信息；懒字符串保持未解码
+		uint32_t strValueLen = 0;
+		RyanJsonBool_e strValueIsClean = RyanJsonInternalGetStrValueInfo(pJson, &strValueLen);
+		result = RyanJsonInternalChangeStringWithLen(pJson, RyanJsonFalse, key, RyanJsonInternalGetStrValue(pJson), strValueLen,
+							     strValueIsClean);
+	}
+
+#if true == RyanJsonObjectHashIndex
+	RyanJsonInternalKeyIndexAdd(indexParent, pJson);
+#endif
+	return result;
 }
 
 /**
@@ -380,12 +826,26 @@ RyanJsonBool_e RyanJsonChangeStringValue(RyanJson_t pJson, const char *strValue)
 {
 	RyanJsonCheckReturnFalse(NULL != pJson && NULL != strValue);
 	RyanJsonCheckReturnFalse(RyanJsonIsString(pJson));
-	return RyanJsonInternalChangeString(pJson, RyanJsonFalse, RyanJsonIsKey(pJson) ? RyanJsonGetKey(pJson) : NULL, strValue);
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalMarkDirty(pJson));
+#if true == RyanJsonDeltaTracking
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalDeltaRecord(RyanJsonInternalGetParent(pJson), NULL, pJson, NULL));
+#endif
+	RyanJsonBool_e result =
+		RyanJsonInternalChangeString(pJson, RyanJsonFalse, RyanJsonIsKey(pJson) ? RyanJsonGetKey(pJson) : NULL, strValue);
+	// 新值为解码后的文本，不再是懒字符串
+	if (RyanJsonTrue == result) { RyanJsonSetPayloadStrIsEscapedByFlag(pJson, RyanJsonFalse); }
+	return result;
 }
 RyanJsonBool_e RyanJsonChangeIntValue(RyanJson_t pJson, int32_t number)
 {
 	RyanJsonCheckReturnFalse(NULL != pJson);
 	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonIsInt(pJson));
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalMarkDirty(pJson));
+#if true == RyanJsonDeltaTracking
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalDeltaRecord(RyanJsonInternalGetParent(pJson), NULL, pJson, NULL));
+#endif
+	// Int 写法的懒数值按 Double 大小分配，清除标志后即为普通 Int 节点
+	RyanJsonSetPayloadNumberIsDoubleByFlag(pJson, RyanJsonFalse);
 	RyanJsonMemcpy(RyanJsonInternalGetValue(pJson), &number, sizeof(number));
 	return RyanJsonTrue;
 }
@@ -393,6 +853,12 @@ RyanJsonBool_e RyanJsonChangeDoubleValue(RyanJson_t pJson, double number)
 {
 	RyanJsonCheckReturnFalse(NULL != pJson);
 	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonIsDouble(pJson));
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalMarkDirty(pJson));
+#if true == RyanJsonDeltaTracking
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalDeltaRecord(RyanJsonInternalGetParent(pJson), NULL, pJson, NULL));
+#endif
+	// NaN 统一写成 NAN，避免与懒数值标记同位型
+	if (isnan(number)) { number = NAN; }
 	RyanJsonMemcpy(RyanJsonInternalGetValue(pJson), &number, sizeof(number));
 	return RyanJsonTrue;
 }
@@ -400,9 +866,57 @@ RyanJsonBool_e RyanJsonChangeBoolValue(RyanJson_t pJson, RyanJsonBool_e boolean)
 {
 	RyanJsonCheckReturnFalse(NULL != pJson);
 	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonIsBool(pJson));
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalMarkDirty(pJson));
+#if true == RyanJsonDeltaTracking
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalDeltaRecord(RyanJsonInternalGetParent(pJson), NULL, pJson, NULL));
+#endif
 	RyanJsonSetPayloadBoolValueByFlag(pJson, boolean);
 	return RyanJsonTrue;
 }
+RyanJsonBool_e RyanJsonChangeBlobValue(RyanJson_t pJson, const void *data, uint32_t len)
+{
+	RyanJsonCheckReturnFalse(NULL != pJson && (NULL != data || 0 == len));
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonIsBlob(pJson));
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalMarkDirty(pJson));
+#if true == RyanJsonDeltaTracking
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalDeltaRecord(RyanJsonInternalGetParent(pJson), NULL, pJson, NULL));
+#endif
+	return RyanJsonRebuildBlob(pJson, RyanJsonIsKey(pJson) ? RyanJsonGetKey(pJson) : NULL, data, len);
+}
+
+/**
+ * @brief 将 base64 String 节点原地转换为 Blob 节点
+ *
+ * @param pJson String 节点
+ * @return RyanJsonBool_e 转换是否成功；非 String、非规范 base64 或内存不足时返回 false 且节点不变
+ * @note 直接解码到最终缓冲，不经过临时缓冲；转换完成后释放原字符串缓冲。
+ * @note 序列化结果不变，因此不记录增量；类型改变会影响比较与哈希，仍需使容器缓存失效。
+ */
+RyanJsonBool_e RyanJsonDecodeBase64(RyanJson_t pJson)
+{
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonIsString(pJson));
+
+	const char *text = RyanJsonGetStringValue(pJson);
+	uint32_t textLen = 0;
+	(void)RyanJsonInternalGetStrValueInfo(pJson, &textLen);
+
+	uint32_t len = 0;
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalBase64DecodedLen(text, textLen, &len));
+
+	RyanJsonBool_e isKey = RyanJsonIsKey(pJson);
+	uint32_t keyLen = isKey ? RyanJsonInternalGetKeyLen(pJson) : 0U;
+	uint8_t *dst = NULL;
+	uint8_t *buf = RyanJsonInternalNewBlobBuf(isKey ? RyanJsonGetKey(pJson) : NULL, keyLen, len, &dst);
+	RyanJsonCheckReturnFalse(NULL != buf);
+	RyanJsonCheckCode(RyanJsonTrue == RyanJsonInternalBase64Decode(text, textLen, dst), {
+		RyanJsonInternalFreeStrBuf(buf);
+		return RyanJsonFalse;
+	});
+
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalMarkDirty(pJson));
+	RyanJsonInternalSetBlobBuf(pJson, buf, isKey, keyLen);
+	return RyanJsonTrue;
+}
 
 /**
  * @brief 设置容器节点的首子节点指针（内部接口）
@@ -436,7 +950,7 @@ RyanJsonBool_e RyanJsonAddItemToObject(RyanJson_t pJson, const char *key, RyanJs
 	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonIsDetachedItem(item));
 
 	// AddItem 仅支持容器类型（Array/Object），标量请使用 AddInt/AddString 等接口
-	RyanjsonType_e type = RyanJsonGetType(item);
+	RyanjsonType_e type = RyanJsonGetPayloadTypeByFlag(item);
 	if (RyanJsonTypeArray != type && RyanJsonTypeObject != type)
 	{
 		RyanJsonDelete(item);
@@ -469,19 +983,11 @@ RyanJsonBool_e RyanJsonReplaceByIndex(RyanJson_t pJson, uint32_t index, RyanJson
 	RyanJsonCheckReturnFalse(_checkType(pJson, RyanJsonTypeArray) || _checkType(pJson, RyanJsonTypeObject));
 	if (_checkType(pJson, RyanJsonTypeObject)) { RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonIsKey(item)); }
 
+	// 定位目标索引节点
 	RyanJson_t prev = NULL;
-	RyanJson_t nextItem = RyanJsonGetObjectValue(pJson);
+	RyanJson_t nextItem = RyanJsonFindNodeByIndex(pJson, index, &prev);
 	RyanJsonCheckReturnFalse(NULL != nextItem);
 
-	// 定位目标索引节点
-	while (index > 0)
-	{
-		prev = nextItem;
-		nextItem = RyanJsonGetNext(nextItem);
-		index--;
-		RyanJsonCheckReturnFalse(NULL != nextItem);
-	}
-
 	// 严格模式下：Object 不允许替换成重复 key
 #if true == RyanJsonStrictObjectKeyCheck
 	if (_checkType(pJson, RyanJsonTypeObject))
@@ -490,8 +996,19 @@ RyanJsonBool_e RyanJsonReplaceByIndex(RyanJson_t pJson, uint32_t index, RyanJson
 	}
 #endif
 
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalMarkDirty(pJson));
+#if true == RyanJsonDeltaTracking
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalDeltaRecord(pJson, nextItem, item, NULL));
+#endif
 	RyanJsonReplaceNode(prev, nextItem, item);
 	if (NULL == prev) { RyanJsonInternalChangeObjectValue(pJson, item); }
+#if true == RyanJsonObjectHashIndex
+	RyanJsonInternalKeyIndexRemove(pJson, nextItem);
+	RyanJsonInternalKeyIndexAdd(pJson, item);
+#endif
+#if true == RyanJsonArrayIndex
+	RyanJsonInternalArrayIndexReplace(pJson, index, item);
+#endif
 
 	RyanJsonDelete(nextItem);
 	return RyanJsonTrue;
@@ -513,7 +1030,7 @@ RyanJsonBool_e RyanJsonReplaceByKey(RyanJson_t pJson, const char *key, RyanJson_
 	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonIsDetachedItem(item));
 
 	RyanJson_t prev = NULL;
-	RyanJson_t nextItem = RyanJsonFindNodeByKey(pJson, key, &prev);
+	RyanJson_t nextItem = RyanJsonFindNodeByKey(pJson, key, (uint32_t)RyanJsonStrlen(key), &prev);
 	RyanJsonCheckReturnFalse(NULL != nextItem);
 
 	// 若传入节点没有 key，则构造一个带 key 的包装节点
@@ -530,8 +1047,16 @@ RyanJsonBool_e RyanJsonReplaceByKey(RyanJson_t pJson, const char *key, RyanJson_
 		}
 	}
 
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalMarkDirty(pJson));
+#if true == RyanJsonDeltaTracking
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalDeltaRecord(pJson, nextItem, item, NULL));
+#endif
 	RyanJsonReplaceNode(prev, nextItem, item);
 	if (NULL == prev) { RyanJsonInternalChangeObjectValue(pJson, item); }
+#if true == RyanJsonObjectHashIndex
+	RyanJsonInternalKeyIndexRemove(pJson, nextItem);
+	RyanJsonInternalKeyIndexAdd(pJson, item);
+#endif
 
 	RyanJsonDelete(nextItem);
 
@@ -551,17 +1076,7 @@ RyanJson_t RyanJsonGetObjectByIndex(RyanJson_t pJson, uint32_t index)
 	RyanJsonCheckReturnNull(NULL != pJson);
 
 	RyanJsonCheckReturnNull(_checkType(pJson, RyanJsonTypeArray) || _checkType(pJson, RyanJsonTypeObject));
-
-	RyanJson_t nextItem = RyanJsonGetObjectValue(pJson);
-	RyanJsonCheckReturnNull(NULL != nextItem);
-	while (index > 0)
-	{
-		index--;
-		nextItem = RyanJsonGetNext(nextItem);
-		RyanJsonCheckReturnNull(NULL != nextItem);
-	}
-
-	return nextItem;
+	return RyanJsonFindNodeByIndex(pJson, index, NULL);
 }
 
 /**
@@ -574,7 +1089,21 @@ RyanJson_t RyanJsonGetObjectByIndex(RyanJson_t pJson, uint32_t index)
 RyanJson_t RyanJsonGetObjectByKey(RyanJson_t pJson, const char *key)
 {
 	RyanJsonCheckReturnNull(NULL != pJson && NULL != key);
-	return RyanJsonFindNodeByKey(pJson, key, NULL);
+	return RyanJsonFindNodeByKey(pJson, key, (uint32_t)RyanJsonStrlen(key), NULL);
+}
+
+/**
+ * @brief 按指定长度的 key 获取 Object 子节点
+ *
+ * @param pJson Object 节点
+ * @param key 目标 key，无需 '\0' 结尾（如借用自输入缓冲的片段）
+ * @param keyLen 目标 key 字节长度
+ * @return RyanJson_t 命中节点，失败返回 NULL
+ */
+RyanJson_t RyanJsonGetObjectByKeyLen(RyanJson_t pJson, const char *key, uint32_t keyLen)
+{
+	RyanJsonCheckReturnNull(NULL != pJson && (NULL != key || 0 == keyLen));
+	return RyanJsonFindNodeByKey(pJson, (NULL != key) ? key : "", keyLen, NULL);
 }
 
 /**
@@ -592,16 +1121,19 @@ RyanJson_t RyanJsonDetachByIndex(RyanJson_t pJson, uint32_t index)
 	RyanJsonCheckReturnNull(_checkType(pJson, RyanJsonTypeArray) || _checkType(pJson, RyanJsonTypeObject));
 
 	RyanJson_t prev = NULL;
-	RyanJson_t nextItem = RyanJsonGetObjectValue(pJson);
+	RyanJson_t nextItem = RyanJsonFindNodeByIndex(pJson, index, &prev);
 	RyanJsonCheckReturnNull(NULL != nextItem);
 
-	while (index > 0)
-	{
-		prev = nextItem;
-		nextItem = RyanJsonGetNext(nextItem);
-		index--;
-		RyanJsonCheckReturnNull(NULL != nextItem);
-	}
+	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonInternalMarkDirty(pJson));
+#if true == RyanJsonDeltaTracking
+	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonInternalDeltaRecord(pJson, nextItem, NULL, NULL));
+#endif
+#if true == RyanJsonObjectHashIndex
+	RyanJsonInternalKeyIndexRemove(pJson, nextItem);
+#endif
+#if true == RyanJsonArrayIndex
+	RyanJsonInternalArrayIndexRemove(pJson, index);
+#endif
 
 	// 维护线索化链表关系
 	RyanJson_t trueNext = RyanJsonGetNext(nextItem);
@@ -641,9 +1173,17 @@ RyanJson_t RyanJsonDetachByKey(RyanJson_t pJson, const char *key)
 	RyanJsonCheckReturnNull(NULL != pJson && NULL != key);
 
 	RyanJson_t prev = NULL;
-	RyanJson_t nextItem = RyanJsonFindNodeByKey(pJson, key, &prev);
+	RyanJson_t nextItem = RyanJsonFindNodeByKey(pJson, key, (uint32_t)RyanJsonStrlen(key), &prev);
 	RyanJsonCheckReturnNull(NULL != nextItem);
 
+	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonInternalMarkDirty(pJson));
+#if true == RyanJsonDeltaTracking
+	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonInternalDeltaRecord(pJson, nextItem, NULL, NULL));
+#endif
+#if true == RyanJsonObjectHashIndex
+	RyanJsonInternalKeyIndexRemove(pJson, nextItem);
+#endif
+
 	// 维护线索化链表关系
 	RyanJson_t trueNext = RyanJsonGetNext(nextItem);
 
@@ -705,6 +1245,62 @@ RyanJsonBool_e RyanJsonDeleteByKey(RyanJson_t pJson, const char *key)
 	return RyanJsonTrue;
 }
 
+/**
+ * @brief 校验容器与待挂载节点是否匹配
+ * @note Array 接受任意节点，Object 要求 item 携带 key。
+ */
+static RyanJsonBool_e RyanJsonCheckInsertType(RyanJson_t pJson, RyanJson_t item)
+{
+	return RyanJsonMakeBool(_checkType(pJson, RyanJsonTypeArray) || (_checkType(pJson, RyanJsonTypeObject) && RyanJsonIsKey(item)));
+}
+
+/**
+ * @brief 将游离节点链接到 prev 之后（Insert 与 Appender 共用的提交步骤）
+ *
+ * @param pJson 父节点（Array 或 Object）
+ * @param prev 前驱节点，NULL 表示头插
+ * @param pos 插入后 item 的下标（超过元素数表示尾插），用于维护 Array 指针表
+ * @param item 待插入节点（要求游离且类型已校验）
+ * @return RyanJsonBool_e 插入是否成功
+ * @note 失败时会释放 item。
+ */
+static RyanJsonBool_e RyanJsonLinkItemAfter(RyanJson_t pJson, RyanJson_t prev, uint32_t pos, RyanJson_t item)
+{
+	// 严格模式下：Object 从插入入口拒绝重复 key
+#if true == RyanJsonStrictObjectKeyCheck
+	if (_checkType(pJson, RyanJsonTypeObject))
+	{
+		RyanJsonCheckCode(RyanJsonFalse == RyanJsonObjectHasKeyConflict(pJson, RyanJsonGetKey(item), NULL), {
+			RyanJsonDelete(item);
+			return RyanJsonFalse;
+		});
+	}
+#endif
+
+	RyanJsonCheckCode(RyanJsonTrue == RyanJsonInternalMarkDirty(pJson), {
+		RyanJsonDelete(item);
+		return RyanJsonFalse;
+	});
+#if true == RyanJsonDeltaTracking
+	RyanJsonCheckCode(RyanJsonTrue == RyanJsonInternalDeltaRecord(pJson, NULL, item, NULL), {
+		RyanJsonDelete(item);
+		return RyanJsonFalse;
+	});
+#endif
+
+	// prev 为 NULL 表示头插，交给统一链表插入函数处理
+	RyanJsonInternalListInsertAfter(pJson, prev, item);
+#if true == RyanJsonObjectHashIndex
+	RyanJsonInternalKeyIndexAdd(pJson, item);
+#endif
+#if true == RyanJsonArrayIndex
+	RyanJsonInternalArrayIndexInsert(pJson, pos, item);
+#else
+	RyanJsonUnused(pos);
+#endif
+	return RyanJsonTrue;
+}
+
 /**
  * @brief 向容器按索引插入子节点
  *
@@ -714,44 +1310,85 @@ RyanJsonBool_e RyanJsonDeleteByKey(RyanJson_t pJson, const char *key)
  * @return RyanJsonBool_e 插入是否成功
  * @note Object 场景要求 item 携带 key，严格模式下会拒绝重复 key。
  * @note 进入 error__ 分支时会释放 item；若 item 为 NULL 或非游离节点，将直接失败且不释放 item。
+ * @note 尾插需要遍历兄弟链表，批量追加请使用 RyanJsonAppender_t。
  */
 RyanJsonBool_e RyanJsonInsert(RyanJson_t pJson, uint32_t index, RyanJson_t item)
 {
-	RyanJson_t nextItem = NULL;
 	RyanJson_t prev = NULL;
 
 	RyanJsonCheckReturnFalse(NULL != item);
 	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonIsDetachedItem(item));
 	RyanJsonCheckCode(NULL != pJson, { goto error__; });
 
-	RyanJsonCheckCode(_checkType(pJson, RyanJsonTypeArray) || (_checkType(pJson, RyanJsonTypeObject) && RyanJsonIsKey(item)), {
+	RyanJsonCheckCode(RyanJsonTrue == RyanJsonCheckInsertType(pJson, item), {
 		jsonLog("error__ 不是正确类型 %d\r\n", index);
 		goto error__;
 	});
 
-	// 严格模式下：Object 从插入入口拒绝重复 key
-#if true == RyanJsonStrictObjectKeyCheck
-	if (_checkType(pJson, RyanJsonTypeObject))
-	{
-		RyanJsonCheckCode(RyanJsonFalse == RyanJsonObjectHasKeyConflict(pJson, RyanJsonGetKey(item), NULL), { goto error__; });
-	}
+#if true == RyanJsonPackedArray
+	// 紧凑数组先展开；展开失败时不能当作空数组继续插入
+	RyanJsonCheckCode(!RyanJsonInternalIsPackedArray(pJson) || RyanJsonTrue == RyanJsonInternalPackedExpand(pJson), { goto error__; });
 #endif
 
-	nextItem = RyanJsonGetObjectValue(pJson);
-	while (nextItem && index > 0)
-	{
-		prev = nextItem;
-		nextItem = RyanJsonGetNext(nextItem);
-		index--;
-	}
+	// 越界时 prev 停在尾节点，等价尾插
+	(void)RyanJsonFindNodeByIndex(pJson, index, &prev);
+	return RyanJsonLinkItemAfter(pJson, prev, index, item);
 
-	if (NULL != prev) { RyanJsonInternalListInsertAfter(pJson, prev, item); }
-	else
+error__:
+	RyanJsonDelete(item);
+	return RyanJsonFalse;
+}
+
+/**
+ * @brief 初始化尾部追加器
+ *
+ * @param appender 追加器
+ * @param pJson 目标容器（Array 或 Object）
+ * @return RyanJsonBool_e 初始化是否成功
+ * @note 初始化时遍历一次定位尾节点，之后每次追加为 O(1)。
+ */
+RyanJsonBool_e RyanJsonAppenderInit(RyanJsonAppender_t *appender, RyanJson_t pJson)
+{
+	RyanJsonCheckReturnFalse(NULL != appender && NULL != pJson);
+	RyanJsonCheckReturnFalse(_checkType(pJson, RyanJsonTypeArray) || _checkType(pJson, RyanJsonTypeObject));
+#if true == RyanJsonPackedArray
+	RyanJsonCheckReturnFalse(!RyanJsonInternalIsPackedArray(pJson) || RyanJsonTrue == RyanJsonInternalPackedExpand(pJson));
+#endif
+
+	appender->container = pJson;
+	appender->last = NULL;
+	for (RyanJson_t item = RyanJsonGetObjectValue(pJson); NULL != item; item = RyanJsonGetNext(item))
 	{
-		// prev 为 NULL 表示头插，交给统一链表插入函数处理
-		RyanJsonInternalListInsertAfter(pJson, NULL, item);
+		appender->last = item;
 	}
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 通过追加器在容器尾部添加子节点
+ *
+ * @param appender 已初始化的追加器
+ * @param item 待添加节点（要求游离）
+ * @return RyanJsonBool_e 添加是否成功
+ * @note 与 Insert 相同：item 为游离节点时失败会释放 item，Object 场景要求 item 携带 key。
+ * @note 始终尾插，不受 RyanJsonDefaultAddAtHead 影响；严格模式下 Object 仍需 O(N) 检查重复 key。
+ * @note 其他接口改动过容器尾部时会重新定位尾节点；记录的尾节点被释放后追加器不可再用。
+ */
+RyanJsonBool_e RyanJsonAppenderAdd(RyanJsonAppender_t *appender, RyanJson_t item)
+{
+	RyanJsonCheckReturnFalse(NULL != item);
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonIsDetachedItem(item));
+	RyanJsonCheckCode(NULL != appender && NULL != appender->container, { goto error__; });
+	RyanJsonCheckCode(RyanJsonTrue == RyanJsonCheckInsertType(appender->container, item), { goto error__; });
+
+	// 尾节点仍挂在容器末尾时其 next 线索指向容器本身，否则说明已被其他接口改动
+	RyanJson_t last = appender->last;
+	RyanJsonBool_e isStale = (NULL == last) ? RyanJsonMakeBool(NULL != RyanJsonGetObjectValue(appender->container))
+						: RyanJsonMakeBool(!RyanJsonGetPayloadIsLastByFlag(last) || last->next != appender->container);
+	if (RyanJsonTrue == isStale) { (void)RyanJsonAppenderInit(appender, appender->container); }
 
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonLinkItemAfter(appender->container, appender->last, UINT32_MAX, item));
+	appender->last = item;
 	return RyanJsonTrue;
 
 error__:
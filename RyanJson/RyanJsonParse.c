@@ -4,6 +4,7 @@ typedef struct
 {
 	const uint8_t *currentPtr; // 待解析字符串地址
 	uint32_t remainSize;       // 待解析字符串剩余长度
+	uint32_t flags;            // RyanJsonParseFlag_e 组合，仅树解析使用
 } RyanJsonParseBuffer;
 
 // 解析缓冲区辅助宏（本文件局部使用）
@@ -19,6 +20,11 @@ typedef struct
 // 是否还有可读的待解析文本
 #define parseBufHasRemainBytes(parseBuf, bytes)   ((parseBuf)->remainSize >= (bytes))
 #define parseBufHasRemain(parseBuf)               parseBufHasRemainBytes(parseBuf, 1)
+// 当前字符是否为十进制数字
+#define parseBufIsDigit(parseBuf)                 (parseBufHasRemain(parseBuf) && (uint8_t)(*(parseBuf)->currentPtr - '0') <= 9U)
+
+// 懒数值位数与指数绝对值之和不超过该值时必在 Double 范围内（DBL_MAX 约为 1.8e308）
+#define RyanJsonLazyNumberSafeDigits (300U)
 
 /**
  * @brief 尝试向前移动解析缓冲区指针
@@ -220,13 +226,89 @@ static RyanJsonBool_e RyanJsonInternalParseDouble(RyanJsonParseBuffer *parseBuf,
 	return RyanJsonTrue;
 }
 
+/**
+ * @brief 只按语法扫描 Number 文本，不计算数值
+ *
+ * @param parseBuf 解析缓冲区（当前指向 Number 首字符）
+ * @param lenPtr 输出 Number 文本字节数
+ * @return RyanJsonBool_e 语法是否合法
+ * @note 成功后 parseBuf->currentPtr 指向 Number 之后。
+ * @note 数值范围与普通解析一致：超出 Double 范围或指数超出 int32 的文本同样拒绝。位数与指数绝对值之和不超过
+ *       RyanJsonLazyNumberSafeDigits 时中间结果、指数与最终数值都不可能溢出，只有超过时才完整计算一次校验。
+ */
+static RyanJsonBool_e RyanJsonParseNumberSpan(RyanJsonParseBuffer *parseBuf, uint32_t *lenPtr)
+{
+	RyanJsonCheckAssert(NULL != parseBuf && NULL != lenPtr);
+
+	const uint8_t *start = parseBuf->currentPtr;
+	uint32_t digits = 0;
+	uint32_t exponent = 0;
+	if ('-' == *parseBuf->currentPtr) { parseBufAdvanceCurrentPrt(parseBuf, 1); }
+	RyanJsonCheckReturnFalse(parseBufIsDigit(parseBuf));
+
+	// 前导 0 后面不允许跟数字
+	if ('0' == *parseBuf->currentPtr)
+	{
+		parseBufAdvanceCurrentPrt(parseBuf, 1);
+		RyanJsonCheckReturnFalse(!parseBufIsDigit(parseBuf));
+	}
+	for (; parseBufIsDigit(parseBuf); digits++) { parseBufAdvanceCurrentPrt(parseBuf, 1); }
+
+	if (parseBufHasRemain(parseBuf) && '.' == *parseBuf->currentPtr)
+	{
+		parseBufAdvanceCurrentPrt(parseBuf, 1);
+		RyanJsonCheckReturnFalse(parseBufIsDigit(parseBuf));
+		for (; parseBufIsDigit(parseBuf); digits++) { parseBufAdvanceCurrentPrt(parseBuf, 1); }
+	}
+
+	if (parseBufHasRemain(parseBuf) && ('e' == *parseBuf->currentPtr || 'E' == *parseBuf->currentPtr))
+	{
+		parseBufAdvanceCurrentPrt(parseBuf, 1);
+		if (parseBufHasRemain(parseBuf) && ('+' == *parseBuf->currentPtr || '-' == *parseBuf->currentPtr))
+		{
+			parseBufAdvanceCurrentPrt(parseBuf, 1);
+		}
+		RyanJsonCheckReturnFalse(parseBufIsDigit(parseBuf));
+		while (parseBufIsDigit(parseBuf))
+		{
+			// 正负指数都计入（负指数过大时普通解析同样拒绝），只需判断是否超过阈值，饱和累加即可
+			if (exponent <= RyanJsonLazyNumberSafeDigits)
+			{
+				exponent = exponent * 10U + (uint32_t)(*parseBuf->currentPtr - '0');
+			}
+			parseBufAdvanceCurrentPrt(parseBuf, 1);
+		}
+	}
+
+	*lenPtr = (uint32_t)(parseBuf->currentPtr - start);
+
+	if (digits + exponent > RyanJsonLazyNumberSafeDigits)
+	{
+		double number = 0;
+		RyanJsonBool_e isInt = RyanJsonTrue;
+		RyanJsonParseBuffer numberBuf = {.currentPtr = start, .remainSize = *lenPtr};
+		RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalParseDouble(&numberBuf, &number, &isInt));
+	}
+	return RyanJsonTrue;
+}
+
 /**
  * @brief 解析文本中的 Number 并创建 Json 节点
+ * @note 启用 RyanJsonParseFlagLazyNumber 时只扫描语法并校验范围，保留源文本，首次判型或取值时才转换。
  */
 static RyanJsonBool_e RyanJsonParseNumber(RyanJsonParseBuffer *parseBuf, char *key, RyanJson_t *out)
 {
 	RyanJsonCheckAssert(NULL != parseBuf && NULL != out);
 
+	if (parseBuf->flags & RyanJsonParseFlagLazyNumber)
+	{
+		const char *text = (const char *)parseBuf->currentPtr;
+		uint32_t len = 0;
+		RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseNumberSpan(parseBuf, &len));
+		*out = RyanJsonInternalCreateLazyNumber(key, text, len);
+		return RyanJsonMakeBool(NULL != *out);
+	}
+
 	double number = 0;
 	RyanJsonBool_e isInt = RyanJsonTrue;
 	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalParseDouble(parseBuf, &number, &isInt));
@@ -330,6 +412,54 @@ static RyanJsonBool_e RyanJsonParseStringBufferGetLen(RyanJsonParseBuffer *parse
 	return RyanJsonTrue;
 }
 
+/**
+ * @brief 将 Unicode 码点编码为 UTF-8
+ *
+ * @param codepoint 码点（不超过 0x10FFFF）
+ * @param out 输出缓冲区，至少 4 字节
+ * @return uint8_t 写入的字节数
+ */
+static uint8_t RyanJsonEncodeUtf8(uint32_t codepoint, uint8_t *out)
+{
+	uint8_t utf8Length;
+	uint8_t firstByteMark;
+	if (codepoint < 0x80)
+	{
+		utf8Length = 1; // ASCII：0xxxxxxx
+		firstByteMark = 0;
+	}
+	else if (codepoint < 0x800)
+	{
+		utf8Length = 2;       // 双字节：110xxxxx 10xxxxxx
+		firstByteMark = 0xC0; // 11000000
+	}
+	else if (codepoint < 0x10000)
+	{
+		utf8Length = 3;       // 三字节：1110xxxx 10xxxxxx 10xxxxxx
+		firstByteMark = 0xE0; // 11100000
+	}
+	else
+	{
+		utf8Length = 4;       // 四字节：11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+		firstByteMark = 0xF0; // 11110000
+	}
+
+	// 先从末尾写 continuation byte（10xxxxxx）
+	for (uint8_t utf8Position = (uint8_t)(utf8Length - 1); utf8Position > 0; utf8Position--)
+	{
+		out[utf8Position] = (uint8_t)((codepoint | 0x80) & 0xBF); // 10xxxxxx
+		codepoint >>= 6;
+	}
+
+	// 再写首字节
+	if (utf8Length > 1) { out[0] = (uint8_t)((codepoint | firstByteMark) & 0xFF); }
+	else
+	{
+		out[0] = (uint8_t)(codepoint & 0x7F);
+	}
+	return utf8Length;
+}
+
 /**
  * @brief 将 Json 字符串字面量片段（引号内文本）解码到目标缓冲区
  *
@@ -380,7 +510,7 @@ static RyanJsonBool_e RyanJsonParseStringBuffer(RyanJsonParseBuffer *parseBuf, c
 
 		case 'u': {
 			// 获取 Unicode 字符
-			uint64_t codepoint = 0;
+			uint32_t codepoint = 0;
 			RyanJsonCheckCode(RyanJsonTrue == RyanJsonParseBufTryAdvanceCurrentPtr(parseBuf, 4), { goto error__; });
 			uint32_t firstCode = 0;
 			RyanJsonCheckCode(RyanJsonTrue == RyanJsonParseHex(parseBuf->currentPtr - 3, &firstCode), { goto error__; });
@@ -412,43 +542,7 @@ static RyanJsonBool_e RyanJsonParseStringBuffer(RyanJsonParseBuffer *parseBuf, c
 			}
 
 			// 将 Unicode 码点编码为 UTF-8
-			uint8_t utf8Length;
-			uint8_t firstByteMark;
-			if (codepoint < 0x80)
-			{
-				utf8Length = 1; // ASCII：0xxxxxxx
-				firstByteMark = 0;
-			}
-			else if (codepoint < 0x800)
-			{
-				utf8Length = 2;       // 双字节：110xxxxx 10xxxxxx
-				firstByteMark = 0xC0; // 11000000
-			}
-			else if (codepoint < 0x10000)
-			{
-				utf8Length = 3;       // 三字节：1110xxxx 10xxxxxx 10xxxxxx
-				firstByteMark = 0xE0; // 11100000
-			}
-			else
-			{
-				utf8Length = 4;       // 四字节：11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
-				firstByteMark = 0xF0; // 11110000
-			}
-
-			// 先从末尾写 continuation byte（10xxxxxx）
-			for (uint8_t utf8Position = (uint8_t)(utf8Length - 1); utf8Position > 0; utf8Position--)
-			{
-				outCurrentPtr[utf8Position] = (uint8_t)((codepoint | 0x80) & 0xBF); // 10xxxxxx
-				codepoint >>= 6;
-			}
-
-			// 再写首字节
-			if (utf8Length > 1) { outCurrentPtr[0] = (uint8_t)((codepoint | firstByteMark) & 0xFF); }
-			else
-			{
-				outCurrentPtr[0] = (uint8_t)(codepoint & 0x7F);
-			}
-			outCurrentPtr += utf8Length;
+			outCurrentPtr += RyanJsonEncodeUtf8(codepoint, outCurrentPtr);
 			break;
 		}
 
@@ -468,8 +562,190 @@ error__:
 	return RyanJsonFalse;
 }
 
+/**
+ * @brief 校验含转义的字符串字面量片段（不解码）
+ *
+ * @param text 引号后的首字符
+ * @param lenPtr 输出引号内源文本的字节数
+ * @note 预扫描已确认结尾引号存在、转义字母合法且 \\u 后至少有 4 个字符，这里补充十六进制与代理对校验。
+ */
+static RyanJsonBool_e RyanJsonCheckEscapedText(const uint8_t *text, uint32_t *lenPtr)
+{
+	uint32_t i = 0;
+	while ('\"' != text[i])
+	{
+		if ('\\' != text[i]) { i++; }
+		else if ('u' != text[i + 1]) { i += 2; }
+		else
+		{
+			uint32_t code = 0;
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseHex(text + i + 2, &code));
+			RyanJsonCheckReturnFalse(code < 0xDC00 || code > 0xDFFF);
+			i += 6;
+			if (code >= 0xD800 && code <= 0xDBFF)
+			{
+				RyanJsonCheckReturnFalse('\\' == text[i] && 'u' == text[i + 1]);
+				RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseHex(text + i + 2, &code));
+				RyanJsonCheckReturnFalse(code >= 0xDC00 && code <= 0xDFFF);
+				i += 6;
+			}
+		}
+	}
+
+	*lenPtr = i;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 解码一个已校验的转义序列
+ *
+ * @param in 指向 '\\'
+ * @param out 输出缓冲，至少 4 字节；可与 in 指向同一缓冲（写入不超过读取位置）
+ * @param outLenPtr 输出解码得到的字节数
+ * @return const uint8_t* 转义序列之后的位置
+ */
+static const uint8_t *RyanJsonUnescapeOne(const uint8_t *in, uint8_t *out, uint32_t *outLenPtr)
+{
+	uint8_t esc = in[1];
+	in += 2;
+	*outLenPtr = 1;
+	switch (esc)
+	{
+	case 'b': *out = '\b'; break;
+	case 'f': *out = '\f'; break;
+	case 'n': *out = '\n'; break;
+	case 'r': *out = '\r'; break;
+	case 't': *out = '\t'; break;
+	case 'u': {
+		uint32_t codepoint = 0;
+		(void)RyanJsonParseHex(in, &codepoint);
+		in += 4;
+		if (codepoint >= 0xD800 && codepoint <= 0xDBFF) // UTF16 代理对，后半部分已校验
+		{
+			uint32_t secondCode = 0;
+			(void)RyanJsonParseHex(in + 2, &secondCode);
+			in += 6;
+			codepoint = 0x10000 + (((codepoint & 0x3FF) << 10) | (secondCode & 0x3FF));
+		}
+		*outLenPtr = RyanJsonEncodeUtf8(codepoint, out);
+		break;
+	}
+	default: *out = esc; break; // '\"' '\\' '/'
+	}
+	return in;
+}
+
+/**
+ * @brief 原地解码已校验的转义文本（懒字符串）
+ *
+ * @param text '\0' 结尾的引号内源文本，需已通过 RyanJsonCheckEscapedText 校验
+ * @return uint32_t 解码后的字节数；与普通解析一致，\\u0000 处截断
+ * @note 解码结果不长于源文本，写指针始终不超过读指针，可直接覆盖原缓冲。
+ */
+RyanJsonInternalApi uint32_t RyanJsonInternalUnescapeString(char *text)
+{
+	RyanJsonCheckAssert(NULL != text);
+
+	const uint8_t *in = (const uint8_t *)text;
+	uint8_t *out = (uint8_t *)text;
+	while ('\0' != *in)
+	{
+		if ('\\' != *in)
+		{
+			*out++ = *in++;
+			continue;
+		}
+
+		uint32_t outLen;
+		in = RyanJsonUnescapeOne(in, out, &outLen);
+		out += outLen;
+	}
+	*out = '\0';
+
+	return (uint32_t)RyanJsonStrlen(text);
+}
+
+/**
+ * @brief 逐字节读取字符串解码结果的游标，不修改源文本
+ */
+typedef struct
+{
+	const uint8_t *in;      // 下一个待读取的源字节
+	uint8_t buf[4];         // 当前转义序列的解码结果
+	uint32_t pos;           // buf 中下一个待输出的位置
+	uint32_t len;           // buf 中有效字节数
+	RyanJsonBool_e escaped; // 源文本是否为未解码的转义文本
+} RyanJsonUnescapeCursor_t;
+
+/**
+ * @brief 取下一个解码字节
+ * @return uint8_t 解码字节，0 表示结束（与 RyanJsonInternalUnescapeString 一致，\\u0000 视为结束）
+ */
+static uint8_t RyanJsonUnescapeCursorNext(RyanJsonUnescapeCursor_t *cursor)
+{
+	if (cursor->pos < cursor->len) { return cursor->buf[cursor->pos++]; }
+	if ('\0' == *cursor->in) { return 0; }
+	if (!cursor->escaped || '\\' != *cursor->in) { return *cursor->in++; }
+
+	cursor->in = RyanJsonUnescapeOne(cursor->in, cursor->buf, &cursor->len);
+	cursor->pos = 1;
+	return cursor->buf[0];
+}
+
+/**
+ * @brief 计算转义文本解码结果的 key 哈希与长度，不修改源文本
+ *
+ * @param text '\0' 结尾的已校验转义文本
+ * @param lenPtr 输出解码后的字节数，可为 NULL
+ * @return uint32_t 与解码后调用 RyanJsonInternalKeyHash 的结果一致
+ */
+RyanJsonInternalApi uint32_t RyanJsonInternalUnescapedHash(const char *text, uint32_t *lenPtr)
+{
+	RyanJsonCheckAssert(NULL != text);
+
+	RyanJsonUnescapeCursor_t cursor = {.in = (const uint8_t *)text, .escaped = RyanJsonTrue};
+	uint32_t hash = RyanJsonKeyHashSeed;
+	uint32_t len = 0;
+	for (uint8_t ch = RyanJsonUnescapeCursorNext(&cursor); 0 != ch; ch = RyanJsonUnescapeCursorNext(&cursor))
+	{
+		hash = RyanJsonKeyHashStep(hash, ch);
+		len++;
+	}
+
+	if (NULL != lenPtr) { *lenPtr = len; }
+	return hash;
+}
+
+/**
+ * @brief 按解码结果比较两段文本，不修改源文本
+ *
+ * @param left 左侧文本
+ * @param leftEscaped 左侧是否为未解码的转义文本
+ * @param right 右侧文本
+ * @param rightEscaped 右侧是否为未解码的转义文本
+ * @return RyanJsonBool_e 解码结果是否逐字节相同
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalUnescapedEq(const char *left, RyanJsonBool_e leftEscaped, const char *right,
+							       RyanJsonBool_e rightEscaped)
+{
+	RyanJsonCheckAssert(NULL != left && NULL != right);
+
+	// 两侧写法相同且源文本相同时无需解码
+	if (leftEscaped == rightEscaped && RyanJsonTrue == RyanJsonInternalStrEq(left, right)) { return RyanJsonTrue; }
+
+	RyanJsonUnescapeCursor_t leftCursor = {.in = (const uint8_t *)left, .escaped = leftEscaped};
+	RyanJsonUnescapeCursor_t rightCursor = {.in = (const uint8_t *)right, .escaped = rightEscaped};
+	while (1)
+	{
+		uint8_t ch = RyanJsonUnescapeCursorNext(&leftCursor);
+		if (ch != RyanJsonUnescapeCursorNext(&rightCursor)) { return RyanJsonFalse; }
+		if (0 == ch) { return RyanJsonTrue; }
+	}
+}
+
 /**
  * @brief 解析 String 节点并创建 String 节点
+ * @note 启用 RyanJsonParseFlagLazyString 时含转义的值只校验不解码，保留源文本，首次读取时再解码。
  */
 static RyanJsonBool_e RyanJsonParseString(RyanJsonParseBuffer *parseBuf, char *key, RyanJson_t *out)
 {
@@ -479,6 +755,20 @@ static RyanJsonBool_e RyanJsonParseString(RyanJsonParseBuffer *parseBuf, char *k
 	RyanJsonBool_e hasEscape = RyanJsonFalse;
 	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseStringBufferGetLen(parseBuf, &len, &hasEscape));
 
+	if (RyanJsonTrue == hasEscape && (parseBuf->flags & RyanJsonParseFlagLazyString))
+	{
+		// 源文本已是合法的转义形式，按“无需转义”记录，打印时整段输出
+		uint32_t rawLen = 0;
+		RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonCheckEscapedText(parseBuf->currentPtr, &rawLen));
+		RyanJson_t newItem = RyanJsonInternalCreateStringWithLen(key, (const char *)parseBuf->currentPtr, rawLen, RyanJsonTrue);
+		RyanJsonCheckReturnFalse(NULL != newItem);
+		RyanJsonSetPayloadStrIsEscapedByFlag(newItem, RyanJsonTrue);
+
+		parseBufAdvanceCurrentPrt(parseBuf, rawLen + 1U); // 连同结尾引号
+		*out = newItem;
+		return RyanJsonTrue;
+	}
+
 	if (len + 1 > RyanJsonInlineStringSize)
 	{
 		char *bufferMalloc = (char *)jsonMalloc((size_t)(len + 1U));
@@ -488,7 +778,9 @@ static RyanJsonBool_e RyanJsonParseString(RyanJsonParseBuffer *parseBuf, char *k
 			return RyanJsonFalse;
 		});
 
-		RyanJson_t newItem = RyanJsonCreateString(key, bufferMalloc);
+		// 源文本不含转义时，解码结果与源文本一致：len 即精确长度，且不含引号、反斜杠与控制字符
+		RyanJson_t newItem = (RyanJsonFalse == hasEscape) ? RyanJsonInternalCreateStringWithLen(key, bufferMalloc, len, RyanJsonTrue)
+								  : RyanJsonCreateString(key, bufferMalloc);
 		RyanJsonCheckCode(NULL != newItem, {
 			jsonFree(bufferMalloc);
 			return RyanJsonFalse;
@@ -606,6 +898,15 @@ static RyanJsonBool_e RyanJsonParseIterative(RyanJsonParseBuffer *parseBuf, Ryan
 		{
 			parseBufAdvanceCurrentPrt(parseBuf, 1);
 
+#if true == RyanJsonPackedArray
+			// 闭合的 Array 若元素同为 Int（或同为 Double）且足够多，转为紧凑存储；失败保持链表
+			// 懒数值需保留源文本，不参与转换
+			if (scopeParentIsArray && 0U != RyanJsonPackedArrayParseMinSize && !(parseBuf->flags & RyanJsonParseFlagLazyNumber))
+			{
+				RyanJsonInternalPackedTryPack(scopeParent, RyanJsonPackedArrayParseMinSize);
+			}
+#endif
+
 			// 当前容器已经闭合，接下来回溯到父容器。
 			// 父容器指针保存在 scopeParent->next（下沉时写入的线索）。
 
@@ -691,6 +992,10 @@ static RyanJsonBool_e RyanJsonParseIterative(RyanJsonParseBuffer *parseBuf, Ryan
 
 		// 阶段：挂接到父容器
 		RyanJsonInternalListInsertAfter(scopeParent, lastSibling, newItem);
+#if true == RyanJsonObjectHashIndex
+		// 严格模式的重复 key 检查可能已为该 Object 建立索引，需同步维护
+		RyanJsonInternalKeyIndexAdd(scopeParent, newItem);
+#endif
 
 		lastSibling = newItem; // 更新游标
 
@@ -738,20 +1043,27 @@ static RyanJsonBool_e RyanJsonParseCheckNullTerminator(RyanJsonParseBuffer *pars
 }
 
 /**
- * @brief 解析 Json 文本（可配置长度与尾部校验）
+ * @brief 解析 Json 文本（可配置长度、尾部校验与解析标志）
  *
  * @param text 输入文本
  * @param size 文本长度
  * @param requireNullTerminator 是否要求解析后仅剩空白
+ * @param flags RyanJsonParseFlag_e 组合
  * @param parseEndPtr 输出第一个未消费字符位置，可为 NULL
  * @return RyanJson_t 解析成功返回根节点，失败返回 NULL
  * @note parseEndPtr 仅在解析成功时写入。
  */
-RyanJson_t RyanJsonParseOptions(const char *text, uint32_t size, RyanJsonBool_e requireNullTerminator, const char **parseEndPtr)
+RyanJson_t RyanJsonParseWithFlags(const char *text, uint32_t size, RyanJsonBool_e requireNullTerminator, uint32_t flags,
+				  const char **parseEndPtr)
 {
 	RyanJsonCheckReturnNull(NULL != text);
 
-	RyanJsonParseBuffer parseBuf = {.currentPtr = (const uint8_t *)text, .remainSize = size};
+#if true == RyanJsonStringIntern
+	// 驻留缓冲可能被多个节点共享，懒字符串无法原地解码
+	flags &= ~(uint32_t)RyanJsonParseFlagLazyString;
+#endif
+
+	RyanJsonParseBuffer parseBuf = {.currentPtr = (const uint8_t *)text, .remainSize = size, .flags = flags};
 	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonParseBufSkipWhitespace(&parseBuf));
 
 	RyanJson_t pJson;
@@ -768,6 +1080,21 @@ RyanJson_t RyanJsonParseOptions(const char *text, uint32_t size, RyanJsonBool_e
 	return pJson;
 }
 
+/**
+ * @brief 解析 Json 文本（可配置长度与尾部校验）
+ *
+ * @param text 输入文本
+ * @param size 文本长度
+ * @param requireNullTerminator 是否要求解析后仅剩空白
+ * @param parseEndPtr 输出第一个未消费字符位置，可为 NULL
+ * @return RyanJson_t 解析成功返回根节点，失败返回 NULL
+ * @note parseEndPtr 仅在解析成功时写入。
+ */
+RyanJson_t RyanJsonParseOptions(const char *text, uint32_t size, RyanJsonBool_e requireNullTerminator, const char **parseEndPtr)
+{
+	return RyanJsonParseWithFlags(text, size, requireNullTerminator, RyanJsonParseFlagNone, parseEndPtr);
+}
+
 /**
  * @brief 解析以 '\\0' 结尾的 Json 文本
  *
@@ -780,20 +1107,933 @@ RyanJson_t RyanJsonParse(const char *text)
 	return RyanJsonParseOptions(text, (uint32_t)RyanJsonStrlen(text), RyanJsonFalse, NULL);
 }
 
+#define RyanJsonValidateInlineDepth (256U) // 栈上记录容器类别的层数（每层 1 bit），更深时才申请内存
+
+/**
+ * @brief 校验字符串字面量（不解码），成功后指向结尾引号之后
+ */
+static RyanJsonBool_e RyanJsonValidateString(RyanJsonParseBuffer *parseBuf)
+{
+	uint32_t len;
+	RyanJsonBool_e hasEscape = RyanJsonFalse;
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseStringBufferGetLen(parseBuf, &len, &hasEscape));
+
+	// 无转义时源文本长度即解码长度
+	uint32_t i = len;
+	if (RyanJsonTrue == hasEscape) { RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonCheckEscapedText(parseBuf->currentPtr, &i)); }
+
+	return RyanJsonParseBufTryAdvanceCurrentPtr(parseBuf, i + 1U);
+}
+
+/**
+ * @brief 校验 Object 成员的 key 与冒号，成功后指向 value 起始处
+ */
+static RyanJsonBool_e RyanJsonValidateKey(RyanJsonParseBuffer *parseBuf)
+{
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonValidateString(parseBuf));
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseBufSkipWhitespace(parseBuf));
+	RyanJsonCheckReturnFalse(parseBufHasRemain(parseBuf) && ':' == *parseBuf->currentPtr);
+	parseBufAdvanceCurrentPrt(parseBuf, 1);
+	return RyanJsonParseBufSkipWhitespace(parseBuf);
+}
+
+/**
+ * @brief 校验标量（String/Number/Bool/Null）
+ */
+static RyanJsonBool_e RyanJsonValidateScalar(RyanJsonParseBuffer *parseBuf)
+{
+	RyanJsonCheckReturnFalse(parseBufHasRemain(parseBuf));
+
+	uint8_t ch = *parseBuf->currentPtr;
+	if ('\"' == ch) { return RyanJsonValidateString(parseBuf); }
+	if ('-' == ch || (ch >= '0' && ch <= '9'))
+	{
+		double number = 0;
+		RyanJsonBool_e isInt = RyanJsonTrue;
+		return RyanJsonInternalParseDouble(parseBuf, &number, &isInt);
+	}
+
+	static const char *const literals[] = {"null", "true", "false"};
+	for (uint32_t i = 0; i < sizeof(literals) / sizeof(literals[0]); i++)
+	{
+		uint32_t len = (uint32_t)RyanJsonStrlen(literals[i]);
+		if (parseBufHasRemainBytes(parseBuf, len) && 0 == strncmp((const char *)parseBuf->currentPtr, literals[i], len))
+		{
+			parseBufAdvanceCurrentPrt(parseBuf, len);
+			return RyanJsonTrue;
+		}
+	}
+	return RyanJsonFalse;
+}
+
 /**
- * @brief 解析原始 Number 文本（打印回读校验辅助）
+ * @brief 校验文本恰为一个合法 Json 值（允许首尾空白），不创建节点
  *
- * @param currentPtr Number 文本起始地址
- * @param remainSize Number 文本长度
- * @param numberValuePtr 输出数值
- * @return RyanJsonBool_e 解析是否成功
+ * @param text 输入文本
+ * @param size 文本长度
+ * @param startPtr 输出值起始位置（跳过前导空白）
+ * @param lenPtr 输出值的字节长度（不含首尾空白）
+ * @return RyanJsonBool_e 校验是否通过
+ * @note 与 RyanJsonParse 接受的文本一致；容器只记录每层是 Array 还是 Object（1 bit），
+ *       嵌套超过 RyanJsonValidateInlineDepth 层时才申请内存。
  */
-RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalParseDoubleRaw(const uint8_t *currentPtr, uint32_t remainSize, double *numberValuePtr)
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalValidateValue(const char *text, uint32_t size, uint32_t *startPtr, uint32_t *lenPtr)
 {
-	RyanJsonCheckAssert(NULL != currentPtr && NULL != numberValuePtr);
-	RyanJsonCheckAssert(remainSize > 0);
+	RyanJsonCheckAssert(NULL != text && NULL != startPtr && NULL != lenPtr);
 
-	RyanJsonBool_e isInt = RyanJsonTrue;
-	RyanJsonParseBuffer parseBuf = {.currentPtr = currentPtr, .remainSize = remainSize};
-	return RyanJsonInternalParseDouble(&parseBuf, numberValuePtr, &isInt);
+	RyanJsonParseBuffer parseBuf = {.currentPtr = (const uint8_t *)text, .remainSize = size};
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseBufSkipWhitespace(&parseBuf));
+	uint32_t start = size - parseBuf.remainSize;
+
+	uint8_t kindInline[RyanJsonValidateInlineDepth / 8U];
+	uint8_t *kind = kindInline; // 第 n 位为 1 表示第 n 层是 Object
+	uint32_t kindCap = RyanJsonValidateInlineDepth;
+	uint32_t depth = 0;
+
+	while (1)
+	{
+		// 阶段：校验一个值；容器只消费起始符号并下沉
+		RyanJsonCheckCode(parseBufHasRemain(&parseBuf), { goto error__; });
+		uint8_t ch = *parseBuf.currentPtr;
+		if ('{' == ch || '[' == ch)
+		{
+			if (depth == kindCap)
+			{
+				uint8_t *newKind = (uint8_t *)jsonMalloc((size_t)kindCap / 4U);
+				RyanJsonCheckCode(NULL != newKind, { goto error__; });
+				RyanJsonMemcpy(newKind, kind, (size_t)kindCap / 8U);
+				if (kind != kindInline) { jsonFree(kind); }
+				kind = newKind;
+				kindCap *= 2U;
+			}
+
+			RyanJsonBool_e isObject = RyanJsonMakeBool('{' == ch);
+			if (isObject) { kind[depth / 8U] = (uint8_t)(kind[depth / 8U] | (1U << (depth % 8U))); }
+			else
+			{
+				kind[depth / 8U] = (uint8_t)(kind[depth / 8U] & ~(1U << (depth % 8U)));
+			}
+			depth++;
+
+			parseBufAdvanceCurrentPrt(&parseBuf, 1);
+			RyanJsonCheckCode(RyanJsonTrue == RyanJsonParseBufSkipWhitespace(&parseBuf), { goto error__; });
+			RyanJsonCheckCode(parseBufHasRemain(&parseBuf), { goto error__; });
+			if ((isObject ? '}' : ']') == *parseBuf.currentPtr)
+			{
+				parseBufAdvanceCurrentPrt(&parseBuf, 1);
+				depth--;
+			}
+			else
+			{
+				if (isObject) { RyanJsonCheckCode(RyanJsonTrue == RyanJsonValidateKey(&parseBuf), { goto error__; }); }
+				continue;
+			}
+		}
+		else
+		{
+			RyanJsonCheckCode(RyanJsonTrue == RyanJsonValidateScalar(&parseBuf), { goto error__; });
+		}
+
+		// 阶段：值之后处理逗号或闭合符号，逐层回溯
+		RyanJsonBool_e hasNext = RyanJsonFalse;
+		while (0 != depth && RyanJsonFalse == hasNext)
+		{
+			RyanJsonCheckCode(RyanJsonTrue == RyanJsonParseBufSkipWhitespace(&parseBuf), { goto error__; });
+			RyanJsonCheckCode(parseBufHasRemain(&parseBuf), { goto error__; });
+
+			RyanJsonBool_e isObject = RyanJsonMakeBool(kind[(depth - 1U) / 8U] & (1U << ((depth - 1U) % 8U)));
+			ch = *parseBuf.currentPtr;
+			parseBufAdvanceCurrentPrt(&parseBuf, 1);
+			if (',' == ch)
+			{
+				RyanJsonCheckCode(RyanJsonTrue == RyanJsonParseBufSkipWhitespace(&parseBuf), { goto error__; });
+				if (isObject) { RyanJsonCheckCode(RyanJsonTrue == RyanJsonValidateKey(&parseBuf), { goto error__; }); }
+				hasNext = RyanJsonTrue;
+			}
+			else
+			{
+				RyanJsonCheckCode((isObject ? '}' : ']') == ch, { goto error__; });
+				depth--;
+			}
+		}
+		if (0 == depth) { break; }
+	}
+
+	if (kind != kindInline) { jsonFree(kind); }
+
+	*startPtr = start;
+	*lenPtr = size - parseBuf.remainSize - start;
+	return RyanJsonParseCheckNullTerminator(&parseBuf, RyanJsonTrue);
+
+error__:
+	if (kind != kindInline) { jsonFree(kind); }
+	return RyanJsonFalse;
+}
+
+/**
+ * @brief 解析字符串字面量到 tape 字符串池
+ *
+ * @param offPtr 输出池内偏移
+ * @param lenPtr 输出解码后的字节数（不含 '\0'）
+ * @param hasEscapePtr 输出源文本是否含转义
+ */
+static RyanJsonBool_e RyanJsonParseTapeString(RyanJsonParseBuffer *parseBuf, RyanJsonTapeBuilder_t *builder, uint32_t *offPtr,
+					      uint32_t *lenPtr, RyanJsonBool_e *hasEscapePtr)
+{
+	uint32_t len;
+	RyanJsonBool_e hasEscape = RyanJsonFalse;
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseStringBufferGetLen(parseBuf, &len, &hasEscape));
+
+	uint8_t *buffer = RyanJsonInternalTapeReservePool(builder, len + 1U);
+	RyanJsonCheckReturnFalse(NULL != buffer);
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseStringBuffer(parseBuf, (char *)buffer, len, hasEscape));
+
+	// 含转义时 len 只是上限，与树解析一致按 '\0' 截断取实际长度
+	if (RyanJsonTrue == hasEscape) { len = (uint32_t)RyanJsonStrlen((const char *)buffer); }
+
+	*offPtr = builder->poolSize;
+	*lenPtr = len;
+	*hasEscapePtr = hasEscape;
+	builder->poolSize += len + 1U;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 解析单个 Json 值并追加条目（容器只追加起始条目并消费起始符号）
+ *
+ * @param keyTag key 相关的 tag 位，无 key 时为 0
+ */
+static RyanJsonBool_e RyanJsonParseTapeValue(RyanJsonParseBuffer *parseBuf, RyanJsonTapeBuilder_t *builder, uint32_t keyTag,
+					     uint32_t keyOff)
+{
+	RyanJsonCheckReturnFalse(parseBufHasRemain(parseBuf));
+
+	RyanJsonTapeEntry_t *entry;
+	uint8_t ch = *parseBuf->currentPtr;
+	if ('\"' == ch)
+	{
+		uint32_t off;
+		uint32_t len;
+		RyanJsonBool_e hasEscape;
+		RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseTapeString(parseBuf, builder, &off, &len, &hasEscape));
+		entry = RyanJsonInternalTapePush(builder, RyanJsonTypeString | keyTag | (hasEscape ? 0U : RyanJsonTapeTagFlag));
+		RyanJsonCheckReturnFalse(NULL != entry);
+		entry->value.str.off = off;
+		entry->value.str.len = len;
+	}
+	else if ('{' == ch || '[' == ch)
+	{
+		entry = RyanJsonInternalTapePush(builder, ('{' == ch ? RyanJsonTypeObject : RyanJsonTypeArray) | keyTag);
+		RyanJsonCheckReturnFalse(NULL != entry);
+		parseBufAdvanceCurrentPrt(parseBuf, 1);
+	}
+	else if ('-' == ch || (ch >= '0' && ch <= '9'))
+	{
+		double number = 0;
+		RyanJsonBool_e isInt = RyanJsonTrue;
+		RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalParseDouble(parseBuf, &number, &isInt));
+
+		// 与树解析一致：int32_t 范围内的整数按 Int 存储
+		if (RyanJsonTrue == isInt && number >= INT32_MIN && number <= INT32_MAX)
+		{
+			entry = RyanJsonInternalTapePush(builder, RyanJsonTypeNumber | keyTag);
+			RyanJsonCheckReturnFalse(NULL != entry);
+			entry->value.intValue = (int32_t)number;
+		}
+		else
+		{
+			entry = RyanJsonInternalTapePush(builder, RyanJsonTypeNumber | keyTag | RyanJsonTapeTagFlag);
+			RyanJsonCheckReturnFalse(NULL != entry);
+			RyanJsonMemcpy(&entry->value, &number, sizeof(number));
+		}
+	}
+	else if (parseBufHasRemainBytes(parseBuf, 4) && 0 == strncmp((const char *)parseBuf->currentPtr, "null", 4))
+	{
+		entry = RyanJsonInternalTapePush(builder, RyanJsonTypeNull | keyTag);
+		RyanJsonCheckReturnFalse(NULL != entry);
+		parseBufAdvanceCurrentPrt(parseBuf, 4);
+	}
+	else if (parseBufHasRemainBytes(parseBuf, 5) && 0 == strncmp((const char *)parseBuf->currentPtr, "false", 5))
+	{
+		entry = RyanJsonInternalTapePush(builder, RyanJsonTypeBool | keyTag);
+		RyanJsonCheckReturnFalse(NULL != entry);
+		parseBufAdvanceCurrentPrt(parseBuf, 5);
+	}
+	else if (parseBufHasRemainBytes(parseBuf, 4) && 0 == strncmp((const char *)parseBuf->currentPtr, "true", 4))
+	{
+		entry = RyanJsonInternalTapePush(builder, RyanJsonTypeBool | keyTag | RyanJsonTapeTagFlag);
+		RyanJsonCheckReturnFalse(NULL != entry);
+		parseBufAdvanceCurrentPrt(parseBuf, 4);
+	}
+	else
+	{
+		return RyanJsonFalse;
+	}
+
+	entry->keyOff = keyOff;
+	return RyanJsonTrue;
+}
+
+#if true == RyanJsonStrictObjectKeyCheck
+/**
+ * @brief 构建期间检查 Object 的已有直接成员中是否存在相同 key
+ */
+static RyanJsonBool_e RyanJsonParseTapeHasKey(const RyanJsonTapeBuilder_t *builder, uint32_t scope, uint32_t keyOff, uint32_t keyLen)
+{
+	const RyanJsonTapeEntry_t *entries = builder->entries;
+	uint32_t child = scope + 1U;
+	for (uint32_t i = 0; i < entries[scope].value.container.count; i++)
+	{
+		if ((entries[child].tag >> RyanJsonTapeTagKeyLenShift) == keyLen &&
+		    0 == RyanJsonMemcmp(builder->pool + entries[child].keyOff, builder->pool + keyOff, keyLen))
+		{
+			return RyanJsonTrue;
+		}
+		child += RyanJsonTapeEntrySpan(&entries[child]);
+	}
+	return RyanJsonFalse;
+}
+#endif
+
+/**
+ * @brief 迭代解析为扁平文档
+ * @details 与树解析的状态机一致；打开的容器条目的 span 暂存父容器下标，闭合时追加结束标记并改写为真正的 span。
+ */
+static RyanJsonBool_e RyanJsonParseTapeIterative(RyanJsonParseBuffer *parseBuf, RyanJsonTapeBuilder_t *builder)
+{
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseTapeValue(parseBuf, builder, 0, 0));
+	if (!RyanJsonTapeEntryIsContainer(&builder->entries[0])) { return RyanJsonTrue; }
+
+	uint32_t scope = 0; // 当前容器的条目下标
+	while (1)
+	{
+		RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseBufSkipWhitespace(parseBuf));
+		RyanJsonCheckReturnFalse(parseBufHasRemain(parseBuf));
+
+		uint8_t ch = *parseBuf->currentPtr;
+		RyanJsonBool_e scopeIsArray = RyanJsonMakeBool(RyanJsonTypeArray == RyanJsonTapeEntryType(&builder->entries[scope]));
+
+		if ((scopeIsArray && ']' == ch) || (!scopeIsArray && '}' == ch))
+		{
+			parseBufAdvanceCurrentPrt(parseBuf, 1);
+			RyanJsonCheckReturnFalse(NULL != RyanJsonInternalTapePush(builder, RyanJsonTapeTypeEnd));
+
+			uint32_t parent = builder->entries[scope].value.container.span;
+			builder->entries[scope].value.container.span = builder->entryCount - scope;
+			if (0U == scope) { return RyanJsonTrue; }
+
+			scope = parent;
+			continue;
+		}
+
+		if (0U != builder->entries[scope].value.container.count)
+		{
+			RyanJsonCheckReturnFalse(',' == ch);
+			parseBufAdvanceCurrentPrt(parseBuf, 1);
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseBufSkipWhitespace(parseBuf));
+		}
+
+		uint32_t keyTag = 0;
+		uint32_t keyOff = 0;
+		if (!scopeIsArray)
+		{
+			uint32_t keyLen;
+			RyanJsonBool_e hasEscape;
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseTapeString(parseBuf, builder, &keyOff, &keyLen, &hasEscape));
+			RyanJsonCheckReturnFalse(keyLen <= RyanJsonTapeKeyLenMax);
+			keyTag = RyanJsonTapeTagHasKey | (keyLen << RyanJsonTapeTagKeyLenShift);
+
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseBufSkipWhitespace(parseBuf));
+			RyanJsonCheckReturnFalse(parseBufHasRemain(parseBuf) && ':' == *parseBuf->currentPtr);
+			parseBufAdvanceCurrentPrt(parseBuf, 1);
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseBufSkipWhitespace(parseBuf));
+
+#if true == RyanJsonStrictObjectKeyCheck
+			RyanJsonCheckReturnFalse(RyanJsonFalse == RyanJsonParseTapeHasKey(builder, scope, keyOff, keyLen));
+#endif
+		}
+
+		uint32_t index = builder->entryCount;
+		RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseTapeValue(parseBuf, builder, keyTag, keyOff));
+		builder->entries[scope].value.container.count++;
+
+		if (RyanJsonTapeEntryIsContainer(&builder->entries[index]))
+		{
+			builder->entries[index].value.container.span = scope;
+			scope = index;
+		}
+	}
+}
+
+/**
+ * @brief 解析 Json 文本为扁平只读文档（可配置长度与尾部校验）
+ *
+ * @param text 输入文本
+ * @param size 文本长度
+ * @param requireNullTerminator 是否要求解析后仅剩空白
+ * @param parseEndPtr 输出第一个未消费字符位置，可为 NULL
+ * @return RyanJsonTape_t 解析成功返回文档，失败返回 NULL
+ * @note 接受的文本与 RyanJsonParseOptions 完全一致；parseEndPtr 仅在解析成功时写入。
+ */
+RyanJsonTape_t RyanJsonParseTapeOptions(const char *text, uint32_t size, RyanJsonBool_e requireNullTerminator, const char **parseEndPtr)
+{
+	RyanJsonCheckReturnNull(NULL != text);
+
+	RyanJsonParseBuffer parseBuf = {.currentPtr = (const uint8_t *)text, .remainSize = size};
+	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonParseBufSkipWhitespace(&parseBuf));
+
+	RyanJsonTapeBuilder_t builder = {0};
+	RyanJsonCheckCode(RyanJsonTrue == RyanJsonParseTapeIterative(&parseBuf, &builder) &&
+				  RyanJsonTrue == RyanJsonParseCheckNullTerminator(&parseBuf, requireNullTerminator),
+			  {
+				  RyanJsonInternalTapeBuilderFree(&builder);
+				  return NULL;
+			  });
+
+	RyanJsonTape_t tape = RyanJsonInternalTapeFinish(&builder, 0);
+	RyanJsonCheckReturnNull(NULL != tape);
+
+	if (parseEndPtr) { *parseEndPtr = (const char *)parseBuf.currentPtr; }
+	return tape;
+}
+
+/**
+ * @brief 解析以 '\\0' 结尾的 Json 文本为扁平只读文档
+ */
+RyanJsonTape_t RyanJsonParseTape(const char *text)
+{
+	RyanJsonCheckReturnNull(NULL != text);
+	return RyanJsonParseTapeOptions(text, (uint32_t)RyanJsonStrlen(text), RyanJsonFalse, NULL);
+}
+
+#define RyanJsonCodecIndefinite  UINT32_MAX // CBOR 不定长容器的剩余成员数
+#define RyanJsonCodecInlineDepth (16U)      // 栈上记录剩余成员数的层数，更深时才申请内存
+
+/**
+ * @brief CBOR/MessagePack 中的单个数据项（容器只含成员数，成员由外层迭代器继续解码）
+ */
+typedef struct
+{
+	RyanjsonType_e type;
+	RyanJsonBool_e boolValue;
+	RyanJsonBool_e isDouble;
+	int32_t intValue;
+	double doubleValue;
+	const char *str; // String/Blob 内容，指向输入数据，不以 '\0' 结尾
+	uint32_t len;    // String/Blob 字节数或容器成员数（RyanJsonCodecIndefinite 表示不定长）
+} RyanJsonCodecItem_t;
+
+/**
+ * @brief 读取 bytes 个大端字节
+ */
+static RyanJsonBool_e RyanJsonParseCodecUint(RyanJsonParseBuffer *parseBuf, uint32_t bytes, uint64_t *valuePtr)
+{
+	RyanJsonCheckReturnFalse(parseBufHasRemainBytes(parseBuf, bytes));
+
+	uint64_t value = 0;
+	for (uint32_t i = 0; i < bytes; i++)
+	{
+		value = (value << 8) | parseBuf->currentPtr[i];
+	}
+	parseBufAdvanceCurrentPrt(parseBuf, bytes);
+	*valuePtr = value;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 整数落在 int32 范围内时为 Int，否则转为 Double（与文本解析一致）
+ */
+static void RyanJsonCodecSetInt(RyanJsonCodecItem_t *item, int64_t value)
+{
+	item->type = RyanJsonTypeNumber;
+	item->isDouble = RyanJsonMakeBool(value < INT32_MIN || value > INT32_MAX);
+	if (item->isDouble) { item->doubleValue = (double)value; }
+	else
+	{
+		item->intValue = (int32_t)value;
+	}
+}
+
+static void RyanJsonCodecSetUint(RyanJsonCodecItem_t *item, uint64_t value)
+{
+	if (value <= (uint64_t)INT64_MAX)
+	{
+		RyanJsonCodecSetInt(item, (int64_t)value);
+		return;
+	}
+	item->type = RyanJsonTypeNumber;
+	item->isDouble = RyanJsonTrue;
+	item->doubleValue = (double)value;
+}
+
+static void RyanJsonCodecSetDouble(RyanJsonCodecItem_t *item, double value)
+{
+	item->type = RyanJsonTypeNumber;
+	item->isDouble = RyanJsonTrue;
+	item->doubleValue = value;
+}
+
+static void RyanJsonCodecSetFloatBits(RyanJsonCodecItem_t *item, uint32_t bits)
+{
+	float value;
+	RyanJsonMemcpy(&value, &bits, sizeof(value));
+	RyanJsonCodecSetDouble(item, (double)value);
+}
+
+/**
+ * @brief 引用输入中的字符串内容
+ * @note 节点中的字符串以 '\0' 结尾，内容中间的 '\0' 无法表示，视为失败。
+ */
+static RyanJsonBool_e RyanJsonCodecSetString(RyanJsonParseBuffer *parseBuf, RyanJsonCodecItem_t *item, uint64_t len)
+{
+	RyanJsonCheckReturnFalse(len <= parseBuf->remainSize);
+
+	const char *str = (const char *)parseBuf->currentPtr;
+	for (uint32_t i = 0; i < (uint32_t)len; i++)
+	{
+		RyanJsonCheckReturnFalse('\0' != str[i]);
+	}
+
+	item->type = RyanJsonTypeString;
+	item->str = str;
+	item->len = (uint32_t)len;
+	parseBufAdvanceCurrentPrt(parseBuf, (uint32_t)len);
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 引用输入中的字节串内容，解码为 Blob 节点
+ */
+static RyanJsonBool_e RyanJsonCodecSetBytes(RyanJsonParseBuffer *parseBuf, RyanJsonCodecItem_t *item, uint64_t len)
+{
+	RyanJsonCheckReturnFalse(len <= parseBuf->remainSize);
+
+	item->type = RyanJsonTypeBlob;
+	item->str = (const char *)parseBuf->currentPtr;
+	item->len = (uint32_t)len;
+	parseBufAdvanceCurrentPrt(parseBuf, (uint32_t)len);
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 记录容器成员数
+ * @note 每个成员至少占 1 字节（Object 成员至少 2 字节），成员数超过剩余数据时直接判定失败。
+ */
+static RyanJsonBool_e RyanJsonCodecSetContainer(const RyanJsonParseBuffer *parseBuf, RyanJsonCodecItem_t *item, RyanjsonType_e type,
+						uint64_t count)
+{
+	RyanJsonCheckReturnFalse(count <= parseBuf->remainSize && count < RyanJsonCodecIndefinite);
+	if (RyanJsonTypeObject == type) { RyanJsonCheckReturnFalse(count <= parseBuf->remainSize / 2U); }
+
+	item->type = type;
+	item->len = (uint32_t)count;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 半精度浮点转 double（按位构造对应的 float）
+ */
+static double RyanJsonCodecHalfToDouble(uint32_t half)
+{
+	uint32_t sign = (half & 0x8000U) << 16;
+	uint32_t exponent = (half >> 10) & 0x1fU;
+	uint32_t mantissa = half & 0x3ffU;
+
+	// 非规格化数（含 ±0）：mantissa * 2^-24，在 float 中可精确表示
+	if (0U == exponent)
+	{
+		double value = (double)mantissa * 5.9604644775390625e-8;
+		return sign ? -value : value;
+	}
+
+	uint32_t bits = sign | (mantissa << 13);
+	bits |= (31U == exponent) ? 0x7f800000U : ((exponent + 112U) << 23);
+
+	float value;
+	RyanJsonMemcpy(&value, &bits, sizeof(value));
+	return (double)value;
+}
+
+/**
+ * @brief 解码单个 CBOR 数据项
+ * @note tag 被忽略，直接解码其标记的数据项；break 只在不定长容器的成员位置由外层处理，这里视为失败。
+ */
+static RyanJsonBool_e RyanJsonParseCborItem(RyanJsonParseBuffer *parseBuf, RyanJsonCodecItem_t *item)
+{
+	while (1)
+	{
+		RyanJsonCheckReturnFalse(parseBufHasRemain(parseBuf));
+		uint32_t lead = *parseBuf->currentPtr;
+		parseBufAdvanceCurrentPrt(parseBuf, 1);
+
+		uint32_t major = lead >> 5;
+		uint32_t info = lead & 0x1fU;
+		uint64_t arg = info;
+		RyanJsonBool_e isIndefinite = RyanJsonMakeBool(31U == info);
+
+		if (7U == major)
+		{
+			switch (info)
+			{
+			case 20:
+			case 21:
+				item->type = RyanJsonTypeBool;
+				item->boolValue = RyanJsonMakeBool(21U == info);
+				return RyanJsonTrue;
+			case 22: item->type = RyanJsonTypeNull; return RyanJsonTrue;
+			case 25:
+				RyanJsonCheckReturnFalse(RyanJsonParseCodecUint(parseBuf, 2, &arg));
+				RyanJsonCodecSetDouble(item, RyanJsonCodecHalfToDouble((uint32_t)arg));
+				return RyanJsonTrue;
+			case 26:
+				RyanJsonCheckReturnFalse(RyanJsonParseCodecUint(parseBuf, 4, &arg));
+				RyanJsonCodecSetFloatBits(item, (uint32_t)arg);
+				return RyanJsonTrue;
+			case 27: {
+				RyanJsonCheckReturnFalse(RyanJsonParseCodecUint(parseBuf, 8, &arg));
+				double value;
+				RyanJsonMemcpy(&value, &arg, sizeof(value));
+				RyanJsonCodecSetDouble(item, value);
+				return RyanJsonTrue;
+			}
+			default: return RyanJsonFalse; // undefined、其他简单值与 break
+			}
+		}
+
+		// 参数：< 24 为值本身，24~27 后跟 1/2/4/8 字节，31 为不定长（仅容器接受）
+		if (info >= 24U && info <= 27U) { RyanJsonCheckReturnFalse(RyanJsonParseCodecUint(parseBuf, 1U << (info - 24U), &arg)); }
+		else
+		{
+			RyanJsonCheckReturnFalse(info < 24U || (isIndefinite && (4U == major || 5U == major)));
+		}
+
+		switch (major)
+		{
+		case 0: RyanJsonCodecSetUint(item, arg); return RyanJsonTrue;
+		case 1:
+			// 负整数为 -1 - arg
+			if (arg <= (uint64_t)INT64_MAX) { RyanJsonCodecSetInt(item, -1 - (int64_t)arg); }
+			else
+			{
+				RyanJsonCodecSetDouble(item, -1.0 - (double)arg);
+			}
+			return RyanJsonTrue;
+		case 2: return RyanJsonCodecSetBytes(parseBuf, item, arg);
+		case 3: return RyanJsonCodecSetString(parseBuf, item, arg);
+		case 4:
+		case 5: {
+			RyanjsonType_e type = (4U == major) ? RyanJsonTypeArray : RyanJsonTypeObject;
+			if (isIndefinite)
+			{
+				item->type = type;
+				item->len = RyanJsonCodecIndefinite;
+				return RyanJsonTrue;
+			}
+			return RyanJsonCodecSetContainer(parseBuf, item, type, arg);
+		}
+		case 6: continue; // tag
+		default: return RyanJsonFalse;
+		}
+	}
+}
+
+/**
+ * @brief 解码单个 MessagePack 数据项
+ */
+static RyanJsonBool_e RyanJsonParseMsgPackItem(RyanJsonParseBuffer *parseBuf, RyanJsonCodecItem_t *item)
+{
+	RyanJsonCheckReturnFalse(parseBufHasRemain(parseBuf));
+	uint32_t lead = *parseBuf->currentPtr;
+	parseBufAdvanceCurrentPrt(parseBuf, 1);
+
+	// fix 形式：类型与值/长度都在首字节中
+	if (lead <= 0x7fU)
+	{
+		RyanJsonCodecSetInt(item, (int64_t)lead);
+		return RyanJsonTrue;
+	}
+	if (lead >= 0xe0U)
+	{
+		RyanJsonCodecSetInt(item, (int64_t)lead - 256);
+		return RyanJsonTrue;
+	}
+	if (lead <= 0x8fU) { return RyanJsonCodecSetContainer(parseBuf, item, RyanJsonTypeObject, lead & 0x0fU); }
+	if (lead <= 0x9fU) { return RyanJsonCodecSetContainer(parseBuf, item, RyanJsonTypeArray, lead & 0x0fU); }
+	if (lead <= 0xbfU) { return RyanJsonCodecSetString(parseBuf, item, lead & 0x1fU); }
+
+	uint64_t value = 0;
+	switch (lead)
+	{
+	case 0xc0: item->type = RyanJsonTypeNull; return RyanJsonTrue;
+	case 0xc2:
+	case 0xc3:
+		item->type = RyanJsonTypeBool;
+		item->boolValue = RyanJsonMakeBool(0xc3U == lead);
+		return RyanJsonTrue;
+	case 0xca:
+		RyanJsonCheckReturnFalse(RyanJsonParseCodecUint(parseBuf, 4, &value));
+		RyanJsonCodecSetFloatBits(item, (uint32_t)value);
+		return RyanJsonTrue;
+	case 0xcb: {
+		RyanJsonCheckReturnFalse(RyanJsonParseCodecUint(parseBuf, 8, &value));
+		double number;
+		RyanJsonMemcpy(&number, &value, sizeof(number));
+		RyanJsonCodecSetDouble(item, number);
+		return RyanJsonTrue;
+	}
+	case 0xcc:
+	case 0xcd:
+	case 0xce:
+	case 0xcf:
+		RyanJsonCheckReturnFalse(RyanJsonParseCodecUint(parseBuf, 1U << (lead - 0xccU), &value));
+		RyanJsonCodecSetUint(item, value);
+		return RyanJsonTrue;
+	case 0xd0:
+	case 0xd1:
+	case 0xd2:
+	case 0xd3: {
+		uint32_t bits = 8U << (lead - 0xd0U);
+		RyanJsonCheckReturnFalse(RyanJsonParseCodecUint(parseBuf, bits / 8U, &value));
+		// 按补码符号扩展：负数为 -((~value & mask) + 1)，避免实现定义的有符号转换
+		uint64_t signBit = (uint64_t)1 << (bits - 1U);
+		uint64_t mask = signBit | (signBit - 1U);
+		RyanJsonCodecSetInt(item, (value & signBit) ? -(int64_t)(~value & mask) - 1 : (int64_t)value);
+		return RyanJsonTrue;
+	}
+	case 0xc4:
+	case 0xc5:
+	case 0xc6:
+		RyanJsonCheckReturnFalse(RyanJsonParseCodecUint(parseBuf, 1U << (lead - 0xc4U), &value));
+		return RyanJsonCodecSetBytes(parseBuf, item, value);
+	case 0xd9:
+	case 0xda:
+	case 0xdb:
+		RyanJsonCheckReturnFalse(RyanJsonParseCodecUint(parseBuf, 1U << (lead - 0xd9U), &value));
+		return RyanJsonCodecSetString(parseBuf, item, value);
+	case 0xdc:
+	case 0xdd:
+		RyanJsonCheckReturnFalse(RyanJsonParseCodecUint(parseBuf, (0xdcU == lead) ? 2U : 4U, &value));
+		return RyanJsonCodecSetContainer(parseBuf, item, RyanJsonTypeArray, value);
+	case 0xde:
+	case 0xdf:
+		RyanJsonCheckReturnFalse(RyanJsonParseCodecUint(parseBuf, (0xdeU == lead) ? 2U : 4U, &value));
+		return RyanJsonCodecSetContainer(parseBuf, item, RyanJsonTypeObject, value);
+	default: return RyanJsonFalse; // 0xc1 与 ext
+	}
+}
+
+static RyanJsonBool_e RyanJsonParseCodecItem(RyanJsonParseBuffer *parseBuf, RyanJsonCodec_e codec, RyanJsonCodecItem_t *item)
+{
+	if (RyanJsonCodecCbor == codec) { return RyanJsonParseCborItem(parseBuf, item); }
+	return RyanJsonParseMsgPackItem(parseBuf, item);
+}
+
+/**
+ * @brief 按数据项创建单个节点（容器为空容器）
+ */
+static RyanJson_t RyanJsonParseCodecNewNode(const RyanJsonCodecItem_t *item, const char *key)
+{
+	switch (item->type)
+	{
+	case RyanJsonTypeNull: return RyanJsonCreateNull(key);
+	case RyanJsonTypeBool: return RyanJsonCreateBool(key, item->boolValue);
+	case RyanJsonTypeNumber:
+		if (item->isDouble) { return RyanJsonCreateDouble(key, item->doubleValue); }
+		return RyanJsonCreateInt(key, item->intValue);
+	case RyanJsonTypeString: return RyanJsonInternalCreateStringWithLen(key, item->str, item->len, RyanJsonFalse);
+	case RyanJsonTypeBlob: return RyanJsonCreateBlob(key, item->str, item->len);
+	case RyanJsonTypeArray: return RyanJsonInternalCreateArrayAndKey(key);
+	case RyanJsonTypeObject: return RyanJsonInternalCreateObjectAndKey(key);
+	default: return NULL;
+	}
+}
+
+/**
+ * @brief 迭代解码器（与文本解析相同，使用线索链表维护父子关系）
+ * @note 定长容器需记录每层剩余成员数，这是唯一按层级增长的状态。
+ */
+static RyanJsonBool_e RyanJsonParseCodecIterative(RyanJsonParseBuffer *parseBuf, RyanJsonCodec_e codec, RyanJson_t *root)
+{
+	RyanJsonCheckAssert(NULL != parseBuf && NULL != root);
+
+	RyanJsonCodecItem_t item;
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonParseCodecItem(parseBuf, codec, &item));
+	*root = RyanJsonParseCodecNewNode(&item, NULL);
+	RyanJsonCheckReturnFalse(NULL != *root);
+
+	// 标量直接返回，无需迭代
+	if (RyanJsonTypeArray != item.type && RyanJsonTypeObject != item.type) { return RyanJsonTrue; }
+
+	uint32_t remainInline[RyanJsonCodecInlineDepth];
+	uint32_t *remain = remainInline; // 各层剩余成员数
+	uint32_t remainCap = RyanJsonCodecInlineDepth;
+	uint32_t depth = 0;
+	remain[0] = item.len;
+
+	RyanJson_t scopeParent = *root;
+	RyanJson_t lastSibling = NULL;
+
+	char shortKey[RyanJsonInlineStringSize];
+	char *key = NULL;
+	RyanJsonBool_e isKeyAllocated = RyanJsonFalse;
+
+	while (1)
+	{
+		// 阶段：检查当前容器是否结束（成员数耗尽，或不定长容器遇到 break）
+		RyanJsonBool_e isEnd = RyanJsonMakeBool(0U == remain[depth]);
+		if (RyanJsonCodecIndefinite == remain[depth])
+		{
+			RyanJsonCheckCode(parseBufHasRemain(parseBuf), { goto error__; });
+			if (0xff == *parseBuf->currentPtr)
+			{
+				parseBufAdvanceCurrentPrt(parseBuf, 1);
+				isEnd = RyanJsonTrue;
+			}
+		}
+
+		if (isEnd)
+		{
+#if true == RyanJsonPackedArray
+			// 与文本解析一致：闭合的 Array 满足条件时转为紧凑存储
+			if (_checkType(scopeParent, RyanJsonTypeArray) && 0U != RyanJsonPackedArrayParseMinSize)
+			{
+				RyanJsonInternalPackedTryPack(scopeParent, RyanJsonPackedArrayParseMinSize);
+			}
+#endif
+			if (scopeParent == *root) { break; }
+
+			lastSibling = scopeParent;
+			scopeParent = scopeParent->next;
+			depth--;
+			continue;
+		}
+		if (RyanJsonCodecIndefinite != remain[depth]) { remain[depth]--; }
+
+		// 阶段：解码 Object key（必须是字符串），复制为 '\0' 结尾供节点创建
+		if (_checkType(scopeParent, RyanJsonTypeObject))
+		{
+			RyanJsonCheckCode(RyanJsonTrue == RyanJsonParseCodecItem(parseBuf, codec, &item) && RyanJsonTypeString == item.type,
+					  { goto error__; });
+
+			if (item.len + 1U > RyanJsonInlineStringSize)
+			{
+				key = (char *)jsonMalloc((size_t)item.len + 1U);
+				RyanJsonCheckCode(NULL != key, { goto error__; });
+				isKeyAllocated = RyanJsonTrue;
+			}
+			else
+			{
+				key = shortKey;
+			}
+			RyanJsonMemcpy(key, item.str, item.len);
+			key[item.len] = '\0';
+
+#if true == RyanJsonStrictObjectKeyCheck
+			RyanJsonCheckCode(RyanJsonFalse == RyanJsonHasObjectByKey(scopeParent, key), { goto error__; });
+#endif
+		}
+
+		// 阶段：解码 value 并挂接到父容器
+		RyanJsonCheckCode(RyanJsonTrue == RyanJsonParseCodecItem(parseBuf, codec, &item), { goto error__; });
+		RyanJson_t newItem = RyanJsonParseCodecNewNode(&item, key);
+		if (isKeyAllocated)
+		{
+			jsonFree(key);
+			isKeyAllocated = RyanJsonFalse;
+		}
+		key = NULL;
+		RyanJsonCheckCode(NULL != newItem, { goto error__; });
+
+		RyanJsonInternalListInsertAfter(scopeParent, lastSibling, newItem);
+#if true == RyanJsonObjectHashIndex
+		// 严格模式的重复 key 检查可能已为该 Object 建立索引，需同步维护
+		RyanJsonInternalKeyIndexAdd(scopeParent, newItem);
+#endif
+		lastSibling = newItem;
+
+		// 阶段：遇到容器时下沉
+		if (RyanJsonTypeArray == item.type || RyanJsonTypeObject == item.type)
+		{
+			if (depth + 1U == remainCap)
+			{
+				uint32_t *newRemain = (uint32_t *)jsonMalloc((size_t)remainCap * 2U * sizeof(uint32_t));
+				RyanJsonCheckCode(NULL != newRemain, { goto error__; });
+				RyanJsonMemcpy(newRemain, remain, (size_t)remainCap * sizeof(uint32_t));
+				if (remain != remainInline) { jsonFree(remain); }
+				remain = newRemain;
+				remainCap *= 2U;
+			}
+
+			depth++;
+			remain[depth] = item.len;
+			scopeParent = newItem;
+			lastSibling = NULL;
+		}
+	}
+
+	if (remain != remainInline) { jsonFree(remain); }
+	return RyanJsonTrue;
+
+error__:
+	if (isKeyAllocated) { jsonFree(key); }
+	if (remain != remainInline) { jsonFree(remain); }
+	RyanJsonDelete(*root);
+	*root = NULL;
+	return RyanJsonFalse;
+}
+
+/**
+ * @brief 解码 CBOR/MessagePack 为 Json 树
+ *
+ * @param data 编码数据
+ * @param size 数据长度
+ * @param codec 编码格式
+ * @param usedLen 输出消费的字节数；为 NULL 时要求数据恰好是一个完整数据项
+ * @return RyanJson_t 解码成功返回根节点，失败返回 NULL
+ * @note usedLen 仅在解码成功时写入，可据此依次解码首尾相接的多个数据项。
+ */
+RyanJson_t RyanJsonParseCodec(const void *data, uint32_t size, RyanJsonCodec_e codec, uint32_t *usedLen)
+{
+	RyanJsonCheckReturnNull(NULL != data);
+	RyanJsonCheckReturnNull(RyanJsonCodecCbor == codec || RyanJsonCodecMsgPack == codec);
+
+	RyanJsonParseBuffer parseBuf = {.currentPtr = (const uint8_t *)data, .remainSize = size};
+	RyanJson_t pJson;
+	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonParseCodecIterative(&parseBuf, codec, &pJson));
+
+	if (NULL == usedLen)
+	{
+		RyanJsonCheckCode(!parseBufHasRemain(&parseBuf), {
+			RyanJsonDelete(pJson);
+			return NULL;
+		});
+	}
+	else
+	{
+		*usedLen = size - parseBuf.remainSize;
+	}
+
+	return pJson;
+}
+
+/**
+ * @brief 解析原始 Number 文本（打印回读校验与懒数值取值）
+ *
+ * @param currentPtr Number 文本起始地址
+ * @param remainSize Number 文本长度
+ * @param numberValuePtr 输出数值
+ * @param isIntPtr 输出文本是否为整数写法（无小数与指数部分），可为 NULL
+ * @return RyanJsonBool_e 解析是否成功
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalParseDoubleRaw(const uint8_t *currentPtr, uint32_t remainSize, double *numberValuePtr,
+								  RyanJsonBool_e *isIntPtr)
+{
+	RyanJsonCheckAssert(NULL != currentPtr && NULL != numberValuePtr);
+	RyanJsonCheckAssert(remainSize > 0);
+
+	RyanJsonBool_e isInt = RyanJsonTrue;
+	RyanJsonParseBuffer parseBuf = {.currentPtr = currentPtr, .remainSize = remainSize};
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalParseDouble(&parseBuf, numberValuePtr, &isInt));
+	if (NULL != isIntPtr) { *isIntPtr = isInt; }
+	return RyanJsonTrue;
 }
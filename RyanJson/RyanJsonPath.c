@@ -0,0 +1,172 @@
+#include "RyanJsonInternal.h"
+
+#define RyanJsonPathNoIndex UINT32_MAX
+
+/**
+ * @brief 预编译路径中的一级
+ * @note key 已完成 ~0/~1 反转义，指向句柄尾部的 key 池，不以 '\0' 结尾。
+ */
+typedef struct
+{
+	const char *key;
+	uint32_t keyLen;
+	uint32_t hash;  // RyanJsonInternalKeyHash(key, keyLen)，Object 查找直接复用
+	uint32_t index; // 合法数组下标，否则为 RyanJsonPathNoIndex
+} RyanJsonPathSegment_t;
+
+/**
+ * @brief 预编译路径：[头部 | 段数组 | key 池]，一次申请
+ */
+struct RyanJsonPath
+{
+	uint32_t count;
+	RyanJsonPathSegment_t segments[];
+};
+
+/**
+ * @brief 扫描一级引用（不含前导 '/'）
+ *
+ * @param text 段起始
+ * @param out 反转义输出，NULL 时只校验并计数
+ * @param lenPtr 输出反转义后的字节数
+ * @return const char* 段结束位置（'/' 或 '\0'），含非法 '~' 转义时返回 NULL
+ */
+static const char *RyanJsonPathScanSegment(const char *text, char *out, uint32_t *lenPtr)
+{
+	uint32_t len = 0;
+	while ('\0' != *text && '/' != *text)
+	{
+		char ch = *text++;
+		if ('~' == ch)
+		{
+			if ('0' == *text) { ch = '~'; }
+			else if ('1' == *text) { ch = '/'; }
+			else
+			{
+				return NULL;
+			}
+			text++;
+		}
+		if (NULL != out) { out[len] = ch; }
+		len++;
+	}
+	*lenPtr = len;
+	return text;
+}
+
+/**
+ * @brief 按 RFC 6901 的 array-index 语法解析下标
+ * @note 只接受 "0" 或无前导零的十进制数；"-"、前导零与超出 uint32 的值都不是下标。
+ */
+static uint32_t RyanJsonPathParseIndex(const char *key, uint32_t keyLen)
+{
+	if (0 == keyLen || keyLen > 10U || (keyLen > 1U && '0' == key[0])) { return RyanJsonPathNoIndex; }
+
+	uint64_t index = 0;
+	for (uint32_t i = 0; i < keyLen; i++)
+	{
+		if (key[i] < '0' || key[i] > '9') { return RyanJsonPathNoIndex; }
+		index = index * 10U + (uint64_t)(key[i] - '0');
+	}
+	if (index >= RyanJsonPathNoIndex) { return RyanJsonPathNoIndex; }
+	return (uint32_t)index;
+}
+
+/**
+ * @brief 编译 JSON Pointer（RFC 6901）
+ *
+ * @param pointer 形如 "/cfg/net/0/ip" 的路径，"" 表示根节点
+ * @return RyanJsonPath_t 编译结果，语法错误或内存不足返回 NULL
+ * @note 编译时完成分段、~0/~1 反转义、key 哈希与数组下标解析，之后求值不再申请内存。
+ */
+RyanJsonPath_t RyanJsonPathCompile(const char *pointer)
+{
+	RyanJsonCheckReturnNull(NULL != pointer);
+	RyanJsonCheckReturnNull('\0' == *pointer || '/' == *pointer);
+
+	// 第一遍：校验并统计段数与 key 总字节数
+	uint32_t count = 0;
+	uint32_t poolSize = 0;
+	const char *text = pointer;
+	while ('\0' != *text)
+	{
+		uint32_t keyLen;
+		text = RyanJsonPathScanSegment(text + 1, NULL, &keyLen);
+		RyanJsonCheckReturnNull(NULL != text);
+		count++;
+		poolSize += keyLen;
+	}
+
+	size_t headSize = sizeof(struct RyanJsonPath) + (size_t)count * sizeof(RyanJsonPathSegment_t);
+	RyanJsonPath_t path = (RyanJsonPath_t)jsonMalloc(headSize + poolSize);
+	RyanJsonCheckReturnNull(NULL != path);
+	path->count = count;
+
+	// 第二遍：反转义到 key 池并预计算哈希与下标
+	char *pool = (char *)path + headSize;
+	text = pointer;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		RyanJsonPathSegment_t *segment = &path->segments[i];
+		text = RyanJsonPathScanSegment(text + 1, pool, &segment->keyLen);
+		RyanJsonCheckAssert(NULL != text);
+		segment->key = pool;
+		segment->hash = RyanJsonInternalKeyHash(pool, segment->keyLen);
+		segment->index = RyanJsonPathParseIndex(pool, segment->keyLen);
+		pool += segment->keyLen;
+	}
+
+	return path;
+}
+
+/**
+ * @brief 释放预编译路径
+ */
+void RyanJsonPathDelete(RyanJsonPath_t path)
+{
+	RyanJsonCheckCode(NULL != path, { return; });
+	jsonFree(path);
+}
+
+/**
+ * @brief 返回路径段数（"" 为 0）
+ */
+uint32_t RyanJsonPathGetCount(RyanJsonPath_t path)
+{
+	RyanJsonCheckCode(NULL != path, { return 0; });
+	return path->count;
+}
+
+/**
+ * @brief 在文档上对预编译路径求值
+ *
+ * @param pJson 起始节点
+ * @param path RyanJsonPathCompile 的结果
+ * @return RyanJson_t 目标节点，路径不存在返回 NULL
+ * @note Object 按预计算的哈希与长度查找 key；Array 只接受合法下标，"-" 与越界均视为不存在；
+ *       向标量继续下钻返回 NULL。求值不申请内存（紧凑数组按下标取值时的展开除外）。
+ */
+RyanJson_t RyanJsonPathGet(RyanJson_t pJson, RyanJsonPath_t path)
+{
+	RyanJsonCheckReturnNull(NULL != pJson && NULL != path);
+
+	RyanJson_t item = pJson;
+	for (uint32_t i = 0; i < path->count && NULL != item; i++)
+	{
+		const RyanJsonPathSegment_t *segment = &path->segments[i];
+		if (RyanJsonIsObject(item))
+		{
+			item = RyanJsonInternalGetObjectByKeyHash(item, segment->key, segment->keyLen, segment->hash);
+		}
+		else if (RyanJsonIsArray(item) && RyanJsonPathNoIndex != segment->index)
+		{
+			item = RyanJsonGetObjectByIndex(item, segment->index);
+		}
+		else
+		{
+			return NULL;
+		}
+	}
+
+	return item;
+}
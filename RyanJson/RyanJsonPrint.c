@@ -6,6 +6,10 @@ typedef struct
 	uint32_t cursor;          // 当前写入位置（字节偏移）
 	uint32_t size;            // 缓冲区总容量，禁止扩容时写满即返回失败
 	RyanJsonBool_e isNoAlloc; // 是否禁止动态扩容（True 表示不扩容）
+	RyanJsonIoVec_t *iov;     // iovec 输出模式的片段数组，NULL 表示连续输出
+	uint32_t iovCap;          // 片段数组容量
+	uint32_t iovCount;        // 已输出片段数量
+	uint32_t segStart;        // 暂存区中尚未输出为片段的起始位置
 } RyanJsonPrintBuffer;
 
 static inline void RyanJsonPrintBufPutChar(RyanJsonPrintBuffer *printfBuf, uint8_t ch)
@@ -19,10 +23,8 @@ static inline void RyanJsonPrintBufPutString(RyanJsonPrintBuffer *printfBuf, con
 	RyanJsonCheckAssert(NULL != printfBuf && NULL != printfBuf->bufAddress);
 	RyanJsonCheckAssert(NULL != putStr);
 
-	for (uint32_t putStrCount = 0; putStrCount < putStrLen; putStrCount++)
-	{
-		printfBuf->bufAddress[printfBuf->cursor++] = putStr[putStrCount];
-	}
+	RyanJsonMemcpy(printfBuf->bufAddress + printfBuf->cursor, putStr, putStrLen);
+	printfBuf->cursor += putStrLen;
 }
 
 #define printBufCurrentPtr(printfBuf)  (&((printfBuf)->bufAddress[(printfBuf)->cursor]))
@@ -108,37 +110,37 @@ static int32_t RyanJsonTrimDoubleTrailingZeros(RyanJsonPrintBuffer *printfBuf, i
 }
 
 /**
- * @brief 打印 Number 节点
+ * @brief 打印 int32_t 数值
  */
-static RyanJsonBool_e RyanJsonPrintNumber(RyanJson_t pJson, RyanJsonPrintBuffer *printfBuf)
+static RyanJsonBool_e RyanJsonPrintIntValue(int32_t intValue, RyanJsonPrintBuffer *printfBuf)
 {
-	RyanJsonCheckAssert(NULL != pJson && NULL != printfBuf);
+	RyanJsonCheckAssert(NULL != printfBuf);
 
-	int32_t len;
+	// INT32_MIN = -2147483648 (11 chars) + '\0'
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 12));
 
-	// Number 节点按 int32_t 存储
-	if (RyanJsonFalse == RyanJsonGetPayloadNumberIsDoubleByFlag(pJson))
-	{
-		// INT32_MIN = -2147483648 (11 chars) + '\0'
-		RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 12));
+	int32_t len = RyanJsonSnprintf((char *)printBufCurrentPtr(printfBuf), printBufRemainBytes(printfBuf), "%" PRId32, intValue);
+	// 这里前面已保证至少 12 字节空间（INT32_MIN + '\0'），正常实现下不会截断
+	RyanJsonCheckReturnFalse(len > 0);
+	printfBuf->cursor += (uint32_t)len;
 
-		len = RyanJsonSnprintf((char *)printBufCurrentPtr(printfBuf), printBufRemainBytes(printfBuf), "%" PRId32,
-				       RyanJsonGetIntValue(pJson));
-		// 这里前面已保证至少 12 字节空间（INT32_MIN + '\0'），正常实现下不会截断
-		RyanJsonCheckReturnFalse(len > 0);
-		printfBuf->cursor += (uint32_t)len;
+	return RyanJsonTrue;
+}
 
-		return RyanJsonTrue;
-	}
+/**
+ * @brief 打印 Double 数值
+ */
+static RyanJsonBool_e RyanJsonPrintDoubleValue(double doubleValue, RyanJsonPrintBuffer *printfBuf)
+{
+	RyanJsonCheckAssert(NULL != printfBuf);
 
-	// Number 节点按 Double 值存储
+	int32_t len;
 	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, RyanJsonDoubleBufferSize));
-	double doubleValue = RyanJsonGetDoubleValue(pJson);
 
 	// 处理特殊值：无穷大和 NaN 输出为 Null（RFC 8259 不支持 Infinity/NaN）
 	if (isinf(doubleValue) || isnan(doubleValue))
 	{
-		RyanJsonPrintBufPutString(printfBuf, (uint8_t *)"null", 4);
+		RyanJsonPrintBufPutString(printfBuf, (const uint8_t *)"null", 4);
 		return RyanJsonTrue;
 	}
 
@@ -186,7 +188,7 @@ static RyanJsonBool_e RyanJsonPrintNumber(RyanJson_t pJson, RyanJsonPrintBuffer
 		// 如果精度不够，改用 %.17g
 		double number = 0;
 		RyanJsonCheckReturnFalse(RyanJsonTrue ==
-					 RyanJsonInternalParseDoubleRaw(printBufCurrentPtr(printfBuf), (uint32_t)len, &number));
+					 RyanJsonInternalParseDoubleRaw(printBufCurrentPtr(printfBuf), (uint32_t)len, &number, NULL));
 		// 容差比较可能把极小非零值与 0 视为相等，这里额外拦截“非零被抹成 0”的情况
 		RyanJsonBool_e loseTinyNonZero = RyanJsonMakeBool(number == 0.0);
 		if (RyanJsonTrue == loseTinyNonZero || RyanJsonFalse == RyanJsonCompareDouble(number, doubleValue))
@@ -209,81 +211,120 @@ static RyanJsonBool_e RyanJsonPrintNumber(RyanJson_t pJson, RyanJsonPrintBuffer
 }
 
 /**
- * @brief 打印字符串并执行转义
+ * @brief 打印 Number 节点
  */
-static RyanJsonBool_e RyanJsonPrintStringBuffer(const uint8_t *strValue, RyanJsonPrintBuffer *printfBuf)
+static RyanJsonBool_e RyanJsonPrintNumber(RyanJson_t pJson, RyanJsonPrintBuffer *printfBuf)
 {
-	RyanJsonCheckAssert(NULL != strValue && NULL != printfBuf);
-	// 获取长度
-	const uint8_t *strCurrentPtr = strValue;
-	uint32_t escapeCharCount = 0;
-	for (strCurrentPtr = strValue; *strCurrentPtr; strCurrentPtr++)
+	RyanJsonCheckAssert(NULL != pJson && NULL != printfBuf);
+
+	// 未转换的懒数值原样输出源文本
+	if (RyanJsonInternalIsLazyNumber(pJson))
 	{
-		switch (*strCurrentPtr)
-		{
-		case '\"':
-		case '\\':
-		case '\b':
-		case '\f':
-		case '\n':
-		case '\r':
-		case '\t':
-		case '/': escapeCharCount++; break;
-
-		default:
-			// 按最坏情况预留转义空间，保证后续写入安全
-			if (*strCurrentPtr < 32) { escapeCharCount += 5; }
-			break;
-		}
+		const char *text = RyanJsonInternalGetLazyNumberText(pJson);
+		uint32_t len = (uint32_t)RyanJsonStrlen(text);
+		RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, len));
+		RyanJsonPrintBufPutString(printfBuf, (const uint8_t *)text, len);
+		return RyanJsonTrue;
 	}
 
-	RyanJsonCheckReturnFalse(
-		RyanJsonPrintBufAppend(printfBuf, (uint32_t)(strCurrentPtr - strValue) + escapeCharCount + 2U)); // 最小是\" \"
-	RyanJsonPrintBufPutChar(printfBuf, '\"');
-
-	// 没有转义字符
-	if (0 == escapeCharCount)
+	// Number 节点按 int32_t 存储
+	if (RyanJsonFalse == RyanJsonGetPayloadNumberIsDoubleByFlag(pJson))
 	{
-		RyanJsonPrintBufPutString(printfBuf, strValue, (uint32_t)(strCurrentPtr - strValue));
-		RyanJsonPrintBufPutChar(printfBuf, '\"');
-		return RyanJsonTrue;
+		return RyanJsonPrintIntValue(RyanJsonGetIntValue(pJson), printfBuf);
 	}
 
-	strCurrentPtr = strValue;
-	while (*strCurrentPtr)
+	// Number 节点按 Double 值存储
+	return RyanJsonPrintDoubleValue(RyanJsonGetDoubleValue(pJson), printfBuf);
+}
+
+/**
+ * @brief 打印字符串并执行转义（单遍扫描）
+ * @details
+ * 按转义表定位下一个需要转义的字节，中间的普通字节段整段 memcpy，
+ * 不再先统计转义数量再逐字节回写，长字符串只遍历一次。
+ * 缓冲区按实际输出长度逐段扩容，预分配模式下只要最终输出放得下即可成功。
+ */
+static RyanJsonBool_e RyanJsonPrintStringBuffer(const uint8_t *strValue, RyanJsonPrintBuffer *printfBuf)
+{
+	static const uint8_t hexDigits[] = "0123456789ABCDEF";
+	RyanJsonCheckAssert(NULL != strValue && NULL != printfBuf);
+
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 1));
+	RyanJsonPrintBufPutChar(printfBuf, '\"');
+
+	const uint8_t *strCurrentPtr = strValue;
+	while (1)
 	{
-		if ((*strCurrentPtr) >= ' ' && '\"' != *strCurrentPtr && '\\' != *strCurrentPtr)
+		// 定位普通字节段，'\0' 在表中非 0，循环必然在字符串末尾停下
+		const uint8_t *runStart = strCurrentPtr;
+		while (0 == RyanJsonInternalEscapeTable[*strCurrentPtr])
 		{
-			RyanJsonPrintBufPutChar(printfBuf, *strCurrentPtr++);
-			continue;
+			strCurrentPtr++;
 		}
 
-		// 转义和打印
-		RyanJsonPrintBufPutChar(printfBuf, '\\');
+		// 段长 + 1，为结束引号或下一个转义序列的首字节一并预留
+		uint32_t runLen = (uint32_t)(strCurrentPtr - runStart);
+		RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, runLen + 1U));
+		RyanJsonPrintBufPutString(printfBuf, runStart, runLen);
+
+		if ('\0' == *strCurrentPtr) { break; }
 
-		switch (*strCurrentPtr)
+		uint8_t escapeCh = RyanJsonInternalEscapeTable[*strCurrentPtr];
+		if ('u' == escapeCh)
 		{
-		case '\\': RyanJsonPrintBufPutChar(printfBuf, '\\'); break;
-		case '\"': RyanJsonPrintBufPutChar(printfBuf, '\"'); break;
-		case '\b': RyanJsonPrintBufPutChar(printfBuf, 'b'); break;
-		case '\f': RyanJsonPrintBufPutChar(printfBuf, 'f'); break;
-		case '\n': RyanJsonPrintBufPutChar(printfBuf, 'n'); break;
-		case '\r': RyanJsonPrintBufPutChar(printfBuf, 'r'); break;
-		case '\t': RyanJsonPrintBufPutChar(printfBuf, 't'); break;
-
-		default: {
 			// 这里按字节转义，不做 UTF-8 合法性校验
-			RyanJsonCheckReturnFalse(5 == RyanJsonSnprintf((char *)printBufCurrentPtr(printfBuf),
-								       printBufRemainBytes(printfBuf), "u%04X", *strCurrentPtr));
-			printfBuf->cursor += 5; // uXXXX 四位十六进制编码
-			break;
+			RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 6));
+			RyanJsonPrintBufPutString(printfBuf, (const uint8_t *)"\\u00", 4);
+			RyanJsonPrintBufPutChar(printfBuf, hexDigits[*strCurrentPtr >> 4]);
+			RyanJsonPrintBufPutChar(printfBuf, hexDigits[*strCurrentPtr & 0x0F]);
 		}
+		else
+		{
+			RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 2));
+			RyanJsonPrintBufPutChar(printfBuf, '\\');
+			RyanJsonPrintBufPutChar(printfBuf, escapeCh);
 		}
 		strCurrentPtr++;
 	}
 
 	RyanJsonPrintBufPutChar(printfBuf, '\"');
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief iovec 模式：把暂存区中尚未输出的内容收尾为一个片段
+ */
+static RyanJsonBool_e RyanJsonPrintIoVecFlush(RyanJsonPrintBuffer *printfBuf)
+{
+	RyanJsonCheckAssert(NULL != printfBuf && NULL != printfBuf->iov);
+
+	if (printfBuf->cursor == printfBuf->segStart) { return RyanJsonTrue; }
+	RyanJsonCheckReturnFalse(printfBuf->iovCount < printfBuf->iovCap);
+
+	printfBuf->iov[printfBuf->iovCount].base = printfBuf->bufAddress + printfBuf->segStart;
+	printfBuf->iov[printfBuf->iovCount].len = printfBuf->cursor - printfBuf->segStart;
+	printfBuf->iovCount++;
+	printfBuf->segStart = printfBuf->cursor;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief iovec 模式：直接引用节点存储中的字符串内容
+ * @note 引号仍写入暂存区，字符串本体作为独立片段，不经过拷贝。
+ */
+static RyanJsonBool_e RyanJsonPrintIoVecRef(const char *strValue, uint32_t len, RyanJsonPrintBuffer *printfBuf)
+{
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 1));
+	RyanJsonPrintBufPutChar(printfBuf, '\"');
+	RyanJsonCheckReturnFalse(RyanJsonPrintIoVecFlush(printfBuf));
+
+	RyanJsonCheckReturnFalse(printfBuf->iovCount < printfBuf->iovCap);
+	printfBuf->iov[printfBuf->iovCount].base = strValue;
+	printfBuf->iov[printfBuf->iovCount].len = len;
+	printfBuf->iovCount++;
 
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 1));
+	RyanJsonPrintBufPutChar(printfBuf, '\"');
 	return RyanJsonTrue;
 }
 
@@ -297,8 +338,206 @@ static RyanJsonBool_e RyanJsonPrintStringBuffer(const uint8_t *strValue, RyanJso
 static RyanJsonBool_e RyanJsonPrintString(RyanJson_t pJson, RyanJsonPrintBuffer *printfBuf)
 {
 	RyanJsonCheckAssert(NULL != pJson && NULL != printfBuf);
-	return RyanJsonPrintStringBuffer((const uint8_t *)RyanJsonGetStringValue(pJson), printfBuf);
+
+	// 已知无需转义时按缓存长度整段拷贝，跳过逐字节转义扫描；懒字符串的源文本同样整段输出，不触发解码
+	uint32_t len = 0;
+	const char *strValue = RyanJsonInternalGetStrValue(pJson);
+	if (RyanJsonTrue == RyanJsonInternalGetStrValueInfo(pJson, &len))
+	{
+		// iovec 模式下长字符串直接引用节点存储
+		if (NULL != printfBuf->iov && len >= RyanJsonPrintIoVecRefMinSize)
+		{
+			return RyanJsonPrintIoVecRef(strValue, len, printfBuf);
+		}
+
+		RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, len + 2U));
+		RyanJsonPrintBufPutChar(printfBuf, '\"');
+		RyanJsonPrintBufPutString(printfBuf, (const uint8_t *)strValue, len);
+		RyanJsonPrintBufPutChar(printfBuf, '\"');
+		return RyanJsonTrue;
+	}
+
+	return RyanJsonPrintStringBuffer((const uint8_t *)strValue, printfBuf);
+}
+
+/**
+ * @brief 打印 Blob 节点：数据按标准 base64（带填充）编码后输出为字符串
+ * @note base64 字母表不含需要转义的字符，直接编码到输出缓冲，不经过中间缓冲。
+ */
+static RyanJsonBool_e RyanJsonPrintBlob(RyanJson_t pJson, RyanJsonPrintBuffer *printfBuf)
+{
+	RyanJsonCheckAssert(NULL != pJson && NULL != printfBuf);
+
+	uint32_t len;
+	const uint8_t *data = RyanJsonGetBlobValue(pJson, &len);
+	RyanJsonCheckReturnFalse(len <= RyanJsonBase64MaxRawLen);
+
+	uint32_t textLen = RyanJsonBase64EncodedLen(len);
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, textLen + 2U));
+	RyanJsonPrintBufPutChar(printfBuf, '\"');
+	printfBuf->cursor += RyanJsonInternalBase64Encode(data, len, printBufCurrentPtr(printfBuf));
+	RyanJsonPrintBufPutChar(printfBuf, '\"');
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 打印 Raw 节点：文本创建时已校验，原样输出
+ * @note 格式化模式下内部不重新缩进；iovec 模式下长文本直接引用节点存储。
+ */
+static RyanJsonBool_e RyanJsonPrintRaw(RyanJson_t pJson, RyanJsonPrintBuffer *printfBuf)
+{
+	RyanJsonCheckAssert(NULL != pJson && NULL != printfBuf);
+
+	uint32_t len = 0;
+	const char *text = RyanJsonGetRawValue(pJson, &len);
+	if (NULL != printfBuf->iov && len >= RyanJsonPrintIoVecRefMinSize)
+	{
+		RyanJsonCheckReturnFalse(RyanJsonPrintIoVecFlush(printfBuf));
+		RyanJsonCheckReturnFalse(printfBuf->iovCount < printfBuf->iovCap);
+		printfBuf->iov[printfBuf->iovCount].base = text;
+		printfBuf->iov[printfBuf->iovCount].len = len;
+		printfBuf->iovCount++;
+		return RyanJsonTrue;
+	}
+
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, len));
+	RyanJsonPrintBufPutString(printfBuf, (const uint8_t *)text, len);
+	return RyanJsonTrue;
+}
+
+#if true == RyanJsonPackedArray
+/**
+ * @brief 格式化模式下输出 depth 层缩进
+ */
+static RyanJsonBool_e RyanJsonPrintPackedIndent(RyanJsonPrintBuffer *printfBuf, uint32_t depth, const RyanJsonPrintStyle *style)
+{
+	if (!style->format) { return RyanJsonTrue; }
+
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, depth * style->indentLen));
+	for (uint32_t i = 0; i < depth; i++)
+	{
+		RyanJsonPrintBufPutString(printfBuf, (uint8_t *)style->indent, style->indentLen);
+	}
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 输出容器的开/闭符号或元素分隔符，格式化模式下在符号之后（开/分隔）或之前（闭）换行
+ */
+static RyanJsonBool_e RyanJsonPrintPackedPunct(RyanJsonPrintBuffer *printfBuf, char ch, RyanJsonBool_e isClose, uint32_t depth,
+					       const RyanJsonPrintStyle *style)
+{
+	uint32_t newlineLen = style->format ? style->newlineLen : 0;
+	if (isClose)
+	{
+		RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, newlineLen));
+		if (style->format) { RyanJsonPrintBufPutString(printfBuf, (uint8_t *)style->newline, newlineLen); }
+		RyanJsonCheckReturnFalse(RyanJsonPrintPackedIndent(printfBuf, depth, style));
+	}
+
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 1 + newlineLen));
+	RyanJsonPrintBufPutChar(printfBuf, ch);
+	if (!isClose && style->format) { RyanJsonPrintBufPutString(printfBuf, (uint8_t *)style->newline, newlineLen); }
+	return RyanJsonTrue;
+}
+
+static RyanJsonBool_e RyanJsonPrintPackedValue(const RyanJsonPackedHead_t *head, uint32_t col, uint32_t row, RyanJsonPrintBuffer *printfBuf)
+{
+	if (RyanJsonInternalPackedColumnIsDouble(head, col))
+	{
+		return RyanJsonPrintDoubleValue(RyanJsonInternalPackedGetDouble(head, col, row), printfBuf);
+	}
+	return RyanJsonPrintIntValue(RyanJsonInternalPackedGetInt(head, col, row), printfBuf);
+}
+
+/**
+ * @brief 直接从数据块打印紧凑数组（含列存表），输出与等价的普通 Array 一致
+ *
+ * @param pJson 紧凑 Array 节点
+ * @param printfBuf 打印缓冲区
+ * @param depth 当前节点所在层级
+ * @param style 打印风格
+ * @return RyanJsonBool_e 打印是否成功
+ */
+static RyanJsonBool_e RyanJsonPrintPackedArray(RyanJson_t pJson, RyanJsonPrintBuffer *printfBuf, uint32_t depth,
+					       const RyanJsonPrintStyle *style)
+{
+	const RyanJsonPackedHead_t *head = RyanJsonInternalGetPacked(pJson);
+	uint32_t colCount = RyanJsonInternalPackedColumnCount(head);
+	RyanJsonBool_e isTable = RyanJsonMakeBool(RyanJsonPackedIsTable(head));
+
+	RyanJsonCheckReturnFalse(RyanJsonPrintPackedPunct(printfBuf, '[', RyanJsonFalse, depth, style));
+	for (uint32_t row = 0; row < head->count; row++)
+	{
+		RyanJsonCheckReturnFalse(RyanJsonPrintPackedIndent(printfBuf, depth + 1U, style));
+		if (!isTable) { RyanJsonCheckReturnFalse(RyanJsonPrintPackedValue(head, 0, row, printfBuf)); }
+		else
+		{
+			// 行按 Object 输出，与普通节点打印的 key/冒号/缩进规则一致
+			RyanJsonCheckReturnFalse(RyanJsonPrintPackedPunct(printfBuf, '{', RyanJsonFalse, depth + 1U, style));
+			for (uint32_t col = 0; col < colCount; col++)
+			{
+				uint32_t keyLen;
+				const char *key = RyanJsonInternalPackedColumnKey(head, col, &keyLen);
+				RyanJsonCheckReturnFalse(RyanJsonPrintPackedIndent(printfBuf, depth + 2U, style));
+				RyanJsonCheckReturnFalse(RyanJsonPrintStringBuffer((const uint8_t *)key, printfBuf));
+
+				uint32_t spaceLen = style->format ? style->spaceAfterColon : 0;
+				RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 1 + spaceLen));
+				RyanJsonPrintBufPutChar(printfBuf, ':');
+				for (uint32_t i = 0; i < spaceLen; i++)
+				{
+					RyanJsonPrintBufPutChar(printfBuf, ' ');
+				}
+
+				RyanJsonCheckReturnFalse(RyanJsonPrintPackedValue(head, col, row, printfBuf));
+				if (col + 1U < colCount)
+				{
+					RyanJsonCheckReturnFalse(RyanJsonPrintPackedPunct(printfBuf, ',', RyanJsonFalse, 0, style));
+				}
+			}
+			RyanJsonCheckReturnFalse(RyanJsonPrintPackedPunct(printfBuf, '}', RyanJsonTrue, depth + 1U, style));
+		}
+
+		if (row + 1U < head->count) { RyanJsonCheckReturnFalse(RyanJsonPrintPackedPunct(printfBuf, ',', RyanJsonFalse, 0, style)); }
+	}
+	return RyanJsonPrintPackedPunct(printfBuf, ']', RyanJsonTrue, depth, style);
+}
+#endif
+
+#if true == RyanJsonPrintCache
+/**
+ * @brief 容器闭合时保存其紧凑打印片段
+ * @note 片段长度不在缓存区间内或申请失败时放弃缓存，并释放仅用于记录起点的扩展信息。
+ * @note 缓存成功后丢弃直接子容器的缓存（其内容已包含在本片段中），保证缓存互不嵌套。
+ */
+static void RyanJsonPrintCacheStore(RyanJson_t pJson, const RyanJsonPrintBuffer *printfBuf)
+{
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	if (NULL == ext) { return; }
+
+	uint32_t len = printfBuf->cursor - ext->printStart;
+	uint8_t *cache = NULL;
+	if (len >= RyanJsonPrintCacheMinSize && len <= RyanJsonPrintCacheMaxSize) { cache = (uint8_t *)jsonMalloc(len); }
+	if (NULL == cache)
+	{
+		RyanJsonInternalTrimContainerExt(pJson);
+		return;
+	}
+
+	RyanJsonMemcpy(cache, printfBuf->bufAddress + ext->printStart, len);
+	ext->printCache = cache;
+	ext->printCacheLen = len;
+
+	for (RyanJson_t child = RyanJsonGetObjectValue(pJson); NULL != child; child = RyanJsonGetNext(child))
+	{
+		if (_checkType(child, RyanJsonTypeArray) || _checkType(child, RyanJsonTypeObject))
+		{
+			RyanJsonInternalDropPrintCache(child);
+		}
+	}
 }
+#endif
 
 /**
  * @brief 将 Json 树打印为字符串（迭代实现）
@@ -353,7 +592,7 @@ static RyanJsonBool_e RyanJsonPrintValue(RyanJson_t pJson, RyanJsonPrintBuffer *
 		}
 
 		// 打印 Value（标量值或容器起始符）
-		RyanJsonType_e type = RyanJsonGetType(curr);
+		RyanJsonType_e type = RyanJsonGetPayloadTypeByFlag(curr);
 #if defined(__clang__)
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wcovered-switch-default"
@@ -362,7 +601,7 @@ static RyanJsonBool_e RyanJsonPrintValue(RyanJson_t pJson, RyanJsonPrintBuffer *
 		{
 		case RyanJsonTypeNull:
 			RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 4));
-			RyanJsonPrintBufPutString(printfBuf, (uint8_t *)"null", 4);
+			RyanJsonPrintBufPutString(printfBuf, (const uint8_t *)"null", 4);
 			break;
 
 		case RyanJsonTypeBool: {
@@ -376,11 +615,40 @@ static RyanJsonBool_e RyanJsonPrintValue(RyanJson_t pJson, RyanJsonPrintBuffer *
 
 		case RyanJsonTypeString: RyanJsonCheckReturnFalse(RyanJsonPrintString(curr, printfBuf)); break;
 
+		case RyanJsonTypeBlob:
+			if (RyanJsonIsRaw(curr)) { RyanJsonCheckReturnFalse(RyanJsonPrintRaw(curr, printfBuf)); }
+			else
+			{
+				RyanJsonCheckReturnFalse(RyanJsonPrintBlob(curr, printfBuf));
+			}
+			break;
+
 		case RyanJsonTypeArray:
 		case RyanJsonTypeObject: {
 			RyanJsonBool_e currIsObject = (type == RyanJsonTypeObject);
+
+#if true == RyanJsonPackedArray
+			// 紧凑数组按标量处理，直接打印数据块，不展开
+			if (RyanJsonInternalIsPackedArray(curr))
+			{
+				RyanJsonCheckReturnFalse(RyanJsonPrintPackedArray(curr, printfBuf, depth, style));
+				break;
+			}
+#endif
+
 			RyanJson_t currChild = RyanJsonGetObjectValue(curr);
 
+#if true == RyanJsonPrintCache
+			// 紧凑输出时，未修改过的容器直接整段拷贝缓存片段，按标量处理
+			RyanJsonContainerExt_t *ext = style->format ? NULL : RyanJsonInternalGetContainerExt(curr);
+			if (NULL != ext && NULL != ext->printCache)
+			{
+				RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, ext->printCacheLen));
+				RyanJsonPrintBufPutString(printfBuf, ext->printCache, ext->printCacheLen);
+				break;
+			}
+#endif
+
 			// 空容器直接输出 [] 或 {}
 			if (NULL == currChild)
 			{
@@ -393,6 +661,17 @@ static RyanJsonBool_e RyanJsonPrintValue(RyanJson_t pJson, RyanJsonPrintBuffer *
 			{
 				uint32_t newlineLen = style->format ? style->newlineLen : 0;
 				RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 1 + newlineLen)); // '[' + newline
+
+#if true == RyanJsonPrintCache
+				// 记录片段起点，闭合时据此生成缓存；扩展信息申请失败只是不缓存
+				// iovec 模式下片段不连续，只读取已有缓存，不生成新缓存
+				if (RyanJsonFalse == style->format && NULL == printfBuf->iov)
+				{
+					ext = RyanJsonInternalEnsureContainerExt(curr);
+					if (NULL != ext) { ext->printStart = printfBuf->cursor; }
+				}
+#endif
+
 				RyanJsonPrintBufPutChar(printfBuf, currIsObject ? '{' : '[');
 
 				// 开启 format 后，非空容器统一走多行输出
@@ -451,6 +730,10 @@ static RyanJsonBool_e RyanJsonPrintValue(RyanJson_t pJson, RyanJsonPrintBuffer *
 			RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 1));
 			RyanJsonPrintBufPutChar(printfBuf, RyanJsonIsArray(curr) ? ']' : '}');
 
+#if true == RyanJsonPrintCache
+			if (RyanJsonFalse == style->format && NULL == printfBuf->iov) { RyanJsonPrintCacheStore(curr, printfBuf); }
+#endif
+
 			// 如果回溯到了起始根节点，结束打印
 			if (curr == pJson) { return RyanJsonTrue; }
 
@@ -559,3 +842,627 @@ char *RyanJsonPrintPreallocated(RyanJson_t pJson, char *buffer, uint32_t length,
 		.indent = "\t", .newline = "\n", .indentLen = 1, .newlineLen = 1, .spaceAfterColon = 1, .format = format};
 	return RyanJsonPrintPreallocatedWithStyle(pJson, buffer, length, &style, len);
 }
+
+/**
+ * @brief 以 iovec 列表形式打印 Json（零拷贝引用长字符串）
+ *
+ * @param pJson 待打印节点
+ * @param scratch 暂存区，保存标点、数字与需要转义的字符串等生成内容
+ * @param scratchSize 暂存区大小
+ * @param format 是否格式化输出
+ * @param iov 输出片段数组
+ * @param iovCap 片段数组容量
+ * @param iovCount 输出片段数量
+ * @return RyanJsonBool_e 打印是否成功
+ * @note 片段依次拼接即为完整输出（不含 '\0'），可直接交给 writev/sendmsg。
+ */
+RyanJsonBool_e RyanJsonPrintIoVec(RyanJson_t pJson, char *scratch, uint32_t scratchSize, RyanJsonBool_e format, RyanJsonIoVec_t *iov,
+				  uint32_t iovCap, uint32_t *iovCount)
+{
+	RyanJsonCheckReturnFalse(NULL != pJson && NULL != scratch && scratchSize > 0 && NULL != iov && iovCap > 0 && NULL != iovCount);
+
+	RyanJsonPrintStyle style = {
+		.indent = "\t", .newline = "\n", .indentLen = 1, .newlineLen = 1, .spaceAfterColon = 1, .format = format};
+	// 暂存区禁止扩容，已输出片段中的地址才能保持有效
+	RyanJsonPrintBuffer printfBuf = {
+		.bufAddress = (uint8_t *)scratch,
+		.isNoAlloc = RyanJsonTrue,
+		.size = scratchSize,
+		.cursor = 0,
+		.iov = iov,
+		.iovCap = iovCap,
+		.iovCount = 0,
+		.segStart = 0,
+	};
+
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonPrintValue(pJson, &printfBuf, 0, &style));
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonPrintIoVecFlush(&printfBuf));
+	*iovCount = printfBuf.iovCount;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 写入二进制编码的首字节与随后 sizeBytes 个大端字节（取 value 的低位）
+ */
+static RyanJsonBool_e RyanJsonPrintCodecHead(RyanJsonPrintBuffer *printfBuf, uint8_t lead, uint32_t sizeBytes, uint64_t value)
+{
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 1U + sizeBytes));
+	RyanJsonPrintBufPutChar(printfBuf, lead);
+	for (uint32_t i = sizeBytes; i > 0; i--)
+	{
+		RyanJsonPrintBufPutChar(printfBuf, (uint8_t)(value >> ((i - 1U) * 8U)));
+	}
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief CBOR 类型头：主类型 + 最短参数编码
+ */
+static RyanJsonBool_e RyanJsonPrintCborHead(RyanJsonPrintBuffer *printfBuf, uint8_t major, uint32_t arg)
+{
+	if (arg < 24U) { return RyanJsonPrintCodecHead(printfBuf, (uint8_t)(major | arg), 0, 0); }
+	if (arg <= UINT8_MAX) { return RyanJsonPrintCodecHead(printfBuf, (uint8_t)(major | 24U), 1, arg); }
+	if (arg <= UINT16_MAX) { return RyanJsonPrintCodecHead(printfBuf, (uint8_t)(major | 25U), 2, arg); }
+	return RyanJsonPrintCodecHead(printfBuf, (uint8_t)(major | 26U), 4, arg);
+}
+
+#define RyanJsonCodecKindString (0U)
+#define RyanJsonCodecKindArray  (1U)
+#define RyanJsonCodecKindObject (2U)
+
+/**
+ * @brief 写入 String/Array/Object 的类型头（长度或成员数）
+ */
+static RyanJsonBool_e RyanJsonPrintCodecLen(RyanJsonPrintBuffer *printfBuf, RyanJsonCodec_e codec, uint32_t kind, uint32_t len)
+{
+	static const uint8_t cborMajor[3] = {0x60, 0x80, 0xa0};
+	// MessagePack：fix 形式上限、fix 前缀、8/16/32 位长度前缀（0 表示无该形式）
+	static const uint8_t msgPackLead[3][5] = {
+		{31, 0xa0, 0xd9, 0xda, 0xdb},
+		{15, 0x90, 0x00, 0xdc, 0xdd},
+		{15, 0x80, 0x00, 0xde, 0xdf},
+	};
+
+	if (RyanJsonCodecCbor == codec) { return RyanJsonPrintCborHead(printfBuf, cborMajor[kind], len); }
+
+	const uint8_t *lead = msgPackLead[kind];
+	if (len <= lead[0]) { return RyanJsonPrintCodecHead(printfBuf, (uint8_t)(lead[1] | len), 0, 0); }
+	if (0U != lead[2] && len <= UINT8_MAX) { return RyanJsonPrintCodecHead(printfBuf, lead[2], 1, len); }
+	if (len <= UINT16_MAX) { return RyanJsonPrintCodecHead(printfBuf, lead[3], 2, len); }
+	return RyanJsonPrintCodecHead(printfBuf, lead[4], 4, len);
+}
+
+static RyanJsonBool_e RyanJsonPrintCodecString(RyanJsonPrintBuffer *printfBuf, RyanJsonCodec_e codec, const char *str, uint32_t len)
+{
+	RyanJsonCheckReturnFalse(RyanJsonPrintCodecLen(printfBuf, codec, RyanJsonCodecKindString, len));
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, len));
+	RyanJsonPrintBufPutString(printfBuf, (const uint8_t *)str, len);
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 字节串：CBOR 主类型 2，MessagePack bin 8/16/32
+ */
+static RyanJsonBool_e RyanJsonPrintCodecBytes(RyanJsonPrintBuffer *printfBuf, RyanJsonCodec_e codec, const uint8_t *data, uint32_t len)
+{
+	if (RyanJsonCodecCbor == codec) { RyanJsonCheckReturnFalse(RyanJsonPrintCborHead(printfBuf, 0x40, len)); }
+	else if (len <= UINT8_MAX) { RyanJsonCheckReturnFalse(RyanJsonPrintCodecHead(printfBuf, 0xc4, 1, len)); }
+	else if (len <= UINT16_MAX) { RyanJsonCheckReturnFalse(RyanJsonPrintCodecHead(printfBuf, 0xc5, 2, len)); }
+	else
+	{
+		RyanJsonCheckReturnFalse(RyanJsonPrintCodecHead(printfBuf, 0xc6, 4, len));
+	}
+
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, len));
+	RyanJsonPrintBufPutString(printfBuf, data, len);
+	return RyanJsonTrue;
+}
+
+static RyanJsonBool_e RyanJsonPrintCodecInt(RyanJsonPrintBuffer *printfBuf, RyanJsonCodec_e codec, int32_t value)
+{
+	if (RyanJsonCodecCbor == codec)
+	{
+		// 负数按 -1 - n 编码 n
+		if (value >= 0) { return RyanJsonPrintCborHead(printfBuf, 0x00, (uint32_t)value); }
+		return RyanJsonPrintCborHead(printfBuf, 0x20, (uint32_t)(-(value + 1)));
+	}
+
+	// 非负数按无符号形式编码，与常见实现一致
+	if (value >= 0)
+	{
+		if (value <= 0x7f) { return RyanJsonPrintCodecHead(printfBuf, (uint8_t)value, 0, 0); }
+		if (value <= UINT8_MAX) { return RyanJsonPrintCodecHead(printfBuf, 0xcc, 1, (uint32_t)value); }
+		if (value <= UINT16_MAX) { return RyanJsonPrintCodecHead(printfBuf, 0xcd, 2, (uint32_t)value); }
+		return RyanJsonPrintCodecHead(printfBuf, 0xce, 4, (uint32_t)value);
+	}
+	if (value >= -32) { return RyanJsonPrintCodecHead(printfBuf, (uint8_t)((uint32_t)value & 0xffU), 0, 0); }
+	if (value >= INT8_MIN) { return RyanJsonPrintCodecHead(printfBuf, 0xd0, 1, (uint32_t)value); }
+	if (value >= INT16_MIN) { return RyanJsonPrintCodecHead(printfBuf, 0xd1, 2, (uint32_t)value); }
+	return RyanJsonPrintCodecHead(printfBuf, 0xd2, 4, (uint32_t)value);
+}
+
+/**
+ * @brief 写入浮点数：能无损放入 float32 时使用 4 字节形式，否则 8 字节
+ */
+static RyanJsonBool_e RyanJsonPrintCodecDouble(RyanJsonPrintBuffer *printfBuf, RyanJsonCodec_e codec, double value)
+{
+	RyanJsonBool_e isCbor = RyanJsonMakeBool(RyanJsonCodecCbor == codec);
+
+	// 先判断范围，超出 float 范围的转换是未定义行为；按位比较，-0.0 也能保持
+	if (value >= -(double)FLT_MAX && value <= (double)FLT_MAX)
+	{
+		float narrow = (float)value;
+		double widen = (double)narrow;
+		if (0 == RyanJsonMemcmp(&widen, &value, sizeof(double)))
+		{
+			uint32_t bits;
+			RyanJsonMemcpy(&bits, &narrow, sizeof(bits));
+			return RyanJsonPrintCodecHead(printfBuf, isCbor ? 0xfa : 0xca, 4, bits);
+		}
+	}
+
+	uint64_t bits;
+	RyanJsonMemcpy(&bits, &value, sizeof(bits));
+	return RyanJsonPrintCodecHead(printfBuf, isCbor ? 0xfb : 0xcb, 8, bits);
+}
+
+#if true == RyanJsonPackedArray
+static RyanJsonBool_e RyanJsonPrintCodecPackedValue(const RyanJsonPackedHead_t *head, uint32_t col, uint32_t row,
+						    RyanJsonPrintBuffer *printfBuf, RyanJsonCodec_e codec)
+{
+	if (RyanJsonInternalPackedColumnIsDouble(head, col))
+	{
+		return RyanJsonPrintCodecDouble(printfBuf, codec, RyanJsonInternalPackedGetDouble(head, col, row));
+	}
+	return RyanJsonPrintCodecInt(printfBuf, codec, RyanJsonInternalPackedGetInt(head, col, row));
+}
+
+/**
+ * @brief 直接从数据块编码紧凑数组（含列存表），输出与等价的普通 Array 一致
+ */
+static RyanJsonBool_e RyanJsonPrintCodecPacked(RyanJson_t pJson, RyanJsonPrintBuffer *printfBuf, RyanJsonCodec_e codec)
+{
+	const RyanJsonPackedHead_t *head = RyanJsonInternalGetPacked(pJson);
+	uint32_t colCount = RyanJsonInternalPackedColumnCount(head);
+	RyanJsonBool_e isTable = RyanJsonMakeBool(RyanJsonPackedIsTable(head));
+
+	RyanJsonCheckReturnFalse(RyanJsonPrintCodecLen(printfBuf, codec, RyanJsonCodecKindArray, head->count));
+	for (uint32_t row = 0; row < head->count; row++)
+	{
+		if (!isTable)
+		{
+			RyanJsonCheckReturnFalse(RyanJsonPrintCodecPackedValue(head, 0, row, printfBuf, codec));
+			continue;
+		}
+
+		RyanJsonCheckReturnFalse(RyanJsonPrintCodecLen(printfBuf, codec, RyanJsonCodecKindObject, colCount));
+		for (uint32_t col = 0; col < colCount; col++)
+		{
+			uint32_t keyLen;
+			const char *key = RyanJsonInternalPackedColumnKey(head, col, &keyLen);
+			RyanJsonCheckReturnFalse(RyanJsonPrintCodecString(printfBuf, codec, key, keyLen));
+			RyanJsonCheckReturnFalse(RyanJsonPrintCodecPackedValue(head, col, row, printfBuf, codec));
+		}
+	}
+	return RyanJsonTrue;
+}
+#endif
+
+/**
+ * @brief 将 Json 树编码为 CBOR/MessagePack（迭代实现，遍历方式与 RyanJsonPrintValue 相同）
+ * @note 两种格式的容器都是定长的，进入容器时先写成员数，闭合时无需输出任何内容。
+ */
+static RyanJsonBool_e RyanJsonPrintCodecValue(RyanJson_t pJson, RyanJsonPrintBuffer *printfBuf, RyanJsonCodec_e codec)
+{
+	RyanJsonCheckAssert(NULL != pJson && NULL != printfBuf);
+
+	RyanJson_t curr = pJson;
+	while (1)
+	{
+		if (curr != pJson && RyanJsonIsKey(curr))
+		{
+			RyanJsonCheckReturnFalse(
+				RyanJsonPrintCodecString(printfBuf, codec, RyanJsonGetKey(curr), RyanJsonInternalGetKeyLen(curr)));
+		}
+
+		RyanJsonType_e type = RyanJsonGetPayloadTypeByFlag(curr);
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wcovered-switch-default"
+#endif
+		switch (type)
+		{
+		case RyanJsonTypeNull:
+			RyanJsonCheckReturnFalse(RyanJsonPrintCodecHead(printfBuf, (RyanJsonCodecCbor == codec) ? 0xf6 : 0xc0, 0, 0));
+			break;
+
+		case RyanJsonTypeBool: {
+			uint8_t lead = (RyanJsonCodecCbor == codec) ? 0xf4 : 0xc2;
+			if (RyanJsonGetBoolValue(curr)) { lead++; }
+			RyanJsonCheckReturnFalse(RyanJsonPrintCodecHead(printfBuf, lead, 0, 0));
+			break;
+		}
+
+		case RyanJsonTypeNumber: {
+			// 懒数值局部解析，节点保持不变
+			RyanJsonBool_e isInt;
+			double number = RyanJsonInternalGetNumber(curr, &isInt);
+			if (isInt) { RyanJsonCheckReturnFalse(RyanJsonPrintCodecInt(printfBuf, codec, (int32_t)number)); }
+			else
+			{
+				RyanJsonCheckReturnFalse(RyanJsonPrintCodecDouble(printfBuf, codec, number));
+			}
+			break;
+		}
+
+		case RyanJsonTypeString: {
+			const char *strValue = RyanJsonGetStringValue(curr); // 先取值，懒字符串解码后长度才准确
+			uint32_t len = 0;
+			(void)RyanJsonInternalGetStrValueInfo(curr, &len);
+			RyanJsonCheckReturnFalse(RyanJsonPrintCodecString(printfBuf, codec, strValue, len));
+			break;
+		}
+
+		case RyanJsonTypeBlob: {
+			// Raw 文本未展开为结构，无法映射到二进制格式
+			RyanJsonCheckReturnFalse(RyanJsonFalse == RyanJsonIsRaw(curr));
+			uint32_t len = 0;
+			const uint8_t *data = RyanJsonGetBlobValue(curr, &len);
+			RyanJsonCheckReturnFalse(RyanJsonPrintCodecBytes(printfBuf, codec, data, len));
+			break;
+		}
+
+		case RyanJsonTypeArray:
+		case RyanJsonTypeObject: {
+#if true == RyanJsonPackedArray
+			if (RyanJsonInternalIsPackedArray(curr))
+			{
+				RyanJsonCheckReturnFalse(RyanJsonPrintCodecPacked(curr, printfBuf, codec));
+				break;
+			}
+#endif
+			uint32_t kind = (RyanJsonTypeObject == type) ? RyanJsonCodecKindObject : RyanJsonCodecKindArray;
+			RyanJsonCheckReturnFalse(RyanJsonPrintCodecLen(printfBuf, codec, kind, RyanJsonGetSize(curr)));
+
+			RyanJson_t currChild = RyanJsonGetObjectValue(curr);
+			if (NULL != currChild)
+			{
+				curr = currChild;
+				continue;
+			}
+			break;
+		}
+
+		default: return RyanJsonFalse;
+		}
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+		if (curr == pJson) { return RyanJsonTrue; }
+
+		// 切换到兄弟节点，没有兄弟时沿线索回溯
+		while (NULL == RyanJsonGetNext(curr))
+		{
+			curr = curr->next;
+			if (curr == pJson) { return RyanJsonTrue; }
+		}
+		curr = RyanJsonGetNext(curr);
+	}
+}
+
+/**
+ * @brief 将 Json 编码为 CBOR/MessagePack（动态分配输出缓冲）
+ *
+ * @param pJson 待编码节点（根节点的 key 不输出）
+ * @param codec 编码格式
+ * @param preset 初始缓冲大小
+ * @param len 输出长度，可为 NULL
+ * @return uint8_t* 编码结果，需调用 RyanJsonFree 释放
+ */
+uint8_t *RyanJsonPrintCodec(RyanJson_t pJson, RyanJsonCodec_e codec, uint32_t preset, uint32_t *len)
+{
+	RyanJsonCheckReturnNull(NULL != pJson);
+	RyanJsonCheckReturnNull(RyanJsonCodecCbor == codec || RyanJsonCodecMsgPack == codec);
+
+	RyanJsonPrintBuffer printfBuf = {
+		.isNoAlloc = RyanJsonFalse,
+		.size = preset,
+		.cursor = 0,
+	};
+
+	if (printfBuf.size < RyanJsonPrintfPreAlloSize) { printfBuf.size = RyanJsonPrintfPreAlloSize; }
+	printfBuf.bufAddress = (uint8_t *)jsonMalloc(printfBuf.size);
+	RyanJsonCheckReturnNull(NULL != printfBuf.bufAddress);
+
+	RyanJsonCheckCode(RyanJsonTrue == RyanJsonPrintCodecValue(pJson, &printfBuf, codec), {
+		jsonFree(printfBuf.bufAddress);
+		return NULL;
+	});
+
+	if (len) { *len = printfBuf.cursor; }
+	return printfBuf.bufAddress;
+}
+
+/**
+ * @brief 将 Json 编码为 CBOR/MessagePack（使用外部预分配缓冲）
+ *
+ * @param pJson 待编码节点（根节点的 key 不输出）
+ * @param codec 编码格式
+ * @param buffer 外部缓冲区
+ * @param length 缓冲区大小
+ * @param len 输出长度，可为 NULL
+ * @return uint8_t* 成功返回 buffer，空间不足等失败返回 NULL
+ */
+uint8_t *RyanJsonPrintCodecPreallocated(RyanJson_t pJson, RyanJsonCodec_e codec, uint8_t *buffer, uint32_t length, uint32_t *len)
+{
+	RyanJsonCheckReturnNull(NULL != pJson && NULL != buffer && length > 0);
+	RyanJsonCheckReturnNull(RyanJsonCodecCbor == codec || RyanJsonCodecMsgPack == codec);
+
+	RyanJsonPrintBuffer printfBuf = {
+		.bufAddress = buffer,
+		.isNoAlloc = RyanJsonTrue,
+		.size = length,
+		.cursor = 0,
+	};
+
+	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonPrintCodecValue(pJson, &printfBuf, codec));
+	if (len) { *len = printfBuf.cursor; }
+	return buffer;
+}
+
+#if true == RyanJsonDeltaTracking
+/**
+ * @brief 输出增量成员的 "key": 前缀，非首个成员时先补逗号
+ * @note key 为 NULL（无 key 成员）时 Merge Patch 无法寻址，返回失败
+ */
+static RyanJsonBool_e RyanJsonPrintDeltaKey(const char *key, RyanJsonPrintBuffer *printfBuf)
+{
+	RyanJsonCheckReturnFalse(NULL != key);
+
+	// 成员值不会以 '{' 结尾，紧跟 '{' 说明是当前 Object 的首个成员
+	if ('{' != printfBuf->bufAddress[printfBuf->cursor - 1U])
+	{
+		RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 1));
+		RyanJsonPrintBufPutChar(printfBuf, ',');
+	}
+
+	RyanJsonCheckReturnFalse(RyanJsonPrintStringBuffer((const uint8_t *)key, printfBuf));
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 1));
+	RyanJsonPrintBufPutChar(printfBuf, ':');
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 输出 "key":null，用于 Merge Patch 中删除 key
+ */
+static RyanJsonBool_e RyanJsonPrintDeltaNull(const char *key, RyanJsonPrintBuffer *printfBuf)
+{
+	RyanJsonCheckReturnFalse(RyanJsonPrintDeltaKey(key, printfBuf));
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 4));
+	RyanJsonPrintBufPutString(printfBuf, (const uint8_t *)"null", 4);
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 输出 '{' 以及基线中存在、当前层已不存在的 key（值为 null）
+ */
+static RyanJsonBool_e RyanJsonPrintDeltaReplaceEnter(RyanJson_t curr, RyanJson_t baseline, RyanJsonPrintBuffer *printfBuf)
+{
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 1));
+	RyanJsonPrintBufPutChar(printfBuf, '{');
+
+	for (RyanJson_t item = RyanJsonGetObjectValue(baseline); NULL != item; item = RyanJsonGetNext(item))
+	{
+		const char *key = RyanJsonInternalDeltaKey(item);
+		if (NULL != key && NULL != RyanJsonGetObjectByKeyLen(curr, key, RyanJsonInternalGetKeyLen(item))) { continue; }
+		RyanJsonCheckReturnFalse(RyanJsonPrintDeltaNull(key, printfBuf));
+	}
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 输出整体替换原 Object 的新 Object（迭代实现）
+ *
+ * @param pJson 新值
+ * @param baseline 原值在检查点时的 key 骨架
+ * @note Merge Patch 中 Object 与 Object 是合并而非替换：原值有、新值没有的 key 必须显式输出 null，
+ *       两侧同为 Object 的成员同样递归处理，其余成员整体输出。
+ */
+static RyanJsonBool_e RyanJsonPrintDeltaReplace(RyanJson_t pJson, RyanJson_t baseline, RyanJsonPrintBuffer *printfBuf,
+						const RyanJsonPrintStyle *style)
+{
+	RyanJson_t curr = pJson;
+	RyanJson_t currBaseline = baseline;
+	RyanJsonCheckReturnFalse(RyanJsonPrintDeltaReplaceEnter(curr, currBaseline, printfBuf));
+	RyanJson_t child = RyanJsonGetObjectValue(curr);
+
+	// 无需显式栈：新值与骨架同步下行，回溯时各自通过线索化链表找到父节点
+	while (1)
+	{
+		if (NULL != child)
+		{
+			RyanJsonCheckReturnFalse(RyanJsonPrintDeltaKey(RyanJsonInternalDeltaKey(child), printfBuf));
+			RyanJson_t item = RyanJsonGetObjectByKeyLen(currBaseline, RyanJsonGetKey(child), RyanJsonInternalGetKeyLen(child));
+			if (NULL == item || !RyanJsonIsObject(item) || !RyanJsonIsObject(child))
+			{
+				RyanJsonCheckReturnFalse(RyanJsonPrintValue(child, printfBuf, 0, style));
+				child = RyanJsonGetNext(child);
+				continue;
+			}
+
+			curr = child;
+			currBaseline = item;
+			RyanJsonCheckReturnFalse(RyanJsonPrintDeltaReplaceEnter(curr, currBaseline, printfBuf));
+			child = RyanJsonGetObjectValue(curr);
+			continue;
+		}
+
+		RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 1));
+		RyanJsonPrintBufPutChar(printfBuf, '}');
+
+		if (curr == pJson) { return RyanJsonTrue; }
+		child = RyanJsonGetNext(curr);
+		curr = RyanJsonInternalGetParent(curr);
+		currBaseline = RyanJsonInternalGetParent(currBaseline);
+	}
+}
+
+/**
+ * @brief 判断变化成员的新值能否写入 Merge Patch
+ * @return RyanJsonBool_e 新值本身为 null，或其 Object 内（不经数组）有 null 成员时为真；
+ *         Merge Patch 合并时把这些 null 当作删除 key，无法表示“值为 null”
+ */
+static RyanJsonBool_e RyanJsonPrintDeltaHasNull(RyanJson_t pJson)
+{
+	if (RyanJsonIsNull(pJson)) { return RyanJsonTrue; }
+	if (RyanJsonFalse == RyanJsonIsObject(pJson)) { return RyanJsonFalse; }
+
+	RyanJson_t curr = pJson;
+	RyanJson_t child = RyanJsonGetObjectValue(curr);
+	while (1)
+	{
+		if (NULL != child)
+		{
+			if (RyanJsonIsNull(child)) { return RyanJsonTrue; }
+			if (RyanJsonIsObject(child))
+			{
+				curr = child;
+				child = RyanJsonGetObjectValue(curr);
+				continue;
+			}
+			child = RyanJsonGetNext(child);
+			continue;
+		}
+
+		if (curr == pJson) { return RyanJsonFalse; }
+		child = RyanJsonGetNext(curr);
+		curr = RyanJsonInternalGetParent(curr);
+	}
+}
+
+/**
+ * @brief 进入一层增量 Object：输出 '{' 与整体变化的成员
+ */
+static RyanJsonBool_e RyanJsonPrintDeltaEnter(RyanJson_t pJson, RyanJsonPrintBuffer *printfBuf, const RyanJsonPrintStyle *style)
+{
+	RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 1));
+	RyanJsonPrintBufPutChar(printfBuf, '{');
+
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	for (uint32_t i = 0; NULL != ext && i < ext->deltaEntryCount; i++)
+	{
+		const RyanJsonDeltaEntry_t *entry = &ext->deltaEntries[i];
+		RyanJsonCheckReturnFalse(RyanJsonFalse == RyanJsonPrintDeltaHasNull(entry->node));
+		RyanJsonCheckReturnFalse(RyanJsonPrintDeltaKey(RyanJsonInternalDeltaKey(entry->node), printfBuf));
+		if (NULL != entry->baseline && RyanJsonIsObject(entry->node))
+		{
+			RyanJsonCheckReturnFalse(RyanJsonPrintDeltaReplace(entry->node, entry->baseline, printfBuf, style));
+			continue;
+		}
+		RyanJsonCheckReturnFalse(RyanJsonPrintValue(entry->node, printfBuf, 0, style));
+	}
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 返回 child 及其之后第一个需要进入的兄弟：带路径标记且未整体输出的 Object
+ */
+static RyanJson_t RyanJsonPrintDeltaNextPath(const RyanJsonContainerExt_t *ext, RyanJson_t child)
+{
+	while (NULL != child && (!RyanJsonInternalIsDeltaPath(child) || NULL != RyanJsonInternalDeltaFindEntry(ext, child)))
+	{
+		child = RyanJsonGetNext(child);
+	}
+	return child;
+}
+
+/**
+ * @brief 按变化记录输出 Merge Patch（迭代实现）
+ * @note 只进入带路径标记的 Object；整体变化的成员复用普通打印流程。
+ */
+static RyanJsonBool_e RyanJsonPrintDeltaValue(RyanJson_t pJson, RyanJsonPrintBuffer *printfBuf, const RyanJsonPrintStyle *style)
+{
+	RyanJsonCheckAssert(NULL != pJson && RyanJsonIsObject(pJson));
+
+	RyanJsonCheckReturnFalse(RyanJsonPrintDeltaEnter(pJson, printfBuf, style));
+	RyanJson_t curr = pJson;
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(curr);
+	RyanJson_t child = RyanJsonInternalIsDeltaPath(pJson) ? RyanJsonPrintDeltaNextPath(ext, RyanJsonGetObjectValue(curr)) : NULL;
+
+	// 无需显式栈：回溯通过线索化链表找到父节点，并从离开的子节点之后继续扫描
+	while (1)
+	{
+		if (NULL != child)
+		{
+			RyanJsonCheckReturnFalse(RyanJsonPrintDeltaKey(RyanJsonInternalDeltaKey(child), printfBuf));
+			RyanJsonCheckReturnFalse(RyanJsonPrintDeltaEnter(child, printfBuf, style));
+			curr = child;
+			ext = RyanJsonInternalGetContainerExt(curr);
+			child = RyanJsonPrintDeltaNextPath(ext, RyanJsonGetObjectValue(curr));
+			continue;
+		}
+
+		// 被删除的 key 输出为 null
+		for (uint32_t i = 0; NULL != ext && i < ext->deltaRemovedCount; i++)
+		{
+			RyanJsonCheckReturnFalse(RyanJsonPrintDeltaNull(RyanJsonInternalDeltaKey(ext->deltaRemoved[i]), printfBuf));
+		}
+
+		RyanJsonCheckReturnFalse(RyanJsonPrintBufAppend(printfBuf, 1));
+		RyanJsonPrintBufPutChar(printfBuf, '}');
+
+		if (curr == pJson) { return RyanJsonTrue; }
+		child = RyanJsonGetNext(curr);
+		curr = RyanJsonInternalGetParent(curr);
+		ext = RyanJsonInternalGetContainerExt(curr);
+		child = RyanJsonPrintDeltaNextPath(ext, child);
+	}
+}
+
+/**
+ * @brief 增量打印：输出自上次检查点以来的 JSON Merge Patch（动态分配输出缓冲）
+ *
+ * @param pJson 根节点
+ * @param preset 初始缓冲大小
+ * @param len 输出长度，可为 NULL
+ * @return char* 打印结果，需调用 RyanJsonFree 释放
+ * @note 输出固定为紧凑格式，无变化时为 "{}"；打印不会清除记录，需显式调用 RyanJsonCheckpoint。
+ * @note 变化成员的新值为 null（或其 Object 内不经数组有 null 成员）时无法表示，返回 NULL，需改用完整打印。
+ * @note ReplaceByKey 包装标量产生的无 key 成员无法寻址，涉及这类成员的变化同样返回 NULL。
+ * @note pJson 不是 Object 时 Merge Patch 只能整体替换，等价于紧凑 RyanJsonPrint。
+ */
+char *RyanJsonPrintDelta(RyanJson_t pJson, uint32_t preset, uint32_t *len)
+{
+	RyanJsonCheckReturnNull(NULL != pJson);
+
+	RyanJsonPrintStyle style = {
+		.indent = "\t", .newline = "\n", .indentLen = 1, .newlineLen = 1, .spaceAfterColon = 1, .format = RyanJsonFalse};
+	if (RyanJsonFalse == RyanJsonIsObject(pJson)) { return RyanJsonPrintWithStyle(pJson, preset, &style, len); }
+
+	RyanJsonPrintBuffer printfBuf = {
+		.isNoAlloc = RyanJsonFalse,
+		.size = preset,
+		.cursor = 0,
+	};
+
+	if (printfBuf.size < RyanJsonPrintfPreAlloSize) { printfBuf.size = RyanJsonPrintfPreAlloSize; }
+	printfBuf.bufAddress = (uint8_t *)jsonMalloc(printfBuf.size);
+	RyanJsonCheckReturnNull(NULL != printfBuf.bufAddress);
+
+	RyanJsonCheckCode(RyanJsonTrue == RyanJsonPrintDeltaValue(pJson, &printfBuf, &style), {
+		jsonFree(printfBuf.bufAddress);
+		return NULL;
+	});
+
+	RyanJsonCheckCode(RyanJsonPrintBufAppend(&printfBuf, 1), {
+		jsonFree(printfBuf.bufAddress);
+		return NULL;
+	});
+
+	printfBuf.bufAddress[printfBuf.cursor] = '\0';
+	if (len) { *len = printfBuf.cursor; }
+
+	return (char *)printfBuf.bufAddress;
+}
+#endif
@@ -0,0 +1,826 @@
+#include "RyanJsonInternal.h"
+
+typedef enum
+{
+	RyanJsonQueryStepName = 0, // .name / ['name']
+	RyanJsonQueryStepWildcard, // .* / [*]
+	RyanJsonQueryStepIndex,    // [n]
+	RyanJsonQueryStepSlice,    // [start:end:step]
+	RyanJsonQueryStepFilter,   // [?@.a op 字面量]
+} RyanJsonQueryStepKind_e;
+
+typedef enum
+{
+	RyanJsonQueryOpExists = 0, // 无比较符，只判断相对路径是否存在
+	RyanJsonQueryOpEq,
+	RyanJsonQueryOpNe,
+	RyanJsonQueryOpLt,
+	RyanJsonQueryOpLe,
+	RyanJsonQueryOpGt,
+	RyanJsonQueryOpGe,
+} RyanJsonQueryOp_e;
+
+typedef enum
+{
+	RyanJsonQueryLiteralNumber = 0,
+	RyanJsonQueryLiteralString,
+	RyanJsonQueryLiteralTrue,
+	RyanJsonQueryLiteralFalse,
+	RyanJsonQueryLiteralNull,
+} RyanJsonQueryLiteral_e;
+
+#define RyanJsonQueryHasStart (1U << 0)
+#define RyanJsonQueryHasEnd   (1U << 1)
+
+// 迭代器游标的选择器状态
+#define RyanJsonQueryPhaseFresh   (0U)
+#define RyanJsonQueryPhaseRunning (1U)
+#define RyanJsonQueryPhaseDone    (2U)
+
+/**
+ * @brief 编译后的 key：已去掉引号与转义，指向查询尾部的字符串池，不以 '\0' 结尾
+ */
+typedef struct
+{
+	const char *key;
+	uint32_t keyLen;
+	uint32_t hash; // RyanJsonInternalKeyHash(key, keyLen)
+} RyanJsonQueryKey_t;
+
+/**
+ * @brief 一段查询
+ * @note 过滤段的相对路径为 keys[keyFirst, keyFirst + keyCount)，字符串字面量复用 name。
+ */
+typedef struct
+{
+	double number;          // 过滤数值字面量
+	RyanJsonQueryKey_t name; // Name 段的 key / 过滤字符串字面量
+	int32_t start;          // Index 下标 / Slice 起点
+	int32_t end;            // Slice 终点
+	uint32_t step;          // Slice 步长
+	uint32_t keyFirst;
+	uint32_t keyCount;
+	uint8_t kind;       // RyanJsonQueryStepKind_e
+	uint8_t descendant; // 是否为 .. 递归下降
+	uint8_t op;         // RyanJsonQueryOp_e
+	uint8_t literal;    // RyanJsonQueryLiteral_e，复用为 Slice 的 RyanJsonQueryHasStart/HasEnd
+} RyanJsonQueryStep_t;
+
+/**
+ * @brief 查询程序：[头部 | 段数组 | 过滤 key 数组 | 字符串池]，一次申请
+ */
+struct RyanJsonQuery
+{
+	uint32_t stepCount;
+	RyanJsonQueryKey_t *keys;
+	RyanJsonQueryStep_t steps[];
+};
+
+/**
+ * @brief 编译状态
+ * @note 编译分两遍执行同一套解析代码：第一遍 query 为 NULL，只校验语法并统计段数、key 数与池大小，
+ *       段与 key 写入 scratch；第二遍按统计结果一次申请后写入真实位置。
+ */
+typedef struct
+{
+	const char *text;
+	RyanJsonQuery_t query;
+	char *pool;
+	uint32_t stepCount;
+	uint32_t keyCount;
+	uint32_t poolSize;
+	RyanJsonQueryStep_t scratchStep;
+	RyanJsonQueryKey_t scratchKey;
+} RyanJsonQueryCompiler_t;
+
+static RyanJsonQueryStep_t *RyanJsonQueryNewStep(RyanJsonQueryCompiler_t *compiler)
+{
+	RyanJsonQueryStep_t *step = (NULL != compiler->query) ? &compiler->query->steps[compiler->stepCount] : &compiler->scratchStep;
+	compiler->stepCount++;
+	RyanJsonMemset(step, 0, sizeof(RyanJsonQueryStep_t));
+	return step;
+}
+
+static RyanJsonQueryKey_t *RyanJsonQueryNewKey(RyanJsonQueryCompiler_t *compiler)
+{
+	RyanJsonQueryKey_t *key = (NULL != compiler->query) ? &compiler->query->keys[compiler->keyCount] : &compiler->scratchKey;
+	compiler->keyCount++;
+	return key;
+}
+
+static void RyanJsonQuerySkipSpace(RyanJsonQueryCompiler_t *compiler)
+{
+	while (' ' == *compiler->text || '\t' == *compiler->text || '\n' == *compiler->text || '\r' == *compiler->text)
+	{
+		compiler->text++;
+	}
+}
+
+static RyanJsonBool_e RyanJsonQueryIsNameChar(uint8_t ch)
+{
+	return RyanJsonMakeBool((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || '_' == ch ||
+				ch >= 0x80U);
+}
+
+/**
+ * @brief 写入池中的一个 key 收尾：记录位置与长度并预计算哈希
+ */
+static void RyanJsonQueryFinishKey(RyanJsonQueryCompiler_t *compiler, RyanJsonQueryKey_t *key, uint32_t len)
+{
+	key->key = compiler->pool;
+	key->keyLen = len;
+	key->hash = 0;
+	if (NULL != compiler->pool)
+	{
+		key->hash = RyanJsonInternalKeyHash(compiler->pool, len);
+		compiler->pool += len;
+	}
+	compiler->poolSize += len;
+}
+
+/**
+ * @brief 解析点号形式的成员名（字母、数字、'_' 与非 ASCII 字节）
+ */
+static RyanJsonBool_e RyanJsonQueryParseName(RyanJsonQueryCompiler_t *compiler, RyanJsonQueryKey_t *key)
+{
+	uint32_t len = 0;
+	while (RyanJsonQueryIsNameChar((uint8_t)compiler->text[len]))
+	{
+		if (NULL != compiler->pool) { compiler->pool[len] = compiler->text[len]; }
+		len++;
+	}
+	RyanJsonCheckReturnFalse(len > 0);
+
+	compiler->text += len;
+	RyanJsonQueryFinishKey(compiler, key, len);
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 解析单引号或双引号字符串
+ * @note 支持 \\、\'、\"、\/ 与 \b \f \n \r \t 转义，不支持 \uXXXX。
+ */
+static RyanJsonBool_e RyanJsonQueryParseQuoted(RyanJsonQueryCompiler_t *compiler, RyanJsonQueryKey_t *key)
+{
+	char quote = *compiler->text++;
+	uint32_t len = 0;
+	while (quote != *compiler->text)
+	{
+		char ch = *compiler->text++;
+		RyanJsonCheckReturnFalse('\0' != ch);
+		if ('\\' == ch)
+		{
+			ch = *compiler->text++;
+			switch (ch)
+			{
+			case '\\':
+			case '\'':
+			case '"':
+			case '/': break;
+			case 'b': ch = '\b'; break;
+			case 'f': ch = '\f'; break;
+			case 'n': ch = '\n'; break;
+			case 'r': ch = '\r'; break;
+			case 't': ch = '\t'; break;
+			default: return RyanJsonFalse;
+			}
+		}
+		if (NULL != compiler->pool) { compiler->pool[len] = ch; }
+		len++;
+	}
+	compiler->text++;
+
+	RyanJsonQueryFinishKey(compiler, key, len);
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 解析带可选负号的十进制整数，范围为 int32
+ */
+static RyanJsonBool_e RyanJsonQueryParseInt(RyanJsonQueryCompiler_t *compiler, int32_t *out)
+{
+	RyanJsonBool_e negative = RyanJsonFalse;
+	if ('-' == *compiler->text)
+	{
+		negative = RyanJsonTrue;
+		compiler->text++;
+	}
+	RyanJsonCheckReturnFalse(*compiler->text >= '0' && *compiler->text <= '9');
+
+	int64_t value = 0;
+	while (*compiler->text >= '0' && *compiler->text <= '9')
+	{
+		value = value * 10 + (*compiler->text - '0');
+		RyanJsonCheckReturnFalse(value <= (int64_t)INT32_MAX + 1);
+		compiler->text++;
+	}
+	if (negative) { value = -value; }
+	RyanJsonCheckReturnFalse(value <= INT32_MAX);
+
+	*out = (int32_t)value;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 解析 Json 语法的数值字面量
+ */
+static RyanJsonBool_e RyanJsonQueryParseNumber(RyanJsonQueryCompiler_t *compiler, double *out)
+{
+	const char *start = compiler->text;
+	const char *text = start;
+	if ('-' == *text) { text++; }
+	RyanJsonCheckReturnFalse(*text >= '0' && *text <= '9');
+	if ('0' == *text) { text++; }
+	else
+	{
+		while (*text >= '0' && *text <= '9') { text++; }
+	}
+	if ('.' == *text)
+	{
+		text++;
+		RyanJsonCheckReturnFalse(*text >= '0' && *text <= '9');
+		while (*text >= '0' && *text <= '9') { text++; }
+	}
+	if ('e' == *text || 'E' == *text)
+	{
+		text++;
+		if ('+' == *text || '-' == *text) { text++; }
+		RyanJsonCheckReturnFalse(*text >= '0' && *text <= '9');
+		while (*text >= '0' && *text <= '9') { text++; }
+	}
+
+	uint32_t len = (uint32_t)(text - start);
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonInternalParseDoubleRaw((const uint8_t *)start, len, out, NULL));
+	compiler->text = text;
+	return RyanJsonTrue;
+}
+
+static RyanJsonBool_e RyanJsonQueryMatchWord(RyanJsonQueryCompiler_t *compiler, const char *word)
+{
+	uint32_t len = 0;
+	while ('\0' != word[len])
+	{
+		if (compiler->text[len] != word[len]) { return RyanJsonFalse; }
+		len++;
+	}
+	if (RyanJsonQueryIsNameChar((uint8_t)compiler->text[len])) { return RyanJsonFalse; }
+	compiler->text += len;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 解析过滤表达式：`?` 之后的 `@.a['b'] op 字面量`，整体可用圆括号包裹
+ */
+static RyanJsonBool_e RyanJsonQueryParseFilter(RyanJsonQueryCompiler_t *compiler, RyanJsonQueryStep_t *step)
+{
+	step->kind = RyanJsonQueryStepFilter;
+	RyanJsonQuerySkipSpace(compiler);
+	RyanJsonBool_e paren = RyanJsonMakeBool('(' == *compiler->text);
+	if (paren)
+	{
+		compiler->text++;
+		RyanJsonQuerySkipSpace(compiler);
+	}
+
+	// 相对路径
+	RyanJsonCheckReturnFalse('@' == *compiler->text);
+	compiler->text++;
+	step->keyFirst = compiler->keyCount;
+	while (1)
+	{
+		if ('.' == *compiler->text)
+		{
+			compiler->text++;
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonQueryParseName(compiler, RyanJsonQueryNewKey(compiler)));
+		}
+		else if ('[' == *compiler->text)
+		{
+			compiler->text++;
+			RyanJsonQuerySkipSpace(compiler);
+			RyanJsonCheckReturnFalse('\'' == *compiler->text || '"' == *compiler->text);
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonQueryParseQuoted(compiler, RyanJsonQueryNewKey(compiler)));
+			RyanJsonQuerySkipSpace(compiler);
+			RyanJsonCheckReturnFalse(']' == *compiler->text);
+			compiler->text++;
+		}
+		else
+		{
+			break;
+		}
+	}
+	step->keyCount = compiler->keyCount - step->keyFirst;
+
+	// 比较符
+	RyanJsonQuerySkipSpace(compiler);
+	const char *text = compiler->text;
+	if ('=' == text[0] && '=' == text[1]) { step->op = RyanJsonQueryOpEq; }
+	else if ('!' == text[0] && '=' == text[1]) { step->op = RyanJsonQueryOpNe; }
+	else if ('<' == text[0]) { step->op = ('=' == text[1]) ? RyanJsonQueryOpLe : RyanJsonQueryOpLt; }
+	else if ('>' == text[0]) { step->op = ('=' == text[1]) ? RyanJsonQueryOpGe : RyanJsonQueryOpGt; }
+	else
+	{
+		step->op = RyanJsonQueryOpExists;
+	}
+
+	// 字面量
+	if (RyanJsonQueryOpExists != step->op)
+	{
+		compiler->text += (RyanJsonQueryOpLt == step->op || RyanJsonQueryOpGt == step->op) ? 1 : 2;
+		RyanJsonQuerySkipSpace(compiler);
+		if ('\'' == *compiler->text || '"' == *compiler->text)
+		{
+			step->literal = RyanJsonQueryLiteralString;
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonQueryParseQuoted(compiler, &step->name));
+		}
+		else if (RyanJsonQueryMatchWord(compiler, "true")) { step->literal = RyanJsonQueryLiteralTrue; }
+		else if (RyanJsonQueryMatchWord(compiler, "false")) { step->literal = RyanJsonQueryLiteralFalse; }
+		else if (RyanJsonQueryMatchWord(compiler, "null")) { step->literal = RyanJsonQueryLiteralNull; }
+		else
+		{
+			step->literal = RyanJsonQueryLiteralNumber;
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonQueryParseNumber(compiler, &step->number));
+		}
+		RyanJsonQuerySkipSpace(compiler);
+	}
+
+	if (paren)
+	{
+		RyanJsonCheckReturnFalse(')' == *compiler->text);
+		compiler->text++;
+	}
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 解析方括号选择器（调用时已越过 '['）
+ */
+static RyanJsonBool_e RyanJsonQueryParseBracket(RyanJsonQueryCompiler_t *compiler, RyanJsonQueryStep_t *step)
+{
+	RyanJsonQuerySkipSpace(compiler);
+	char ch = *compiler->text;
+	if ('*' == ch)
+	{
+		step->kind = RyanJsonQueryStepWildcard;
+		compiler->text++;
+	}
+	else if ('\'' == ch || '"' == ch)
+	{
+		step->kind = RyanJsonQueryStepName;
+		RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonQueryParseQuoted(compiler, &step->name));
+	}
+	else if ('?' == ch)
+	{
+		compiler->text++;
+		RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonQueryParseFilter(compiler, step));
+	}
+	else
+	{
+		// [n] 或 [start:end:step]
+		uint8_t flags = 0;
+		if ('-' == ch || (ch >= '0' && ch <= '9'))
+		{
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonQueryParseInt(compiler, &step->start));
+			flags |= RyanJsonQueryHasStart;
+			RyanJsonQuerySkipSpace(compiler);
+		}
+
+		if (':' != *compiler->text)
+		{
+			RyanJsonCheckReturnFalse(0 != (flags & RyanJsonQueryHasStart));
+			step->kind = RyanJsonQueryStepIndex;
+		}
+		else
+		{
+			step->kind = RyanJsonQueryStepSlice;
+			step->step = 1;
+			compiler->text++;
+			RyanJsonQuerySkipSpace(compiler);
+			if ('-' == *compiler->text || (*compiler->text >= '0' && *compiler->text <= '9'))
+			{
+				RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonQueryParseInt(compiler, &step->end));
+				flags |= RyanJsonQueryHasEnd;
+				RyanJsonQuerySkipSpace(compiler);
+			}
+			if (':' == *compiler->text)
+			{
+				compiler->text++;
+				RyanJsonQuerySkipSpace(compiler);
+				if ('-' == *compiler->text || (*compiler->text >= '0' && *compiler->text <= '9'))
+				{
+					// 线索化链表只能单向前进，不支持负步长
+					int32_t stepValue;
+					RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonQueryParseInt(compiler, &stepValue));
+					RyanJsonCheckReturnFalse(stepValue >= 0);
+					step->step = (uint32_t)stepValue;
+				}
+			}
+		}
+		step->literal = flags;
+	}
+
+	RyanJsonQuerySkipSpace(compiler);
+	RyanJsonCheckReturnFalse(']' == *compiler->text);
+	compiler->text++;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 解析整条查询
+ */
+static RyanJsonBool_e RyanJsonQueryParse(RyanJsonQueryCompiler_t *compiler)
+{
+	RyanJsonQuerySkipSpace(compiler);
+	RyanJsonCheckReturnFalse('$' == *compiler->text);
+	compiler->text++;
+
+	while (1)
+	{
+		RyanJsonQuerySkipSpace(compiler);
+		if ('\0' == *compiler->text) { break; }
+		RyanJsonCheckReturnFalse(compiler->stepCount < RyanJsonQueryMaxSteps);
+
+		RyanJsonQueryStep_t *step = RyanJsonQueryNewStep(compiler);
+		if ('[' == *compiler->text)
+		{
+			compiler->text++;
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonQueryParseBracket(compiler, step));
+			continue;
+		}
+
+		RyanJsonCheckReturnFalse('.' == *compiler->text);
+		compiler->text++;
+		if ('.' == *compiler->text)
+		{
+			step->descendant = RyanJsonTrue;
+			compiler->text++;
+			if ('[' == *compiler->text)
+			{
+				compiler->text++;
+				RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonQueryParseBracket(compiler, step));
+				continue;
+			}
+		}
+
+		if ('*' == *compiler->text)
+		{
+			step->kind = RyanJsonQueryStepWildcard;
+			compiler->text++;
+		}
+		else
+		{
+			step->kind = RyanJsonQueryStepName;
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonQueryParseName(compiler, &step->name));
+		}
+	}
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 编译 JSONPath 查询
+ *
+ * @param expr 以 '$' 开头的查询，如 "$.fleet[*].devices[?@.online == true].id"
+ * @return RyanJsonQuery_t 查询程序，语法错误、段数超过 RyanJsonQueryMaxSteps 或内存不足时返回 NULL
+ * @note 编译结果只读，可被多个迭代器同时使用。
+ */
+RyanJsonQuery_t RyanJsonQueryCompile(const char *expr)
+{
+	RyanJsonCheckReturnNull(NULL != expr);
+
+	// 第一遍：校验语法并统计大小
+	RyanJsonQueryCompiler_t compiler;
+	RyanJsonMemset(&compiler, 0, sizeof(compiler));
+	compiler.text = expr;
+	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonQueryParse(&compiler));
+
+	size_t stepsSize = sizeof(struct RyanJsonQuery) + (size_t)compiler.stepCount * sizeof(RyanJsonQueryStep_t);
+	size_t keysSize = (size_t)compiler.keyCount * sizeof(RyanJsonQueryKey_t);
+	RyanJsonQuery_t query = (RyanJsonQuery_t)jsonMalloc(stepsSize + keysSize + compiler.poolSize);
+	RyanJsonCheckReturnNull(NULL != query);
+	query->stepCount = compiler.stepCount;
+	query->keys = (RyanJsonQueryKey_t *)((uint8_t *)query + stepsSize);
+
+	// 第二遍：写入段、key 与字符串池
+	RyanJsonMemset(&compiler, 0, sizeof(compiler));
+	compiler.text = expr;
+	compiler.query = query;
+	compiler.pool = (char *)query + stepsSize + keysSize;
+	RyanJsonBool_e ok = RyanJsonQueryParse(&compiler);
+	RyanJsonCheckAssert(RyanJsonTrue == ok && compiler.stepCount == query->stepCount);
+	(void)ok;
+
+	return query;
+}
+
+/**
+ * @brief 释放查询程序
+ */
+void RyanJsonQueryDelete(RyanJsonQuery_t query)
+{
+	RyanJsonCheckCode(NULL != query, { return; });
+	jsonFree(query);
+}
+
+static RyanJson_t RyanJsonQueryFirstChild(RyanJson_t pJson)
+{
+	if (!_checkType(pJson, RyanJsonTypeArray) && !_checkType(pJson, RyanJsonTypeObject)) { return NULL; }
+	return RyanJsonGetObjectValue(pJson);
+}
+
+/**
+ * @brief 递归下降的先序后继：优先下沉到首个子节点，否则前进到兄弟，没有兄弟时沿线索回溯
+ *
+ * @param pJson 当前节点
+ * @param anchor 子树根，回溯到它即遍历结束
+ * @return RyanJson_t 后继节点，子树遍历完返回 NULL
+ * @note 紧凑数组的元素都是标量，任何选择器作用于标量都不会命中，因此不下沉（也就不会被展开）。
+ */
+static RyanJson_t RyanJsonQueryWalkNext(RyanJson_t pJson, RyanJson_t anchor)
+{
+	if ((_checkType(pJson, RyanJsonTypeArray) || _checkType(pJson, RyanJsonTypeObject)) && !RyanJsonInternalIsPackedArray(pJson))
+	{
+		RyanJson_t child = RyanJsonGetObjectValue(pJson);
+		if (NULL != child) { return child; }
+	}
+
+	while (pJson != anchor)
+	{
+		RyanJson_t next = RyanJsonGetNext(pJson);
+		if (NULL != next) { return next; }
+
+		// 最后一个兄弟的 next 在内部链表中指向父节点
+		pJson = pJson->next;
+	}
+	return NULL;
+}
+
+/**
+ * @brief 判断节点是否满足过滤条件
+ * @note 类型不同时只有 != 成立；Bool 与 null 只有相等关系，<= 与 >= 在相等时成立。
+ */
+static RyanJsonBool_e RyanJsonQueryFilterMatch(RyanJsonQuery_t query, const RyanJsonQueryStep_t *step, RyanJson_t item)
+{
+	RyanJson_t target = item;
+	for (uint32_t i = 0; i < step->keyCount && NULL != target; i++)
+	{
+		const RyanJsonQueryKey_t *key = &query->keys[step->keyFirst + i];
+		if (!_checkType(target, RyanJsonTypeObject)) { return RyanJsonMakeBool(RyanJsonQueryOpNe == step->op); }
+		target = RyanJsonInternalGetObjectByKeyHash(target, key->key, key->keyLen, key->hash);
+	}
+	if (RyanJsonQueryOpExists == step->op) { return RyanJsonMakeBool(NULL != target); }
+
+	RyanJsonBool_e equal = RyanJsonFalse;
+	RyanJsonBool_e ordered = RyanJsonFalse;
+	int32_t order = 0;
+	if (NULL != target)
+	{
+		switch (step->literal)
+		{
+		case RyanJsonQueryLiteralNumber:
+			if (RyanJsonIsNumber(target))
+			{
+				double number = RyanJsonInternalGetNumber(target, NULL);
+				equal = RyanJsonCompareDouble(number, step->number);
+				ordered = RyanJsonTrue;
+				order = equal ? 0 : ((number < step->number) ? -1 : 1);
+			}
+			break;
+
+		case RyanJsonQueryLiteralString:
+			if (RyanJsonIsString(target))
+			{
+				const char *str = RyanJsonGetStringValue(target);
+				uint32_t strLen = RyanJsonGetStringLength(target);
+				uint32_t minLen = (strLen < step->name.keyLen) ? strLen : step->name.keyLen;
+				int32_t cmp = (0 == minLen) ? 0 : RyanJsonMemcmp(str, step->name.key, minLen);
+				if (0 == cmp) { cmp = (strLen == step->name.keyLen) ? 0 : ((strLen < step->name.keyLen) ? -1 : 1); }
+				equal = RyanJsonMakeBool(0 == cmp);
+				ordered = RyanJsonTrue;
+				order = cmp;
+			}
+			break;
+
+		case RyanJsonQueryLiteralTrue:
+		case RyanJsonQueryLiteralFalse:
+			if (RyanJsonIsBool(target))
+			{
+				equal = RyanJsonMakeBool(RyanJsonGetBoolValue(target) == (RyanJsonQueryLiteralTrue == step->literal));
+			}
+			break;
+
+		default: equal = RyanJsonIsNull(target); break;
+		}
+	}
+
+	switch (step->op)
+	{
+	case RyanJsonQueryOpEq: return equal;
+	case RyanJsonQueryOpNe: return RyanJsonMakeBool(!equal);
+	case RyanJsonQueryOpLt: return RyanJsonMakeBool(ordered && order < 0);
+	case RyanJsonQueryOpLe: return RyanJsonMakeBool(equal || (ordered && order < 0));
+	case RyanJsonQueryOpGt: return RyanJsonMakeBool(ordered && order > 0);
+	default: return RyanJsonMakeBool(equal || (ordered && order > 0));
+	}
+}
+
+/**
+ * @brief 按 RFC 9535 规则把切片边界规范化到 [0, size]
+ */
+static uint32_t RyanJsonQuerySliceBound(int32_t value, uint32_t size)
+{
+	if (value >= 0) { return ((uint32_t)value < size) ? (uint32_t)value : size; }
+	uint32_t back = (uint32_t)(-(int64_t)value);
+	return (back < size) ? (size - back) : 0;
+}
+
+/**
+ * @brief 取 frame->walk 上选择器的下一个结果
+ */
+static RyanJson_t RyanJsonQuerySelectNext(RyanJsonQuery_t query, const RyanJsonQueryStep_t *step, RyanJsonQueryFrame_t *frame)
+{
+	RyanJson_t node = frame->walk;
+	if (RyanJsonQueryPhaseDone == frame->phase) { return NULL; }
+
+	if (RyanJsonQueryPhaseFresh == frame->phase)
+	{
+		frame->phase = RyanJsonQueryPhaseRunning;
+		switch (step->kind)
+		{
+		case RyanJsonQueryStepName:
+			frame->phase = RyanJsonQueryPhaseDone;
+			if (!_checkType(node, RyanJsonTypeObject)) { return NULL; }
+			return RyanJsonInternalGetObjectByKeyHash(node, step->name.key, step->name.keyLen, step->name.hash);
+
+		case RyanJsonQueryStepIndex: {
+			frame->phase = RyanJsonQueryPhaseDone;
+			if (!_checkType(node, RyanJsonTypeArray)) { return NULL; }
+			uint32_t index = (uint32_t)step->start;
+			if (step->start < 0)
+			{
+				uint32_t size = RyanJsonGetSize(node);
+				uint32_t back = (uint32_t)(-(int64_t)step->start);
+				if (back > size) { return NULL; }
+				index = size - back;
+			}
+			return RyanJsonGetObjectByIndex(node, index);
+		}
+
+		case RyanJsonQueryStepSlice: {
+			if (!_checkType(node, RyanJsonTypeArray) || 0 == step->step) { frame->child = NULL; }
+			else
+			{
+				// 边界均非负时无需求元素个数，省去一次遍历
+				uint32_t size = UINT32_MAX;
+				uint32_t hasStart = step->literal & RyanJsonQueryHasStart;
+				uint32_t hasEnd = step->literal & RyanJsonQueryHasEnd;
+				if ((0 != hasStart && step->start < 0) || (0 != hasEnd && step->end < 0)) { size = RyanJsonGetSize(node); }
+				frame->pos = (0 != hasStart) ? RyanJsonQuerySliceBound(step->start, size) : 0;
+				frame->limit = (0 != hasEnd) ? RyanJsonQuerySliceBound(step->end, size) : size;
+				frame->child = (frame->pos < frame->limit) ? RyanJsonGetObjectByIndex(node, frame->pos) : NULL;
+			}
+			break;
+		}
+
+		default: frame->child = RyanJsonQueryFirstChild(node); break;
+		}
+	}
+	else if (RyanJsonQueryStepSlice == step->kind)
+	{
+		for (uint32_t i = 0; i < step->step && NULL != frame->child; i++)
+		{
+			frame->child = RyanJsonGetNext(frame->child);
+		}
+		frame->pos = (frame->limit - frame->pos > step->step) ? (frame->pos + step->step) : frame->limit;
+		if (frame->pos >= frame->limit) { frame->child = NULL; }
+	}
+	else
+	{
+		frame->child = RyanJsonGetNext(frame->child);
+	}
+
+	if (RyanJsonQueryStepFilter == step->kind)
+	{
+		while (NULL != frame->child && RyanJsonTrue != RyanJsonQueryFilterMatch(query, step, frame->child))
+		{
+			frame->child = RyanJsonGetNext(frame->child);
+		}
+	}
+
+	if (NULL == frame->child) { frame->phase = RyanJsonQueryPhaseDone; }
+	return frame->child;
+}
+
+/**
+ * @brief 取一段的下一个输出：递归下降时按先序把选择器依次作用于 input 及其全部后代
+ */
+static RyanJson_t RyanJsonQueryStepNext(RyanJsonQuery_t query, const RyanJsonQueryStep_t *step, RyanJsonQueryFrame_t *frame)
+{
+	while (1)
+	{
+		RyanJson_t item = RyanJsonQuerySelectNext(query, step, frame);
+		if (NULL != item || !step->descendant) { return item; }
+
+		frame->walk = RyanJsonQueryWalkNext(frame->walk, frame->input);
+		if (NULL == frame->walk) { return NULL; }
+		frame->phase = RyanJsonQueryPhaseFresh;
+	}
+}
+
+static void RyanJsonQueryFrameInit(RyanJsonQueryFrame_t *frame, RyanJson_t input)
+{
+	RyanJsonMemset(frame, 0, sizeof(RyanJsonQueryFrame_t));
+	frame->input = input;
+	frame->walk = input;
+	frame->phase = RyanJsonQueryPhaseFresh;
+}
+
+/**
+ * @brief 初始化查询迭代器
+ *
+ * @param iter 迭代器，通常位于调用方栈上
+ * @param pJson 查询的根节点（对应 '$'）
+ * @param query RyanJsonQueryCompile 的结果
+ * @return RyanJsonBool_e 参数非法时返回 false
+ */
+RyanJsonBool_e RyanJsonQueryIterInit(RyanJsonQueryIter_t *iter, RyanJson_t pJson, RyanJsonQuery_t query)
+{
+	RyanJsonCheckReturnFalse(NULL != iter);
+	iter->query = query;
+	iter->depth = 0;
+	RyanJsonCheckReturnFalse(NULL != pJson && NULL != query);
+
+	RyanJsonQueryFrameInit(&iter->frames[0], pJson);
+	iter->depth = 1;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 取下一个命中节点
+ *
+ * @param iter 已初始化的迭代器
+ * @return RyanJson_t 命中节点，全部产出后返回 NULL
+ * @note 结果顺序与 RFC 9535 一致：每段依次作用于上一段的每个结果；递归下降可能产出重复节点（如 "$..*..*"）。
+ * @note 第 k 段的游标保存在 frames[k - 1]，当前段耗尽时回到上一段取下一个输入，整个过程不递归。
+ */
+RyanJson_t RyanJsonQueryIterNext(RyanJsonQueryIter_t *iter)
+{
+	RyanJsonCheckReturnNull(NULL != iter && NULL != iter->query);
+	RyanJsonQuery_t query = iter->query;
+
+	// "$" 只产出根节点一次
+	if (0 == query->stepCount)
+	{
+		RyanJson_t root = (0 != iter->depth) ? iter->frames[0].input : NULL;
+		iter->depth = 0;
+		return root;
+	}
+
+	while (iter->depth > 0)
+	{
+		uint32_t level = iter->depth - 1;
+		RyanJson_t item = RyanJsonQueryStepNext(query, &query->steps[level], &iter->frames[level]);
+		if (NULL == item)
+		{
+			iter->depth--;
+			continue;
+		}
+		if (level + 1 == query->stepCount) { return item; }
+
+		RyanJsonQueryFrameInit(&iter->frames[level + 1], item);
+		iter->depth++;
+	}
+	return NULL;
+}
+
+/**
+ * @brief 对每个命中节点调用回调
+ *
+ * @param pJson 查询的根节点
+ * @param query 查询程序
+ * @param callback 回调，返回 false 时停止
+ * @param userData 透传给回调的参数
+ * @return uint32_t 已回调的命中数
+ */
+uint32_t RyanJsonQueryEach(RyanJson_t pJson, RyanJsonQuery_t query, RyanJsonQueryCallback_t callback, void *userData)
+{
+	RyanJsonCheckCode(NULL != callback, { return 0; });
+
+	RyanJsonQueryIter_t iter;
+	RyanJson_t item;
+	uint32_t count = 0;
+	RyanJsonQueryForEach(iter, pJson, query, item)
+	{
+		count++;
+		if (RyanJsonTrue != callback(item, userData)) { break; }
+	}
+	return count;
+}
+
+/**
+ * @brief 返回首个命中节点，未命中返回 NULL
+ */
+RyanJson_t RyanJsonQueryFirst(RyanJson_t pJson, RyanJsonQuery_t query)
+{
+	RyanJsonQueryIter_t iter;
+	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonQueryIterInit(&iter, pJson, query));
+	return RyanJsonQueryIterNext(&iter);
+}
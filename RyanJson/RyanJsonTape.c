@@ -0,0 +1,852 @@
+#include "RyanJsonInternal.h"
+
+#define RyanJsonTapeInitEntryCap (16U)
+#define RyanJsonTapeInitPoolCap  (64U)
+
+/**
+ * @brief 追加一个条目
+ *
+ * @param builder 构建器
+ * @param tag 条目 tag
+ * @return RyanJsonTapeEntry_t* 新条目（除 tag 外清零），内存不足返回 NULL
+ * @note 扩容后之前取得的条目指针全部失效，调用方应按下标访问。
+ */
+RyanJsonInternalApi RyanJsonTapeEntry_t *RyanJsonInternalTapePush(RyanJsonTapeBuilder_t *builder, uint32_t tag)
+{
+	RyanJsonCheckAssert(NULL != builder);
+
+	if (builder->entryCount >= builder->entryCap)
+	{
+		RyanJsonCheckReturnNull(builder->entryCap < UINT32_MAX / 2U / sizeof(RyanJsonTapeEntry_t));
+		uint32_t newCap = (0U == builder->entryCap) ? RyanJsonTapeInitEntryCap : (builder->entryCap * 2U);
+		RyanJsonTapeEntry_t *entries;
+		if (NULL == builder->entries) { entries = (RyanJsonTapeEntry_t *)jsonMalloc((size_t)newCap * sizeof(RyanJsonTapeEntry_t)); }
+		else
+		{
+			entries = (RyanJsonTapeEntry_t *)RyanJsonInternalExpandRealloc(
+				builder->entries, builder->entryCap * (uint32_t)sizeof(RyanJsonTapeEntry_t),
+				newCap * (uint32_t)sizeof(RyanJsonTapeEntry_t));
+		}
+		RyanJsonCheckReturnNull(NULL != entries);
+		builder->entries = entries;
+		builder->entryCap = newCap;
+	}
+
+	RyanJsonTapeEntry_t *entry = &builder->entries[builder->entryCount++];
+	RyanJsonMemset(entry, 0, sizeof(RyanJsonTapeEntry_t));
+	entry->tag = tag;
+	return entry;
+}
+
+/**
+ * @brief 保证字符串池尾部至少还有 size 字节可写
+ *
+ * @return uint8_t* 池尾地址（写入后由调用方推进 poolSize），内存不足返回 NULL
+ */
+RyanJsonInternalApi uint8_t *RyanJsonInternalTapeReservePool(RyanJsonTapeBuilder_t *builder, uint32_t size)
+{
+	RyanJsonCheckAssert(NULL != builder);
+	RyanJsonCheckReturnNull(size <= UINT32_MAX / 2U - builder->poolSize);
+
+	uint32_t need = builder->poolSize + size;
+	if (need > builder->poolCap)
+	{
+		uint32_t newCap = (0U == builder->poolCap) ? RyanJsonTapeInitPoolCap : (builder->poolCap * 2U);
+		if (newCap < need) { newCap = need; }
+
+		uint8_t *pool;
+		if (NULL == builder->pool) { pool = (uint8_t *)jsonMalloc((size_t)newCap); }
+		else
+		{
+			pool = (uint8_t *)RyanJsonInternalExpandRealloc(builder->pool, builder->poolCap, newCap);
+		}
+		RyanJsonCheckReturnNull(NULL != pool);
+		builder->pool = pool;
+		builder->poolCap = newCap;
+	}
+
+	return builder->pool + builder->poolSize;
+}
+
+/**
+ * @brief 释放构建器持有的临时内存
+ */
+RyanJsonInternalApi void RyanJsonInternalTapeBuilderFree(RyanJsonTapeBuilder_t *builder)
+{
+	RyanJsonCheckAssert(NULL != builder);
+
+	if (NULL != builder->entries) { jsonFree(builder->entries); }
+	if (NULL != builder->pool) { jsonFree(builder->pool); }
+	RyanJsonMemset(builder, 0, sizeof(RyanJsonTapeBuilder_t));
+}
+
+/**
+ * @brief 追加哨兵并合并为一整块文档
+ *
+ * @param builder 构建器，无论成败都会被释放
+ * @param headroom 文档前额外预留的字节数（二进制镜像头部），应为 4 的倍数
+ * @return RyanJsonTape_t 文档（位于申请到的内存块 headroom 偏移处），内存不足返回 NULL
+ * @note 池内偏移在此改写为相对各条目自身地址的偏移，文档因此可整体搬移。
+ */
+RyanJsonInternalApi RyanJsonTape_t RyanJsonInternalTapeFinish(RyanJsonTapeBuilder_t *builder, uint32_t headroom)
+{
+	RyanJsonCheckAssert(NULL != builder);
+
+	RyanJsonTape_t tape = NULL;
+	RyanJsonCheckCode(NULL != RyanJsonInternalTapePush(builder, RyanJsonTapeTypeEnd), { goto exit__; });
+
+	uint32_t entryBytes = builder->entryCount * (uint32_t)sizeof(RyanJsonTapeEntry_t);
+	RyanJsonCheckCode(builder->poolSize <= UINT32_MAX - headroom - sizeof(struct RyanJsonTape) - entryBytes, { goto exit__; });
+
+	uint8_t *block = (uint8_t *)jsonMalloc((size_t)headroom + sizeof(struct RyanJsonTape) + entryBytes + builder->poolSize);
+	RyanJsonCheckCode(NULL != block, { goto exit__; });
+	tape = (RyanJsonTape_t)(void *)(block + headroom);
+
+	tape->entryCount = builder->entryCount;
+	tape->poolSize = builder->poolSize;
+	RyanJsonTapeEntry_t *entries = RyanJsonTapeEntries(tape);
+	RyanJsonMemcpy(entries, builder->entries, entryBytes);
+	if (0U != builder->poolSize) { RyanJsonMemcpy((uint8_t *)entries + entryBytes, builder->pool, builder->poolSize); }
+
+	for (uint32_t i = 0; i < tape->entryCount; i++)
+	{
+		// 本条目到字符串池起点的距离
+		uint32_t toPool = (tape->entryCount - i) * (uint32_t)sizeof(RyanJsonTapeEntry_t);
+		if (0U != (entries[i].tag & RyanJsonTapeTagHasKey)) { entries[i].keyOff += toPool; }
+		if (RyanJsonTypeString == RyanJsonTapeEntryType(&entries[i])) { entries[i].value.str.off += toPool; }
+	}
+
+exit__:
+	RyanJsonInternalTapeBuilderFree(builder);
+	return tape;
+}
+
+/**
+ * @brief 释放扁平文档
+ */
+void RyanJsonTapeDelete(RyanJsonTape_t tape)
+{
+	RyanJsonCheckCode(NULL != tape, { return; });
+	jsonFree(tape);
+}
+
+RyanJsonTapeVal_t RyanJsonTapeGetRoot(RyanJsonTape_t tape)
+{
+	RyanJsonCheckReturnNull(NULL != tape);
+	return RyanJsonTapeEntries(tape);
+}
+
+RyanjsonType_e RyanJsonTapeGetType(RyanJsonTapeVal_t val)
+{
+	RyanJsonCheckAssert(NULL != val);
+	return (RyanjsonType_e)RyanJsonTapeEntryType(val);
+}
+
+RyanJsonBool_e RyanJsonTapeIsInt(RyanJsonTapeVal_t val)
+{
+	RyanJsonCheckCode(NULL != val, { return RyanJsonFalse; });
+	return RyanJsonMakeBool(RyanJsonTypeNumber == RyanJsonTapeEntryType(val) && 0U == (val->tag & RyanJsonTapeTagFlag));
+}
+
+RyanJsonBool_e RyanJsonTapeIsDouble(RyanJsonTapeVal_t val)
+{
+	RyanJsonCheckCode(NULL != val, { return RyanJsonFalse; });
+	return RyanJsonMakeBool(RyanJsonTypeNumber == RyanJsonTapeEntryType(val) && 0U != (val->tag & RyanJsonTapeTagFlag));
+}
+
+const char *RyanJsonTapeGetKey(RyanJsonTapeVal_t val)
+{
+	RyanJsonCheckAssert(NULL != val);
+	if (0U == (val->tag & RyanJsonTapeTagHasKey)) { return NULL; }
+	return (const char *)val + val->keyOff;
+}
+
+uint32_t RyanJsonTapeGetKeyLength(RyanJsonTapeVal_t val)
+{
+	RyanJsonCheckAssert(NULL != val);
+	return val->tag >> RyanJsonTapeTagKeyLenShift;
+}
+
+const char *RyanJsonTapeGetStringValue(RyanJsonTapeVal_t val)
+{
+	RyanJsonCheckAssert(NULL != val);
+	return (const char *)val + val->value.str.off;
+}
+
+uint32_t RyanJsonTapeGetStringLength(RyanJsonTapeVal_t val)
+{
+	RyanJsonCheckAssert(NULL != val);
+	if (RyanJsonTypeString != RyanJsonTapeEntryType(val)) { return 0; }
+	return val->value.str.len;
+}
+
+int32_t RyanJsonTapeGetIntValue(RyanJsonTapeVal_t val)
+{
+	RyanJsonCheckAssert(NULL != val);
+	return val->value.intValue;
+}
+
+double RyanJsonTapeGetDoubleValue(RyanJsonTapeVal_t val)
+{
+	RyanJsonCheckAssert(NULL != val);
+
+	double doubleValue;
+	RyanJsonMemcpy(&doubleValue, &val->value, sizeof(doubleValue));
+	return doubleValue;
+}
+
+RyanJsonBool_e RyanJsonTapeGetBoolValue(RyanJsonTapeVal_t val)
+{
+	RyanJsonCheckAssert(NULL != val);
+	return RyanJsonMakeBool(0U != (val->tag & RyanJsonTapeTagFlag));
+}
+
+uint32_t RyanJsonTapeGetSize(RyanJsonTapeVal_t val)
+{
+	RyanJsonCheckCode(NULL != val, { return 0; });
+	if (!RyanJsonTapeEntryIsContainer(val)) { return 1; }
+	return val->value.container.count;
+}
+
+RyanJsonTapeVal_t RyanJsonTapeGetObjectValue(RyanJsonTapeVal_t val)
+{
+	RyanJsonCheckReturnNull(NULL != val);
+	if (!RyanJsonTapeEntryIsContainer(val) || 0U == val->value.container.count) { return NULL; }
+	return val + 1;
+}
+
+/**
+ * @brief 获取同层下一个值
+ * @note 跨过整个子树只需一次加法，不访问子树内的任何条目。
+ */
+RyanJsonTapeVal_t RyanJsonTapeGetNext(RyanJsonTapeVal_t val)
+{
+	RyanJsonCheckReturnNull(NULL != val);
+
+	RyanJsonTapeVal_t next = val + RyanJsonTapeEntrySpan(val);
+	if (RyanJsonTapeTypeEnd == RyanJsonTapeEntryType(next)) { return NULL; }
+	return next;
+}
+
+/**
+ * @brief 按 key 查找 Object 的直接成员（先比较长度再比较内容）
+ */
+RyanJsonTapeVal_t RyanJsonTapeGetObjectByKey(RyanJsonTapeVal_t val, const char *key)
+{
+	RyanJsonCheckReturnNull(NULL != val && NULL != key);
+	RyanJsonCheckReturnNull(RyanJsonTypeObject == RyanJsonTapeEntryType(val));
+
+	uint32_t keyLen = (uint32_t)RyanJsonStrlen(key);
+	RyanJsonTapeVal_t item;
+	RyanJsonTapeForEach(val, item)
+	{
+		if (RyanJsonTapeGetKeyLength(item) == keyLen && 0 == RyanJsonMemcmp(RyanJsonTapeGetKey(item), key, keyLen)) { return item; }
+	}
+	return NULL;
+}
+
+RyanJsonTapeVal_t RyanJsonTapeGetObjectByIndex(RyanJsonTapeVal_t val, uint32_t index)
+{
+	RyanJsonCheckReturnNull(NULL != val);
+	RyanJsonCheckReturnNull(RyanJsonTapeEntryIsContainer(val) && index < val->value.container.count);
+
+	RyanJsonTapeVal_t item = RyanJsonTapeGetObjectValue(val);
+	while (index-- > 0)
+	{
+		item = RyanJsonTapeGetNext(item);
+	}
+	return item;
+}
+
+/**
+ * @brief 按条目创建单个树节点（容器为空容器）
+ */
+static RyanJson_t RyanJsonTapeNewNode(RyanJsonTapeVal_t val)
+{
+	const char *key = RyanJsonTapeGetKey(val);
+	switch (RyanJsonTapeEntryType(val))
+	{
+	case RyanJsonTypeNull: return RyanJsonCreateNull(key);
+	case RyanJsonTypeBool: return RyanJsonCreateBool(key, RyanJsonTapeGetBoolValue(val));
+	case RyanJsonTypeNumber:
+		if (RyanJsonTapeIsDouble(val)) { return RyanJsonCreateDouble(key, RyanJsonTapeGetDoubleValue(val)); }
+		return RyanJsonCreateInt(key, RyanJsonTapeGetIntValue(val));
+	case RyanJsonTypeString:
+		return RyanJsonInternalCreateStringWithLen(key, RyanJsonTapeGetStringValue(val), val->value.str.len,
+							   RyanJsonMakeBool(0U != (val->tag & RyanJsonTapeTagFlag)));
+	case RyanJsonTypeArray: return RyanJsonInternalCreateArrayAndKey(key);
+	case RyanJsonTypeObject: return RyanJsonInternalCreateObjectAndKey(key);
+	default: return NULL;
+	}
+}
+
+/**
+ * @brief 将扁平文档中的值（含子树）转为可修改的普通树
+ *
+ * @param val 文档中的任意值
+ * @return RyanJson_t 新树根节点（保留 val 的 key），失败返回 NULL
+ * @note 条目按先序排列，顺序扫描即可，遇到结束标记经线索回到父节点，不使用递归或显式栈。
+ */
+RyanJson_t RyanJsonTapeToTree(RyanJsonTapeVal_t val)
+{
+	RyanJsonCheckReturnNull(NULL != val);
+
+	RyanJson_t root = RyanJsonTapeNewNode(val);
+	RyanJsonCheckReturnNull(NULL != root);
+	if (!RyanJsonTapeEntryIsContainer(val)) { return root; }
+
+	RyanJson_t scopeParent = root;
+	RyanJson_t lastSibling = NULL;
+	for (RyanJsonTapeVal_t curr = val + 1;; curr++)
+	{
+		if (RyanJsonTapeTypeEnd == RyanJsonTapeEntryType(curr))
+		{
+#if true == RyanJsonPackedArray
+			// 与解析路径一致：闭合的 Array 满足条件时转为紧凑存储
+			if (_checkType(scopeParent, RyanJsonTypeArray) && 0U != RyanJsonPackedArrayParseMinSize)
+			{
+				RyanJsonInternalPackedTryPack(scopeParent, RyanJsonPackedArrayParseMinSize);
+			}
+#endif
+			if (scopeParent == root) { return root; }
+
+			// 刚闭合的容器一定是父容器当前的尾节点，next 即父节点线索
+			lastSibling = scopeParent;
+			scopeParent = scopeParent->next;
+			continue;
+		}
+
+		RyanJson_t item = RyanJsonTapeNewNode(curr);
+		RyanJsonCheckCode(NULL != item, {
+			RyanJsonDelete(root);
+			return NULL;
+		});
+		RyanJsonInternalListInsertAfter(scopeParent, lastSibling, item);
+		lastSibling = item;
+
+		if (RyanJsonTapeEntryIsContainer(curr))
+		{
+			scopeParent = item;
+			lastSibling = NULL;
+		}
+	}
+}
+
+#define RyanJsonBinaryDedupInitCap (64U)
+
+typedef struct
+{
+	uint32_t hash;
+	uint32_t off; // 池内偏移 + 1，0 表示空槽
+} RyanJsonBinaryDedupSlot_t;
+
+/**
+ * @brief 镜像写入器：tape 构建器 + 池内字符串去重表
+ * @note 重复出现的 key（如对象数组每行相同的 key）与枚举式字符串值在池中只写一次，各条目指向同一份；
+ *       去重表扩容失败时放弃去重，镜像照常生成。
+ */
+typedef struct
+{
+	RyanJsonTapeBuilder_t builder;
+	RyanJsonBinaryDedupSlot_t *slots; // 开放寻址表（线性探测）
+	uint32_t slotCap;                 // 槽位数量（2 的幂）
+	uint32_t slotCount;
+	RyanJsonBool_e noDedup;
+} RyanJsonBinaryWriter_t;
+
+static void RyanJsonBinaryWriterFree(RyanJsonBinaryWriter_t *writer)
+{
+	RyanJsonInternalTapeBuilderFree(&writer->builder);
+	if (NULL != writer->slots) { jsonFree(writer->slots); }
+	writer->slots = NULL;
+}
+
+/**
+ * @brief 去重表扩容（首次调用时建立），失败时释放旧表并放弃去重
+ */
+static void RyanJsonBinaryDedupGrow(RyanJsonBinaryWriter_t *writer)
+{
+	uint32_t newCap = (0U == writer->slotCap) ? RyanJsonBinaryDedupInitCap : writer->slotCap * 2U;
+	RyanJsonBinaryDedupSlot_t *slots = NULL;
+	if (newCap <= UINT32_MAX / sizeof(RyanJsonBinaryDedupSlot_t))
+	{
+		slots = (RyanJsonBinaryDedupSlot_t *)jsonMalloc((size_t)newCap * sizeof(RyanJsonBinaryDedupSlot_t));
+	}
+	if (NULL == slots)
+	{
+		if (NULL != writer->slots) { jsonFree(writer->slots); }
+		writer->slots = NULL;
+		writer->noDedup = RyanJsonTrue;
+		return;
+	}
+	RyanJsonMemset(slots, 0, (size_t)newCap * sizeof(RyanJsonBinaryDedupSlot_t));
+
+	for (uint32_t i = 0; i < writer->slotCap; i++)
+	{
+		if (0U == writer->slots[i].off) { continue; }
+		uint32_t pos = writer->slots[i].hash & (newCap - 1U);
+		while (0U != slots[pos].off)
+		{
+			pos = (pos + 1U) & (newCap - 1U);
+		}
+		slots[pos] = writer->slots[i];
+	}
+
+	if (NULL != writer->slots) { jsonFree(writer->slots); }
+	writer->slots = slots;
+	writer->slotCap = newCap;
+}
+
+/**
+ * @brief 向字符串池写入一段字节串（补 '\0'），池中已有相同内容时直接复用
+ */
+static RyanJsonBool_e RyanJsonBinaryAppendPool(RyanJsonBinaryWriter_t *writer, const char *str, uint32_t len, uint32_t *offPtr)
+{
+	RyanJsonTapeBuilder_t *builder = &writer->builder;
+	uint32_t hash = 0;
+	uint32_t pos = 0;
+
+	if (!writer->noDedup)
+	{
+		if ((writer->slotCount + 1U) * 4U > writer->slotCap * 3U) { RyanJsonBinaryDedupGrow(writer); }
+	}
+	if (!writer->noDedup)
+	{
+		hash = RyanJsonInternalKeyHash(str, len);
+		pos = hash & (writer->slotCap - 1U);
+		while (0U != writer->slots[pos].off)
+		{
+			// 池中字符串均以 '\0' 结尾且不含内嵌 '\0'，长度相符时 memcmp 不会越出池尾
+			uint32_t off = writer->slots[pos].off - 1U;
+			if (writer->slots[pos].hash == hash && len < builder->poolSize - off && '\0' == builder->pool[off + len] &&
+			    0 == RyanJsonMemcmp(builder->pool + off, str, len))
+			{
+				*offPtr = off;
+				return RyanJsonTrue;
+			}
+			pos = (pos + 1U) & (writer->slotCap - 1U);
+		}
+	}
+
+	uint8_t *buffer = RyanJsonInternalTapeReservePool(builder, len + 1U);
+	RyanJsonCheckReturnFalse(NULL != buffer);
+	if (0U != len) { RyanJsonMemcpy(buffer, str, len); }
+	buffer[len] = '\0';
+
+	*offPtr = builder->poolSize;
+	builder->poolSize += len + 1U;
+
+	if (!writer->noDedup)
+	{
+		writer->slots[pos].hash = hash;
+		writer->slots[pos].off = *offPtr + 1U;
+		writer->slotCount++;
+	}
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 追加条目并写入 key（key 为 NULL 时不带 key）
+ */
+static RyanJsonTapeEntry_t *RyanJsonBinaryPushEntry(RyanJsonBinaryWriter_t *writer, uint32_t tag, const char *key, uint32_t keyLen)
+{
+	uint32_t keyOff = 0;
+	if (NULL != key)
+	{
+		RyanJsonCheckReturnNull(keyLen <= RyanJsonTapeKeyLenMax);
+		RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonBinaryAppendPool(writer, key, keyLen, &keyOff));
+		tag |= RyanJsonTapeTagHasKey | (keyLen << RyanJsonTapeTagKeyLenShift);
+	}
+
+	RyanJsonTapeEntry_t *entry = RyanJsonInternalTapePush(&writer->builder, tag);
+	RyanJsonCheckReturnNull(NULL != entry);
+	entry->keyOff = keyOff;
+	return entry;
+}
+
+/**
+ * @brief 按树节点追加单个条目（容器只追加起始条目）
+ */
+static RyanJsonBool_e RyanJsonBinaryPushNode(RyanJsonBinaryWriter_t *writer, RyanJson_t pJson)
+{
+	const char *key = RyanJsonIsKey(pJson) ? RyanJsonGetKey(pJson) : NULL;
+	uint32_t keyLen = (NULL != key) ? RyanJsonInternalGetKeyLen(pJson) : 0U;
+	uint32_t tag = (uint32_t)RyanJsonGetPayloadTypeByFlag(pJson);
+
+	// Raw 文本未展开为结构，无法写成 tape 条目
+	RyanJsonCheckReturnFalse(RyanJsonFalse == RyanJsonIsRaw(pJson));
+
+	// tape 没有二进制类型，Blob 按其文本形式（base64 字符串）保存，base64 字母表无需转义
+	if (RyanJsonIsBlob(pJson))
+	{
+		uint32_t len;
+		const uint8_t *data = RyanJsonGetBlobValue(pJson, &len);
+		RyanJsonCheckReturnFalse(len <= RyanJsonBase64MaxRawLen);
+
+		uint32_t textLen = RyanJsonBase64EncodedLen(len);
+		uint8_t *buffer = RyanJsonInternalTapeReservePool(&writer->builder, textLen + 1U);
+		RyanJsonCheckReturnFalse(NULL != buffer);
+		(void)RyanJsonInternalBase64Encode(data, len, buffer);
+		buffer[textLen] = '\0';
+		uint32_t off = writer->builder.poolSize;
+		writer->builder.poolSize += textLen + 1U;
+
+		RyanJsonTapeEntry_t *entry = RyanJsonBinaryPushEntry(writer, RyanJsonTypeString | RyanJsonTapeTagFlag, key, keyLen);
+		RyanJsonCheckReturnFalse(NULL != entry);
+		entry->value.str.off = off;
+		entry->value.str.len = textLen;
+		return RyanJsonTrue;
+	}
+
+	if (RyanJsonIsString(pJson))
+	{
+		const char *strValue = RyanJsonGetStringValue(pJson); // 先取值，懒字符串解码后长度与转义信息才准确
+		uint32_t len;
+		uint32_t off;
+		if (RyanJsonTrue == RyanJsonInternalGetStrValueInfo(pJson, &len)) { tag |= RyanJsonTapeTagFlag; }
+		RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonBinaryAppendPool(writer, strValue, len, &off));
+
+		RyanJsonTapeEntry_t *entry = RyanJsonBinaryPushEntry(writer, tag, key, keyLen);
+		RyanJsonCheckReturnFalse(NULL != entry);
+		entry->value.str.off = off;
+		entry->value.str.len = len;
+		return RyanJsonTrue;
+	}
+
+	if (RyanJsonIsBool(pJson) && RyanJsonTrue == RyanJsonGetBoolValue(pJson)) { tag |= RyanJsonTapeTagFlag; }
+	// 懒数值局部解析，节点保持不变
+	RyanJsonBool_e isInt = RyanJsonFalse;
+	double number = 0;
+	if (RyanJsonIsNumber(pJson))
+	{
+		number = RyanJsonInternalGetNumber(pJson, &isInt);
+		if (!isInt) { tag |= RyanJsonTapeTagFlag; }
+	}
+
+	RyanJsonTapeEntry_t *entry = RyanJsonBinaryPushEntry(writer, tag, key, keyLen);
+	RyanJsonCheckReturnFalse(NULL != entry);
+	if (RyanJsonIsNumber(pJson))
+	{
+		if (isInt) { entry->value.intValue = (int32_t)number; }
+		else
+		{
+			RyanJsonMemcpy(&entry->value, &number, sizeof(number));
+		}
+	}
+	return RyanJsonTrue;
+}
+
+#if true == RyanJsonPackedArray
+/**
+ * @brief 追加紧凑数组中的单个数值
+ *
+ * @param keyOff 列存表中该列 key 在池内的偏移，keyTag 为 0 时忽略
+ */
+static RyanJsonBool_e RyanJsonBinaryPushPackedValue(RyanJsonBinaryWriter_t *writer, const RyanJsonPackedHead_t *head, uint32_t col,
+						    uint32_t row, uint32_t keyTag, uint32_t keyOff)
+{
+	RyanJsonBool_e isDouble = RyanJsonInternalPackedColumnIsDouble(head, col);
+	uint32_t tag = RyanJsonTypeNumber | keyTag | (isDouble ? RyanJsonTapeTagFlag : 0U);
+	RyanJsonTapeEntry_t *entry = RyanJsonInternalTapePush(&writer->builder, tag);
+	RyanJsonCheckReturnFalse(NULL != entry);
+	entry->keyOff = keyOff;
+
+	if (isDouble)
+	{
+		double number = RyanJsonInternalPackedGetDouble(head, col, row);
+		RyanJsonMemcpy(&entry->value, &number, sizeof(number));
+	}
+	else
+	{
+		entry->value.intValue = RyanJsonInternalPackedGetInt(head, col, row);
+	}
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 按普通 Array 的形态展开紧凑数组的子树条目（不含数组自身的结束标记）
+ */
+static RyanJsonBool_e RyanJsonBinaryPushPacked(RyanJsonBinaryWriter_t *writer, uint32_t index, RyanJson_t pJson)
+{
+	RyanJsonTapeBuilder_t *builder = &writer->builder;
+	const RyanJsonPackedHead_t *head = RyanJsonInternalGetPacked(pJson);
+	uint32_t colCount = RyanJsonInternalPackedColumnCount(head);
+
+	for (uint32_t row = 0; row < head->count; row++)
+	{
+		if (!RyanJsonPackedIsTable(head))
+		{
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonBinaryPushPackedValue(writer, head, 0, row, 0, 0));
+			continue;
+		}
+
+		uint32_t rowIndex = builder->entryCount;
+		RyanJsonCheckReturnFalse(NULL != RyanJsonInternalTapePush(builder, RyanJsonTypeObject));
+		for (uint32_t col = 0; col < colCount; col++)
+		{
+			uint32_t keyLen;
+			uint32_t keyOff;
+			const char *key = RyanJsonInternalPackedColumnKey(head, col, &keyLen);
+			RyanJsonCheckReturnFalse(keyLen <= RyanJsonTapeKeyLenMax);
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonBinaryAppendPool(writer, key, keyLen, &keyOff));
+
+			uint32_t keyTag = RyanJsonTapeTagHasKey | (keyLen << RyanJsonTapeTagKeyLenShift);
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonBinaryPushPackedValue(writer, head, col, row, keyTag, keyOff));
+		}
+		RyanJsonCheckReturnFalse(NULL != RyanJsonInternalTapePush(builder, RyanJsonTapeTypeEnd));
+		builder->entries[rowIndex].value.container.count = colCount;
+		builder->entries[rowIndex].value.container.span = builder->entryCount - rowIndex;
+	}
+
+	builder->entries[index].value.container.count = head->count;
+	return RyanJsonTrue;
+}
+#endif
+
+/**
+ * @brief 按先序遍历树并构建 tape
+ * @details 与 tape 解析一致：打开的容器条目的 span 暂存父容器下标，闭合时追加结束标记并改写为真正的 span；
+ *          树侧经线索回到父节点，不使用递归或显式栈。
+ */
+static RyanJsonBool_e RyanJsonBinaryBuildTape(RyanJsonBinaryWriter_t *writer, RyanJson_t pJson)
+{
+	RyanJsonTapeBuilder_t *builder = &writer->builder;
+	uint32_t scope = 0; // current 所在容器的条目下标，current 为根时无意义
+	RyanJson_t current = pJson;
+	while (1)
+	{
+		uint32_t index = builder->entryCount;
+		RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonBinaryPushNode(writer, current));
+		if (current != pJson) { builder->entries[scope].value.container.count++; }
+
+		if (_checkType(current, RyanJsonTypeArray) || _checkType(current, RyanJsonTypeObject))
+		{
+			RyanJson_t child = NULL;
+#if true == RyanJsonPackedArray
+			// 紧凑数组不展开树节点，直接按元素写出条目
+			if (RyanJsonInternalIsPackedArray(current))
+			{
+				RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonBinaryPushPacked(writer, index, current));
+			}
+			else
+#endif
+			{
+				child = RyanJsonGetObjectValue(current);
+			}
+
+			if (NULL != child)
+			{
+				builder->entries[index].value.container.span = scope;
+				scope = index;
+				current = child;
+				continue;
+			}
+
+			RyanJsonCheckReturnFalse(NULL != RyanJsonInternalTapePush(builder, RyanJsonTapeTypeEnd));
+			builder->entries[index].value.container.span = builder->entryCount - index;
+		}
+
+		// 寻找下一个待访问节点：优先同层兄弟，否则闭合当前容器并回溯
+		while (1)
+		{
+			if (current == pJson) { return RyanJsonTrue; }
+
+			RyanJson_t next = RyanJsonGetNext(current);
+			if (NULL != next)
+			{
+				current = next;
+				break;
+			}
+
+			RyanJsonCheckReturnFalse(NULL != RyanJsonInternalTapePush(builder, RyanJsonTapeTypeEnd));
+			uint32_t parent = builder->entries[scope].value.container.span;
+			builder->entries[scope].value.container.span = builder->entryCount - scope;
+			scope = parent;
+			current = current->next; // 最后一个兄弟的 next 指向父节点
+		}
+	}
+}
+
+/**
+ * @brief 镜像校验和：按 4 字节分组的 FNV-1a，尾部不足 4 字节逐字节处理
+ * @note 每步都是可逆运算，任意单个分组被改写都必然改变结果；按字处理比逐字节快约 4 倍，加载大镜像时以此为主要开销。
+ */
+RyanJsonInternalApi uint32_t RyanJsonInternalBinaryChecksum(const uint8_t *data, uint32_t size)
+{
+	uint32_t hash = 2166136261U;
+	uint32_t i = 0;
+	for (; size - i >= sizeof(uint32_t); i += (uint32_t)sizeof(uint32_t))
+	{
+		uint32_t word;
+		RyanJsonMemcpy(&word, data + i, sizeof(word));
+		hash = (hash ^ word) * 16777619U;
+	}
+	for (; i < size; i++)
+	{
+		hash = (hash ^ data[i]) * 16777619U;
+	}
+	return RyanJsonInternalHashMix(hash);
+}
+
+/**
+ * @brief 将树保存为可重定位的二进制镜像
+ *
+ * @param pJson 根节点（保留其 key）
+ * @param len 输出镜像字节数，可为 NULL
+ * @return uint8_t* 镜像，需用户调用 RyanJsonFree 释放；失败返回 NULL
+ * @note 镜像为 [头部 | tape 文档]，内部只有相对偏移，可原样写入文件或 flash，之后用 RyanJsonLoadBinary 在原地读取。
+ *       紧凑数组按等价普通 Array 写出；镜像依赖本机字节序与 RyanJsonBinaryVersion 中的配置，不用于跨平台交换。
+ */
+uint8_t *RyanJsonSaveBinary(RyanJson_t pJson, uint32_t *len)
+{
+	RyanJsonCheckReturnNull(NULL != pJson);
+
+	RyanJsonBinaryWriter_t writer = {0};
+	RyanJsonCheckCode(RyanJsonTrue == RyanJsonBinaryBuildTape(&writer, pJson), {
+		RyanJsonBinaryWriterFree(&writer);
+		return NULL;
+	});
+	if (NULL != writer.slots) { jsonFree(writer.slots); }
+
+	RyanJsonTape_t tape = RyanJsonInternalTapeFinish(&writer.builder, (uint32_t)sizeof(RyanJsonBinaryHead_t));
+	RyanJsonCheckReturnNull(NULL != tape);
+
+	uint32_t entryBytes = tape->entryCount * (uint32_t)sizeof(RyanJsonTapeEntry_t);
+	uint32_t bodySize = (uint32_t)sizeof(struct RyanJsonTape) + entryBytes + tape->poolSize;
+	RyanJsonBinaryHead_t head = {
+		.magic = RyanJsonBinaryMagic,
+		.version = RyanJsonBinaryVersion,
+		.totalSize = (uint32_t)sizeof(RyanJsonBinaryHead_t) + bodySize,
+		.checksum = RyanJsonInternalBinaryChecksum((const uint8_t *)tape, bodySize),
+	};
+
+	uint8_t *image = (uint8_t *)tape - sizeof(RyanJsonBinaryHead_t);
+	RyanJsonMemcpy(image, &head, sizeof(head));
+	if (NULL != len) { *len = head.totalSize; }
+	return image;
+}
+
+/**
+ * @brief 校验池内 '\0' 结尾字节串是否完整落在池内且不含内嵌 '\0'
+ *
+ * @param off 条目内记录的相对偏移
+ * @param toPool 该条目到池起点的距离
+ */
+static RyanJsonBool_e RyanJsonBinaryCheckPoolStr(const char *pool, uint32_t poolSize, uint32_t off, uint32_t toPool, uint32_t len)
+{
+	RyanJsonCheckReturnFalse(off >= toPool);
+	uint32_t pos = off - toPool;
+	RyanJsonCheckReturnFalse(pos < poolSize && len < poolSize - pos);
+	RyanJsonCheckReturnFalse('\0' == pool[pos + len]);
+	return RyanJsonMakeBool(RyanJsonStrlen(pool + pos) == len);
+}
+
+/**
+ * @brief 校验镜像中的 tape 结构，保证之后的只读访问与 RyanJsonTapeToTree 不会越界
+ * @note 每个容器沿 span 逐个跳过直接子节点，必须恰好落在自身结束标记上；每个条目只被其父容器跳过一次，整体 O(n)。
+ */
+static RyanJsonBool_e RyanJsonBinaryCheckTape(RyanJsonTape_t tape, uint32_t dataSize)
+{
+	uint32_t entryCount = tape->entryCount;
+	RyanJsonCheckReturnFalse(entryCount >= 2U && entryCount <= dataSize / sizeof(RyanJsonTapeEntry_t));
+	uint32_t poolSize = tape->poolSize;
+	RyanJsonCheckReturnFalse(poolSize == dataSize - entryCount * (uint32_t)sizeof(RyanJsonTapeEntry_t));
+
+	const RyanJsonTapeEntry_t *entries = RyanJsonTapeEntries(tape);
+	const char *pool = (const char *)(entries + entryCount);
+
+	// 根值恰好占满哨兵之前的全部条目
+	RyanJsonCheckReturnFalse(RyanJsonTapeTypeEnd == RyanJsonTapeEntryType(&entries[entryCount - 1U]));
+	RyanJsonCheckReturnFalse(RyanJsonTapeTypeEnd != RyanJsonTapeEntryType(&entries[0]));
+
+	for (uint32_t i = 0; i < entryCount - 1U; i++)
+	{
+		const RyanJsonTapeEntry_t *entry = &entries[i];
+		uint32_t type = RyanJsonTapeEntryType(entry);
+		uint32_t toPool = (entryCount - i) * (uint32_t)sizeof(RyanJsonTapeEntry_t);
+		uint32_t keyLen = entry->tag >> RyanJsonTapeTagKeyLenShift;
+
+		if (0U != (entry->tag & RyanJsonTapeTagHasKey))
+		{
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonBinaryCheckPoolStr(pool, poolSize, entry->keyOff, toPool, keyLen));
+		}
+		else
+		{
+			RyanJsonCheckReturnFalse(0U == keyLen);
+		}
+
+		if (RyanJsonTypeString == type)
+		{
+			uint32_t strOff = entry->value.str.off;
+			uint32_t strLen = entry->value.str.len;
+			RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonBinaryCheckPoolStr(pool, poolSize, strOff, toPool, strLen));
+
+			// “无需转义”标记会让加载后的节点整段打印，校验和不防伪造，需逐字节确认
+			if (0U != (entry->tag & RyanJsonTapeTagFlag))
+			{
+				const uint8_t *str = (const uint8_t *)pool + (strOff - toPool);
+				for (uint32_t n = 0; n < strLen; n++)
+				{
+					RyanJsonCheckReturnFalse(0U == RyanJsonInternalEscapeTable[str[n]]);
+				}
+			}
+		}
+		else if (RyanJsonTypeArray == type || RyanJsonTypeObject == type)
+		{
+			uint32_t span = entry->value.container.span;
+			RyanJsonCheckReturnFalse(span >= 2U && span <= entryCount - 1U - i);
+			if (0U == i) { RyanJsonCheckReturnFalse(span == entryCount - 1U); }
+
+			uint32_t end = i + span - 1U;
+			uint32_t pos = i + 1U;
+			for (uint32_t n = 0; n < entry->value.container.count; n++)
+			{
+				RyanJsonCheckReturnFalse(pos < end && RyanJsonTapeTypeEnd != RyanJsonTapeEntryType(&entries[pos]));
+				// Object 的成员必须带 key，按 key 查找才不会访问空 key
+				RyanJsonBool_e hasKey = RyanJsonMakeBool(0U != (entries[pos].tag & RyanJsonTapeTagHasKey));
+				if (RyanJsonTypeObject == type) { RyanJsonCheckReturnFalse(hasKey); }
+
+				uint32_t childSpan = RyanJsonTapeEntrySpan(&entries[pos]);
+				RyanJsonCheckReturnFalse(0U != childSpan && childSpan <= end - pos);
+				pos += childSpan;
+			}
+			RyanJsonCheckReturnFalse(pos == end && RyanJsonTapeTypeEnd == RyanJsonTapeEntryType(&entries[end]));
+		}
+		else if (RyanJsonTapeTypeEnd != type)
+		{
+			RyanJsonCheckReturnFalse(RyanJsonTypeNull == type || RyanJsonTypeBool == type || RyanJsonTypeNumber == type);
+			if (0U == i) { RyanJsonCheckReturnFalse(2U == entryCount); }
+		}
+	}
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 加载二进制镜像，校验后在原地作为只读 tape 文档使用
+ *
+ * @param data 镜像起始地址（mmap 映射区、XIP flash 或内存缓冲），需按 4 字节对齐
+ * @param size data 可读字节数，不小于镜像总大小即可
+ * @return RyanJsonTape_t 指向 data 内部的文档，校验失败返回 NULL
+ * @note 不申请内存也不修改 data；返回的文档与 data 同生命周期，不能调用 RyanJsonTapeDelete。
+ *       需要修改时用 RyanJsonTapeToTree 转为普通树。
+ * @note 校验头部、整体校验和与全部偏移/span，耗时与镜像大小成正比，但不涉及任何文本解析与内存申请。
+ */
+RyanJsonTape_t RyanJsonLoadBinary(const void *data, uint32_t size)
+{
+	RyanJsonCheckReturnNull(NULL != data && 0U == (uintptr_t)data % RyanJsonBinaryAlign);
+	RyanJsonCheckReturnNull(size >= sizeof(RyanJsonBinaryHead_t) + sizeof(struct RyanJsonTape));
+
+	RyanJsonBinaryHead_t head;
+	RyanJsonMemcpy(&head, data, sizeof(head));
+	RyanJsonCheckReturnNull(RyanJsonBinaryMagic == head.magic && RyanJsonBinaryVersion == head.version);
+	RyanJsonCheckReturnNull(head.totalSize <= size && head.totalSize >= sizeof(RyanJsonBinaryHead_t) + sizeof(struct RyanJsonTape));
+
+	const uint8_t *body = (const uint8_t *)data + sizeof(RyanJsonBinaryHead_t);
+	uint32_t bodySize = head.totalSize - (uint32_t)sizeof(RyanJsonBinaryHead_t);
+	RyanJsonCheckReturnNull(head.checksum == RyanJsonInternalBinaryChecksum(body, bodySize));
+
+	// 文档只经只读接口访问，这里仅去掉 const 以复用 RyanJsonTape_t
+	RyanJsonTape_t tape = (RyanJsonTape_t)(uintptr_t)body;
+	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonBinaryCheckTape(tape, bodySize - (uint32_t)sizeof(struct RyanJsonTape)));
+	return tape;
+}
@@ -51,6 +51,307 @@ RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalStrEq(const char *s1, const c
 	return RyanJsonMakeBool(0 == RyanJsonStrcmp(s1, s2));
 }
 
+/**
+ * @brief key 哈希（FNV-1a）
+ *
+ * @param key key 字节序列，无需 '\0' 结尾
+ * @param len key 字节长度
+ * @return uint32_t 哈希值（key 指纹与 Object key 索引共用）
+ */
+RyanJsonInternalApi uint32_t RyanJsonInternalKeyHash(const char *key, uint32_t len)
+{
+	RyanJsonCheckAssert(NULL != key || 0 == len);
+
+	uint32_t hash = RyanJsonKeyHashSeed;
+	for (uint32_t i = 0; i < len; i++)
+	{
+		hash = RyanJsonKeyHashStep(hash, key[i]);
+	}
+	return hash;
+}
+
+/**
+ * @brief 32 位整数混合（murmur3 fmix32），输入相近时输出也充分分散
+ */
+RyanJsonInternalApi uint32_t RyanJsonInternalHashMix(uint32_t hash)
+{
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6BU;
+	hash ^= hash >> 13;
+	hash *= 0xC2B2AE35U;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+/**
+ * @brief 奇数在模 2^32 下的乘法逆元（Newton 迭代，每轮有效位数翻倍）
+ */
+RyanJsonInternalApi uint32_t RyanJsonInternalHashInverse(uint32_t odd)
+{
+	RyanJsonCheckAssert(0 != (odd & 1U));
+
+	uint32_t inv = odd; // odd * odd ≡ 1 (mod 8)，已有 3 位正确
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		inv *= 2U - odd * inv;
+	}
+	return inv;
+}
+
+/**
+ * @brief 模 2^32 快速幂
+ */
+RyanJsonInternalApi uint32_t RyanJsonInternalHashPow(uint32_t base, uint32_t exp)
+{
+	uint32_t result = 1U;
+	while (0 != exp)
+	{
+		if (exp & 1U) { result *= base; }
+		base *= base;
+		exp >>= 1;
+	}
+	return result;
+}
+
+/**
+ * @brief Object 成员的边权重（奇数，保证可逆）
+ */
+RyanJsonInternalApi uint32_t RyanJsonInternalHashKeyWeight(const char *key, uint32_t keyLen)
+{
+	return RyanJsonInternalHashMix(RyanJsonInternalKeyHash(key, keyLen) ^ 0x9E3779B9U) | 1U;
+}
+
+/**
+ * @brief Int 节点的内容哈希
+ */
+RyanJsonInternalApi uint32_t RyanJsonInternalHashInt(int32_t number)
+{
+	return RyanJsonInternalHashMix(RyanJsonInternalHashTag(RyanJsonTypeNumber) ^ (uint32_t)number);
+}
+
+/**
+ * @brief Double 节点的内容哈希（按位计算，-0 与 +0 视为相同）
+ */
+RyanJsonInternalApi uint32_t RyanJsonInternalHashDouble(double number)
+{
+	uint64_t bits = 0;
+	if (0.0 != number) { RyanJsonMemcpy(&bits, &number, sizeof(bits)); }
+
+	uint32_t hash = RyanJsonInternalHashMix(RyanJsonInternalHashTag(RyanJsonTypeNumber | 0x10U) ^ (uint32_t)bits);
+	return RyanJsonInternalHashMix(hash ^ (uint32_t)(bits >> 32));
+}
+
+/**
+ * @brief 节点是否记录了 key 指纹（仅 ptr 模式且 keyLenField 未占满 4 字节）
+ */
+static RyanJsonBool_e RyanJsonHasKeyFingerprint(RyanJson_t pJson)
+{
+	uint8_t encoded = RyanJsonGetPayloadEncodeKeyLenByFlag(pJson);
+	return RyanJsonMakeBool(RyanJsonTrue == RyanJsonGetPayloadStrIsPtrByFlag(pJson) && 0 != encoded && 3 != encoded);
+}
+
+/**
+ * @brief 判断节点 key 是否等于给定字节序列
+ *
+ * @param pJson 带 key 的节点
+ * @param key 目标 key，无需 '\0' 结尾
+ * @param keyLen 目标 key 字节长度
+ * @param hash 目标 key 的 RyanJsonInternalKeyHash 结果
+ * @return RyanJsonBool_e 是否相等
+ * @note 依次比较长度与指纹，均一致时才访问 key 字节；ptr 模式下多数不匹配的兄弟无需解引用堆缓冲。
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalKeyEq(RyanJson_t pJson, const char *key, uint32_t keyLen, uint32_t hash)
+{
+	RyanJsonCheckAssert(NULL != pJson && RyanJsonIsKey(pJson));
+
+	if (keyLen != RyanJsonInternalGetKeyLen(pJson)) { return RyanJsonFalse; }
+	if (RyanJsonTrue == RyanJsonHasKeyFingerprint(pJson) &&
+	    RyanJsonKeyFingerprintOf(hash) != RyanJsonGetPayloadPtr(pJson)[RyanJsonKeyFingerprintOffset])
+	{
+		return RyanJsonFalse;
+	}
+	return RyanJsonMakeBool(0 == RyanJsonMemcmp(RyanJsonGetKey(pJson), key, keyLen));
+}
+
+/**
+ * @brief 判断两个节点的 key 是否相等
+ *
+ * @param left 带 key 的节点
+ * @param right 带 key 的节点
+ * @return RyanJsonBool_e 是否相等
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalKeyEqNode(RyanJson_t left, RyanJson_t right)
+{
+	RyanJsonCheckAssert(NULL != left && NULL != right);
+
+	uint32_t keyLen = RyanJsonInternalGetKeyLen(left);
+	if (keyLen != RyanJsonInternalGetKeyLen(right)) { return RyanJsonFalse; }
+	if (RyanJsonTrue == RyanJsonHasKeyFingerprint(left) && RyanJsonTrue == RyanJsonHasKeyFingerprint(right) &&
+	    RyanJsonGetPayloadPtr(left)[RyanJsonKeyFingerprintOffset] != RyanJsonGetPayloadPtr(right)[RyanJsonKeyFingerprintOffset])
+	{
+		return RyanJsonFalse;
+	}
+	return RyanJsonMakeBool(0 == RyanJsonMemcmp(RyanJsonGetKey(left), RyanJsonGetKey(right), keyLen));
+}
+
+/**
+ * @brief 字符串转义表（打印与 strValue 元信息共用）
+ * @details
+ * - 0：普通字节，可直接批量拷贝
+ * - 'u'：控制字符，输出 \u00XX（'\0' 同样标记为非 0，作为扫描终止哨兵）
+ * - 其他：输出 '\\' + 表项字符
+ * @note '/' 不转义，与历史输出保持一致
+ */
+const uint8_t RyanJsonInternalEscapeTable[256] = {
+	['\0'] = 'u', [0x01] = 'u', [0x02] = 'u', [0x03] = 'u', [0x04] = 'u', [0x05] = 'u', [0x06] = 'u', [0x07] = 'u',
+	['\b'] = 'b', ['\t'] = 't', ['\n'] = 'n', [0x0B] = 'u', ['\f'] = 'f', ['\r'] = 'r', [0x0E] = 'u', [0x0F] = 'u',
+	[0x10] = 'u', [0x11] = 'u', [0x12] = 'u', [0x13] = 'u', [0x14] = 'u', [0x15] = 'u', [0x16] = 'u', [0x17] = 'u',
+	[0x18] = 'u', [0x19] = 'u', [0x1A] = 'u', [0x1B] = 'u', [0x1C] = 'u', [0x1D] = 'u', [0x1E] = 'u', [0x1F] = 'u',
+	['\"'] = '\"', ['\\'] = '\\',
+};
+
+/**
+ * @brief base64 编码字母表
+ */
+static const uint8_t RyanJsonBase64Chars[64] = {
+	'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V',
+	'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r',
+	's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/',
+};
+
+/**
+ * @brief base64 反查表：字母表内字符为其 6 位值，其余字节（含 '='）为 0xFF
+ * @note 合法值不超过 0x3F，非法项带 0xC0 位，解码时把各次查表结果按位或累积，整段结束后统一判断一次。
+ */
+static const uint8_t RyanJsonBase64Index[256] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+	0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+	0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+/**
+ * @brief base64 编码（带 '=' 填充，不追加 '\0'）
+ *
+ * @param src 原始数据
+ * @param len 原始数据字节数，不超过 RyanJsonBase64MaxRawLen
+ * @param dst 输出缓冲，至少 RyanJsonBase64EncodedLen(len) 字节
+ * @return uint32_t 写入的字符数
+ * @note 每轮把 3 字节拼成 24 位后查表输出 4 个字符，循环内没有分支；尾部 1~2 字节单独补齐。
+ */
+RyanJsonInternalApi uint32_t RyanJsonInternalBase64Encode(const uint8_t *src, uint32_t len, uint8_t *dst)
+{
+	RyanJsonCheckAssert((NULL != src || 0 == len) && NULL != dst);
+
+	uint8_t *out = dst;
+	uint32_t i = 0;
+	for (; len - i >= 3U; i += 3U)
+	{
+		uint32_t group = ((uint32_t)src[i] << 16) | ((uint32_t)src[i + 1U] << 8) | (uint32_t)src[i + 2U];
+		out[0] = RyanJsonBase64Chars[group >> 18];
+		out[1] = RyanJsonBase64Chars[(group >> 12) & 0x3FU];
+		out[2] = RyanJsonBase64Chars[(group >> 6) & 0x3FU];
+		out[3] = RyanJsonBase64Chars[group & 0x3FU];
+		out += 4;
+	}
+
+	if (i < len)
+	{
+		RyanJsonBool_e hasTwo = RyanJsonMakeBool(len - i == 2U);
+		uint32_t group = ((uint32_t)src[i] << 16) | (hasTwo ? ((uint32_t)src[i + 1U] << 8) : 0U);
+		out[0] = RyanJsonBase64Chars[group >> 18];
+		out[1] = RyanJsonBase64Chars[(group >> 12) & 0x3FU];
+		out[2] = hasTwo ? RyanJsonBase64Chars[(group >> 6) & 0x3FU] : (uint8_t)'=';
+		out[3] = '=';
+		out += 4;
+	}
+	return (uint32_t)(out - dst);
+}
+
+/**
+ * @brief 校验 base64 文本的长度与填充，并计算解码后的字节数
+ *
+ * @param src base64 文本，无需 '\0' 结尾
+ * @param len 文本字节数
+ * @param outLen 输出解码后的字节数
+ * @return RyanJsonBool_e 长度与填充是否合法（字符合法性由 RyanJsonInternalBase64Decode 检查）
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalBase64DecodedLen(const char *src, uint32_t len, uint32_t *outLen)
+{
+	RyanJsonCheckAssert((NULL != src || 0 == len) && NULL != outLen);
+	RyanJsonCheckReturnFalse(0U == (len & 3U));
+
+	uint32_t pad = 0;
+	if (0U != len && '=' == src[len - 1U]) { pad = ('=' == src[len - 2U]) ? 2U : 1U; }
+	*outLen = len / 4U * 3U - pad;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief base64 解码
+ *
+ * @param src base64 文本，需已通过 RyanJsonInternalBase64DecodedLen 校验
+ * @param len 文本字节数
+ * @param dst 输出缓冲，至少为 RyanJsonInternalBase64DecodedLen 给出的字节数
+ * @return RyanJsonBool_e 是否为规范编码；失败时 dst 内容不确定
+ * @note 主循环每轮 4 次查表拼出 24 位再写出 3 字节，非法字符只做累积，不在循环内分支判断。
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalBase64Decode(const char *src, uint32_t len, uint8_t *dst)
+{
+	RyanJsonCheckAssert((NULL != src || 0 == len) && NULL != dst);
+	RyanJsonCheckAssert(0U == (len & 3U));
+
+	const uint8_t *in = (const uint8_t *)src;
+	uint32_t bad = 0;
+	uint32_t fullLen = (0U != len && '=' == src[len - 1U]) ? len - 4U : len;
+	uint8_t *out = dst;
+
+	for (uint32_t i = 0; i < fullLen; i += 4U)
+	{
+		uint32_t a = RyanJsonBase64Index[in[i]];
+		uint32_t b = RyanJsonBase64Index[in[i + 1U]];
+		uint32_t c = RyanJsonBase64Index[in[i + 2U]];
+		uint32_t d = RyanJsonBase64Index[in[i + 3U]];
+		bad |= a | b | c | d;
+
+		uint32_t group = (a << 18) | (b << 12) | (c << 6) | d;
+		out[0] = (uint8_t)(group >> 16);
+		out[1] = (uint8_t)(group >> 8);
+		out[2] = (uint8_t)group;
+		out += 3;
+	}
+
+	if (fullLen != len)
+	{
+		// 末组：1 个 '=' 输出 2 字节，2 个 '=' 输出 1 字节；未使用的尾部比特必须为 0
+		uint32_t a = RyanJsonBase64Index[in[fullLen]];
+		uint32_t b = RyanJsonBase64Index[in[fullLen + 1U]];
+		bad |= a | b;
+		out[0] = (uint8_t)((a << 2) | (b >> 4));
+		if ('=' == src[fullLen + 2U]) { bad |= (0U != (b & 0x0FU)) ? 0xFFU : 0U; }
+		else
+		{
+			uint32_t c = RyanJsonBase64Index[in[fullLen + 2U]];
+			bad |= c | ((0U != (c & 0x03U)) ? 0xFFU : 0U);
+			out[1] = (uint8_t)((b << 4) | (c >> 2));
+		}
+	}
+
+	return RyanJsonMakeBool(0U == (bad & 0xC0U));
+}
+
 /**
  * @brief 安全的 Double 比较
  */
@@ -202,24 +503,277 @@ RyanJsonInternalApi void *RyanJsonInternalGetValue(RyanJson_t pJson)
 }
 
 /**
- * @brief 更新 key 与 strValue
+ * @brief 写入 ptr 模式 strValue 元信息
+ *
+ * @param pJson Json 节点（ptr 模式）
+ * @param len strValue 字节长度
+ * @param isClean strValue 是否无需转义
+ */
+static void RyanJsonSetStrValueMeta(RyanJson_t pJson, uint32_t len, RyanJsonBool_e isClean)
+{
+	RyanJsonCheckAssert(NULL != pJson);
+	if (0 == RyanJsonStrValueMetaSize) { return; }
+
+	uint32_t cleanBit = (uint32_t)1U << (RyanJsonStrValueMetaSize * 8U - 1U);
+	uint32_t value = len < (cleanBit - 1U) ? len : (cleanBit - 1U);
+	if (RyanJsonTrue == isClean) { value |= cleanBit; }
+
+	// 使用大小端无关的方式写入
+	uint8_t *buf = RyanJsonGetPayloadPtr(pJson) + RyanJsonStrValueMetaOffset;
+	for (uint8_t i = 0; i < RyanJsonStrValueMetaSize; i++)
+	{
+		buf[i] = (uint8_t)(value & 0xFF);
+		value >>= 8;
+	}
+}
+
+/**
+ * @brief 获取 strValue 长度与“无需转义”标记
+ *
+ * @param pJson String 节点
+ * @param lenPtr 输出 strValue 字节长度（不含 '\0'）
+ * @return RyanJsonBool_e strValue 是否已知无需转义；未知时返回 false
+ * @note ptr 模式直接读取元信息，inline 模式现场计算长度（不超过内联区大小）。
+ * @note 懒字符串返回源文本长度且总是返回 true（源文本可直接输出）；需要解码后的长度时先调用 RyanJsonGetStringValue。
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalGetStrValueInfo(RyanJson_t pJson, uint32_t *lenPtr)
+{
+	RyanJsonCheckAssert(NULL != pJson && NULL != lenPtr);
+
+	if (0 != RyanJsonStrValueMetaSize && RyanJsonTrue == RyanJsonGetPayloadStrIsPtrByFlag(pJson))
+	{
+		const uint8_t *buf = RyanJsonGetPayloadPtr(pJson) + RyanJsonStrValueMetaOffset;
+		uint32_t value = 0;
+		for (uint8_t i = 0; i < RyanJsonStrValueMetaSize; i++)
+		{
+			value |= ((uint32_t)buf[i]) << (i * 8);
+		}
+
+		uint32_t cleanBit = (uint32_t)1U << (RyanJsonStrValueMetaSize * 8U - 1U);
+		uint32_t len = value & (cleanBit - 1U);
+		*lenPtr = (len == cleanBit - 1U) ? (uint32_t)RyanJsonStrlen(RyanJsonInternalGetStrValue(pJson)) : len;
+		return RyanJsonMakeBool(value & cleanBit);
+	}
+
+	*lenPtr = (uint32_t)RyanJsonStrlen(RyanJsonInternalGetStrValue(pJson));
+	return RyanJsonInternalIsLazyString(pJson);
+}
+
+/**
+ * @brief 将懒字符串原地解码为普通 String
+ * @note 解码结果不长于源文本，直接覆盖原缓冲，inline/ptr 模式与缓冲地址都不变；序列化语义不变，不标记脏。
+ */
+RyanJsonInternalApi void RyanJsonInternalUnescapeLazyString(RyanJson_t pJson)
+{
+	RyanJsonCheckAssert(RyanJsonInternalIsLazyString(pJson));
+
+	uint32_t len = RyanJsonInternalUnescapeString(RyanJsonInternalGetStrValue(pJson));
+	if (RyanJsonTrue == RyanJsonGetPayloadStrIsPtrByFlag(pJson)) { RyanJsonSetStrValueMeta(pJson, len, RyanJsonFalse); }
+	RyanJsonSetPayloadStrIsEscapedByFlag(pJson, RyanJsonFalse);
+}
+
+/**
+ * @brief 按 "key\0strValue\0" 布局写入 ptr 模式缓冲（key/strValue 为 NULL 时省略对应段）
+ */
+static void RyanJsonFillStrBuf(uint8_t *buf, const char *key, uint32_t keyLen, const char *strValue, uint32_t strValueLen)
+{
+	if (NULL != key)
+	{
+		if (0 != keyLen) { RyanJsonMemcpy(buf, key, keyLen); }
+		buf[keyLen] = '\0';
+		buf += keyLen + 1;
+	}
+
+	if (NULL != strValue)
+	{
+		if (0 != strValueLen) { RyanJsonMemcpy(buf, strValue, strValueLen); }
+		buf[strValueLen] = '\0';
+	}
+}
+
+#if true == RyanJsonStringIntern
+/**
+ * @brief 驻留缓冲头，位于 ptr 模式缓冲之前；节点指针槽保存的仍是内容首地址，读取路径不受影响。
+ */
+typedef struct RyanJsonInternHead
+{
+	struct RyanJsonInternHead *next; // 同桶链表；指向自身表示未登记到驻留表
+	uint32_t hash;                   // 内容哈希（FNV-1a）
+	uint32_t size;                   // 内容字节数（含各段 '\0'）
+	uint32_t refCount;               // 共享该缓冲的节点数
+} RyanJsonInternHead_t;
+
+#define RyanJsonInternInitBucketCount (16U)
+#define RyanJsonInternGetBuf(head)    ((uint8_t *)(head) + sizeof(RyanJsonInternHead_t))
+
+static RyanJsonInternHead_t **internBuckets = NULL; // 桶数组，桶数恒为 2 的幂
+static uint32_t internBucketCount = 0;
+static uint32_t internCount = 0; // 已登记的缓冲数，归零时释放桶数组
+
+static uint32_t RyanJsonInternHashSegment(uint32_t hash, const char *str, uint32_t len)
+{
+	for (uint32_t i = 0; i < len; i++)
+	{
+		hash = (hash ^ (uint8_t)str[i]) * 16777619U;
+	}
+	return hash * 16777619U; // 段尾 '\0'（异或 0 不改变哈希）
+}
+
+/**
+ * @brief 缓冲内容是否与 "key\0strValue\0" 逐字节一致（调用方已确认长度相等）
+ */
+static RyanJsonBool_e RyanJsonInternMatch(const uint8_t *buf, const char *key, uint32_t keyLen, const char *strValue,
+					  uint32_t strValueLen)
+{
+	if (NULL != key)
+	{
+		if ('\0' != buf[keyLen] || (0 != keyLen && 0 != RyanJsonMemcmp(buf, key, keyLen))) { return RyanJsonFalse; }
+		buf += keyLen + 1;
+	}
+
+	if (NULL != strValue)
+	{
+		if ('\0' != buf[strValueLen] || (0 != strValueLen && 0 != RyanJsonMemcmp(buf, strValue, strValueLen)))
+		{
+			return RyanJsonFalse;
+		}
+	}
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 桶数组扩容为两倍（首次建立为 RyanJsonInternInitBucketCount）
+ * @note 申请失败时保持原表，只是链表变长，不影响正确性。
+ */
+static void RyanJsonInternGrow(void)
+{
+	uint32_t newCount = (0 == internBucketCount) ? RyanJsonInternInitBucketCount : internBucketCount * 2U;
+	if (newCount < internBucketCount) { return; }
+
+	RyanJsonInternHead_t **newBuckets = (RyanJsonInternHead_t **)jsonMalloc(newCount * sizeof(RyanJsonInternHead_t *));
+	if (NULL == newBuckets) { return; }
+	RyanJsonMemset(newBuckets, 0, newCount * sizeof(RyanJsonInternHead_t *));
+
+	for (uint32_t i = 0; i < internBucketCount; i++)
+	{
+		RyanJsonInternHead_t *head = internBuckets[i];
+		while (NULL != head)
+		{
+			RyanJsonInternHead_t *next = head->next;
+			uint32_t slot = head->hash & (newCount - 1U);
+			head->next = newBuckets[slot];
+			newBuckets[slot] = head;
+			head = next;
+		}
+	}
+
+	if (NULL != internBuckets) { jsonFree(internBuckets); }
+	internBuckets = newBuckets;
+	internBucketCount = newCount;
+}
+
+/**
+ * @brief 获取内容为 "key\0strValue\0" 的驻留缓冲
+ *
+ * @param size 内容字节数（含各段 '\0'）
+ * @return uint8_t* 缓冲内容首地址，失败返回 NULL
+ * @note 命中已有缓冲时只增加引用计数，不申请内存；未命中时新建并登记，登记失败的缓冲照常可用，只是不参与去重。
+ */
+static uint8_t *RyanJsonInternAcquire(const char *key, uint32_t keyLen, const char *strValue, uint32_t strValueLen, uint32_t size)
+{
+	uint32_t hash = 2166136261U;
+	if (NULL != key) { hash = RyanJsonInternHashSegment(hash, key, keyLen); }
+	if (NULL != strValue) { hash = RyanJsonInternHashSegment(hash, strValue, strValueLen); }
+
+	if (0 != internBucketCount)
+	{
+		for (RyanJsonInternHead_t *head = internBuckets[hash & (internBucketCount - 1U)]; NULL != head; head = head->next)
+		{
+			if (hash == head->hash && size == head->size &&
+			    RyanJsonTrue == RyanJsonInternMatch(RyanJsonInternGetBuf(head), key, keyLen, strValue, strValueLen))
+			{
+				head->refCount++;
+				return RyanJsonInternGetBuf(head);
+			}
+		}
+	}
+
+	RyanJsonInternHead_t *head = (RyanJsonInternHead_t *)jsonMalloc(sizeof(RyanJsonInternHead_t) + size);
+	RyanJsonCheckReturnNull(NULL != head);
+	RyanJsonFillStrBuf(RyanJsonInternGetBuf(head), key, keyLen, strValue, strValueLen);
+	head->hash = hash;
+	head->size = size;
+	head->refCount = 1;
+	head->next = head;
+
+	// 负载因子超过 1 时扩容
+	if (internCount >= internBucketCount) { RyanJsonInternGrow(); }
+	if (0 != internBucketCount)
+	{
+		uint32_t slot = hash & (internBucketCount - 1U);
+		head->next = internBuckets[slot];
+		internBuckets[slot] = head;
+		internCount++;
+	}
+	return RyanJsonInternGetBuf(head);
+}
+
+/**
+ * @brief 释放一次驻留缓冲引用
+ *
+ * @param buf RyanJsonInternAcquire 返回的缓冲内容首地址
+ * @note 引用归零时从驻留表摘除并释放；驻留表为空时一并释放桶数组。
+ */
+RyanJsonInternalApi void RyanJsonInternalInternRelease(uint8_t *buf)
+{
+	RyanJsonCheckAssert(NULL != buf);
+
+	RyanJsonInternHead_t *head = (RyanJsonInternHead_t *)(void *)(buf - sizeof(RyanJsonInternHead_t));
+	RyanJsonCheckAssert(0 != head->refCount);
+	if (0 != --head->refCount) { return; }
+
+	if (head != head->next)
+	{
+		RyanJsonInternHead_t **link = &internBuckets[head->hash & (internBucketCount - 1U)];
+		while (*link != head)
+		{
+			link = &(*link)->next;
+		}
+		*link = head->next;
+
+		internCount--;
+		if (0 == internCount)
+		{
+			jsonFree(internBuckets);
+			internBuckets = NULL;
+			internBucketCount = 0;
+		}
+	}
+	jsonFree(head);
+}
+#endif
+
+/**
+ * @brief 更新 key 与 strValue（strValue 长度由调用方给出）
  *
  * @param pJson Json 节点
  * @param isNew 是否是新创建的节点
  * @param key key 字符串
- * @param strValue strValue
+ * @param strValue strValue，可为 NULL
+ * @param strValueLen strValue 字节长度（不含 '\0'），strValue 为 NULL 时忽略
+ * @param strValueIsClean 调用方已确认 strValue 无需转义；为 false 时在 ptr 模式下现场扫描
  * @return RyanJsonBool_e
  * @note key/strValue 内容会被拷贝，输入指针不会被保存。
- * @note isNew 为 false 时，若原先为指针模式，会在切换成功后释放旧堆缓冲。
+ * @note isNew 为 false 时，若原先为指针模式，会在切换成功后释放旧堆缓冲（启用驻留时为释放一次引用）。
  */
-RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalChangeString(RyanJson_t pJson, RyanJsonBool_e isNew, const char *key,
-								const char *strValue)
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalChangeStringWithLen(RyanJson_t pJson, RyanJsonBool_e isNew, const char *key,
+								       const char *strValue, uint32_t strValueLen,
+								       RyanJsonBool_e strValueIsClean)
 {
 	RyanJsonCheckAssert(NULL != pJson);
 
-	uint32_t keyLen = 0;      // key 字节长度
-	uint8_t keyLenField = 0;  // key 长度字段编码所需字节数
-	uint32_t strValueLen = 0; // strValue 字节长度
+	uint32_t keyLen = 0;     // key 字节长度
+	uint8_t keyLenField = 0; // key 长度字段编码所需字节数
 
 	uint32_t mallocSize = 0;
 
@@ -231,10 +785,10 @@ RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalChangeString(RyanJson_t pJson
 		mallocSize += keyLen + 1;
 	}
 
-	if (NULL != strValue)
+	if (NULL != strValue) { mallocSize += strValueLen + 1; }
+	else
 	{
-		strValueLen = RyanJsonStrlen(strValue);
-		mallocSize += strValueLen + 1;
+		strValueLen = 0;
 	}
 	if (0 == mallocSize) { return RyanJsonTrue; }
 
@@ -257,28 +811,34 @@ RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalChangeString(RyanJson_t pJson
 	}
 	else
 	{
-		// 申请新的 str 缓冲区
+		// 申请新的 str 缓冲区；启用驻留时内容相同的缓冲直接共享
+		// 先写好内容，再写回指针，避免指针写入后覆盖原数据（key/strValue 可能指向当前内联区）
+#if true == RyanJsonStringIntern
+		uint8_t *newPtr = RyanJsonInternAcquire(key, keyLen, strValue, strValueLen, mallocSize);
+#else
 		uint8_t *newPtr = (uint8_t *)jsonMalloc(mallocSize);
+		if (NULL != newPtr) { RyanJsonFillStrBuf(newPtr, key, keyLen, strValue, strValueLen); }
+#endif
 		RyanJsonCheckReturnFalse(NULL != newPtr);
 
-		// 先拷贝内容，再写回指针，避免指针写入后覆盖原数据
-		if (NULL != key)
+		// 调用方未确认时现场扫描一遍，后续每次打印都可省去转义检查
+		if (NULL != strValue && RyanJsonFalse == strValueIsClean && 0 != RyanJsonStrValueMetaSize)
 		{
-			if (0 != keyLen) { RyanJsonMemcpy(newPtr, key, keyLen); }
-			newPtr[keyLen] = '\0';
-		}
-
-		if (NULL != strValue)
-		{
-			uint8_t *strValueBuf = newPtr;
-			if (NULL != key) { strValueBuf = newPtr + keyLen + 1; }
-
-			if (0 != strValueLen) { RyanJsonMemcpy(strValueBuf, strValue, strValueLen); }
-			strValueBuf[strValueLen] = '\0';
+			const uint8_t *strValueBuf = (NULL != key) ? newPtr + keyLen + 1 : newPtr;
+			strValueIsClean = RyanJsonTrue;
+			for (uint32_t i = 0; i < strValueLen; i++)
+			{
+				if (0 != RyanJsonInternalEscapeTable[strValueBuf[i]])
+				{
+					strValueIsClean = RyanJsonFalse;
+					break;
+				}
+			}
 		}
 
 		RyanJsonInternalSetStrPtrModeBuf(pJson, newPtr);
 		RyanJsonSetPayloadStrIsPtrByFlag(pJson, RyanJsonTrue);
+		if (NULL != strValue) { RyanJsonSetStrValueMeta(pJson, strValueLen, strValueIsClean); }
 	}
 
 	// 设置 key
@@ -286,6 +846,12 @@ RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalChangeString(RyanJson_t pJson
 	{
 		RyanJsonSetPayloadEncodeKeyLenByFlag(pJson, keyLenField);
 		RyanJsonSetKeyLen(pJson, keyLen);
+		if (RyanJsonTrue == RyanJsonHasKeyFingerprint(pJson))
+		{
+			// 入参 key 可能指向已被指针槽覆盖的旧内联区，这里按新缓冲中的副本计算
+			RyanJsonGetPayloadPtr(pJson)[RyanJsonKeyFingerprintOffset] =
+				RyanJsonKeyFingerprintOf(RyanJsonInternalKeyHash(RyanJsonGetKey(pJson), keyLen));
+		}
 		if (RyanJsonFalse == RyanJsonGetPayloadStrIsPtrByFlag(pJson))
 		{
 			char *keyBuf = RyanJsonGetKey(pJson);
@@ -303,158 +869,1951 @@ RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalChangeString(RyanJson_t pJson
 	{
 		if (RyanJsonFalse == RyanJsonGetPayloadStrIsPtrByFlag(pJson))
 		{
-			char *strValueBuf = RyanJsonGetStringValue(pJson);
+			char *strValueBuf = RyanJsonInternalGetStrValue(pJson);
 			if (0 != strValueLen) { RyanJsonMemcpy(strValueBuf, arr + keyLen, strValueLen); }
 			strValueBuf[strValueLen] = '\0';
 		}
 	}
 
-	if (oldPrt) { jsonFree(oldPrt); }
+	if (oldPrt) { RyanJsonInternalFreeStrBuf(oldPrt); }
 	return RyanJsonTrue;
 }
 
 /**
- * @brief 创建一个节点
+ * @brief 更新 key 与 strValue
  *
- * @param info 节点信息
- * @return RyanJson_t 节点
- * @note key/strValue 会被拷贝进节点，返回节点拥有其内存。
+ * @param pJson Json 节点
+ * @param isNew 是否是新创建的节点
+ * @param key key 字符串
+ * @param strValue strValue
+ * @return RyanJsonBool_e
+ * @note 等价于按 strlen 计算长度后调用 RyanJsonInternalChangeStringWithLen。
  */
-RyanJsonInternalApi RyanJson_t RyanJsonInternalNewNode(RyanJsonNodeInfo_t *info)
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalChangeString(RyanJson_t pJson, RyanJsonBool_e isNew, const char *key,
+								const char *strValue)
+{
+	uint32_t strValueLen = (NULL != strValue) ? (uint32_t)RyanJsonStrlen(strValue) : 0U;
+	return RyanJsonInternalChangeStringWithLen(pJson, isNew, key, strValue, strValueLen, RyanJsonFalse);
+}
+
+/**
+ * @brief 申请 Blob 缓冲并写入 key 与长度
+ *
+ * @param key key，可为 NULL
+ * @param keyLen key 字节长度，key 为 NULL 时忽略
+ * @param len 数据字节数
+ * @param data 输出数据区首地址，由调用方填充
+ * @return uint8_t* 缓冲首地址，失败返回 NULL
+ * @note 启用驻留时缓冲带驻留头但不登记到驻留表（数据不参与去重），复制节点时同样按引用计数共享。
+ */
+RyanJsonInternalApi uint8_t *RyanJsonInternalNewBlobBuf(const char *key, uint32_t keyLen, uint32_t len, uint8_t **data)
+{
+	RyanJsonCheckAssert(NULL != data);
+
+	uint32_t keySize = (NULL != key) ? keyLen + 1U : 0U;
+	RyanJsonCheckReturnNull(len <= UINT32_MAX - RyanJsonBlobLenSize - keySize);
+	uint32_t size = keySize + RyanJsonBlobLenSize + len;
+
+#if true == RyanJsonStringIntern
+	RyanJsonInternHead_t *head = (RyanJsonInternHead_t *)jsonMalloc(sizeof(RyanJsonInternHead_t) + size);
+	RyanJsonCheckReturnNull(NULL != head);
+	head->next = head;
+	head->hash = 0;
+	head->size = size;
+	head->refCount = 1;
+	uint8_t *buf = RyanJsonInternGetBuf(head);
+#else
+	uint8_t *buf = (uint8_t *)jsonMalloc(size);
+	RyanJsonCheckReturnNull(NULL != buf);
+#endif
+
+	RyanJsonFillStrBuf(buf, key, keyLen, NULL, 0);
+
+	// 使用大小端无关的方式写入
+	uint8_t *lenBuf = buf + keySize;
+	for (uint8_t i = 0; i < RyanJsonBlobLenSize; i++)
+	{
+		lenBuf[i] = (uint8_t)(len >> (i * 8U));
+	}
+	*data = lenBuf + RyanJsonBlobLenSize;
+	return buf;
+}
+
+/**
+ * @brief 把 Blob 缓冲挂到节点上，节点随之成为 Blob 节点
+ *
+ * @param pJson String 或 Blob 节点（或刚创建的 Blob 节点）
+ * @param buf RyanJsonInternalNewBlobBuf 返回的缓冲
+ * @param hasKey 缓冲中是否带 key
+ * @param keyLen 缓冲中 key 的字节长度
+ * @note 节点原有的 ptr 模式缓冲在切换后释放，因此 buf 的内容可以来自旧缓冲。
+ */
+RyanJsonInternalApi void RyanJsonInternalSetBlobBuf(RyanJson_t pJson, uint8_t *buf, RyanJsonBool_e hasKey, uint32_t keyLen)
+{
+	RyanJsonCheckAssert(NULL != pJson && NULL != buf);
+
+	uint8_t *oldPrt = NULL;
+	if (RyanJsonTrue == RyanJsonGetPayloadStrIsPtrByFlag(pJson)) { oldPrt = RyanJsonInternalGetStrPtrModeBuf(pJson); }
+
+	RyanJsonSetType(pJson, RyanJsonTypeBlob);
+	RyanJsonSetPayloadIsRawByFlag(pJson, RyanJsonFalse);
+	RyanJsonInternalSetStrPtrModeBuf(pJson, buf);
+	RyanJsonSetPayloadStrIsPtrByFlag(pJson, RyanJsonTrue);
+	if (hasKey)
+	{
+		RyanJsonSetPayloadEncodeKeyLenByFlag(pJson, RyanJsonInternalCalcLenBytes(keyLen));
+		RyanJsonSetKeyLen(pJson, keyLen);
+		if (RyanJsonTrue == RyanJsonHasKeyFingerprint(pJson))
+		{
+			RyanJsonGetPayloadPtr(pJson)[RyanJsonKeyFingerprintOffset] =
+				RyanJsonKeyFingerprintOf(RyanJsonInternalKeyHash((const char *)buf, keyLen));
+		}
+	}
+	else
+	{
+		RyanJsonSetPayloadEncodeKeyLenByFlag(pJson, 0);
+	}
+
+	if (oldPrt) { RyanJsonInternalFreeStrBuf(oldPrt); }
+}
+
+/**
+ * @brief 计算节点本体的分配字节数
+ *
+ * @param type 节点类型
+ * @param isDouble Number 节点是否为 Double
+ * @param hasInline 是否带内联字符串区（带 key 或 String/Blob 节点）
+ * @return uint32_t 节点字节数
+ * @note 节点创建后类型、Int/Double 与是否带 key 都不再改变，因此任何时刻都可由 flag 反推出分配大小。
+ *       例外是懒数值：分配时另有源文本，转换为 Int 后反推值只会偏小，按反推值整块拷贝仍然安全。
+ */
+static uint32_t RyanJsonNodeSize(RyanjsonType_e type, RyanJsonBool_e isDouble, RyanJsonBool_e hasInline)
+{
+	// 加 1 是 flag 的空间
+	uint32_t size = sizeof(struct RyanJsonNode) + RyanJsonFlagSize;
+
+	if (RyanJsonTypeNumber == type)
+	{
+		if (RyanJsonFalse == isDouble) { size += sizeof(int32_t); }
+		else
+		{
+			size += sizeof(double);
+		}
+	}
+	else if (RyanJsonTypeArray == type || RyanJsonTypeObject == type) { size += sizeof(RyanJson_t) + RyanJsonContainerExtSize; }
+
+	// 是否内联字符串
+	if (hasInline) { size += RyanJsonInlineStringSize; }
+	return size;
+}
+
+/**
+ * @brief 创建一个节点
+ *
+ * @param info 节点信息
+ * @return RyanJson_t 节点
+ * @note key/strValue 会被拷贝进节点，返回节点拥有其内存。
+ */
+RyanJsonInternalApi RyanJson_t RyanJsonInternalNewNode(RyanJsonNodeInfo_t *info)
 {
 	RyanJsonCheckAssert(NULL != info);
 
-	// 加 1 是 flag 的空间
-	uint32_t size = sizeof(struct RyanJsonNode) + RyanJsonFlagSize;
+	uint32_t size = RyanJsonNodeSize(info->type, info->numberIsDoubleFlag,
+					 RyanJsonMakeBool(NULL != info->key || RyanJsonTypeString == info->type ||
+							  RyanJsonTypeBlob == info->type));
+	size += info->extraSize;
+
+	RyanJson_t pJson = (RyanJson_t)jsonMalloc((size_t)size);
+	RyanJsonCheckReturnNull(NULL != pJson);
+
+	// 节点体积较小，直接整块清零即可
+	RyanJsonMemset(pJson, 0, size);
+
+	RyanJsonSetType(pJson, info->type);
+
+	// 设置 key 和 value
+	uint32_t strValueLen = info->strValueLen;
+	if (NULL != info->strValue && RyanJsonFalse == info->hasStrValueLen) { strValueLen = (uint32_t)RyanJsonStrlen(info->strValue); }
+	RyanJsonCheckCode(RyanJsonTrue == RyanJsonInternalChangeStringWithLen(pJson, RyanJsonTrue, info->key, info->strValue, strValueLen,
+									      info->strValueIsClean),
+			  {
+				  jsonFree(pJson);
+				  return NULL;
+			  });
+
+	// 设置 Bool / Number
+	if (RyanJsonTypeBool == info->type) { RyanJsonSetPayloadBoolValueByFlag(pJson, info->boolIsTrueFlag); }
+	else if (RyanJsonTypeNumber == info->type) { RyanJsonSetPayloadNumberIsDoubleByFlag(pJson, info->numberIsDoubleFlag); }
+
+	return pJson;
+}
+
+/**
+ * @brief 按字节复制单个节点（不复制子节点）
+ *
+ * @param pJson 源节点
+ * @return RyanJson_t 游离的新节点，失败返回 NULL
+ * @note 节点本体整块拷贝，key/strValue 元信息、key 指纹与数值无需重新计算；
+ *       ptr 模式缓冲按已知长度整块拷贝（启用驻留时直接共享并增加引用计数），紧凑数组连同数据块一起复制。
+ * @note 容器的子节点与扩展信息（各类缓存、索引、增量记录）不复制，新节点为空容器。
+ */
+RyanJsonInternalApi RyanJson_t RyanJsonInternalCloneNode(RyanJson_t pJson)
+{
+	RyanJsonCheckAssert(NULL != pJson);
+
+	RyanjsonType_e type = RyanJsonGetPayloadTypeByFlag(pJson);
+	// 非法类型无法确定节点大小，与逐类型重建时一样按复制失败处理
+	if (type < RyanJsonTypeNull || type > RyanJsonTypeBlob) { return NULL; }
+
+	RyanJsonBool_e isKey = RyanJsonIsKey(pJson);
+	RyanJsonBool_e isDouble = RyanJsonMakeBool(RyanJsonTypeNumber == type && RyanJsonGetPayloadNumberIsDoubleByFlag(pJson));
+	uint32_t size = RyanJsonNodeSize(type, isDouble, RyanJsonMakeBool(isKey || RyanJsonTypeString == type || RyanJsonTypeBlob == type));
+	// 未转换的懒数值连同源文本一起复制
+	if (RyanJsonInternalIsLazyNumber(pJson)) { size += (uint32_t)RyanJsonStrlen(RyanJsonInternalGetLazyNumberText(pJson)) + 1U; }
+
+	RyanJson_t item = (RyanJson_t)jsonMalloc((size_t)size);
+	RyanJsonCheckReturnNull(NULL != item);
+	RyanJsonMemcpy(item, pJson, size);
+	item->next = NULL;
+	RyanJsonSetPayloadIsLastByFlag(item, 0);
+
+	if (RyanJsonTypeArray == type || RyanJsonTypeObject == type)
+	{
+		RyanJsonMemset(RyanJsonInternalGetValue(item), 0, sizeof(RyanJson_t) + RyanJsonContainerExtSize);
+#if true == RyanJsonDeltaTracking
+		// 增量记录保存在扩展信息中，不随复制带走，路径标记也一并清除
+		if (RyanJsonTypeObject == type) { RyanJsonSetPayloadDeltaPathByFlag(item, RyanJsonFalse); }
+#endif
+#if true == RyanJsonPackedArray
+		if (RyanJsonInternalIsPackedArray(pJson))
+		{
+			RyanJsonSetPayloadIsPackedByFlag(item, 0);
+			RyanJsonCheckCode(RyanJsonTrue == RyanJsonInternalPackedDuplicate(item, pJson), { goto error__; });
+		}
+#endif
+	}
+
+	if (RyanJsonTrue == RyanJsonGetPayloadStrIsPtrByFlag(pJson))
+	{
+		uint8_t *buf = RyanJsonInternalGetStrPtrModeBuf(pJson);
+#if true == RyanJsonStringIntern
+		RyanJsonInternHead_t *head = (RyanJsonInternHead_t *)(void *)(buf - sizeof(RyanJsonInternHead_t));
+		head->refCount++;
+#else
+		uint32_t bufSize = isKey ? RyanJsonInternalGetKeyLen(pJson) + 1U : 0U;
+		if (RyanJsonTypeString == type || RyanJsonInternalIsRaw(pJson))
+		{
+			uint32_t strValueLen;
+			(void)RyanJsonInternalGetStrValueInfo(pJson, &strValueLen);
+			bufSize += strValueLen + 1U;
+		}
+		else if (RyanJsonTypeBlob == type)
+		{
+			uint32_t blobLen;
+			(void)RyanJsonGetBlobValue(pJson, &blobLen);
+			bufSize += RyanJsonBlobLenSize + blobLen;
+		}
+
+		uint8_t *newBuf = (uint8_t *)jsonMalloc(bufSize);
+		RyanJsonCheckCode(NULL != newBuf, { goto error__; });
+		RyanJsonMemcpy(newBuf, buf, bufSize);
+		RyanJsonInternalSetStrPtrModeBuf(item, newBuf);
+#endif
+	}
+	return item;
+
+#if true == RyanJsonPackedArray || true != RyanJsonStringIntern
+error__:
+	// 此时 item 尚未持有任何独立资源
+	jsonFree(item);
+	return NULL;
+#endif
+}
+
+/**
+ * @brief 在父节点中插入子节点（维护线索化链表）
+ *
+ * @param parent 父节点（Object 或 Array）
+ * @param prev 前驱兄弟节点，为 NULL 表示头插
+ * @param item 待插入节点
+ * @note 要求 parent 为容器节点且 item 为游离节点。
+ */
+RyanJsonInternalApi void RyanJsonInternalListInsertAfter(RyanJson_t parent, RyanJson_t prev, RyanJson_t item)
+{
+	RyanJson_t nextItem;
+
+	if (prev)
+	{
+		// 若 prev 原本是尾节点，则 prev->next 指向 parent，此时 nextItem 应视为 NULL
+		// 通过 IsLast 标志区分“下一个兄弟节点”与“父节点线索”。
+		if (RyanJsonGetPayloadIsLastByFlag(prev)) { nextItem = NULL; }
+		else
+		{
+			nextItem = prev->next;
+		}
+	}
+	else
+	{
+		// 插入到头部，RyanJsonNode 结构保证了 Object 和 Array 的 Value 指针位置一致
+		nextItem = RyanJsonGetObjectValue(parent);
+	}
+
+	// 先链接 prev -> item
+	if (prev)
+	{
+		prev->next = item;
+		// prev 不再是最后一个，取消 IsLast 标记
+		RyanJsonSetPayloadIsLastByFlag(prev, 0);
+	}
+	else
+	{
+		// 只有 item 一个子节点，或者 item 是新的头部
+		RyanJsonInternalChangeObjectValue(parent, item);
+	}
+
+	// 再链接 item -> nextItem（或 Parent）
+	if (nextItem)
+	{
+		// 不是最后一个节点，item->next 指向下一个兄弟
+		item->next = nextItem;
+		RyanJsonSetPayloadIsLastByFlag(item, 0);
+	}
+	else
+	{
+		// 是最后一个节点，item->next 指向 Parent (线索化)
+		item->next = parent;
+		RyanJsonSetPayloadIsLastByFlag(item, 1);
+	}
+}
+
+/**
+ * @brief 获取同层下一个兄弟节点
+ *
+ * @param pJson 当前节点
+ * @return RyanJson_t 下一个兄弟节点；若当前为最后节点返回 NULL
+ */
+RyanJson_t RyanJsonGetNext(RyanJson_t pJson)
+{
+	RyanJsonCheckAssert(NULL != pJson);
+
+	// 尾节点（Bit7=1）的 next 保存的是父节点线索，对外应返回 NULL
+	if (RyanJsonGetPayloadIsLastByFlag(pJson)) { return NULL; }
+	return pJson->next;
+}
+
+/**
+ * @brief 获取当前节点的父节点
+ *
+ * @param pJson 当前节点
+ * @return RyanJson_t 父节点
+ */
+RyanJsonInternalApi RyanJson_t RyanJsonInternalGetParent(RyanJson_t pJson)
+{
+	RyanJsonCheckAssert(NULL != pJson);
+
+	RyanJson_t curr = pJson;
+	RyanJson_t next = RyanJsonGetNext(curr);
+
+	// 沿着兄弟链表一直走到该层级的最后一个节点
+	while (NULL != next)
+	{
+		curr = next;
+		next = RyanJsonGetNext(curr);
+	}
+
+	// 此时 curr 是当前层级的最后一个节点，其 next 指针存放的就是父节点
+	return curr->next;
+}
+
+#if true == RyanJsonContainerExtEnable
+static void RyanJsonSetContainerExt(RyanJson_t pJson, RyanJsonContainerExt_t *ext)
+{
+	// 扩展槽紧跟 children 指针，可能未按指针对齐，统一走 memcpy
+	RyanJsonMemcpy((uint8_t *)RyanJsonInternalGetValue(pJson) + sizeof(void *), (void *)&ext, sizeof(void *));
+}
+
+/**
+ * @brief 获取容器扩展信息
+ *
+ * @param pJson 容器节点（Array 或 Object）
+ * @return RyanJsonContainerExt_t* 扩展信息，未分配时返回 NULL
+ */
+RyanJsonInternalApi RyanJsonContainerExt_t *RyanJsonInternalGetContainerExt(RyanJson_t pJson)
+{
+	RyanJsonCheckAssert(NULL != pJson);
+	RyanJsonCheckAssert(_checkType(pJson, RyanJsonTypeArray) || _checkType(pJson, RyanJsonTypeObject));
+
+	RyanJsonContainerExt_t *ext;
+	RyanJsonMemcpy((void *)&ext, (uint8_t *)RyanJsonInternalGetValue(pJson) + sizeof(void *), sizeof(void *));
+	return ext;
+}
+
+/**
+ * @brief 获取容器扩展信息，不存在时分配
+ *
+ * @param pJson 容器节点（Array 或 Object）
+ * @return RyanJsonContainerExt_t* 扩展信息，分配失败返回 NULL
+ */
+RyanJsonInternalApi RyanJsonContainerExt_t *RyanJsonInternalEnsureContainerExt(RyanJson_t pJson)
+{
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	if (NULL != ext) { return ext; }
+
+	ext = (RyanJsonContainerExt_t *)jsonMalloc(sizeof(RyanJsonContainerExt_t));
+	RyanJsonCheckReturnNull(NULL != ext);
+	RyanJsonMemset(ext, 0, sizeof(RyanJsonContainerExt_t));
+
+	RyanJsonSetContainerExt(pJson, ext);
+	return ext;
+}
+
+#if true == RyanJsonSnapshotShare
+/**
+ * @brief 解除容器与共享快照的关联，释放容器持有的那次引用
+ */
+static void RyanJsonUnlinkSnapshot(RyanJsonContainerExt_t *ext)
+{
+	RyanJson_t snapshot = RyanJsonInternalGetSnapshot(ext);
+	if (NULL == snapshot) { return; }
+
+	RyanJsonInternalSetSnapshot(ext, NULL);
+	RyanJsonSnapshotRelease(snapshot);
+}
+#endif
+
+#if true == RyanJsonDeltaTracking
+static void RyanJsonDeltaFreeRecords(RyanJsonContainerExt_t *ext)
+{
+	for (uint32_t i = 0; i < ext->deltaRemovedCount; i++)
+	{
+		RyanJsonDelete(ext->deltaRemoved[i]);
+	}
+	for (uint32_t i = 0; i < ext->deltaEntryCount; i++)
+	{
+		if (NULL != ext->deltaEntries[i].baseline) { RyanJsonDelete(ext->deltaEntries[i].baseline); }
+	}
+	if (NULL != ext->deltaRemoved) { jsonFree(ext->deltaRemoved); }
+	if (NULL != ext->deltaEntries) { jsonFree(ext->deltaEntries); }
+
+	ext->deltaRemoved = NULL;
+	ext->deltaEntries = NULL;
+	ext->deltaRemovedCount = ext->deltaRemovedCap = 0;
+	ext->deltaEntryCount = ext->deltaEntryCap = 0;
+}
+#endif
+
+/**
+ * @brief 释放容器扩展信息及其持有的全部缓存
+ *
+ * @param pJson 容器节点（Array 或 Object）
+ */
+RyanJsonInternalApi void RyanJsonInternalFreeContainerExt(RyanJson_t pJson)
+{
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	if (NULL == ext) { return; }
+
+#if true == RyanJsonPrintCache
+	if (NULL != ext->printCache) { jsonFree(ext->printCache); }
+#endif
+#if true == RyanJsonDeltaTracking
+	RyanJsonDeltaFreeRecords(ext);
+#endif
+#if true == RyanJsonObjectHashIndex
+	if (_checkType(pJson, RyanJsonTypeObject) && NULL != ext->index.keyIndex) { jsonFree(ext->index.keyIndex); }
+#endif
+#if true == RyanJsonArrayIndex
+	if (_checkType(pJson, RyanJsonTypeArray) && NULL != ext->index.childIndex) { jsonFree(ext->index.childIndex); }
+#endif
+#if true == RyanJsonSnapshotShare
+	RyanJsonUnlinkSnapshot(ext);
+#endif
+
+	jsonFree(ext);
+	RyanJsonSetContainerExt(pJson, NULL);
+}
+
+/**
+ * @brief 扩展信息中已无任何有效内容时将其释放
+ *
+ * @param pJson 容器节点（Array 或 Object）
+ */
+RyanJsonInternalApi void RyanJsonInternalTrimContainerExt(RyanJson_t pJson)
+{
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	if (NULL == ext) { return; }
+
+#if true == RyanJsonPrintCache
+	if (NULL != ext->printCache) { return; }
+#endif
+#if true == RyanJsonDeltaTracking
+	if (NULL != ext->deltaEntries || NULL != ext->deltaRemoved) { return; }
+#endif
+#if true == RyanJsonObjectHashIndex
+	if (_checkType(pJson, RyanJsonTypeObject) && NULL != ext->index.keyIndex) { return; }
+#endif
+#if true == RyanJsonArrayIndex
+	if (_checkType(pJson, RyanJsonTypeArray) && NULL != ext->index.childIndex) { return; }
+#endif
+#if true == RyanJsonHashCache
+	if (0 != ext->hashState) { return; }
+#endif
+#if true == RyanJsonSnapshotShare
+	if (0U != ext->snapshotLink) { return; }
+#endif
+
+	RyanJsonInternalFreeContainerExt(pJson);
+}
+#endif
+
+#if true == RyanJsonPrintCache
+/**
+ * @brief 丢弃容器自身的打印缓存
+ *
+ * @param pJson 容器节点（Array 或 Object）
+ */
+RyanJsonInternalApi void RyanJsonInternalDropPrintCache(RyanJson_t pJson)
+{
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	if (NULL == ext || NULL == ext->printCache) { return; }
+
+	jsonFree(ext->printCache);
+	ext->printCache = NULL;
+	ext->printCacheLen = 0;
+	RyanJsonInternalTrimContainerExt(pJson);
+}
+#endif
+
+#if true == RyanJsonHashCache
+/**
+ * @brief 读取容器的子树哈希缓存
+ *
+ * @param pJson 容器节点（Array 或 Object）
+ * @param hash 输出子树哈希（未做最终混合）
+ * @param hasDouble 输出子树是否含 Double，可为 NULL
+ * @return RyanJsonBool_e 缓存是否有效
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalGetHashCache(RyanJson_t pJson, uint32_t *hash, RyanJsonBool_e *hasDouble)
+{
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	if (NULL == ext || 0 == (ext->hashState & RyanJsonHashCacheValid)) { return RyanJsonFalse; }
+
+	*hash = ext->subtreeHash;
+	if (NULL != hasDouble) { *hasDouble = RyanJsonMakeBool(0 != (ext->hashState & RyanJsonHashCacheHasDouble)); }
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 记录容器的子树哈希缓存，扩展信息分配失败时放弃缓存
+ */
+RyanJsonInternalApi void RyanJsonInternalSetHashCache(RyanJson_t pJson, uint32_t hash, RyanJsonBool_e hasDouble)
+{
+	RyanJsonContainerExt_t *ext = RyanJsonInternalEnsureContainerExt(pJson);
+	if (NULL == ext) { return; }
+
+	ext->subtreeHash = hash;
+	ext->hashState = (uint8_t)(RyanJsonHashCacheValid | (hasDouble ? RyanJsonHashCacheHasDouble : 0U));
+}
+
+/**
+ * @brief 丢弃容器自身的子树哈希缓存
+ */
+static void RyanJsonDropHashCache(RyanJson_t pJson)
+{
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	if (NULL == ext || 0 == ext->hashState) { return; }
+
+	ext->hashState = 0;
+	ext->subtreeHash = 0;
+	RyanJsonInternalTrimContainerExt(pJson);
+}
+#endif
+
+#if true == RyanJsonSnapshotShare
+/**
+ * @brief 容器内容或自身 key 即将改变，解除其与共享快照的关联
+ */
+RyanJsonInternalApi void RyanJsonInternalDropSnapshotLink(RyanJson_t pJson)
+{
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	if (NULL == ext) { return; }
+
+	// 快照只读，不允许修改快照内的节点
+	RyanJsonCheckAssert(!RyanJsonInternalIsSnapshotRoot(ext));
+	if (NULL == RyanJsonInternalGetSnapshot(ext)) { return; }
+
+	RyanJsonUnlinkSnapshot(ext);
+	RyanJsonInternalTrimContainerExt(pJson);
+}
+
+/**
+ * @brief 判断节点是否为快照根节点（只读，只能经 RyanJsonSnapshotRelease 释放）
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalIsSnapshot(RyanJson_t pJson)
+{
+	if (!_checkType(pJson, RyanJsonTypeArray) && !_checkType(pJson, RyanJsonTypeObject)) { return RyanJsonFalse; }
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	return RyanJsonMakeBool(NULL != ext && RyanJsonInternalIsSnapshotRoot(ext));
+}
+#endif
+
+#if true == RyanJsonPrintCache || true == RyanJsonHashCache || true == RyanJsonSnapshotShare
+/**
+ * @brief 使 pJson 及其全部祖先容器的打印缓存与子树哈希缓存失效，并解除共享快照
+ *
+ * @param pJson 序列化结果即将改变的节点，可为 NULL
+ * @return RyanJsonBool_e pJson 位于快照内时返回 RyanJsonFalse（快照只读），此前清除的缓存只影响性能
+ * @note 子容器片段过短时不会缓存，但祖先仍可能持有缓存，因此必须一直走到根。
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalMarkDirty(RyanJson_t pJson)
+{
+	RyanJson_t curr = pJson;
+	while (NULL != curr)
+	{
+		if (_checkType(curr, RyanJsonTypeArray) || _checkType(curr, RyanJsonTypeObject))
+		{
+#if true == RyanJsonSnapshotShare
+			RyanJsonCheckReturnFalse(RyanJsonFalse == RyanJsonInternalIsSnapshot(curr));
+#endif
+#if true == RyanJsonPrintCache
+			RyanJsonInternalDropPrintCache(curr);
+#endif
+#if true == RyanJsonHashCache
+			RyanJsonDropHashCache(curr);
+#endif
+#if true == RyanJsonSnapshotShare
+			RyanJsonInternalDropSnapshotLink(curr);
+#endif
+		}
+		curr = RyanJsonInternalGetParent(curr);
+	}
+	return RyanJsonTrue;
+}
+#endif
+
+#if true == RyanJsonDeltaTracking
+/**
+ * @brief 保证动态数组至少还能追加一个元素
+ */
+static RyanJsonBool_e RyanJsonDeltaReserve(void **array, uint32_t *cap, uint32_t count, uint32_t elemSize)
+{
+	if (count < *cap) { return RyanJsonTrue; }
+
+	uint32_t newCap = (0U == *cap) ? 4U : (*cap * 2U);
+	void *newArray;
+	if (NULL == *array) { newArray = jsonMalloc((size_t)newCap * elemSize); }
+	else
+	{
+		newArray = RyanJsonInternalExpandRealloc(*array, *cap * elemSize, newCap * elemSize);
+	}
+	RyanJsonCheckReturnFalse(NULL != newArray);
+
+	*array = newArray;
+	*cap = newCap;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 查找 node 在 ext 所属 Object 中的整体变化记录
+ * @return RyanJsonDeltaEntry_t* 记录，node 未整体变化时返回 NULL
+ */
+RyanJsonInternalApi RyanJsonDeltaEntry_t *RyanJsonInternalDeltaFindEntry(const RyanJsonContainerExt_t *ext, RyanJson_t node)
+{
+	if (NULL == ext) { return NULL; }
+	for (uint32_t i = 0; i < ext->deltaEntryCount; i++)
+	{
+		if (ext->deltaEntries[i].node == node) { return &ext->deltaEntries[i]; }
+	}
+	return NULL;
+}
+
+/**
+ * @brief 查找 pJson 自身及祖先中最外层的 Array
+ * @details Merge Patch 无法寻址数组元素，数组内部的变化只能按最外层数组整体替换输出。
+ * @return RyanJson_t 最外层 Array，不存在返回 NULL
+ */
+static RyanJson_t RyanJsonDeltaFindTopArray(RyanJson_t pJson)
+{
+	RyanJson_t topArray = NULL;
+	for (RyanJson_t node = pJson; NULL != node; node = RyanJsonInternalGetParent(node))
+	{
+		if (_checkType(node, RyanJsonTypeArray)) { topArray = node; }
+	}
+	return topArray;
+}
+
+/**
+ * @brief 把 ext 中全部删除记录的副本加入骨架
+ */
+static RyanJsonBool_e RyanJsonDeltaCopyRemoved(RyanJson_t skeleton, const RyanJsonContainerExt_t *ext)
+{
+	for (uint32_t i = 0; NULL != ext && i < ext->deltaRemovedCount; i++)
+	{
+		RyanJson_t copy = RyanJsonDuplicate(ext->deltaRemoved[i]);
+		RyanJsonCheckReturnFalse(NULL != copy);
+		RyanJsonInternalListInsertAfter(skeleton, NULL, copy);
+	}
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 生成成员在检查点时的 key 骨架（迭代实现）
+ *
+ * @param pJson 即将移除的成员，自检查点以来未整体变化
+ * @return RyanJson_t 与 pJson 同 key 的骨架，内存不足返回 NULL
+ * @note 非 Object 成员为 Null 节点；Object 内已整体变化的成员取其基线，已删除的成员取其删除记录，
+ *       因此骨架覆盖检查点时的全部 key（检查点之后新增的 key 也会出现，补 null 时不影响结果）。
+ */
+static RyanJson_t RyanJsonDeltaBuildSkeleton(RyanJson_t pJson)
+{
+	if (!_checkType(pJson, RyanJsonTypeObject)) { return RyanJsonCreateNull(RyanJsonInternalDeltaKey(pJson)); }
+
+	RyanJson_t skeleton = RyanJsonInternalCreateObjectAndKey(RyanJsonInternalDeltaKey(pJson));
+	RyanJsonCheckReturnNull(NULL != skeleton);
+
+	// 无需显式栈：原树与骨架同步下行，回溯时各自通过线索化链表找到父节点
+	RyanJson_t curr = pJson;
+	RyanJson_t currSkeleton = skeleton;
+	RyanJsonCheckCode(RyanJsonDeltaCopyRemoved(currSkeleton, RyanJsonInternalGetContainerExt(curr)), { goto error__; });
+	RyanJson_t child = RyanJsonGetObjectValue(curr);
+	while (1)
+	{
+		if (NULL != child)
+		{
+			const RyanJsonDeltaEntry_t *entry = RyanJsonInternalDeltaFindEntry(RyanJsonInternalGetContainerExt(curr), child);
+			RyanJsonBool_e descend = RyanJsonMakeBool(NULL == entry && _checkType(child, RyanJsonTypeObject));
+			RyanJson_t item;
+			if (NULL != entry && NULL != entry->baseline) { item = RyanJsonDuplicate(entry->baseline); }
+			else if (descend) { item = RyanJsonInternalCreateObjectAndKey(RyanJsonInternalDeltaKey(child)); }
+			else
+			{
+				item = RyanJsonCreateNull(RyanJsonInternalDeltaKey(child));
+			}
+			RyanJsonCheckCode(NULL != item, { goto error__; });
+			RyanJsonInternalListInsertAfter(currSkeleton, NULL, item);
+
+			if (RyanJsonFalse == descend)
+			{
+				child = RyanJsonGetNext(child);
+				continue;
+			}
+			curr = child;
+			currSkeleton = item;
+			RyanJsonCheckCode(RyanJsonDeltaCopyRemoved(currSkeleton, RyanJsonInternalGetContainerExt(curr)), { goto error__; });
+			child = RyanJsonGetObjectValue(curr);
+			continue;
+		}
+
+		if (curr == pJson) { return skeleton; }
+		child = RyanJsonGetNext(curr);
+		curr = RyanJsonInternalGetParent(curr);
+		currSkeleton = RyanJsonInternalGetParent(currSkeleton);
+	}
+
+error__:
+	RyanJsonDelete(skeleton);
+	return NULL;
+}
+
+/**
+ * @brief 记录一次成员变化（语义见 RyanJsonInternal.h）
+ * @note 先预留全部所需内存再写入，保证失败时记录状态不变。
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalDeltaRecord(RyanJson_t container, RyanJson_t removed, RyanJson_t added,
+								const char *addedKey)
+{
+	if (NULL == container) { return RyanJsonTrue; }
+
+	// 变化位于数组内部时，改为记录“最外层数组整体变化”；该数组就是根时无需记录（始终整体输出）
+	RyanJson_t topArray = RyanJsonDeltaFindTopArray(container);
+	if (NULL != topArray)
+	{
+		container = RyanJsonInternalGetParent(topArray);
+		if (NULL == container) { return RyanJsonTrue; }
+		added = topArray;
+		removed = NULL;
+		addedKey = NULL;
+	}
+	RyanJsonCheckAssert(_checkType(container, RyanJsonTypeObject));
+
+	// 第一步：预留全部所需内存
+	RyanJsonContainerExt_t *ext = RyanJsonInternalEnsureContainerExt(container);
+	RyanJsonCheckReturnFalse(NULL != ext);
+
+	if (NULL != removed)
+	{
+		RyanJsonCheckReturnFalse(
+			RyanJsonDeltaReserve((void **)&ext->deltaRemoved, &ext->deltaRemovedCap, ext->deltaRemovedCount, sizeof(RyanJson_t)));
+	}
+	if (NULL != added)
+	{
+		RyanJsonCheckReturnFalse(RyanJsonDeltaReserve((void **)&ext->deltaEntries, &ext->deltaEntryCap, ext->deltaEntryCount,
+							      sizeof(RyanJsonDeltaEntry_t)));
+	}
+
+	// 骨架最后生成：此后不再有可能失败的步骤，且记录数组不会再被扩容
+	RyanJsonDeltaEntry_t *removedEntry = NULL;
+	RyanJson_t removedSkeleton = NULL;
+	if (NULL != removed)
+	{
+		// 已整体变化的成员，检查点时的结构就是其基线；否则按当前结构与其内部记录生成
+		removedEntry = RyanJsonInternalDeltaFindEntry(ext, removed);
+		if (NULL != removedEntry && NULL != removedEntry->baseline) { removedSkeleton = removedEntry->baseline; }
+		else if (NULL != removedEntry) { removedSkeleton = RyanJsonCreateNull(RyanJsonInternalDeltaKey(removed)); }
+		else
+		{
+			removedSkeleton = RyanJsonDeltaBuildSkeleton(removed);
+		}
+		RyanJsonCheckReturnFalse(NULL != removedSkeleton);
+	}
+
+	// 第二步：写入记录（不再申请内存）
+	if (NULL != removed)
+	{
+		// 基线已转入删除记录
+		if (NULL != removedEntry) { *removedEntry = ext->deltaEntries[--ext->deltaEntryCount]; }
+		ext->deltaRemoved[ext->deltaRemovedCount++] = removedSkeleton;
+	}
+	if (NULL != added)
+	{
+		// 同名 key 重新出现，删除记录失效；原值为 Object 时其骨架转为新成员的基线
+		const char *key = (NULL != addedKey) ? addedKey : RyanJsonInternalDeltaKey(added);
+		RyanJsonDeltaEntry_t *entry = RyanJsonInternalDeltaFindEntry(ext, added);
+		if (NULL == entry)
+		{
+			entry = &ext->deltaEntries[ext->deltaEntryCount++];
+			entry->node = added;
+			entry->baseline = NULL;
+		}
+		for (uint32_t i = 0; NULL != key && i < ext->deltaRemovedCount;)
+		{
+			RyanJson_t skeleton = ext->deltaRemoved[i];
+			const char *skeletonKey = RyanJsonInternalDeltaKey(skeleton);
+			if (NULL != skeletonKey && RyanJsonTrue == RyanJsonInternalStrEq(skeletonKey, key))
+			{
+				ext->deltaRemoved[i] = ext->deltaRemoved[--ext->deltaRemovedCount];
+				if (NULL == entry->baseline && _checkType(skeleton, RyanJsonTypeObject)) { entry->baseline = skeleton; }
+				else
+				{
+					RyanJsonDelete(skeleton);
+				}
+				continue;
+			}
+			i++;
+		}
+	}
+
+	// 第三步：沿父链标记路径，遇到已标记的祖先即停止
+	for (RyanJson_t node = container; NULL != node && !RyanJsonGetPayloadDeltaPathByFlag(node); node = RyanJsonInternalGetParent(node))
+	{
+		RyanJsonSetPayloadDeltaPathByFlag(node, RyanJsonTrue);
+	}
+
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 判断 Object 自身是否带有未清除的变化记录
+ */
+static RyanJsonBool_e RyanJsonDeltaHasRecord(RyanJson_t pJson)
+{
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	return RyanJsonMakeBool(NULL != ext && (0U != ext->deltaEntryCount || 0U != ext->deltaRemovedCount));
+}
+
+/**
+ * @brief 返回 child 及其之后第一个带路径标记的兄弟 Object，不存在返回 NULL
+ */
+static RyanJson_t RyanJsonDeltaNextPath(RyanJson_t child)
+{
+	while (NULL != child && !RyanJsonInternalIsDeltaPath(child))
+	{
+		child = RyanJsonGetNext(child);
+	}
+	return child;
+}
+
+/**
+ * @brief 清除增量记录（建立检查点）
+ *
+ * @param pJson 根节点，应与 RyanJsonPrintDelta 使用的节点一致
+ * @note 只进入带路径标记的 Object，不访问未修改的子树；对子树建立检查点时同时撤销祖先上已无意义的标记。
+ */
+void RyanJsonCheckpoint(RyanJson_t pJson)
+{
+	RyanJsonCheckCode(NULL != pJson, { return; });
+	if (!RyanJsonInternalIsDeltaPath(pJson)) { return; }
+
+	// 无需显式栈：回溯通过线索化链表找到父节点，并从离开的子节点之后继续扫描
+	RyanJson_t curr = pJson;
+	RyanJson_t child = RyanJsonDeltaNextPath(RyanJsonGetObjectValue(curr));
+	while (1)
+	{
+		if (NULL != child)
+		{
+			curr = child;
+			child = RyanJsonDeltaNextPath(RyanJsonGetObjectValue(curr));
+			continue;
+		}
+
+		// 当前层处理完毕：释放记录、清除标记后回到父节点
+		RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(curr);
+		if (NULL != ext)
+		{
+			RyanJsonDeltaFreeRecords(ext);
+			RyanJsonInternalTrimContainerExt(curr);
+		}
+		RyanJsonSetPayloadDeltaPathByFlag(curr, RyanJsonFalse);
+		if (curr == pJson) { break; }
+		child = RyanJsonDeltaNextPath(RyanJsonGetNext(curr));
+		curr = RyanJsonInternalGetParent(curr);
+	}
+
+	// 祖先自身无记录且不再有带标记的成员时撤销其标记
+	for (RyanJson_t parent = RyanJsonInternalGetParent(pJson); NULL != parent && RyanJsonInternalIsDeltaPath(parent);
+	     parent = RyanJsonInternalGetParent(parent))
+	{
+		if (RyanJsonTrue == RyanJsonDeltaHasRecord(parent)) { break; }
+		if (NULL != RyanJsonDeltaNextPath(RyanJsonGetObjectValue(parent))) { break; }
+		RyanJsonSetPayloadDeltaPathByFlag(parent, RyanJsonFalse);
+	}
+}
+#endif
+
+#if true == RyanJsonObjectHashIndex
+/**
+ * @brief 丢弃 Object 的 key 索引，之后的查找退回线性扫描
+ */
+static void RyanJsonKeyIndexDrop(RyanJson_t pJson, RyanJsonContainerExt_t *ext)
+{
+	jsonFree(ext->index.keyIndex);
+	ext->index.keyIndex = NULL;
+	ext->indexCap = 0;
+	ext->indexCount = 0;
+	RyanJsonInternalTrimContainerExt(pJson);
+}
+
+/**
+ * @brief 在槽位表中查找 key（线性探测）
+ * @return uint32_t 命中的槽位下标，未命中时为 key 应落入的空槽下标
+ */
+static uint32_t RyanJsonKeyIndexProbe(const RyanJsonKeyIndexSlot_t *slots, uint32_t cap, uint32_t hash, const char *key, uint32_t keyLen)
+{
+	uint32_t mask = cap - 1U;
+	uint32_t i = hash & mask;
+	while (NULL != slots[i].node)
+	{
+		if (hash == slots[i].hash && RyanJsonTrue == RyanJsonInternalKeyEq(slots[i].node, key, keyLen, hash)) { break; }
+		i = (i + 1U) & mask;
+	}
+	return i;
+}
+
+/**
+ * @brief 通过 key 索引查找成员
+ *
+ * @param pJson Object 节点
+ * @param key 目标 key，无需 '\0' 结尾
+ * @param keyLen 目标 key 字节长度
+ * @param hash 目标 key 的 RyanJsonInternalKeyHash 结果
+ * @param found 输出命中节点，未命中为 NULL
+ * @return RyanJsonBool_e 是否已建立索引；false 时调用方需线性扫描
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalKeyIndexFind(RyanJson_t pJson, const char *key, uint32_t keyLen, uint32_t hash,
+								RyanJson_t *found)
+{
+	RyanJsonCheckAssert(NULL != pJson && NULL != key && NULL != found);
+
+	if (!_checkType(pJson, RyanJsonTypeObject)) { return RyanJsonFalse; }
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	if (NULL == ext || NULL == ext->index.keyIndex) { return RyanJsonFalse; }
+
+	uint32_t i = RyanJsonKeyIndexProbe(ext->index.keyIndex, ext->indexCap, hash, key, keyLen);
+	*found = ext->index.keyIndex[i].node;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 为 Object 建立 key 索引
+ *
+ * @param pJson Object 节点
+ * @note 按链表顺序登记成员，遇到重复 key 或内存不足时放弃建立（查找仍走线性扫描）。
+ */
+RyanJsonInternalApi void RyanJsonInternalKeyIndexBuild(RyanJson_t pJson)
+{
+	RyanJsonCheckAssert(NULL != pJson && _checkType(pJson, RyanJsonTypeObject));
+
+	uint32_t count = 0;
+	for (RyanJson_t item = RyanJsonGetObjectValue(pJson); NULL != item; item = RyanJsonGetNext(item))
+	{
+		count++;
+	}
+
+	// 负载因子不超过 1/2
+	uint32_t cap = 16U;
+	while (cap < count * 2U)
+	{
+		cap <<= 1;
+	}
+
+	RyanJsonKeyIndexSlot_t *slots = (RyanJsonKeyIndexSlot_t *)jsonMalloc((size_t)cap * sizeof(RyanJsonKeyIndexSlot_t));
+	if (NULL == slots) { return; }
+	RyanJsonMemset(slots, 0, (size_t)cap * sizeof(RyanJsonKeyIndexSlot_t));
+
+	for (RyanJson_t item = RyanJsonGetObjectValue(pJson); NULL != item; item = RyanJsonGetNext(item))
+	{
+		const char *key = RyanJsonGetKey(item);
+		uint32_t keyLen = RyanJsonInternalGetKeyLen(item);
+		uint32_t hash = RyanJsonInternalKeyHash(key, keyLen);
+		uint32_t i = RyanJsonKeyIndexProbe(slots, cap, hash, key, keyLen);
+		if (NULL != slots[i].node)
+		{
+			jsonFree(slots);
+			return;
+		}
+		slots[i].hash = hash;
+		slots[i].node = item;
+	}
+
+	RyanJsonContainerExt_t *ext = RyanJsonInternalEnsureContainerExt(pJson);
+	if (NULL == ext)
+	{
+		jsonFree(slots);
+		return;
+	}
+	ext->index.keyIndex = slots;
+	ext->indexCap = cap;
+	ext->indexCount = count;
+}
+
+/**
+ * @brief 成员加入 Object（或 key 改变）后登记到索引
+ *
+ * @param pJson 所属容器，可为 NULL
+ * @param item 已挂载的成员
+ */
+RyanJsonInternalApi void RyanJsonInternalKeyIndexAdd(RyanJson_t pJson, RyanJson_t item)
+{
+	if (NULL == pJson || !_checkType(pJson, RyanJsonTypeObject)) { return; }
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	if (NULL == ext || NULL == ext->index.keyIndex) { return; }
+
+	const char *key = RyanJsonGetKey(item);
+	uint32_t keyLen = RyanJsonInternalGetKeyLen(item);
+	uint32_t hash = RyanJsonInternalKeyHash(key, keyLen);
+	uint32_t i = RyanJsonKeyIndexProbe(ext->index.keyIndex, ext->indexCap, hash, key, keyLen);
+
+	// 出现重复 key 时“首个命中”取决于链表顺序，索引无法表达，直接丢弃
+	if (NULL != ext->index.keyIndex[i].node)
+	{
+		RyanJsonKeyIndexDrop(pJson, ext);
+		return;
+	}
+
+	if ((ext->indexCount + 1U) * 2U > ext->indexCap)
+	{
+		uint32_t newCap = ext->indexCap * 2U;
+		RyanJsonKeyIndexSlot_t *slots = (RyanJsonKeyIndexSlot_t *)jsonMalloc((size_t)newCap * sizeof(RyanJsonKeyIndexSlot_t));
+		if (NULL == slots)
+		{
+			RyanJsonKeyIndexDrop(pJson, ext);
+			return;
+		}
+		RyanJsonMemset(slots, 0, (size_t)newCap * sizeof(RyanJsonKeyIndexSlot_t));
+
+		for (uint32_t j = 0; j < ext->indexCap; j++)
+		{
+			if (NULL == ext->index.keyIndex[j].node) { continue; }
+			uint32_t k = ext->index.keyIndex[j].hash & (newCap - 1U);
+			while (NULL != slots[k].node)
+			{
+				k = (k + 1U) & (newCap - 1U);
+			}
+			slots[k] = ext->index.keyIndex[j];
+		}
+
+		jsonFree(ext->index.keyIndex);
+		ext->index.keyIndex = slots;
+		ext->indexCap = newCap;
+		i = RyanJsonKeyIndexProbe(slots, newCap, hash, key, keyLen);
+	}
+
+	ext->index.keyIndex[i].hash = hash;
+	ext->index.keyIndex[i].node = item;
+	ext->indexCount++;
+}
+
+/**
+ * @brief 成员离开 Object（或 key 即将改变）前从索引中移除
+ *
+ * @param pJson 所属容器，可为 NULL
+ * @param item 仍挂载且 key 未改变的成员
+ */
+RyanJsonInternalApi void RyanJsonInternalKeyIndexRemove(RyanJson_t pJson, RyanJson_t item)
+{
+	if (NULL == pJson || !_checkType(pJson, RyanJsonTypeObject)) { return; }
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	if (NULL == ext || NULL == ext->index.keyIndex) { return; }
+
+	RyanJsonKeyIndexSlot_t *slots = ext->index.keyIndex;
+	uint32_t mask = ext->indexCap - 1U;
+	uint32_t i = RyanJsonInternalKeyHash(RyanJsonGetKey(item), RyanJsonInternalGetKeyLen(item)) & mask;
+	while (item != slots[i].node)
+	{
+		// 未登记说明索引已不一致，丢弃即可
+		if (NULL == slots[i].node)
+		{
+			RyanJsonKeyIndexDrop(pJson, ext);
+			return;
+		}
+		i = (i + 1U) & mask;
+	}
+
+	// 向后移位删除：把探测链上后续元素挪回空位，无需墓碑
+	uint32_t j = i;
+	while (1)
+	{
+		j = (j + 1U) & mask;
+		if (NULL == slots[j].node) { break; }
+
+		// home 位于 (i, j] 循环区间内的元素不能前移
+		uint32_t home = slots[j].hash & mask;
+		RyanJsonBool_e keep = (i <= j) ? RyanJsonMakeBool(i < home && home <= j) : RyanJsonMakeBool(i < home || home <= j);
+		if (RyanJsonTrue == keep) { continue; }
+
+		slots[i] = slots[j];
+		i = j;
+	}
+	slots[i].node = NULL;
+	ext->indexCount--;
+}
+#endif
+
+#if true == RyanJsonArrayIndex
+/**
+ * @brief 丢弃 Array 的子节点指针表，之后按索引访问退回链表遍历
+ */
+static void RyanJsonArrayIndexDrop(RyanJson_t pJson, RyanJsonContainerExt_t *ext)
+{
+	jsonFree(ext->index.childIndex);
+	ext->index.childIndex = NULL;
+	ext->indexCount = 0;
+	ext->indexCap = 0;
+	RyanJsonInternalTrimContainerExt(pJson);
+}
+
+/**
+ * @brief 获取已建立的指针表所在扩展信息
+ * @return RyanJsonContainerExt_t* 未建立指针表（或 pJson 非 Array）时返回 NULL
+ */
+static RyanJsonContainerExt_t *RyanJsonArrayIndexGetExt(RyanJson_t pJson)
+{
+	if (NULL == pJson || !_checkType(pJson, RyanJsonTypeArray)) { return NULL; }
+	RyanJsonContainerExt_t *ext = RyanJsonInternalGetContainerExt(pJson);
+	if (NULL == ext || NULL == ext->index.childIndex) { return NULL; }
+	return ext;
+}
+
+/**
+ * @brief 通过指针表按索引查找子节点
+ *
+ * @param pJson Array 节点
+ * @param index 子节点索引
+ * @param found 输出命中节点，越界为 NULL
+ * @param prevOut 输出 index 之前的节点（越界时为尾节点），可为 NULL
+ * @return RyanJsonBool_e 是否已建立指针表；false 时调用方需遍历链表
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalArrayIndexFind(RyanJson_t pJson, uint32_t index, RyanJson_t *found, RyanJson_t *prevOut)
+{
+	RyanJsonCheckAssert(NULL != found);
+
+	RyanJsonContainerExt_t *ext = RyanJsonArrayIndexGetExt(pJson);
+	if (NULL == ext) { return RyanJsonFalse; }
+
+	uint32_t count = ext->indexCount;
+	*found = (index < count) ? ext->index.childIndex[index] : NULL;
+	if (NULL != prevOut)
+	{
+		uint32_t pos = (index < count) ? index : count;
+		*prevOut = (0 == pos) ? NULL : ext->index.childIndex[pos - 1U];
+	}
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 为 Array 建立子节点指针表
+ *
+ * @param pJson Array 节点
+ * @note 预留约一半余量供后续追加，内存不足时放弃建立（访问仍走链表遍历）。
+ */
+RyanJsonInternalApi void RyanJsonInternalArrayIndexBuild(RyanJson_t pJson)
+{
+	RyanJsonCheckAssert(NULL != pJson && _checkType(pJson, RyanJsonTypeArray));
+
+	uint32_t count = 0;
+	for (RyanJson_t item = RyanJsonGetObjectValue(pJson); NULL != item; item = RyanJsonGetNext(item))
+	{
+		count++;
+	}
+
+	uint32_t cap = count + count / 2U;
+	if (cap < 16U) { cap = 16U; }
+
+	RyanJson_t *slots = (RyanJson_t *)jsonMalloc((size_t)cap * sizeof(RyanJson_t));
+	if (NULL == slots) { return; }
+
+	uint32_t i = 0;
+	for (RyanJson_t item = RyanJsonGetObjectValue(pJson); NULL != item; item = RyanJsonGetNext(item))
+	{
+		slots[i++] = item;
+	}
+
+	RyanJsonContainerExt_t *ext = RyanJsonInternalEnsureContainerExt(pJson);
+	if (NULL == ext)
+	{
+		jsonFree(slots);
+		return;
+	}
+	if (NULL != ext->index.childIndex) { jsonFree(ext->index.childIndex); }
+	ext->index.childIndex = slots;
+	ext->indexCount = count;
+	ext->indexCap = cap;
+}
+
+/**
+ * @brief 子节点插入 Array 后登记到指针表
+ *
+ * @param pJson 所属容器，可为 NULL
+ * @param pos 插入后的下标，超过元素数按尾插处理
+ * @param item 已挂载的子节点
+ */
+RyanJsonInternalApi void RyanJsonInternalArrayIndexInsert(RyanJson_t pJson, uint32_t pos, RyanJson_t item)
+{
+	RyanJsonContainerExt_t *ext = RyanJsonArrayIndexGetExt(pJson);
+	if (NULL == ext) { return; }
+
+	if (ext->indexCount >= ext->indexCap)
+	{
+		uint32_t newCap = ext->indexCap * 2U;
+		RyanJson_t *slots = (RyanJson_t *)RyanJsonInternalExpandRealloc(ext->index.childIndex, ext->indexCap * sizeof(RyanJson_t),
+										 newCap * sizeof(RyanJson_t));
+		if (NULL == slots)
+		{
+			RyanJsonArrayIndexDrop(pJson, ext);
+			return;
+		}
+		ext->index.childIndex = slots;
+		ext->indexCap = newCap;
+	}
+
+	if (pos > ext->indexCount) { pos = ext->indexCount; }
+	RyanJsonMemmove(&ext->index.childIndex[pos + 1U], &ext->index.childIndex[pos], (size_t)(ext->indexCount - pos) * sizeof(RyanJson_t));
+	ext->index.childIndex[pos] = item;
+	ext->indexCount++;
+}
+
+/**
+ * @brief 子节点离开 Array 后从指针表移除
+ *
+ * @param pJson 所属容器，可为 NULL
+ * @param pos 被移除子节点的下标
+ */
+RyanJsonInternalApi void RyanJsonInternalArrayIndexRemove(RyanJson_t pJson, uint32_t pos)
+{
+	RyanJsonContainerExt_t *ext = RyanJsonArrayIndexGetExt(pJson);
+	if (NULL == ext) { return; }
+	RyanJsonCheckAssert(pos < ext->indexCount);
+
+	ext->indexCount--;
+	RyanJsonMemmove(&ext->index.childIndex[pos], &ext->index.childIndex[pos + 1U], (size_t)(ext->indexCount - pos) * sizeof(RyanJson_t));
+}
+
+/**
+ * @brief Array 子节点原位替换后更新指针表
+ *
+ * @param pJson 所属容器，可为 NULL
+ * @param pos 被替换子节点的下标
+ * @param item 新子节点
+ */
+RyanJsonInternalApi void RyanJsonInternalArrayIndexReplace(RyanJson_t pJson, uint32_t pos, RyanJson_t item)
+{
+	RyanJsonContainerExt_t *ext = RyanJsonArrayIndexGetExt(pJson);
+	if (NULL == ext) { return; }
+	RyanJsonCheckAssert(pos < ext->indexCount);
+	ext->index.childIndex[pos] = item;
+}
+#endif
+
+#if true == RyanJsonPackedArray
+/**
+ * @brief 读取紧凑数组的数据块指针
+ */
+RyanJsonInternalApi RyanJsonPackedHead_t *RyanJsonInternalGetPacked(RyanJson_t pJson)
+{
+	RyanJsonCheckAssert(NULL != pJson && RyanJsonInternalIsPackedArray(pJson));
+
+	RyanJsonPackedHead_t *head;
+	RyanJsonMemcpy((void *)&head, RyanJsonInternalGetValue(pJson), sizeof(void *));
+	return head;
+}
+
+/**
+ * @brief 挂载数据块并置位紧凑标记（pJson 需为无子节点的 Array）
+ */
+static void RyanJsonPackedAttach(RyanJson_t pJson, RyanJsonPackedHead_t *head)
+{
+	RyanJsonMemcpy(RyanJsonInternalGetValue(pJson), (void *)&head, sizeof(void *));
+	RyanJsonSetPayloadIsPackedByFlag(pJson, 1);
+}
+
+/**
+ * @brief 摘下数据块并清除紧凑标记，pJson 恢复为空 Array
+ */
+static RyanJsonPackedHead_t *RyanJsonPackedDetach(RyanJson_t pJson)
+{
+	RyanJsonPackedHead_t *head = RyanJsonInternalGetPacked(pJson);
+	RyanJsonSetPayloadIsPackedByFlag(pJson, 0);
+	RyanJsonInternalChangeObjectValue(pJson, NULL);
+	return head;
+}
+
+/**
+ * @brief 申请一维数组数据块（未初始化元素）
+ */
+static RyanJsonPackedHead_t *RyanJsonPackedAlloc(uint8_t elemType, uint32_t count)
+{
+	size_t elemSize = RyanJsonPackedElemSize(elemType);
+	RyanJsonCheckReturnNull(count <= (UINT32_MAX - RyanJsonPackedDataOffset) / elemSize);
+
+	uint32_t blockSize = (uint32_t)(RyanJsonPackedDataOffset + (size_t)count * elemSize);
+	RyanJsonPackedHead_t *head = (RyanJsonPackedHead_t *)jsonMalloc(blockSize);
+	RyanJsonCheckReturnNull(NULL != head);
+	head->count = count;
+	head->blockSize = blockSize;
+	head->elemType = elemType;
+	head->colCount = 0;
+	return head;
+}
+
+/**
+ * @brief 列存表构造游标
+ */
+typedef struct
+{
+	RyanJsonPackedHead_t *head;
+	uint32_t col;        // 下一个待写入的列
+	uint32_t dataOffset; // 下一列数据的偏移
+	uint32_t keyOffset;  // 下一个 key 的偏移
+} RyanJsonPackedTableBuilder_t;
+
+/**
+ * @brief 累加一列数据所占字节（按 8 字节对齐），溢出返回 false
+ */
+static RyanJsonBool_e RyanJsonPackedAddColumnSize(size_t *dataBytes, uint8_t elemType, uint32_t count)
+{
+	size_t elemSize = RyanJsonPackedElemSize(elemType);
+	RyanJsonCheckReturnFalse(count <= (UINT32_MAX - 7U) / elemSize);
+
+	size_t columnBytes = RyanJsonPackedAlign8((size_t)count * elemSize);
+	RyanJsonCheckReturnFalse(*dataBytes <= UINT32_MAX - columnBytes);
+	*dataBytes += columnBytes;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 申请列存表数据块，之后按列顺序调用 RyanJsonPackedTableAddColumn 填写
+ *
+ * @param dataBytes 全部列数据字节数（RyanJsonPackedAddColumnSize 累加结果）
+ * @param keyBytes 全部 key 字节数（含各自的 '\0'）
+ */
+static RyanJsonBool_e RyanJsonPackedTableBegin(RyanJsonPackedTableBuilder_t *builder, uint32_t count, uint32_t colCount, size_t dataBytes,
+					       size_t keyBytes)
+{
+	RyanJsonCheckAssert(0 != colCount && colCount <= UINT8_MAX);
+
+	size_t dataStart = RyanJsonPackedDataOffset + RyanJsonPackedAlign8((size_t)colCount * sizeof(RyanJsonPackedColumn_t));
+	RyanJsonCheckReturnFalse(dataBytes <= UINT32_MAX - dataStart && keyBytes <= UINT32_MAX - dataStart - dataBytes);
+
+	uint32_t blockSize = (uint32_t)(dataStart + dataBytes + keyBytes);
+	RyanJsonPackedHead_t *head = (RyanJsonPackedHead_t *)jsonMalloc(blockSize);
+	RyanJsonCheckReturnFalse(NULL != head);
+	head->count = count;
+	head->blockSize = blockSize;
+	head->elemType = RyanJsonPackedTypeTable;
+	head->colCount = (uint8_t)colCount;
+
+	builder->head = head;
+	builder->col = 0;
+	builder->dataOffset = (uint32_t)dataStart;
+	builder->keyOffset = (uint32_t)(dataStart + dataBytes);
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 写入下一列的描述与 key
+ * @return uint8_t* 该列数据区起点，由调用方填写 count 个元素
+ */
+static uint8_t *RyanJsonPackedTableAddColumn(RyanJsonPackedTableBuilder_t *builder, const char *key, uint32_t keyLen, uint8_t elemType)
+{
+	RyanJsonPackedHead_t *head = builder->head;
+	RyanJsonCheckAssert(builder->col < head->colCount);
+
+	RyanJsonPackedColumn_t column = {
+		.dataOffset = builder->dataOffset,
+		.keyOffset = builder->keyOffset,
+		.keyLen = keyLen,
+		.elemType = elemType,
+	};
+	RyanJsonMemcpy(RyanJsonPackedData(head) + (size_t)builder->col * sizeof(RyanJsonPackedColumn_t), &column, sizeof(column));
+
+	uint8_t *keyBuf = (uint8_t *)head + builder->keyOffset;
+	if (0 != keyLen) { RyanJsonMemcpy(keyBuf, key, keyLen); }
+	keyBuf[keyLen] = '\0';
+
+	builder->col++;
+	builder->dataOffset += (uint32_t)RyanJsonPackedAlign8((size_t)head->count * RyanJsonPackedElemSize(elemType));
+	builder->keyOffset += keyLen + 1U;
+	return (uint8_t *)head + column.dataOffset;
+}
+
+/**
+ * @brief 读取列描述；一维数组视为单列、无 key
+ */
+static void RyanJsonPackedLoadColumn(const RyanJsonPackedHead_t *head, uint32_t col, RyanJsonPackedColumn_t *column)
+{
+	RyanJsonCheckAssert(col < RyanJsonInternalPackedColumnCount(head));
+
+	if (RyanJsonPackedIsTable(head))
+	{
+		RyanJsonMemcpy(column, RyanJsonPackedData(head) + (size_t)col * sizeof(RyanJsonPackedColumn_t), sizeof(*column));
+		return;
+	}
+
+	column->dataOffset = (uint32_t)RyanJsonPackedDataOffset;
+	column->keyOffset = 0;
+	column->keyLen = 0;
+	column->elemType = head->elemType;
+}
+
+RyanJsonInternalApi uint32_t RyanJsonInternalPackedColumnCount(const RyanJsonPackedHead_t *head)
+{
+	return RyanJsonPackedIsTable(head) ? head->colCount : 1U;
+}
+
+/**
+ * @brief 读取列 key（一维数组返回 NULL）
+ */
+RyanJsonInternalApi const char *RyanJsonInternalPackedColumnKey(const RyanJsonPackedHead_t *head, uint32_t col, uint32_t *keyLen)
+{
+	RyanJsonPackedColumn_t column;
+	RyanJsonPackedLoadColumn(head, col, &column);
+	*keyLen = column.keyLen;
+	return RyanJsonPackedIsTable(head) ? (const char *)head + column.keyOffset : NULL;
+}
+
+/**
+ * @brief 列元素是否按 Double 语义打印/比较/展开（float 与 double）
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalPackedColumnIsDouble(const RyanJsonPackedHead_t *head, uint32_t col)
+{
+	RyanJsonPackedColumn_t column;
+	RyanJsonPackedLoadColumn(head, col, &column);
+	return RyanJsonMakeBool(RyanJsonPackedTypeInt != column.elemType);
+}
+
+RyanJsonInternalApi int32_t RyanJsonInternalPackedGetInt(const RyanJsonPackedHead_t *head, uint32_t col, uint32_t row)
+{
+	RyanJsonPackedColumn_t column;
+	RyanJsonPackedLoadColumn(head, col, &column);
+	RyanJsonCheckAssert(RyanJsonPackedTypeInt == column.elemType && row < head->count);
+
+	int32_t intValue;
+	RyanJsonMemcpy(&intValue, (const uint8_t *)head + column.dataOffset + (size_t)row * sizeof(int32_t), sizeof(intValue));
+	return intValue;
+}
+
+RyanJsonInternalApi double RyanJsonInternalPackedGetDouble(const RyanJsonPackedHead_t *head, uint32_t col, uint32_t row)
+{
+	RyanJsonPackedColumn_t column;
+	RyanJsonPackedLoadColumn(head, col, &column);
+	RyanJsonCheckAssert(RyanJsonPackedTypeInt != column.elemType && row < head->count);
+
+	const uint8_t *data = (const uint8_t *)head + column.dataOffset;
+	if (RyanJsonPackedTypeFloat == column.elemType)
+	{
+		float floatValue;
+		RyanJsonMemcpy(&floatValue, data + (size_t)row * sizeof(float), sizeof(floatValue));
+		return (double)floatValue;
+	}
+
+	double doubleValue;
+	RyanJsonMemcpy(&doubleValue, data + (size_t)row * sizeof(double), sizeof(doubleValue));
+	return doubleValue;
+}
+
+/**
+ * @brief 按列类型创建单个 Number 节点
+ */
+static RyanJson_t RyanJsonPackedCreateNumber(const RyanJsonPackedHead_t *head, uint32_t col, uint32_t row, const char *key)
+{
+	if (RyanJsonInternalPackedColumnIsDouble(head, col))
+	{
+		return RyanJsonCreateDouble(key, RyanJsonInternalPackedGetDouble(head, col, row));
+	}
+	return RyanJsonCreateInt(key, RyanJsonInternalPackedGetInt(head, col, row));
+}
+
+/**
+ * @brief 创建第 row 个元素：一维数组为 Number 节点，列存表为同形 Object
+ */
+static RyanJson_t RyanJsonPackedCreateRow(const RyanJsonPackedHead_t *head, uint32_t row)
+{
+	if (!RyanJsonPackedIsTable(head)) { return RyanJsonPackedCreateNumber(head, 0, row, NULL); }
+
+	RyanJson_t rowItem = RyanJsonCreateObject();
+	RyanJsonCheckReturnNull(NULL != rowItem);
+
+	RyanJson_t lastField = NULL;
+	for (uint32_t col = 0; col < head->colCount; col++)
+	{
+		uint32_t keyLen;
+		const char *key = RyanJsonInternalPackedColumnKey(head, col, &keyLen);
+		RyanJson_t field = RyanJsonPackedCreateNumber(head, col, row, key);
+		RyanJsonCheckCode(NULL != field, {
+			RyanJsonDelete(rowItem);
+			return NULL;
+		});
+
+		RyanJsonInternalListInsertAfter(rowItem, lastField, field);
+		lastField = field;
+	}
+	return rowItem;
+}
+
+/**
+ * @brief 将紧凑数组（含列存表）展开为普通子节点链表
+ *
+ * @param pJson 紧凑 Array 节点
+ * @return RyanJsonBool_e 展开是否成功；失败时保持紧凑存储不变
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalPackedExpand(RyanJson_t pJson)
+{
+	RyanJsonCheckAssert(NULL != pJson && RyanJsonInternalIsPackedArray(pJson));
+
+	const RyanJsonPackedHead_t *head = RyanJsonInternalGetPacked(pJson);
+	RyanJson_t first = NULL;
+	RyanJson_t last = NULL;
+
+	// 先在链外建好全部节点，任一申请失败都能完整回滚
+	for (uint32_t row = 0; row < head->count; row++)
+	{
+		RyanJson_t item = RyanJsonPackedCreateRow(head, row);
+		RyanJsonCheckCode(NULL != item, { goto error__; });
+
+		if (NULL == last) { first = item; }
+		else
+		{
+			last->next = item;
+		}
+		last = item;
+	}
+
+	jsonFree(RyanJsonPackedDetach(pJson));
+	RyanJsonInternalChangeObjectValue(pJson, first);
+	last->next = pJson;
+	RyanJsonSetPayloadIsLastByFlag(last, 1);
+	return RyanJsonTrue;
+
+error__:
+	while (NULL != first)
+	{
+		RyanJson_t next = (first == last) ? NULL : first->next;
+		RyanJsonDelete(first);
+		first = next;
+	}
+	return RyanJsonFalse;
+}
+
+/**
+ * @brief 释放紧凑数组的数据块，pJson 恢复为空 Array
+ */
+RyanJsonInternalApi void RyanJsonInternalPackedFree(RyanJson_t pJson)
+{
+	jsonFree(RyanJsonPackedDetach(pJson));
+}
+
+/**
+ * @brief 将 src 的数据块转移给无子节点的 Array dst，src 变为空 Array
+ */
+RyanJsonInternalApi void RyanJsonInternalPackedMove(RyanJson_t dst, RyanJson_t src)
+{
+	RyanJsonCheckAssert(_checkType(dst, RyanJsonTypeArray) && NULL == RyanJsonGetObjectValue(dst));
+	RyanJsonPackedAttach(dst, RyanJsonPackedDetach(src));
+}
+
+/**
+ * @brief 为无子节点的 Array dst 复制 src 的数据块
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalPackedDuplicate(RyanJson_t dst, RyanJson_t src)
+{
+	const RyanJsonPackedHead_t *srcHead = RyanJsonInternalGetPacked(src);
+	RyanJsonPackedHead_t *head = (RyanJsonPackedHead_t *)jsonMalloc(srcHead->blockSize);
+	RyanJsonCheckReturnFalse(NULL != head);
+
+	// 数据块内只有偏移没有指针，整块拷贝即可
+	RyanJsonMemcpy(head, srcHead, srcHead->blockSize);
+	RyanJsonPackedAttach(dst, head);
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 比较用的数值快照
+ */
+typedef struct
+{
+	RyanJsonBool_e isDouble;
+	int32_t intValue;
+	double doubleValue;
+} RyanJsonPackedNumber_t;
+
+static void RyanJsonPackedLoadNumber(const RyanJsonPackedHead_t *head, uint32_t col, uint32_t row, RyanJsonPackedNumber_t *number)
+{
+	number->isDouble = RyanJsonInternalPackedColumnIsDouble(head, col);
+	if (number->isDouble) { number->doubleValue = RyanJsonInternalPackedGetDouble(head, col, row); }
+	else
+	{
+		number->intValue = RyanJsonInternalPackedGetInt(head, col, row);
+	}
+}
+
+static void RyanJsonPackedLoadNode(RyanJson_t item, RyanJsonPackedNumber_t *number)
+{
+	RyanJsonBool_e isInt;
+	double value = RyanJsonInternalGetNumber(item, &isInt);
+	number->isDouble = RyanJsonMakeBool(!isInt);
+	if (number->isDouble) { number->doubleValue = value; }
+	else
+	{
+		number->intValue = (int32_t)value;
+	}
+}
+
+/**
+ * @brief 语义与普通 Number 节点比较一致：值比较时 Int/Double 种类需一致
+ */
+static RyanJsonBool_e RyanJsonPackedNumberEq(const RyanJsonPackedNumber_t *left, const RyanJsonPackedNumber_t *right,
+					     RyanJsonBool_e fullCompare)
+{
+	if (!fullCompare) { return RyanJsonTrue; }
+	RyanJsonCheckReturnFalse(left->isDouble == right->isDouble);
+	if (left->isDouble) { return RyanJsonCompareDouble(left->doubleValue, right->doubleValue); }
+	return RyanJsonMakeBool(left->intValue == right->intValue);
+}
 
-	if (RyanJsonTypeNumber == info->type)
+/**
+ * @brief 在列存表中按 key 查找列，未找到返回 UINT32_MAX
+ */
+static uint32_t RyanJsonPackedFindColumn(const RyanJsonPackedHead_t *head, const char *key, uint32_t keyLen)
+{
+	for (uint32_t col = 0; col < head->colCount; col++)
 	{
-		if (RyanJsonFalse == info->numberIsDoubleFlag) { size += sizeof(int32_t); }
-		else
-		{
-			size += sizeof(double);
-		}
+		uint32_t colKeyLen;
+		const char *colKey = RyanJsonInternalPackedColumnKey(head, col, &colKeyLen);
+		if (colKeyLen == keyLen && 0 == RyanJsonMemcmp(colKey, key, keyLen)) { return col; }
 	}
-	else if (RyanJsonTypeArray == info->type || RyanJsonTypeObject == info->type) { size += sizeof(RyanJson_t); }
+	return UINT32_MAX;
+}
 
-	// 是否内联字符串
-	if (NULL != info->key || RyanJsonTypeString == info->type) { size += RyanJsonInlineStringSize; }
+/**
+ * @brief 逐元素比较两个 Array（至少一侧为紧凑数组）
+ *
+ * @param leftJson 左侧 Array
+ * @param rightJson 右侧 Array
+ * @param fullCompare RyanJsonTrue 比较值，RyanJsonFalse 仅比较结构与 key
+ * @return RyanJsonBool_e 是否相等
+ * @note 语义与普通 Array 一致：列存表的行按 Object 语义（同 key 对齐、与顺序无关）比较。
+ */
+RyanJsonInternalApi RyanJsonBool_e RyanJsonInternalPackedCompare(RyanJson_t leftJson, RyanJson_t rightJson, RyanJsonBool_e fullCompare)
+{
+	// 统一让左侧为紧凑数组
+	if (!RyanJsonInternalIsPackedArray(leftJson))
+	{
+		RyanJson_t tmp = leftJson;
+		leftJson = rightJson;
+		rightJson = tmp;
+	}
 
-	RyanJson_t pJson = (RyanJson_t)jsonMalloc((size_t)size);
-	RyanJsonCheckReturnNull(NULL != pJson);
+	const RyanJsonPackedHead_t *left = RyanJsonInternalGetPacked(leftJson);
+	uint32_t colCount = RyanJsonInternalPackedColumnCount(left);
+	RyanJsonBool_e isTable = RyanJsonMakeBool(RyanJsonPackedIsTable(left));
+	RyanJsonPackedNumber_t leftNumber;
+	RyanJsonPackedNumber_t rightNumber;
 
-	// 节点体积较小，直接整块清零即可
-	RyanJsonMemset(pJson, 0, size);
+	// 两侧都紧凑：按列比较，每列只查找一次对应列
+	if (RyanJsonInternalIsPackedArray(rightJson))
+	{
+		const RyanJsonPackedHead_t *right = RyanJsonInternalGetPacked(rightJson);
+		RyanJsonCheckReturnFalse(left->count == right->count && isTable == RyanJsonPackedIsTable(right) &&
+					 colCount == RyanJsonInternalPackedColumnCount(right));
 
-	RyanJsonSetType(pJson, info->type);
+		for (uint32_t col = 0; col < colCount; col++)
+		{
+			uint32_t rightCol = col;
+			if (isTable)
+			{
+				uint32_t keyLen;
+				const char *key = RyanJsonInternalPackedColumnKey(left, col, &keyLen);
+				rightCol = RyanJsonPackedFindColumn(right, key, keyLen);
+				RyanJsonCheckReturnFalse(UINT32_MAX != rightCol);
+			}
+
+			for (uint32_t row = 0; row < left->count; row++)
+			{
+				RyanJsonPackedLoadNumber(left, col, row, &leftNumber);
+				RyanJsonPackedLoadNumber(right, rightCol, row, &rightNumber);
+				RyanJsonCheckReturnFalse(RyanJsonPackedNumberEq(&leftNumber, &rightNumber, fullCompare));
+			}
+		}
+		return RyanJsonTrue;
+	}
 
-	// 设置 key 和 value
-	RyanJsonCheckCode(RyanJsonTrue == RyanJsonInternalChangeString(pJson, RyanJsonTrue, info->key, info->strValue), {
-		jsonFree(pJson);
-		return NULL;
-	});
+	// 右侧为普通 Array：按行比较
+	RyanJson_t rightRow = RyanJsonGetObjectValue(rightJson);
+	for (uint32_t row = 0; row < left->count; row++)
+	{
+		RyanJsonCheckReturnFalse(NULL != rightRow);
+		if (isTable) { RyanJsonCheckReturnFalse(RyanJsonIsObject(rightRow) && colCount == RyanJsonGetSize(rightRow)); }
 
-	// 设置 Bool / Number
-	if (RyanJsonTypeBool == info->type) { RyanJsonSetPayloadBoolValueByFlag(pJson, info->boolIsTrueFlag); }
-	else if (RyanJsonTypeNumber == info->type) { RyanJsonSetPayloadNumberIsDoubleByFlag(pJson, info->numberIsDoubleFlag); }
+		for (uint32_t col = 0; col < colCount; col++)
+		{
+			RyanJson_t rightItem = rightRow;
+			if (isTable)
+			{
+				uint32_t keyLen;
+				const char *key = RyanJsonInternalPackedColumnKey(left, col, &keyLen);
+				rightItem = RyanJsonGetObjectByKeyLen(rightRow, key, keyLen);
+			}
+			RyanJsonCheckReturnFalse(NULL != rightItem && RyanJsonTrue == RyanJsonIsNumber(rightItem));
+
+			RyanJsonPackedLoadNumber(left, col, row, &leftNumber);
+			RyanJsonPackedLoadNode(rightItem, &rightNumber);
+			RyanJsonCheckReturnFalse(RyanJsonPackedNumberEq(&leftNumber, &rightNumber, fullCompare));
+		}
+		rightRow = RyanJsonGetNext(rightRow);
+	}
 
-	return pJson;
+	return RyanJsonMakeBool(NULL == rightRow);
 }
 
 /**
- * @brief 在父节点中插入子节点（维护线索化链表）
+ * @brief 计算紧凑数组的子树哈希（未做最终混合），结果与展开后的普通 Array 一致
  *
- * @param parent 父节点（Object 或 Array）
- * @param prev 前驱兄弟节点，为 NULL 表示头插
- * @param item 待插入节点
- * @note 要求 parent 为容器节点且 item 为游离节点。
+ * @param pJson 紧凑数组
+ * @param hasDouble 输出是否含 Double 元素
+ * @return uint32_t 子树哈希
  */
-RyanJsonInternalApi void RyanJsonInternalListInsertAfter(RyanJson_t parent, RyanJson_t prev, RyanJson_t item)
+RyanJsonInternalApi uint32_t RyanJsonInternalPackedHash(RyanJson_t pJson, RyanJsonBool_e *hasDouble)
 {
-	RyanJson_t nextItem;
+	const RyanJsonPackedHead_t *head = RyanJsonInternalGetPacked(pJson);
+	uint32_t colCount = RyanJsonInternalPackedColumnCount(head);
+	RyanJsonBool_e isTable = RyanJsonMakeBool(RyanJsonPackedIsTable(head));
+	RyanJsonPackedNumber_t number;
 
-	if (prev)
+	*hasDouble = RyanJsonFalse;
+	for (uint32_t col = 0; col < colCount; col++)
 	{
-		// 若 prev 原本是尾节点，则 prev->next 指向 parent，此时 nextItem 应视为 NULL
-		// 通过 IsLast 标志区分“下一个兄弟节点”与“父节点线索”。
-		if (RyanJsonGetPayloadIsLastByFlag(prev)) { nextItem = NULL; }
-		else
-		{
-			nextItem = prev->next;
-		}
+		if (RyanJsonInternalPackedColumnIsDouble(head, col)) { *hasDouble = RyanJsonTrue; }
 	}
-	else
+
+	// 从最后一个元素往前，元素权重依次为 B、B*A、B*A^2 ...；按列累加，每列的 key 权重只计算一次
+	uint32_t hash = RyanJsonInternalHashTag(RyanJsonTypeArray);
+	for (uint32_t col = 0; col < colCount; col++)
 	{
-		// 插入到头部，RyanJsonNode 结构保证了 Object 和 Array 的 Value 指针位置一致
-		nextItem = RyanJsonGetObjectValue(parent);
+		uint32_t colHash = 0;
+		uint32_t weight = RyanJsonHashArrayLast;
+		for (uint32_t row = head->count; row-- > 0;)
+		{
+			RyanJsonPackedLoadNumber(head, col, row, &number);
+			colHash += weight * (number.isDouble ? RyanJsonInternalHashDouble(number.doubleValue)
+							     : RyanJsonInternalHashInt(number.intValue));
+			weight *= RyanJsonHashArrayStep;
+		}
+
+		if (isTable)
+		{
+			uint32_t keyLen;
+			const char *key = RyanJsonInternalPackedColumnKey(head, col, &keyLen);
+			colHash *= RyanJsonInternalHashKeyWeight(key, keyLen);
+		}
+		hash += colHash;
 	}
 
-	// 先链接 prev -> item
-	if (prev)
+	// 列存表每行自身还带一个 Object 标签，按全部行权重之和累加一次
+	if (isTable)
 	{
-		prev->next = item;
-		// prev 不再是最后一个，取消 IsLast 标记
-		RyanJsonSetPayloadIsLastByFlag(prev, 0);
+		uint32_t weightSum = 0;
+		uint32_t weight = RyanJsonHashArrayLast;
+		for (uint32_t row = 0; row < head->count; row++)
+		{
+			weightSum += weight;
+			weight *= RyanJsonHashArrayStep;
+		}
+		hash += weightSum * RyanJsonInternalHashTag(RyanJsonTypeObject);
 	}
-	else
+	return hash;
+}
+
+/**
+ * @brief 删除已拷贝进数据块的全部子节点，并挂载数据块
+ */
+static void RyanJsonPackedReplaceChildren(RyanJson_t pJson, RyanJsonPackedHead_t *head)
+{
+	RyanJson_t item = RyanJsonGetObjectValue(pJson);
+	while (NULL != item)
 	{
-		// 只有 item 一个子节点，或者 item 是新的头部
-		RyanJsonInternalChangeObjectValue(parent, item);
+		RyanJson_t next = RyanJsonGetNext(item);
+		item->next = NULL;
+		RyanJsonDelete(item);
+		item = next;
 	}
 
-	// 再链接 item -> nextItem（或 Parent）
-	if (nextItem)
+	RyanJsonInternalChangeObjectValue(pJson, NULL);
+	RyanJsonPackedAttach(pJson, head);
+}
+
+/**
+ * @brief 子节点全为 Int（或全为 Double）时转为一维紧凑数组
+ */
+static void RyanJsonPackedTryPackNumbers(RyanJson_t pJson, RyanJson_t first, uint32_t minCount)
+{
+	RyanJsonBool_e isDouble = RyanJsonIsDouble(first);
+	uint32_t count = 0;
+	for (RyanJson_t item = first; NULL != item; item = RyanJsonGetNext(item))
 	{
-		// 不是最后一个节点，item->next 指向下一个兄弟
-		item->next = nextItem;
-		RyanJsonSetPayloadIsLastByFlag(item, 0);
+		if (!RyanJsonIsNumber(item) || isDouble != RyanJsonIsDouble(item)) { return; }
+		count++;
 	}
-	else
+	if (count < minCount) { return; }
+
+	uint8_t elemType = isDouble ? RyanJsonPackedTypeDouble : RyanJsonPackedTypeInt;
+	RyanJsonPackedHead_t *head = RyanJsonPackedAlloc(elemType, count);
+	if (NULL == head) { return; }
+
+	// Int/Double 节点 value 区与紧凑元素同宽，直接逐个拷贝
+	size_t elemSize = RyanJsonPackedElemSize(elemType);
+	uint8_t *data = RyanJsonPackedData(head);
+	for (RyanJson_t item = first; NULL != item; item = RyanJsonGetNext(item))
 	{
-		// 是最后一个节点，item->next 指向 Parent (线索化)
-		item->next = parent;
-		RyanJsonSetPayloadIsLastByFlag(item, 1);
+		RyanJsonMemcpy(data, RyanJsonInternalGetValue(item), elemSize);
+		data += elemSize;
 	}
+
+	RyanJsonPackedReplaceChildren(pJson, head);
 }
 
 /**
- * @brief 获取同层下一个兄弟节点
- *
- * @param pJson 当前节点
- * @return RyanJson_t 下一个兄弟节点；若当前为最后节点返回 NULL
+ * @brief 子节点全为同形 Object 时转为列存表
+ * @note 同形指：成员全为 Number、key 顺序相同且互不重复、同列 Int/Double 种类一致。
  */
-RyanJson_t RyanJsonGetNext(RyanJson_t pJson)
+static void RyanJsonPackedTryPackTable(RyanJson_t pJson, RyanJson_t first, uint32_t minCount)
 {
-	RyanJsonCheckAssert(NULL != pJson);
+	// 以首行确定表结构
+	uint32_t colCount = 0;
+	size_t keyBytes = 0;
+	for (RyanJson_t field = RyanJsonGetObjectValue(first); NULL != field; field = RyanJsonGetNext(field))
+	{
+		if (!RyanJsonIsNumber(field) || colCount >= RyanJsonPackedTableParseMaxColumns) { return; }
 
-	// 尾节点（Bit7=1）的 next 保存的是父节点线索，对外应返回 NULL
-	if (RyanJsonGetPayloadIsLastByFlag(pJson)) { return NULL; }
-	return pJson->next;
+		// key 含 '\0' 时无法按 C 字符串展开还原
+		uint32_t keyLen = RyanJsonInternalGetKeyLen(field);
+		if (keyLen != RyanJsonStrlen(RyanJsonGetKey(field))) { return; }
+		for (RyanJson_t prev = RyanJsonGetObjectValue(first); prev != field; prev = RyanJsonGetNext(prev))
+		{
+			if (RyanJsonTrue == RyanJsonInternalKeyEqNode(prev, field)) { return; }
+		}
+
+		colCount++;
+		keyBytes += (size_t)keyLen + 1U;
+	}
+	if (0 == colCount) { return; }
+
+	// 其余行须与首行同形
+	uint32_t count = 0;
+	for (RyanJson_t row = first; NULL != row; row = RyanJsonGetNext(row))
+	{
+		if (!RyanJsonIsObject(row)) { return; }
+#if true == RyanJsonContainerExtEnable
+		if (NULL != RyanJsonInternalGetContainerExt(row)) { return; }
+#endif
+
+		RyanJson_t expect = RyanJsonGetObjectValue(first);
+		for (RyanJson_t field = RyanJsonGetObjectValue(row); NULL != field; field = RyanJsonGetNext(field))
+		{
+			if (NULL == expect || !RyanJsonIsNumber(field) || RyanJsonIsDouble(field) != RyanJsonIsDouble(expect) ||
+			    RyanJsonTrue != RyanJsonInternalKeyEqNode(field, expect))
+			{
+				return;
+			}
+			expect = RyanJsonGetNext(expect);
+		}
+		if (NULL != expect) { return; }
+		count++;
+	}
+	if (count < minCount) { return; }
+
+	size_t dataBytes = 0;
+	for (RyanJson_t field = RyanJsonGetObjectValue(first); NULL != field; field = RyanJsonGetNext(field))
+	{
+		uint8_t elemType = RyanJsonIsDouble(field) ? RyanJsonPackedTypeDouble : RyanJsonPackedTypeInt;
+		if (RyanJsonTrue != RyanJsonPackedAddColumnSize(&dataBytes, elemType, count)) { return; }
+	}
+
+	RyanJsonPackedTableBuilder_t builder;
+	if (RyanJsonTrue != RyanJsonPackedTableBegin(&builder, count, colCount, dataBytes, keyBytes)) { return; }
+
+	// 逐列拷贝：列内元素与节点 value 区同宽
+	uint32_t col = 0;
+	for (RyanJson_t field = RyanJsonGetObjectValue(first); NULL != field; field = RyanJsonGetNext(field), col++)
+	{
+		uint8_t elemType = RyanJsonIsDouble(field) ? RyanJsonPackedTypeDouble : RyanJsonPackedTypeInt;
+		size_t elemSize = RyanJsonPackedElemSize(elemType);
+		uint8_t *data = RyanJsonPackedTableAddColumn(&builder, RyanJsonGetKey(field), RyanJsonInternalGetKeyLen(field), elemType);
+
+		for (RyanJson_t row = first; NULL != row; row = RyanJsonGetNext(row))
+		{
+			RyanJson_t cell = RyanJsonGetObjectValue(row);
+			for (uint32_t i = 0; i < col; i++)
+			{
+				cell = RyanJsonGetNext(cell);
+			}
+			RyanJsonMemcpy(data, RyanJsonInternalGetValue(cell), elemSize);
+			data += elemSize;
+		}
+	}
+
+	RyanJsonPackedReplaceChildren(pJson, builder.head);
 }
 
 /**
- * @brief 获取当前节点的父节点
- *
- * @param pJson 当前节点
- * @return RyanJson_t 父节点
+ * @brief 刚闭合的 Array 满足条件时转为紧凑存储（一维数组或列存表）
+ * @note 仅用于刚构建完成、尚无扩展信息的 Array；不满足条件或申请失败时保持原样。
  */
-RyanJsonInternalApi RyanJson_t RyanJsonInternalGetParent(RyanJson_t pJson)
+RyanJsonInternalApi void RyanJsonInternalPackedTryPack(RyanJson_t pJson, uint32_t minCount)
 {
-	RyanJsonCheckAssert(NULL != pJson);
+	RyanJsonCheckAssert(NULL != pJson && _checkType(pJson, RyanJsonTypeArray));
 
-	RyanJson_t curr = pJson;
-	RyanJson_t next = RyanJsonGetNext(curr);
+	RyanJson_t first = RyanJsonGetObjectValue(pJson);
+	if (NULL == first) { return; }
+#if true == RyanJsonContainerExtEnable
+	if (NULL != RyanJsonInternalGetContainerExt(pJson)) { return; }
+#endif
 
-	// 沿着兄弟链表一直走到该层级的最后一个节点
-	while (NULL != next)
+	if (RyanJsonIsNumber(first)) { RyanJsonPackedTryPackNumbers(pJson, first, minCount); }
+	else if (RyanJsonIsObject(first) && 0U != RyanJsonPackedTableParseMaxColumns)
 	{
-		curr = next;
-		next = RyanJsonGetNext(curr);
+		RyanJsonPackedTryPackTable(pJson, first, minCount);
 	}
-
-	// 此时 curr 是当前层级的最后一个节点，其 next 指针存放的就是父节点
-	return curr->next;
 }
+#endif
 
 /**
  * @brief 按多级 key 路径获取节点
@@ -515,6 +2874,19 @@ RyanJson_t RyanJsonGetObjectByIndexs(RyanJson_t pJson, uint32_t index, ...)
 	return nextItem;
 }
 
+/**
+ * @brief typed array 构造时按 RyanJsonAddPosition 语义添加元素
+ * @note 尾插借助追加器记录尾节点，头插本身即为 O(1)，整体构造均为 O(N)。
+ */
+static RyanJsonBool_e RyanJsonTypedArrayAdd(RyanJsonAppender_t *appender, RyanJson_t item)
+{
+#if true == RyanJsonDefaultAddAtHead
+	return RyanJsonInsert(appender->container, 0, item);
+#else
+	return RyanJsonAppenderAdd(appender, item);
+#endif
+}
+
 /**
  * @brief 创建 int32_t Array 节点
  *
@@ -528,9 +2900,12 @@ RyanJson_t RyanJsonCreateIntArray(const int32_t *numbers, uint32_t count)
 
 	RyanJson_t pJson = RyanJsonCreateArray();
 	RyanJsonCheckReturnNull(NULL != pJson);
+
+	RyanJsonAppender_t appender;
+	(void)RyanJsonAppenderInit(&appender, pJson);
 	for (uint32_t i = 0; i < count; i++)
 	{
-		RyanJsonCheckCode(RyanJsonTrue == RyanJsonAddIntToArray(pJson, numbers[i]), {
+		RyanJsonCheckCode(RyanJsonTrue == RyanJsonTypedArrayAdd(&appender, RyanJsonCreateInt(NULL, numbers[i])), {
 			RyanJsonDelete(pJson);
 			return NULL;
 		});
@@ -551,9 +2926,12 @@ RyanJson_t RyanJsonCreateDoubleArray(const double *numbers, uint32_t count)
 
 	RyanJson_t pJson = RyanJsonCreateArray();
 	RyanJsonCheckReturnNull(NULL != pJson);
+
+	RyanJsonAppender_t appender;
+	(void)RyanJsonAppenderInit(&appender, pJson);
 	for (uint32_t i = 0; i < count; i++)
 	{
-		RyanJsonCheckCode(RyanJsonTrue == RyanJsonAddDoubleToArray(pJson, numbers[i]), {
+		RyanJsonCheckCode(RyanJsonTrue == RyanJsonTypedArrayAdd(&appender, RyanJsonCreateDouble(NULL, numbers[i])), {
 			RyanJsonDelete(pJson);
 			return NULL;
 		});
@@ -574,12 +2952,200 @@ RyanJson_t RyanJsonCreateStringArray(const char **strings, uint32_t count)
 
 	RyanJson_t pJson = RyanJsonCreateArray();
 	RyanJsonCheckReturnNull(NULL != pJson);
+
+	RyanJsonAppender_t appender;
+	(void)RyanJsonAppenderInit(&appender, pJson);
 	for (uint32_t i = 0; i < count; i++)
 	{
-		RyanJsonCheckCode(RyanJsonTrue == RyanJsonAddStringToArray(pJson, strings[i]), {
+		RyanJsonCheckCode(RyanJsonTrue == RyanJsonTypedArrayAdd(&appender, RyanJsonCreateString(NULL, strings[i])), {
 			RyanJsonDelete(pJson);
 			return NULL;
 		});
 	}
 	return pJson;
 }
+
+#if true == RyanJsonPackedArray
+/**
+ * @brief 以连续数据创建紧凑 Array
+ * @note count 为 0 时返回普通空 Array。
+ */
+static RyanJson_t RyanJsonCreatePackedArray(const void *numbers, uint32_t count, uint8_t elemType)
+{
+	RyanJsonCheckReturnNull(NULL != numbers);
+
+	RyanJson_t pJson = RyanJsonCreateArray();
+	RyanJsonCheckReturnNull(NULL != pJson);
+	if (0 == count) { return pJson; }
+
+	RyanJsonPackedHead_t *head = RyanJsonPackedAlloc(elemType, count);
+	RyanJsonCheckCode(NULL != head, {
+		RyanJsonDelete(pJson);
+		return NULL;
+	});
+	RyanJsonMemcpy(RyanJsonPackedData(head), numbers, (size_t)count * RyanJsonPackedElemSize(elemType));
+	RyanJsonPackedAttach(pJson, head);
+	return pJson;
+}
+
+/**
+ * @brief 创建 int32_t 紧凑 Array 节点
+ *
+ * @param numbers 输入数组
+ * @param count 元素个数
+ * @return RyanJson_t 新建 Array 节点，失败返回 NULL
+ * @note 元素顺序与 numbers 一致，不受 RyanJsonDefaultAddAtHead 影响。
+ */
+RyanJson_t RyanJsonCreatePackedIntArray(const int32_t *numbers, uint32_t count)
+{
+	return RyanJsonCreatePackedArray(numbers, count, RyanJsonPackedTypeInt);
+}
+
+/**
+ * @brief 创建 float 紧凑 Array 节点（每个元素 4 字节，按 Double 输出）
+ *
+ * @param numbers 输入数组
+ * @param count 元素个数
+ * @return RyanJson_t 新建 Array 节点，失败返回 NULL
+ */
+RyanJson_t RyanJsonCreatePackedFloatArray(const float *numbers, uint32_t count)
+{
+	return RyanJsonCreatePackedArray(numbers, count, RyanJsonPackedTypeFloat);
+}
+
+/**
+ * @brief 创建 double 紧凑 Array 节点
+ *
+ * @param numbers 输入数组
+ * @param count 元素个数
+ * @return RyanJson_t 新建 Array 节点，失败返回 NULL
+ */
+RyanJson_t RyanJsonCreatePackedDoubleArray(const double *numbers, uint32_t count)
+{
+	return RyanJsonCreatePackedArray(numbers, count, RyanJsonPackedTypeDouble);
+}
+
+RyanJsonBool_e RyanJsonIsPackedArray(RyanJson_t pJson)
+{
+	return RyanJsonMakeBool(NULL != pJson && RyanJsonInternalIsPackedArray(pJson));
+}
+
+/**
+ * @brief 获取紧凑 Array 的连续数据
+ *
+ * @param pJson Array 节点
+ * @param elemType 输出元素类型，可为 NULL
+ * @param count 输出元素个数，可为 NULL
+ * @return const void* 首元素地址（按 8 字节对齐），pJson 不是一维紧凑 Array（含列存表）时返回 NULL
+ * @note 返回地址在 Array 被展开、修改或释放前有效。
+ */
+const void *RyanJsonGetPackedArrayData(RyanJson_t pJson, RyanJsonPackedType_e *elemType, uint32_t *count)
+{
+	RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonIsPackedArray(pJson));
+
+	const RyanJsonPackedHead_t *head = RyanJsonInternalGetPacked(pJson);
+	RyanJsonCheckReturnNull(!RyanJsonPackedIsTable(head));
+	if (NULL != elemType) { *elemType = (RyanJsonPackedType_e)head->elemType; }
+	if (NULL != count) { *count = head->count; }
+	return RyanJsonPackedData(head);
+}
+
+/**
+ * @brief 以列数据创建列存表（每行是一个同形 Object 的紧凑 Array）
+ *
+ * @param keys 各列 key，互不重复
+ * @param types 各列元素类型
+ * @param columns 各列数据起点，第 i 列按 types[i] 连续存放 rowCount 个元素
+ * @param colCount 列数，1 ~ 255
+ * @param rowCount 行数
+ * @return RyanJson_t 新建 Array 节点，失败返回 NULL
+ * @note 等价于 [{"k0":c0[0],"k1":c1[0],...}, ...]；key 在整表只存一份，每个数值只占 4/8 字节。
+ * @note rowCount 为 0 时返回普通空 Array。
+ */
+RyanJson_t RyanJsonCreatePackedTable(const char *const *keys, const RyanJsonPackedType_e *types, const void *const *columns,
+				     uint32_t colCount, uint32_t rowCount)
+{
+	RyanJsonCheckReturnNull(NULL != keys && NULL != types && NULL != columns);
+	RyanJsonCheckReturnNull(0 != colCount && colCount <= UINT8_MAX);
+
+	size_t dataBytes = 0;
+	size_t keyBytes = 0;
+	for (uint32_t col = 0; col < colCount; col++)
+	{
+		RyanJsonCheckReturnNull(NULL != keys[col] && NULL != columns[col]);
+		RyanJsonCheckReturnNull(RyanJsonPackedTypeInt == types[col] || RyanJsonPackedTypeFloat == types[col] ||
+					RyanJsonPackedTypeDouble == types[col]);
+		for (uint32_t prev = 0; prev < col; prev++)
+		{
+			RyanJsonCheckReturnNull(0 != RyanJsonStrcmp(keys[prev], keys[col]));
+		}
+
+		RyanJsonCheckReturnNull(RyanJsonTrue == RyanJsonPackedAddColumnSize(&dataBytes, (uint8_t)types[col], rowCount));
+		keyBytes += RyanJsonStrlen(keys[col]) + 1U;
+	}
+
+	RyanJson_t pJson = RyanJsonCreateArray();
+	RyanJsonCheckReturnNull(NULL != pJson);
+	if (0 == rowCount) { return pJson; }
+
+	RyanJsonPackedTableBuilder_t builder;
+	RyanJsonCheckCode(RyanJsonTrue == RyanJsonPackedTableBegin(&builder, rowCount, colCount, dataBytes, keyBytes), {
+		RyanJsonDelete(pJson);
+		return NULL;
+	});
+	for (uint32_t col = 0; col < colCount; col++)
+	{
+		uint8_t elemType = (uint8_t)types[col];
+		uint8_t *data = RyanJsonPackedTableAddColumn(&builder, keys[col], (uint32_t)RyanJsonStrlen(keys[col]), elemType);
+		RyanJsonMemcpy(data, columns[col], (size_t)rowCount * RyanJsonPackedElemSize(elemType));
+	}
+
+	RyanJsonPackedAttach(pJson, builder.head);
+	return pJson;
+}
+
+RyanJsonBool_e RyanJsonIsPackedTable(RyanJson_t pJson)
+{
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonIsPackedArray(pJson));
+	return RyanJsonMakeBool(RyanJsonPackedIsTable(RyanJsonInternalGetPacked(pJson)));
+}
+
+/**
+ * @brief 获取列存表中某一列的连续数据
+ *
+ * @param pJson 列存表 Array 节点
+ * @param key 列 key
+ * @param elemType 输出元素类型，可为 NULL
+ * @param count 输出元素（行）个数，可为 NULL
+ * @return const void* 该列首元素地址（按 8 字节对齐），不是列存表或列不存在时返回 NULL
+ * @note 返回地址在 Array 被展开、修改或释放前有效。
+ */
+const void *RyanJsonGetPackedTableColumn(RyanJson_t pJson, const char *key, RyanJsonPackedType_e *elemType, uint32_t *count)
+{
+	RyanJsonCheckReturnNull(NULL != key && RyanJsonTrue == RyanJsonIsPackedTable(pJson));
+
+	const RyanJsonPackedHead_t *head = RyanJsonInternalGetPacked(pJson);
+	uint32_t col = RyanJsonPackedFindColumn(head, key, (uint32_t)RyanJsonStrlen(key));
+	RyanJsonCheckReturnNull(UINT32_MAX != col);
+
+	RyanJsonPackedColumn_t column;
+	RyanJsonPackedLoadColumn(head, col, &column);
+	if (NULL != elemType) { *elemType = (RyanJsonPackedType_e)column.elemType; }
+	if (NULL != count) { *count = head->count; }
+	return (const uint8_t *)head + column.dataOffset;
+}
+
+/**
+ * @brief 将紧凑 Array 展开为普通 Array
+ *
+ * @param pJson Array 节点
+ * @return RyanJsonBool_e 展开成功或本就是普通 Array 时返回 true，参数非法或内存不足返回 false
+ * @note 需要子节点的接口会自动展开，显式调用可提前暴露内存不足。
+ */
+RyanJsonBool_e RyanJsonExpandPackedArray(RyanJson_t pJson)
+{
+	RyanJsonCheckReturnFalse(RyanJsonTrue == RyanJsonIsArray(pJson));
+	if (!RyanJsonInternalIsPackedArray(pJson)) { return RyanJsonTrue; }
+	return RyanJsonInternalPackedExpand(pJson);
+}
+#endif
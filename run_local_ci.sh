@@ -3,7 +3,8 @@ set -euo pipefail
 
 # 本地一键 CI（模拟 ci-pr）。
 # 执行顺序：
-#   先跑 full 单元矩阵（8 组），再跑 quick fuzz（1 组默认语义）。
+#   先跑 full 单元矩阵（8 组），再跑 quick fuzz（1 组默认语义），
+#   最后打开全部 8 个可选特性宏，在同一组默认语义下各补跑一次单元测试与 quick fuzz。
 # 默认参数与 ci-pr.yml 对齐：
 #   unit: UNIT_MODE=full, UNIT_SKIP_COV=1
 #   fuzz: FUZZ_MODE=quick, FUZZ_SKIP_COV=1, FUZZ_MAX_TOTAL_TIME=45, workers/jobs=2
@@ -16,13 +17,6 @@ repoRoot="$(ryanjson_repo_root_from_source "${BASH_SOURCE[0]}" 0)"
 cd "${repoRoot}"
 
 main() {
-	ryanjson_print_banner_begin "本地 CI 启动：阶段 1/2 -> Base 单元测试"
-	ryanjson_print_banner_end
-	bash ./run_local_base.sh
-
-	ryanjson_print_banner_begin "本地 CI 启动：阶段 2/2 -> Fuzz quick"
-	ryanjson_print_banner_end
-
 	: "${RYANJSON_STRICT_OBJECT_KEY_CHECK:=false}"
 	: "${RYANJSON_DEFAULT_ADD_AT_HEAD:=true}"
 	: "${RYANJSON_SNPRINTF_SUPPORT_SCIENTIFIC:=true}"
@@ -34,6 +28,13 @@ main() {
 	: "${FUZZ_JOBS:=2}"
 	: "${XMAKE_FORCE_CLEAN:=0}"
 
+	ryanjson_print_banner_begin "本地 CI 启动：阶段 1/4 -> Base 单元测试"
+	ryanjson_print_banner_end
+	bash ./run_local_base.sh
+
+	ryanjson_print_banner_begin "本地 CI 启动：阶段 2/4 -> Fuzz quick"
+	ryanjson_print_banner_end
+
 	export RYANJSON_STRICT_OBJECT_KEY_CHECK
 	export RYANJSON_DEFAULT_ADD_AT_HEAD
 	export RYANJSON_SNPRINTF_SUPPORT_SCIENTIFIC
@@ -41,6 +42,18 @@ main() {
 	export XMAKE_FORCE_CLEAN
 	bash ./run_local_fuzz.sh
 
+	# 可选特性宏只影响内部数据结构，语义矩阵沿用阶段 2 的默认组合即可
+	ryanjson_export_feature_macros true
+
+	ryanjson_print_banner_begin "本地 CI 启动：阶段 3/4 -> Base 单元测试（全部可选特性）"
+	ryanjson_print_banner_end
+	UNIT_SINGLE_CASE="${RYANJSON_STRICT_OBJECT_KEY_CHECK} ${RYANJSON_DEFAULT_ADD_AT_HEAD} ${RYANJSON_SNPRINTF_SUPPORT_SCIENTIFIC}" \
+		bash ./run_local_base.sh
+
+	ryanjson_print_banner_begin "本地 CI 启动：阶段 4/4 -> Fuzz quick（全部可选特性）"
+	ryanjson_print_banner_end
+	bash ./run_local_fuzz.sh
+
 	ryanjson_print_banner_begin "本地 CI 执行完成"
 	ryanjson_print_banner_end
 }
@@ -265,6 +265,20 @@ ryanjson_print_semantic_kv() {
   ryanjson_print_banner_kv "RyanJsonSnprintfSupportScientific" "${scientific}"
 }
 
+ryanjson_export_feature_macros() {
+  # 统一导出 8 个可选特性宏（同值：true 即全特性组合）
+  local enabled="$1"
+
+  export RYANJSON_PRINT_CACHE="${enabled}"
+  export RYANJSON_DELTA_TRACKING="${enabled}"
+  export RYANJSON_OBJECT_HASH_INDEX="${enabled}"
+  export RYANJSON_ARRAY_INDEX="${enabled}"
+  export RYANJSON_PACKED_ARRAY="${enabled}"
+  export RYANJSON_STRING_INTERN="${enabled}"
+  export RYANJSON_HASH_CACHE="${enabled}"
+  export RYANJSON_SNAPSHOT_SHARE="${enabled}"
+}
+
 ryanjson_semantic_log_error() {
   # 语义矩阵输出错误提示
   ryanjson_log_error "$@"
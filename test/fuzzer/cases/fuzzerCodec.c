@@ -0,0 +1,83 @@
+#include "RyanJson.h"
+#include "RyanJsonFuzzer.h"
+
+/**
+ * @brief 对单个编码执行“解码 -> 编码 -> 再解码 -> 再编码”
+ *
+ * NaN、超出 int32 的整数等值无法与文本解析结果逐项比较，
+ * 这里改为校验编码的幂等性：同一棵树两次编码的字节必须完全一致。
+ */
+static RyanJsonBool_e RyanJsonFuzzerTestCodecOne(const uint8_t *data, uint32_t size, RyanJsonCodec_e codec)
+{
+	RyanJsonBool_e result = RyanJsonTrue;
+	RyanJson_t pJson = NULL;
+	RyanJson_t pJson2 = NULL;
+	uint8_t *encoded = NULL;
+	uint8_t *encoded2 = NULL;
+	char *jsonStr = NULL;
+
+	uint32_t usedLen = 0;
+	pJson = RyanJsonParseCodec(data, size, codec, &usedLen);
+	RyanJsonCheckGotoExit(NULL != pJson);
+	assert(usedLen > 0 && usedLen <= size);
+
+	// 解码结果可以是任意合法树，按文本打印一遍覆盖 Blob/NaN/大整数等来源于二进制格式的值
+	jsonStr = RyanJsonPrint(pJson, 100, RyanJsonFalse, NULL);
+	RyanJsonCheckGotoExit(NULL != jsonStr);
+
+	uint32_t len = 0;
+	encoded = RyanJsonPrintCodec(pJson, codec, 64, &len);
+	RyanJsonCheckGotoExit(NULL != encoded && len > 0);
+
+	// 自身编码的结果必须能被完整解码，且不多不少恰好消费全部字节
+	uint32_t usedLen2 = 0;
+	pJson2 = RyanJsonParseCodec(encoded, len, codec, &usedLen2);
+	RyanJsonCheckGotoExit(NULL != pJson2);
+	assert(usedLen2 == len);
+
+	uint32_t len2 = 0;
+	encoded2 = RyanJsonPrintCodec(pJson2, codec, 64, &len2);
+	RyanJsonCheckGotoExit(NULL != encoded2);
+	assert(len == len2 && 0 == memcmp(encoded, encoded2, (size_t)len));
+
+exit__:
+	if (jsonStr) { RyanJsonFree(jsonStr); }
+	if (encoded) { RyanJsonFree(encoded); }
+	if (encoded2) { RyanJsonFree(encoded2); }
+	RyanJsonDelete(pJson);
+	RyanJsonDelete(pJson2);
+	return result;
+}
+
+/**
+ * @brief CBOR / MessagePack 编解码测试
+ *
+ * 覆盖场景：
+ * 原始字节解码：输入不经过文本解析，直接按 CBOR 与 MessagePack 各解码一次，覆盖二进制解码器的越界与深度保护。
+ * 编码往返：文本解析成功时，把树编码后再解码，验证与原树一致。
+ *
+ * @param pJson 文本解析结果，可为 NULL
+ * @param data 原始输入数据
+ * @param size 输入数据长度
+ */
+RyanJsonBool_e RyanJsonFuzzerTestCodec(RyanJson_t pJson, const uint8_t *data, uint32_t size)
+{
+	RyanJsonFuzzerTestCodecOne(data, size, RyanJsonCodecCbor);
+	RyanJsonFuzzerTestCodecOne(data, size, RyanJsonCodecMsgPack);
+
+	if (NULL == pJson) { return RyanJsonTrue; }
+
+	RyanJsonCodec_e codec = (0 != size % 2) ? RyanJsonCodecCbor : RyanJsonCodecMsgPack;
+	uint32_t len = 0;
+	uint8_t *encoded = RyanJsonPrintCodec(pJson, codec, 64, &len);
+	RyanJsonCheckReturnFalse(NULL != encoded);
+
+	RyanJson_t decoded = RyanJsonParseCodec(encoded, len, codec, NULL);
+	RyanJsonFree(encoded);
+	RyanJsonCheckReturnFalse(NULL != decoded);
+
+	// 文本解析的值都在编码可无损表示的范围内，往返后必须与原树相等
+	fuzzTestWithMemFail(assert(RyanJsonTrue == RyanJsonCompare(pJson, decoded)));
+	RyanJsonDelete(decoded);
+	return RyanJsonTrue;
+}
@@ -0,0 +1,90 @@
+#include "RyanJson.h"
+#include "RyanJsonFuzzer.h"
+
+/**
+ * @brief 懒解析测试
+ *
+ * 覆盖场景：
+ * 懒解析：同一份输入带 LazyNumber/LazyString 标志解析，懒节点保留源文本。
+ * 只读一致性：懒树与普通解析树比较必须相等，且比较不会把懒节点转换掉（打印仍按源文本输出）。
+ * 打印往返：懒树打印的文本重新解析后与普通解析树相等。
+ * 原地转换：逐个取值触发转换后，懒树与普通解析树仍相等。
+ *
+ * @param pJson 普通解析结果，可为 NULL
+ * @param data 原始输入数据文本
+ * @param size 输入数据长度
+ * @param requireNullTerminator 与普通解析一致的尾部模式
+ */
+RyanJsonBool_e RyanJsonFuzzerTestLazy(RyanJson_t pJson, const char *data, uint32_t size, RyanJsonBool_e requireNullTerminator)
+{
+	RyanJsonBool_e result = RyanJsonTrue;
+	char *jsonStr = NULL;
+	char *jsonStr2 = NULL;
+	RyanJson_t reparsed = NULL;
+
+	// 两个标志由输入选择，三种组合都会被命中
+	uint32_t flags = (0 != size % 5) ? (RyanJsonParseFlagLazyNumber | RyanJsonParseFlagLazyString)
+		       : (0 != size % 2) ? RyanJsonParseFlagLazyNumber
+					 : RyanJsonParseFlagLazyString;
+	// 先在故障注入下解析一次，覆盖懒解析的失败回滚路径
+	RyanJson_t lazy = RyanJsonParseWithFlags(data, size, requireNullTerminator, flags, NULL);
+	RyanJsonDelete(lazy);
+
+	// 故障注入会让解析器偶尔放过非法转义，交叉校验的基准需在关闭注入后重新解析
+	fuzzTestWithMemFail(lazy = RyanJsonParseWithFlags(data, size, requireNullTerminator, flags, NULL));
+	RyanJsonCheckGotoExit(NULL != lazy);
+
+	uint32_t len = 0;
+	jsonStr = RyanJsonPrint(lazy, 100, RyanJsonFalse, &len);
+	RyanJsonCheckGotoExit(NULL != jsonStr);
+
+	if (NULL != pJson)
+	{
+		fuzzTestWithMemFail(assert(RyanJsonTrue == RyanJsonCompare(pJson, lazy)));
+		fuzzTestWithMemFail(assert(RyanJsonTrue == RyanJsonCompare(lazy, pJson)));
+
+		// 比较只在局部解析，节点保持懒状态，打印结果不变
+		uint32_t len2 = 0;
+		jsonStr2 = RyanJsonPrint(lazy, 100, RyanJsonFalse, &len2);
+		RyanJsonCheckGotoExit(NULL != jsonStr2);
+		assert(len == len2 && 0 == memcmp(jsonStr, jsonStr2, (size_t)len));
+	}
+
+	fuzzTestWithMemFail(reparsed = RyanJsonParseOptions(jsonStr, len, RyanJsonTrue, NULL));
+	assert(NULL != reparsed);
+	fuzzTestWithMemFail(assert(RyanJsonTrue == RyanJsonCompare(reparsed, lazy)));
+
+	// 逐个取值触发原地转换，转换后仍与普通解析树相等。
+	// 懒数值转换会复用解析器重新扫描已校验的源文本，注入的推进失败在真实环境中不可能出现，这里关闭注入。
+	RyanJsonBool_e lastIsEnableMemFail;
+	RyanJsonFuzzerMemFailPush(lastIsEnableMemFail, RyanJsonFalse);
+	{
+		RyanJson_t item = lazy;
+		while (NULL != item)
+		{
+			if (RyanJsonIsInt(item)) { (void)RyanJsonGetIntValue(item); }
+			else if (RyanJsonIsDouble(item)) { (void)RyanJsonGetDoubleValue(item); }
+			else if (RyanJsonIsString(item)) { (void)RyanJsonGetStringValue(item); }
+
+			if ((RyanJsonIsArray(item) || RyanJsonIsObject(item)) && NULL != RyanJsonGetObjectValue(item))
+			{
+				item = RyanJsonGetObjectValue(item);
+				continue;
+			}
+			while (NULL != item && item != lazy && NULL == RyanJsonGetNext(item))
+			{
+				item = RyanJsonInternalGetParent(item);
+			}
+			item = (NULL == item || item == lazy) ? NULL : RyanJsonGetNext(item);
+		}
+	}
+	assert(RyanJsonTrue == RyanJsonCompare(reparsed, lazy));
+	RyanJsonFuzzerMemFailPop(lastIsEnableMemFail);
+
+exit__:
+	if (jsonStr) { RyanJsonFree(jsonStr); }
+	if (jsonStr2) { RyanJsonFree(jsonStr2); }
+	RyanJsonDelete(reparsed);
+	RyanJsonDelete(lazy);
+	return result;
+}
@@ -0,0 +1,96 @@
+#include "RyanJson.h"
+#include "RyanJsonFuzzer.h"
+
+static RyanJsonBool_e RyanJsonFuzzerQueryCount(RyanJson_t item, void *userData)
+{
+	assert(NULL != item);
+	(*(uint32_t *)userData)++;
+	return RyanJsonTrue;
+}
+
+/**
+ * @brief 对文档求值一个已编译的查询，验证三种遍历接口结果一致
+ *
+ * 迭代器、回调与 First 走同一套段程序，命中顺序与个数必须完全相同。
+ * 紧凑数组按需展开会申请内存，OOM 时各接口提前结束的位置不同，调用方需关闭故障注入。
+ */
+static void RyanJsonFuzzerRunQuery(RyanJson_t pJson, RyanJsonQuery_t query)
+{
+	RyanJsonQueryIter_t iter;
+	RyanJson_t first = NULL;
+	uint32_t iterCount = 0;
+	if (RyanJsonTrue == RyanJsonQueryIterInit(&iter, pJson, query))
+	{
+		RyanJson_t item;
+		while (NULL != (item = RyanJsonQueryIterNext(&iter)))
+		{
+			if (0 == iterCount) { first = item; }
+			iterCount++;
+		}
+	}
+
+	uint32_t eachCount = 0;
+	assert(iterCount == RyanJsonQueryEach(pJson, query, RyanJsonFuzzerQueryCount, &eachCount));
+	assert(iterCount == eachCount);
+	assert(first == RyanJsonQueryFirst(pJson, query));
+}
+
+/**
+ * @brief JSON Pointer 与 JSONPath 查询测试
+ *
+ * 覆盖场景：
+ * 编译：输入整体作为 JSON Pointer 与 JSONPath 表达式编译，覆盖两套编译器的语法与上限检查。
+ * 求值：编译成功的路径与查询对文本解析结果求值（解析失败时对内置样本求值）。
+ * 遍历一致性：递归下降查询命中文档内全部后代，三种遍历接口结果一致。
+ *
+ * @param pJson 文本解析结果，可为 NULL
+ * @param data 原始输入数据文本
+ * @param size 输入数据长度
+ */
+RyanJsonBool_e RyanJsonFuzzerTestQuery(RyanJson_t pJson, const char *data, uint32_t size)
+{
+	RyanJsonBool_e result = RyanJsonTrue;
+	RyanJson_t sample = NULL;
+	RyanJsonPath_t path = NULL;
+	RyanJsonQuery_t query = NULL;
+
+	// 编译接口以 '\0' 结尾，输入中间的 '\0' 自然截断表达式
+	char *expr = (char *)malloc((size_t)size + 1U);
+	if (NULL == expr) { return RyanJsonFalse; }
+	memcpy(expr, data, size);
+	expr[size] = '\0';
+
+	RyanJson_t doc = pJson;
+	if (NULL == doc)
+	{
+		fuzzTestWithMemFail(sample = RyanJsonParse("{\"a\":[1,{\"b\":\"x\",\"c\":[true,null]},2.5],\"~/\":{\"0\":{\"d\":-1}},\"e\":\"y\"}"));
+		assert(NULL != sample);
+		doc = sample;
+	}
+
+	path = RyanJsonPathCompile(expr);
+	if (NULL != path)
+	{
+		(void)RyanJsonPathGetCount(path);
+		(void)RyanJsonPathGet(doc, path);
+	}
+
+	query = RyanJsonQueryCompile(expr);
+	if (NULL != query) { fuzzTestWithMemFail(RyanJsonFuzzerRunQuery(doc, query)); }
+
+	// 递归下降：命中全部后代，这里只验证遍历接口之间的一致性
+	if (NULL != pJson)
+	{
+		RyanJsonQueryDelete(query);
+		query = RyanJsonQueryCompile("$..*");
+		RyanJsonCheckGotoExit(NULL != query);
+		fuzzTestWithMemFail(RyanJsonFuzzerRunQuery(pJson, query));
+	}
+
+exit__:
+	free(expr);
+	RyanJsonPathDelete(path);
+	RyanJsonQueryDelete(query);
+	RyanJsonDelete(sample);
+	return result;
+}
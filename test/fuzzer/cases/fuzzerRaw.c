@@ -0,0 +1,77 @@
+#include "RyanJson.h"
+#include "RyanJsonFuzzer.h"
+
+/**
+ * @brief Raw 节点测试
+ *
+ * 覆盖场景：
+ * 创建校验：输入直接作为 Raw 文本创建，覆盖只校验不建树的 Json 值校验器。
+ * 原样输出：创建成功时打印结果恰为去掉首尾空白后的输入，以打印结果再建的 Raw 作为 Object 成员打印后整体仍可解析（严格 key 模式除外）。
+ * 复制与比较：复制后的 Raw 与原节点相等，类型仍报告为 Raw。
+ * 编码拒绝：二进制镜像与 CBOR 不支持 Raw，必须返回失败。
+ *
+ * @param data 原始输入数据文本
+ * @param size 输入数据长度
+ */
+RyanJsonBool_e RyanJsonFuzzerTestRaw(const char *data, uint32_t size)
+{
+	RyanJsonBool_e result = RyanJsonTrue;
+	char *jsonStr = NULL;
+	RyanJson_t dup = NULL;
+	RyanJson_t obj = NULL;
+	RyanJson_t reparsed = NULL;
+
+	RyanJson_t raw = RyanJsonCreateRaw(NULL, data, size);
+	RyanJsonCheckGotoExit(NULL != raw);
+	assert(RyanJsonTypeRaw == RyanJsonGetType(raw));
+
+	// 打印不经过转义，输出恰为去掉首尾空白后的输入
+	uint32_t len = 0;
+	jsonStr = RyanJsonPrint(raw, 100, RyanJsonFalse, &len);
+	RyanJsonCheckGotoExit(NULL != jsonStr);
+	uint32_t start = 0;
+	while (start < size && (' ' == data[start] || '\t' == data[start] || '\n' == data[start] || '\r' == data[start]))
+	{
+		start++;
+	}
+	assert(len > 0 && len <= size - start);
+	assert(0 == memcmp(data + start, jsonStr, (size_t)len));
+
+	dup = RyanJsonDuplicate(raw);
+	RyanJsonCheckGotoExit(NULL != dup);
+	assert(RyanJsonTypeRaw == RyanJsonGetType(dup));
+	fuzzTestWithMemFail(assert(RyanJsonTrue == RyanJsonCompare(raw, dup)));
+
+	fuzzTestWithMemFail({
+		uint32_t binLen = 0;
+		assert(NULL == RyanJsonSaveBinary(raw, &binLen));
+		assert(NULL == RyanJsonPrintCodec(raw, RyanJsonCodecCbor, 64, &binLen));
+	});
+
+	// 故障注入会让校验器偶尔放过非法转义，关闭注入后以打印结果再建一个 Raw 作为基准，
+	// 作为 Object 成员嵌入后整体打印结果必须仍能解析
+	RyanJsonBool_e isValid = RyanJsonFalse;
+	fuzzTestWithMemFail({
+		obj = RyanJsonCreateObject();
+		assert(NULL != obj);
+		isValid = RyanJsonAddRawToObject(obj, "raw", jsonStr, len);
+	});
+	RyanJsonCheckGotoExit(RyanJsonTrue == isValid);
+
+	RyanJsonFree(jsonStr);
+	jsonStr = RyanJsonPrint(obj, 100, RyanJsonFalse, &len);
+	RyanJsonCheckGotoExit(NULL != jsonStr);
+	fuzzTestWithMemFail(reparsed = RyanJsonParseOptions(jsonStr, len, RyanJsonTrue, NULL));
+#if true != RyanJsonStrictObjectKeyCheck
+	// Raw 只校验语法，重复 key 在严格模式下会被解析拒绝
+	assert(NULL != reparsed);
+#endif
+
+exit__:
+	if (jsonStr) { RyanJsonFree(jsonStr); }
+	RyanJsonDelete(reparsed);
+	RyanJsonDelete(obj);
+	RyanJsonDelete(dup);
+	RyanJsonDelete(raw);
+	return result;
+}
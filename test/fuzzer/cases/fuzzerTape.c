@@ -0,0 +1,154 @@
+#include "RyanJson.h"
+#include "RyanJsonFuzzer.h"
+
+/**
+ * @brief 经只读接口遍历整份 tape
+ *
+ * 加载成功的文档承诺所有只读接口都不越界，这里对每个条目调用与类型匹配的取值接口，
+ * 并验证按 key / 按索引查找与顺序遍历命中同一个条目。
+ */
+static void RyanJsonFuzzerWalkTape(RyanJsonTapeVal_t val)
+{
+	RyanjsonType_e type = RyanJsonTapeGetType(val);
+	if (NULL != RyanJsonTapeGetKey(val)) { assert(strlen(RyanJsonTapeGetKey(val)) == RyanJsonTapeGetKeyLength(val)); }
+
+	switch (type)
+	{
+	case RyanJsonTypeBool: (void)RyanJsonTapeGetBoolValue(val); break;
+	case RyanJsonTypeNumber:
+		if (RyanJsonTapeIsInt(val)) { (void)RyanJsonTapeGetIntValue(val); }
+		else
+		{
+			assert(RyanJsonTrue == RyanJsonTapeIsDouble(val));
+			(void)RyanJsonTapeGetDoubleValue(val);
+		}
+		break;
+	case RyanJsonTypeString: assert(strlen(RyanJsonTapeGetStringValue(val)) == RyanJsonTapeGetStringLength(val)); break;
+	case RyanJsonTypeArray:
+	case RyanJsonTypeObject: {
+		uint32_t index = 0;
+		RyanJsonTapeVal_t item = NULL;
+		RyanJsonTapeForEach(val, item)
+		{
+			assert(item == RyanJsonTapeGetObjectByIndex(val, index));
+			if (RyanJsonTypeObject == type)
+			{
+				// 重复 key 时按 key 查找命中第一个同名成员，只要求 key 相同
+				RyanJsonTapeVal_t byKey = RyanJsonTapeGetObjectByKey(val, RyanJsonTapeGetKey(item));
+				assert(NULL != byKey && 0 == strcmp(RyanJsonTapeGetKey(byKey), RyanJsonTapeGetKey(item)));
+			}
+			RyanJsonFuzzerWalkTape(item);
+			index++;
+		}
+		assert(index == RyanJsonTapeGetSize(val));
+		assert(NULL == RyanJsonTapeGetObjectByIndex(val, index));
+		break;
+	}
+	default: break;
+	}
+}
+
+/**
+ * @brief 校验已加载的镜像：遍历只读接口并转回普通树打印
+ */
+static void RyanJsonFuzzerCheckTape(RyanJsonTape_t tape)
+{
+	RyanJsonTapeVal_t root = RyanJsonTapeGetRoot(tape);
+	assert(NULL != root);
+	RyanJsonFuzzerWalkTape(root);
+
+	RyanJson_t tree = RyanJsonTapeToTree(root);
+	if (NULL == tree) { return; }
+
+	char *jsonStr = RyanJsonPrint(tree, 100, RyanJsonFalse, NULL);
+	if (NULL != jsonStr) { RyanJsonFree(jsonStr); }
+	RyanJsonDelete(tree);
+}
+
+/**
+ * @brief 以输入为文档体构造一份头部合法的镜像并加载
+ *
+ * 随机字节几乎不可能通过魔数与校验和，直接加载只能覆盖头部检查；
+ * 这里补上合法头部，让输入直接落到文档结构校验（偏移、长度、子树跨度与转义标记）上。
+ */
+static void RyanJsonFuzzerTestLoadBinary(const uint8_t *data, uint32_t size)
+{
+	if (size > UINT32_MAX - (uint32_t)sizeof(RyanJsonBinaryHead_t)) { return; }
+
+	// 镜像需按 4 字节对齐，malloc 的返回值满足该要求
+	uint32_t totalSize = (uint32_t)sizeof(RyanJsonBinaryHead_t) + size;
+	uint8_t *image = (uint8_t *)malloc((size_t)totalSize);
+	if (NULL == image) { return; }
+
+	// 原始输入当作完整镜像加载一次，覆盖魔数、版本、长度与校验和的拒绝路径
+	memcpy(image, data, size);
+	(void)RyanJsonLoadBinary(image, size);
+
+	RyanJsonBinaryHead_t head = {
+		.magic = RyanJsonBinaryMagic,
+		.version = RyanJsonBinaryVersion,
+		.totalSize = totalSize,
+		.checksum = RyanJsonInternalBinaryChecksum(data, size),
+	};
+	memcpy(image, &head, sizeof(head));
+	memcpy(image + sizeof(head), data, size);
+
+	RyanJsonTape_t tape = RyanJsonLoadBinary(image, totalSize);
+	if (NULL != tape) { RyanJsonFuzzerCheckTape(tape); }
+	free(image);
+}
+
+/**
+ * @brief 扁平只读文档（tape）与二进制镜像测试
+ *
+ * 覆盖场景：
+ * 文本解析：同一份输入按 tape 解析，成功时转回普通树应与树解析结果相等。
+ * 镜像加载：输入作为镜像文档体加载，加载成功的文档经全部只读接口访问不越界。
+ * 镜像往返：文本解析成功时保存为镜像再加载，转回的树应与原树相等。
+ *
+ * @param pJson 文本解析结果，可为 NULL
+ * @param data 原始输入数据
+ * @param size 输入数据长度
+ * @param requireNullTerminator 与树解析一致的尾部模式
+ */
+RyanJsonBool_e RyanJsonFuzzerTestTape(RyanJson_t pJson, const uint8_t *data, uint32_t size, RyanJsonBool_e requireNullTerminator)
+{
+	RyanJsonFuzzerTestLoadBinary(data, size);
+
+	RyanJsonTape_t tape = RyanJsonParseTapeOptions((const char *)data, size, requireNullTerminator, NULL);
+	if (NULL != tape)
+	{
+		RyanJsonFuzzerCheckTape(tape);
+		RyanJsonTapeDelete(tape);
+	}
+
+	if (NULL == pJson) { return RyanJsonTrue; }
+
+	// 故障注入会让解析器偶尔放过非法转义，与树解析交叉校验时关闭注入重新解析
+	fuzzTestWithMemFail({
+		tape = RyanJsonParseTapeOptions((const char *)data, size, requireNullTerminator, NULL);
+		if (NULL != tape)
+		{
+			RyanJson_t tree = RyanJsonTapeToTree(RyanJsonTapeGetRoot(tape));
+			assert(NULL != tree && RyanJsonTrue == RyanJsonCompare(pJson, tree));
+			RyanJsonDelete(tree);
+			RyanJsonTapeDelete(tape);
+		}
+	});
+
+	uint32_t len = 0;
+	uint8_t *image = RyanJsonSaveBinary(pJson, &len);
+	RyanJsonCheckReturnFalse(NULL != image);
+
+	// 刚保存的镜像必须能加载，加载过程不申请内存
+	RyanJsonTape_t loaded = RyanJsonLoadBinary(image, len);
+	assert(NULL != loaded);
+	RyanJson_t tree = RyanJsonTapeToTree(RyanJsonTapeGetRoot(loaded));
+	if (NULL != tree)
+	{
+		fuzzTestWithMemFail(assert(RyanJsonTrue == RyanJsonCompare(pJson, tree)));
+		RyanJsonDelete(tree);
+	}
+	RyanJsonFree(image);
+	return RyanJsonTrue;
+}
@@ -28,7 +28,17 @@ int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
 	       RyanJsonInitHooks(RyanJsonFuzzerMalloc, RyanJsonFuzzerFree, 0 != inputSize % 2 ? NULL : RyanJsonFuzzerRealloc));
 
 	// 用输入驱动 strict 选项，保证同一份样本在“宽松尾部/严格尾部”两类解析语义下都能逐步积累覆盖。
-	RyanJson_t pJson = RyanJsonParseOptions((const char *)data, inputSize, 0 != inputSize % 3 ? RyanJsonTrue : RyanJsonFalse, NULL);
+	RyanJsonBool_e requireNullTerminator = 0 != inputSize % 3 ? RyanJsonTrue : RyanJsonFalse;
+	RyanJson_t pJson = RyanJsonParseOptions((const char *)data, inputSize, requireNullTerminator, NULL);
+
+	// 其余解析入口同样直接消费不可信输入，不依赖树解析成功；树解析成功时与之交叉校验。
+	// 这些 case 只读 pJson，放在所有变异类 case 之前。
+	RyanJsonFuzzerTestCodec(pJson, data, inputSize);
+	RyanJsonFuzzerTestTape(pJson, data, inputSize, requireNullTerminator);
+	RyanJsonFuzzerTestLazy(pJson, (const char *)data, inputSize, requireNullTerminator);
+	RyanJsonFuzzerTestRaw((const char *)data, inputSize);
+	RyanJsonFuzzerTestQuery(pJson, (const char *)data, inputSize);
+
 	if (NULL != pJson)
 	{
 		// 执行顺序保持“文本相关 -> 只读访问 -> 原地变异 -> 所有权迁移”。
@@ -100,6 +100,17 @@ extern void RyanJsonFuzzerSelfTestDuplicateCases(void);
 extern RyanJsonBool_e RyanJsonFuzzerTestParse(RyanJson_t pJson, const char *data, uint32_t size);
 extern RyanJsonBool_e RyanJsonFuzzerTestMinify(const char *data, uint32_t size);
 
+/**
+ * @brief 非树解析入口测试
+ * 覆盖 CBOR/MessagePack 解码、tape 解析与二进制镜像加载、懒解析、Raw 校验以及 JSON Pointer/JSONPath 编译。
+ * pJson 为同一输入的树解析结果，解析失败时为 NULL；这些 case 只读 pJson，必须在原地变异类 case 之前执行。
+ */
+extern RyanJsonBool_e RyanJsonFuzzerTestCodec(RyanJson_t pJson, const uint8_t *data, uint32_t size);
+extern RyanJsonBool_e RyanJsonFuzzerTestTape(RyanJson_t pJson, const uint8_t *data, uint32_t size, RyanJsonBool_e requireNullTerminator);
+extern RyanJsonBool_e RyanJsonFuzzerTestLazy(RyanJson_t pJson, const char *data, uint32_t size, RyanJsonBool_e requireNullTerminator);
+extern RyanJsonBool_e RyanJsonFuzzerTestRaw(const char *data, uint32_t size);
+extern RyanJsonBool_e RyanJsonFuzzerTestQuery(RyanJson_t pJson, const char *data, uint32_t size);
+
 /**
  * @brief 深度复制与比较测试
  * 验证复制结果与原 Object 的一致性。
@@ -0,0 +1,204 @@
+#include "testBase.h"
+
+// 超过 RyanJsonArrayIndexMinSize，启用指针表时首次长遍历后建立
+#define accessorIndexedInitCount (200U)
+#define accessorIndexedMaxCount  (600U)
+
+typedef struct
+{
+	int32_t values[accessorIndexedMaxCount];
+	uint32_t count;
+} accessorIndexedModel_t;
+
+static uint32_t accessorIndexedRand(uint32_t *seed)
+{
+	*seed = *seed * 1103515245U + 12345U;
+	return (*seed >> 16) & 0x7FFFU;
+}
+
+/**
+ * @brief 按索引访问与 ForEach 遍历都应与模型一致
+ */
+static void assertArrayMatchesModel(RyanJson_t arr, const accessorIndexedModel_t *model)
+{
+	TEST_ASSERT_EQUAL_UINT32(model->count, RyanJsonGetSize(arr));
+
+	uint32_t i = 0;
+	RyanJson_t item = NULL;
+	RyanJsonArrayForEach(arr, item)
+	{
+		TEST_ASSERT_TRUE(i < model->count);
+		TEST_ASSERT_EQUAL_INT32(model->values[i], RyanJsonGetIntValue(item));
+		i++;
+	}
+	TEST_ASSERT_EQUAL_UINT32(model->count, i);
+
+	for (i = 0; i < model->count; i++)
+	{
+		TEST_ASSERT_EQUAL_INT32(model->values[i], RyanJsonGetIntValue(RyanJsonGetObjectByIndex(arr, i)));
+	}
+	TEST_ASSERT_NULL(RyanJsonGetObjectByIndex(arr, model->count));
+	TEST_ASSERT_NULL(RyanJsonGetObjectByIndex(arr, UINT32_MAX));
+}
+
+static RyanJson_t createIndexedArray(accessorIndexedModel_t *model)
+{
+	RyanJson_t arr = RyanJsonCreateArray();
+	TEST_ASSERT_NOT_NULL(arr);
+
+	RyanJsonAppender_t appender;
+	TEST_ASSERT_TRUE(RyanJsonAppenderInit(&appender, arr));
+	model->count = 0;
+	for (uint32_t i = 0; i < accessorIndexedInitCount; i++)
+	{
+		TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, RyanJsonCreateInt(NULL, (int32_t)i)));
+		model->values[model->count++] = (int32_t)i;
+	}
+	return arr;
+}
+
+static void modelInsert(accessorIndexedModel_t *model, uint32_t index, int32_t value)
+{
+	if (index > model->count) { index = model->count; }
+	memmove(&model->values[index + 1], &model->values[index], (model->count - index) * sizeof(int32_t));
+	model->values[index] = value;
+	model->count++;
+}
+
+static void modelRemove(accessorIndexedModel_t *model, uint32_t index)
+{
+	model->count--;
+	memmove(&model->values[index], &model->values[index + 1], (model->count - index) * sizeof(int32_t));
+}
+
+static void testAccessorIndexedRandomMutation(void)
+{
+	static accessorIndexedModel_t model;
+	RyanJson_t arr = createIndexedArray(&model);
+
+	// 先做一次长遍历（启用指针表时触发建立）
+	TEST_ASSERT_EQUAL_INT32(150, RyanJsonGetIntValue(RyanJsonGetObjectByIndex(arr, 150)));
+	assertArrayMatchesModel(arr, &model);
+
+	uint32_t seed = 20240601U;
+	int32_t nextValue = 10000;
+	for (uint32_t round = 0; round < 400; round++)
+	{
+		uint32_t op = accessorIndexedRand(&seed) % 5U;
+		uint32_t index = (0 == model.count) ? 0 : accessorIndexedRand(&seed) % model.count;
+
+		if ((0 == op || 4 == op) && model.count < accessorIndexedMaxCount)
+		{
+			// 插入（含越界尾插）
+			uint32_t at = (4 == op) ? UINT32_MAX : index;
+			TEST_ASSERT_TRUE(RyanJsonInsert(arr, at, RyanJsonCreateInt(NULL, nextValue)));
+			modelInsert(&model, at, nextValue++);
+		}
+		else if (1 == op && model.count > 0)
+		{
+			RyanJson_t detached = RyanJsonDetachByIndex(arr, index);
+			TEST_ASSERT_NOT_NULL(detached);
+			TEST_ASSERT_EQUAL_INT32(model.values[index], RyanJsonGetIntValue(detached));
+			RyanJsonDelete(detached);
+			modelRemove(&model, index);
+		}
+		else if (2 == op && model.count > 0)
+		{
+			TEST_ASSERT_TRUE(RyanJsonReplaceByIndex(arr, index, RyanJsonCreateInt(NULL, nextValue)));
+			model.values[index] = nextValue++;
+		}
+		else if (3 == op && model.count > 0)
+		{
+			TEST_ASSERT_TRUE(RyanJsonDeleteByIndex(arr, index));
+			modelRemove(&model, index);
+		}
+
+		if (0 == round % 40U) { assertArrayMatchesModel(arr, &model); }
+	}
+	assertArrayMatchesModel(arr, &model);
+
+	// 越界访问与修改失败且不影响现有元素
+	TEST_ASSERT_NULL(RyanJsonDetachByIndex(arr, model.count));
+	RyanJson_t spare = RyanJsonCreateInt(NULL, -1);
+	TEST_ASSERT_FALSE(RyanJsonReplaceByIndex(arr, model.count, spare));
+	RyanJsonDelete(spare);
+
+	// 清空后重新追加
+	while (model.count > 0)
+	{
+		TEST_ASSERT_TRUE(RyanJsonDeleteByIndex(arr, model.count - 1U));
+		model.count--;
+	}
+	assertArrayMatchesModel(arr, &model);
+	for (uint32_t i = 0; i < 50; i++)
+	{
+		TEST_ASSERT_TRUE(RyanJsonAddIntToArray(arr, (int32_t)i));
+		modelInsert(&model, RyanJsonAddPosition, (int32_t)i);
+	}
+	assertArrayMatchesModel(arr, &model);
+
+	RyanJsonDelete(arr);
+}
+
+static void testAccessorIndexedAppenderAndCompare(void)
+{
+	static accessorIndexedModel_t model;
+	RyanJson_t arr = createIndexedArray(&model);
+	TEST_ASSERT_NOT_NULL(RyanJsonGetObjectByIndex(arr, accessorIndexedInitCount - 1U));
+
+	// 追加器尾插需同步到指针表
+	RyanJsonAppender_t appender;
+	TEST_ASSERT_TRUE(RyanJsonAppenderInit(&appender, arr));
+	for (int32_t i = 0; i < 100; i++)
+	{
+		TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, RyanJsonCreateInt(NULL, -i)));
+		modelInsert(&model, UINT32_MAX, -i);
+	}
+	assertArrayMatchesModel(arr, &model);
+
+	RyanJson_t dup = RyanJsonDuplicate(arr);
+	TEST_ASSERT_NOT_NULL(dup);
+	TEST_ASSERT_TRUE(RyanJsonCompare(arr, dup));
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByIndex(dup, 250), 7777));
+	TEST_ASSERT_FALSE(RyanJsonCompare(arr, dup));
+	RyanJsonDelete(dup);
+
+	RyanJsonDelete(arr);
+}
+
+static void testAccessorIndexedOomFallback(void)
+{
+	static accessorIndexedModel_t model;
+	RyanJson_t arr = createIndexedArray(&model);
+
+	// 指针表建立失败只退回链表遍历
+	UNITY_TEST_OOM_BEGIN(0);
+	RyanJson_t hit = RyanJsonGetObjectByIndex(arr, 180);
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_NOT_NULL(hit);
+	TEST_ASSERT_EQUAL_INT32(180, RyanJsonGetIntValue(hit));
+
+	// 扩容失败时丢弃指针表，插入本身仍成功
+	TEST_ASSERT_NOT_NULL(RyanJsonGetObjectByIndex(arr, 180));
+	for (uint32_t i = 0; i < 200; i++)
+	{
+		RyanJson_t item = RyanJsonCreateInt(NULL, (int32_t)(5000 + i));
+		TEST_ASSERT_NOT_NULL(item);
+		UNITY_TEST_OOM_BEGIN(0);
+		RyanJsonBool_e ok = RyanJsonInsert(arr, i * 2U, item);
+		UNITY_TEST_OOM_END();
+		TEST_ASSERT_TRUE(ok);
+		modelInsert(&model, i * 2U, (int32_t)(5000 + i));
+	}
+	assertArrayMatchesModel(arr, &model);
+
+	RyanJsonDelete(arr);
+}
+
+void testAccessorIndexedRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+	RUN_TEST(testAccessorIndexedRandomMutation);
+	RUN_TEST(testAccessorIndexedAppenderAndCompare);
+	RUN_TEST(testAccessorIndexedOomFallback);
+}
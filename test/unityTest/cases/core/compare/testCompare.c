@@ -410,6 +410,113 @@ static void testCompareDeepNestAndLargeArray(void)
 	RyanJsonDelete(arr2);
 }
 
+/**
+ * @brief 生成 depth 层嵌套 Object，每层 "nest" 夹在两个标量兄弟之间；reversed 时每层兄弟顺序颠倒
+ */
+static char *createNestedSiblingText(uint32_t depth, RyanJsonBool_e reversed, int32_t leaf)
+{
+	uint32_t cap = depth * 48U + 64U;
+	char *text = (char *)malloc(cap);
+	TEST_ASSERT_NOT_NULL(text);
+
+	uint32_t len = 0;
+	for (uint32_t i = 0; i < depth; i++)
+	{
+		len += (uint32_t)RyanJsonSnprintf(text + len, cap - len, "{\"%s\":%" PRIu32 ",\"nest\":", reversed ? "after" : "before", i);
+	}
+	len += (uint32_t)RyanJsonSnprintf(text + len, cap - len, "{\"leaf\":%" PRId32 "}", leaf);
+	for (uint32_t i = depth; i > 0; i--)
+	{
+		len += (uint32_t)RyanJsonSnprintf(text + len, cap - len, ",\"%s\":%" PRIu32 "}", reversed ? "before" : "after", i - 1U);
+	}
+	TEST_ASSERT_TRUE(len < cap);
+	return text;
+}
+
+static void testCompareWideAndDeepObjectPaths(void)
+{
+	// 深度超过 Compare 祖先缓存，且每层子容器后仍有需按 key 匹配的兄弟
+	uint32_t depth = RyanJsonCompareAncestorCacheDepth + 24U;
+	char *leftText = createNestedSiblingText(depth, RyanJsonFalse, 1);
+	char *rightText = createNestedSiblingText(depth, RyanJsonTrue, 1);
+	char *diffText = createNestedSiblingText(depth, RyanJsonTrue, 2);
+	RyanJson_t left = RyanJsonParse(leftText);
+	RyanJson_t right = RyanJsonParse(rightText);
+	RyanJson_t diff = RyanJsonParse(diffText);
+	free(leftText);
+	free(rightText);
+	free(diffText);
+	TEST_ASSERT_NOT_NULL(left);
+	TEST_ASSERT_NOT_NULL(right);
+	TEST_ASSERT_NOT_NULL(diff);
+
+	TEST_ASSERT_TRUE(RyanJsonCompare(left, right));
+	TEST_ASSERT_TRUE(RyanJsonCompare(right, left));
+	TEST_ASSERT_FALSE(RyanJsonCompare(left, diff));
+	TEST_ASSERT_TRUE(RyanJsonCompareOnlyKey(left, diff));
+
+	// 回溯后仍需匹配的兄弟（缓存内外的层级各改一处）
+	RyanJson_t shallow = RyanJsonGetObjectByKey(RyanJsonGetObjectByKey(right, "nest"), "nest");
+	RyanJson_t deep = right;
+	for (uint32_t i = 0; i < depth - 2U; i++)
+	{
+		deep = RyanJsonGetObjectByKey(deep, "nest");
+	}
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByKey(shallow, "before"), -1));
+	TEST_ASSERT_FALSE(RyanJsonCompare(left, right));
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByKey(shallow, "before"), 2));
+	TEST_ASSERT_TRUE(RyanJsonCompare(left, right));
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByKey(deep, "before"), -1));
+	TEST_ASSERT_FALSE(RyanJsonCompare(left, right));
+	TEST_ASSERT_TRUE(RyanJsonCompareOnlyKey(left, right));
+
+	RyanJsonDelete(left);
+	RyanJsonDelete(right);
+	RyanJsonDelete(diff);
+
+	// 宽 Object：同序、中途交换一对成员、末尾值不同
+	uint32_t count = 2000;
+	RyanJson_t wideLeft = RyanJsonCreateObject();
+	RyanJson_t wideRight = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(wideLeft);
+	TEST_ASSERT_NOT_NULL(wideRight);
+	RyanJsonAppender_t leftAppender;
+	RyanJsonAppender_t rightAppender;
+	TEST_ASSERT_TRUE(RyanJsonAppenderInit(&leftAppender, wideLeft));
+	TEST_ASSERT_TRUE(RyanJsonAppenderInit(&rightAppender, wideRight));
+	for (uint32_t i = 0; i < count; i++)
+	{
+		char key[16];
+		// 右侧交换第 10/11 个成员
+		uint32_t rightIndex = (10U == i) ? 11U : ((11U == i) ? 10U : i);
+		RyanJsonSnprintf(key, sizeof(key), "key%" PRIu32, i);
+		TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&leftAppender, RyanJsonCreateInt(key, (int32_t)i)));
+		RyanJsonSnprintf(key, sizeof(key), "key%" PRIu32, rightIndex);
+		TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&rightAppender, RyanJsonCreateInt(key, (int32_t)rightIndex)));
+	}
+	TEST_ASSERT_TRUE(RyanJsonCompare(wideLeft, wideRight));
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByKey(wideRight, "key1999"), -1));
+	TEST_ASSERT_FALSE(RyanJsonCompare(wideLeft, wideRight));
+	RyanJsonDelete(wideLeft);
+	RyanJsonDelete(wideRight);
+
+#if true != RyanJsonStrictObjectKeyCheck
+	// 重复 key：乱序后必须按出现序号对齐，而不是取右侧下一个同名兄弟
+	RyanJson_t dupLeft = RyanJsonParse("{\"b\":0,\"a\":1,\"a\":2}");
+	RyanJson_t dupRight = RyanJsonParse("{\"a\":1,\"b\":0,\"a\":2}");
+	RyanJson_t dupSwapped = RyanJsonParse("{\"b\":0,\"a\":2,\"a\":1}");
+	TEST_ASSERT_NOT_NULL(dupLeft);
+	TEST_ASSERT_NOT_NULL(dupRight);
+	TEST_ASSERT_NOT_NULL(dupSwapped);
+	TEST_ASSERT_TRUE(RyanJsonCompare(dupLeft, dupRight));
+	TEST_ASSERT_FALSE(RyanJsonCompare(dupLeft, dupSwapped));
+	TEST_ASSERT_FALSE(RyanJsonCompare(dupRight, dupSwapped));
+	RyanJsonDelete(dupLeft);
+	RyanJsonDelete(dupRight);
+	RyanJsonDelete(dupSwapped);
+#endif
+}
+
 static void testCompareEqualityAndStructuralDiff(void)
 {
 	char jsonstr[] = "{\"inter\":16,\"double\":16.89,\"string\":\"hello\",\"boolTrue\":true,\"boolFalse\":false,\"null\":null,\"item\":"
@@ -628,6 +735,7 @@ void testCompareRunner(void)
 	RUN_TEST(testCompareNestedObjectScenarios);
 	RUN_TEST(testCompareArrayWithObjects);
 	RUN_TEST(testCompareDeepNestAndLargeArray);
+	RUN_TEST(testCompareWideAndDeepObjectPaths);
 	RUN_TEST(testCompareEqualityAndStructuralDiff);
 }
 
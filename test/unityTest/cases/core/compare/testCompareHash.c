@@ -0,0 +1,243 @@
+#include "testBase.h"
+
+#define hashTestRowCount (24U)
+
+/**
+ * @brief 生成 [{"id":0,"name":"n0","tags":[0,true,null]},...]，行数足够触发子树哈希缓存
+ */
+static RyanJson_t createHashRows(uint32_t rowCount)
+{
+	RyanJson_t root = RyanJsonCreateArray();
+	TEST_ASSERT_NOT_NULL(root);
+	for (uint32_t i = 0; i < rowCount; i++)
+	{
+		char name[16];
+		RyanJsonSnprintf(name, sizeof(name), "n%" PRIu32, i);
+
+		RyanJson_t row = RyanJsonCreateObject();
+		TEST_ASSERT_NOT_NULL(row);
+		TEST_ASSERT_TRUE(RyanJsonInsert(row, UINT32_MAX, RyanJsonCreateInt("id", (int32_t)i)));
+		TEST_ASSERT_TRUE(RyanJsonInsert(row, UINT32_MAX, RyanJsonCreateString("name", name)));
+
+		RyanJson_t tags = RyanJsonCreateArray();
+		TEST_ASSERT_NOT_NULL(tags);
+		TEST_ASSERT_TRUE(RyanJsonInsert(tags, UINT32_MAX, RyanJsonCreateInt(NULL, (int32_t)i)));
+		TEST_ASSERT_TRUE(RyanJsonInsert(tags, UINT32_MAX, RyanJsonCreateBool(NULL, RyanJsonTrue)));
+		TEST_ASSERT_TRUE(RyanJsonInsert(tags, UINT32_MAX, RyanJsonCreateNull(NULL)));
+		TEST_ASSERT_TRUE(RyanJsonAddItemToObject(row, "tags", tags));
+
+		TEST_ASSERT_TRUE(RyanJsonInsert(root, UINT32_MAX, row));
+	}
+	return root;
+}
+
+static void testCompareHashContentSemantics(void)
+{
+	TEST_ASSERT_EQUAL_UINT32(0, RyanJsonHash(NULL));
+
+	// Object 成员顺序与根节点 key 不影响哈希
+	RyanJson_t a = RyanJsonParse("{\"a\":1,\"b\":[1,2,{\"x\":\"s\",\"y\":null}],\"c\":{\"d\":true,\"e\":1.5}}");
+	RyanJson_t b = RyanJsonParse("{\"c\":{\"e\":1.5,\"d\":true},\"b\":[1,2,{\"y\":null,\"x\":\"s\"}],\"a\":1}");
+	TEST_ASSERT_NOT_NULL(a);
+	TEST_ASSERT_NOT_NULL(b);
+	TEST_ASSERT_TRUE(RyanJsonCompare(a, b));
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(a), RyanJsonHash(b));
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(RyanJsonGetObjectByKey(a, "c")), RyanJsonHash(RyanJsonGetObjectByKey(b, "c")));
+
+	RyanJson_t dup = RyanJsonDuplicate(a);
+	TEST_ASSERT_NOT_NULL(dup);
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(a), RyanJsonHash(dup));
+	RyanJsonDelete(dup);
+
+	RyanJson_t keyedObject = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(keyedObject);
+	TEST_ASSERT_TRUE(RyanJsonAddItemToObject(keyedObject, "renamed", RyanJsonDuplicate(RyanJsonGetObjectByKey(a, "c"))));
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(RyanJsonGetObjectByKey(a, "c")),
+				 RyanJsonHash(RyanJsonGetObjectByKey(keyedObject, "renamed")));
+	RyanJsonDelete(keyedObject);
+
+	// Array 元素顺序、key、值、Int/Double 类型均参与计算
+	const char *variants[] = {
+		"{\"a\":1,\"b\":[2,1,{\"x\":\"s\",\"y\":null}],\"c\":{\"d\":true,\"e\":1.5}}",
+		"{\"a\":1,\"b\":[1,2,{\"x\":\"s\",\"z\":null}],\"c\":{\"d\":true,\"e\":1.5}}",
+		"{\"a\":1,\"b\":[1,2,{\"x\":\"t\",\"y\":null}],\"c\":{\"d\":true,\"e\":1.5}}",
+		"{\"a\":1.0,\"b\":[1,2,{\"x\":\"s\",\"y\":null}],\"c\":{\"d\":true,\"e\":1.5}}",
+		"{\"a\":1,\"b\":[1,2,{\"x\":\"s\",\"y\":null}],\"c\":{\"d\":false,\"e\":1.5}}",
+		"{\"a\":1,\"b\":[1,2,{\"x\":\"s\",\"y\":null}],\"c\":{\"d\":true,\"e\":1.5},\"f\":[]}",
+		"{\"a\":1,\"b\":[1,2,{\"x\":\"s\",\"y\":null},{}],\"c\":{\"d\":true,\"e\":1.5}}",
+		"{\"a\":1,\"b\":[1,[2],{\"x\":\"s\",\"y\":null}],\"c\":{\"d\":true,\"e\":1.5}}",
+	};
+	for (uint32_t i = 0; i < sizeof(variants) / sizeof(variants[0]); i++)
+	{
+		RyanJson_t variant = RyanJsonParse(variants[i]);
+		TEST_ASSERT_NOT_NULL(variant);
+		TEST_ASSERT_NOT_EQUAL_UINT32(RyanJsonHash(a), RyanJsonHash(variant));
+		RyanJsonDelete(variant);
+	}
+
+	// 同 key 的成员交换位置不影响，交换值则影响
+	RyanJson_t swapped = RyanJsonParse("{\"a\":1,\"b\":[1,2,{\"x\":\"s\",\"y\":null}],\"c\":{\"d\":1.5,\"e\":true}}");
+	TEST_ASSERT_NOT_NULL(swapped);
+	TEST_ASSERT_NOT_EQUAL_UINT32(RyanJsonHash(a), RyanJsonHash(swapped));
+	RyanJsonDelete(swapped);
+
+	// -0 与 0 视为相同
+	RyanJson_t zero = RyanJsonCreateDouble(NULL, 0.0);
+	RyanJson_t negZero = RyanJsonCreateDouble(NULL, -0.0);
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(zero), RyanJsonHash(negZero));
+	RyanJsonDelete(zero);
+	RyanJsonDelete(negZero);
+
+	RyanJsonDelete(a);
+	RyanJsonDelete(b);
+}
+
+static void testCompareHashDeepAndPacked(void)
+{
+	// 超过祖先缓存深度的嵌套仍能正确回溯
+	char text[512];
+	uint32_t len = 0;
+	uint32_t depth = RyanJsonCompareAncestorCacheDepth + 8U;
+	for (uint32_t i = 0; i < depth; i++)
+	{
+		len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, (0 == i % 2U) ? "[1," : "{\"k\":2,\"v\":");
+	}
+	len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, "0");
+	for (uint32_t i = depth; i-- > 0;)
+	{
+		len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, (0 == i % 2U) ? ",3]" : ",\"w\":4}");
+	}
+	TEST_ASSERT_TRUE(len < sizeof(text));
+
+	RyanJson_t deep = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(deep);
+	RyanJson_t deepCopy = RyanJsonDuplicate(deep);
+	TEST_ASSERT_NOT_NULL(deepCopy);
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(deep), RyanJsonHash(deepCopy));
+
+	RyanJson_t leaf = deepCopy;
+	while (RyanJsonIsArray(leaf) || RyanJsonIsObject(leaf))
+	{
+		leaf = RyanJsonIsArray(leaf) ? RyanJsonGetObjectByIndex(leaf, 1) : RyanJsonGetObjectByKey(leaf, "v");
+	}
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(leaf, 5));
+	TEST_ASSERT_NOT_EQUAL_UINT32(RyanJsonHash(deep), RyanJsonHash(deepCopy));
+	RyanJsonDelete(deepCopy);
+	RyanJsonDelete(deep);
+
+	// 紧凑数组与逐个添加的普通 Array 哈希一致
+	RyanJson_t packed = RyanJsonParse("[[0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17],"
+					  "[{\"x\":1,\"y\":2.5},{\"x\":2,\"y\":3.5},{\"x\":3,\"y\":4.5},{\"x\":4,\"y\":5.5},"
+					  "{\"x\":5,\"y\":6.5},{\"x\":6,\"y\":7.5},{\"x\":7,\"y\":8.5},{\"x\":8,\"y\":9.5},"
+					  "{\"x\":9,\"y\":10.5},{\"x\":10,\"y\":11.5},{\"x\":11,\"y\":12.5},{\"x\":12,\"y\":13.5},"
+					  "{\"x\":13,\"y\":14.5},{\"x\":14,\"y\":15.5},{\"x\":15,\"y\":16.5},{\"x\":16,\"y\":17.5}]]");
+	TEST_ASSERT_NOT_NULL(packed);
+
+	RyanJson_t plain = RyanJsonCreateArray();
+	RyanJson_t flat = RyanJsonCreateArray();
+	RyanJson_t table = RyanJsonCreateArray();
+	TEST_ASSERT_NOT_NULL(plain);
+	TEST_ASSERT_NOT_NULL(flat);
+	TEST_ASSERT_NOT_NULL(table);
+	for (int32_t i = 0; i < 18; i++)
+	{
+		TEST_ASSERT_TRUE(RyanJsonInsert(flat, UINT32_MAX, RyanJsonCreateInt(NULL, i)));
+	}
+	for (int32_t i = 1; i <= 16; i++)
+	{
+		RyanJson_t row = RyanJsonCreateObject();
+		TEST_ASSERT_NOT_NULL(row);
+		TEST_ASSERT_TRUE(RyanJsonAddDoubleToObject(row, "y", (double)i + 1.5));
+		TEST_ASSERT_TRUE(RyanJsonAddIntToObject(row, "x", i));
+		TEST_ASSERT_TRUE(RyanJsonInsert(table, UINT32_MAX, row));
+	}
+	TEST_ASSERT_TRUE(RyanJsonInsert(plain, UINT32_MAX, flat));
+	TEST_ASSERT_TRUE(RyanJsonInsert(plain, UINT32_MAX, table));
+
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(plain), RyanJsonHash(packed));
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByIndex(flat, 17), 18));
+	TEST_ASSERT_NOT_EQUAL_UINT32(RyanJsonHash(plain), RyanJsonHash(packed));
+
+	RyanJsonDelete(plain);
+	RyanJsonDelete(packed);
+}
+
+#if true == RyanJsonHashCache
+static void testCompareHashCacheInvalidation(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	RyanJson_t left = createHashRows(hashTestRowCount);
+	RyanJson_t right = createHashRows(hashTestRowCount);
+	uint32_t hash = RyanJsonHash(left);
+	TEST_ASSERT_EQUAL_UINT32(hash, RyanJsonHash(right));
+	TEST_ASSERT_EQUAL_UINT32(hash, RyanJsonHash(left)); // 命中缓存
+
+	// 每种修改都必须作废祖先缓存，改回后哈希复原
+	RyanJson_t row = RyanJsonGetObjectByIndex(left, 7);
+	RyanJson_t tags = RyanJsonGetObjectByKey(row, "tags");
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByIndex(tags, 0), 100));
+	TEST_ASSERT_NOT_EQUAL_UINT32(hash, RyanJsonHash(left));
+	TEST_ASSERT_FALSE(RyanJsonCompare(left, right));
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByIndex(tags, 0), 7));
+	TEST_ASSERT_EQUAL_UINT32(hash, RyanJsonHash(left));
+	TEST_ASSERT_TRUE(RyanJsonCompare(left, right));
+
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(RyanJsonGetObjectByKey(row, "name"), "title"));
+	TEST_ASSERT_NOT_EQUAL_UINT32(hash, RyanJsonHash(left));
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(RyanJsonGetObjectByKey(row, "title"), "name"));
+	TEST_ASSERT_EQUAL_UINT32(hash, RyanJsonHash(left));
+
+	RyanJson_t detached = RyanJsonDetachByIndex(tags, 2);
+	TEST_ASSERT_NOT_NULL(detached);
+	TEST_ASSERT_NOT_EQUAL_UINT32(hash, RyanJsonHash(left));
+	TEST_ASSERT_TRUE(RyanJsonInsert(tags, UINT32_MAX, detached));
+	TEST_ASSERT_EQUAL_UINT32(hash, RyanJsonHash(left));
+
+	TEST_ASSERT_TRUE(RyanJsonChangeStringValue(RyanJsonGetObjectByKey(RyanJsonGetObjectByIndex(right, 20), "name"), "other"));
+	TEST_ASSERT_NOT_EQUAL_UINT32(hash, RyanJsonHash(right));
+	TEST_ASSERT_FALSE(RyanJsonCompare(left, right));
+	TEST_ASSERT_TRUE(RyanJsonCompareOnlyKey(left, right));
+
+	RyanJsonDelete(left);
+	RyanJsonDelete(right);
+
+	unityTestLeakScopeEnd(scope, "子树哈希缓存应随容器释放");
+}
+
+static void testCompareHashCacheOom(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	RyanJson_t left = createHashRows(hashTestRowCount);
+	RyanJson_t right = createHashRows(hashTestRowCount);
+	uint32_t expected = RyanJsonHash(right);
+
+	// 缓存申请失败时照常返回正确结果
+	UNITY_TEST_OOM_BEGIN(0);
+	TEST_ASSERT_EQUAL_UINT32(expected, RyanJsonHash(left));
+	TEST_ASSERT_EQUAL_UINT32(expected, RyanJsonHash(left));
+	TEST_ASSERT_TRUE(RyanJsonCompare(left, right));
+	UNITY_TEST_OOM_END();
+
+	// 仅一侧持有缓存时不做提前判定，逐节点比较结果不变
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByKey(RyanJsonGetObjectByIndex(left, 3), "id"), -1));
+	TEST_ASSERT_FALSE(RyanJsonCompare(left, right));
+
+	RyanJsonDelete(left);
+	RyanJsonDelete(right);
+
+	unityTestLeakScopeEnd(scope, "OOM 路径不应泄漏哈希缓存");
+}
+#endif
+
+void testCompareHashRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+	RUN_TEST(testCompareHashContentSemantics);
+	RUN_TEST(testCompareHashDeepAndPacked);
+#if true == RyanJsonHashCache
+	RUN_TEST(testCompareHashCacheInvalidation);
+	RUN_TEST(testCompareHashCacheOom);
+#endif
+}
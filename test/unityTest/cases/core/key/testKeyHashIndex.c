@@ -0,0 +1,196 @@
+#include "testBase.h"
+
+// 超过 RyanJsonObjectHashIndexMinSize，启用索引时会在首次长扫描后建立
+#define keyHashIndexMemberCount (300U)
+
+/**
+ * @brief 线性扫描基准：返回首个 key 匹配的成员
+ */
+static RyanJson_t findFirstByKeyLinear(RyanJson_t obj, const char *key)
+{
+	RyanJson_t item = NULL;
+	RyanJsonObjectForEach(obj, item)
+	{
+		if (0 == strcmp(RyanJsonGetKey(item), key)) { return item; }
+	}
+	return NULL;
+}
+
+static RyanJson_t createKeyHashIndexDoc(void)
+{
+	RyanJson_t obj = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(obj);
+
+	RyanJsonAppender_t appender;
+	TEST_ASSERT_TRUE(RyanJsonAppenderInit(&appender, obj));
+	for (uint32_t i = 0; i < keyHashIndexMemberCount; i++)
+	{
+		char key[16];
+		RyanJsonSnprintf(key, sizeof(key), "dev%" PRIu32, i);
+		TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, RyanJsonCreateInt(key, (int32_t)i)));
+	}
+	return obj;
+}
+
+/**
+ * @brief 逐个 key 对比“接口查找”与“线性扫描”结果
+ */
+static void assertLookupMatchesLinear(RyanJson_t obj, const char *extraKey)
+{
+	RyanJson_t item = NULL;
+	RyanJsonObjectForEach(obj, item)
+	{
+		const char *key = RyanJsonGetKey(item);
+		TEST_ASSERT_EQUAL_PTR(findFirstByKeyLinear(obj, key), RyanJsonGetObjectByKey(obj, key));
+	}
+	if (NULL != extraKey) { TEST_ASSERT_EQUAL_PTR(findFirstByKeyLinear(obj, extraKey), RyanJsonGetObjectByKey(obj, extraKey)); }
+}
+
+static void testKeyHashIndexLookup(void)
+{
+	RyanJson_t obj = createKeyHashIndexDoc();
+
+	// 先触发一次完整扫描（未命中），之后的查找都应与线性扫描一致
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKey(obj, "missing"));
+	assertLookupMatchesLinear(obj, "missing");
+	TEST_ASSERT_EQUAL_INT(123, RyanJsonGetIntValue(RyanJsonGetObjectByKey(obj, "dev123")));
+	TEST_ASSERT_EQUAL_INT(0, RyanJsonGetIntValue(RyanJsonGetObjectByKey(obj, "dev0")));
+	TEST_ASSERT_EQUAL_INT(299, RyanJsonGetIntValue(RyanJsonGetObjectByKey(obj, "dev299")));
+
+	// 等价文档比较同样依赖按 key 查找
+	RyanJson_t dup = RyanJsonDuplicate(obj);
+	TEST_ASSERT_NOT_NULL(dup);
+	TEST_ASSERT_TRUE(RyanJsonCompare(obj, dup));
+	RyanJsonDelete(dup);
+
+	RyanJsonDelete(obj);
+}
+
+static void testKeyHashIndexMutation(void)
+{
+	RyanJson_t obj = createKeyHashIndexDoc();
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKey(obj, "missing"));
+
+	// Insert / Add
+	TEST_ASSERT_TRUE(RyanJsonInsert(obj, 5, RyanJsonCreateString("inserted", "x")));
+	TEST_ASSERT_TRUE(RyanJsonAddBoolToObject(obj, "added", RyanJsonTrue));
+	assertLookupMatchesLinear(obj, "missing");
+
+	// Detach / Delete
+	RyanJson_t detached = RyanJsonDetachByKey(obj, "dev10");
+	TEST_ASSERT_NOT_NULL(detached);
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKey(obj, "dev10"));
+	RyanJsonDelete(detached);
+	// 头插模式下首个成员是 "added"，按实际首个 key 断言
+	char firstKey[16];
+	RyanJsonSnprintf(firstKey, sizeof(firstKey), "%s", RyanJsonGetKey(RyanJsonGetObjectByIndex(obj, 0)));
+	TEST_ASSERT_TRUE(RyanJsonDeleteByIndex(obj, 0));
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKey(obj, firstKey));
+	assertLookupMatchesLinear(obj, "dev10");
+
+	// Replace（按 key / 按索引换成不同 key）
+	TEST_ASSERT_TRUE(RyanJsonReplaceByKey(obj, "dev20", RyanJsonCreateString("dev20", "replaced")));
+	TEST_ASSERT_EQUAL_STRING("replaced", RyanJsonGetStringValue(RyanJsonGetObjectByKey(obj, "dev20")));
+	TEST_ASSERT_TRUE(RyanJsonReplaceByIndex(obj, 1, RyanJsonCreateInt("renamedByIndex", 1)));
+	assertLookupMatchesLinear(obj, "renamedByIndex");
+
+	// ChangeKey：旧 key 不可再命中，新 key 命中同一节点
+	RyanJson_t node = RyanJsonGetObjectByKey(obj, "dev30");
+	TEST_ASSERT_NOT_NULL(node);
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(node, "dev30-renamed"));
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKey(obj, "dev30"));
+	TEST_ASSERT_EQUAL_PTR(node, RyanJsonGetObjectByKey(obj, "dev30-renamed"));
+	assertLookupMatchesLinear(obj, "dev30");
+
+	// 大量删除后再大量追加（覆盖索引删除与扩容）
+	for (uint32_t i = 100; i < 200; i++)
+	{
+		char key[16];
+		RyanJsonSnprintf(key, sizeof(key), "dev%" PRIu32, i);
+		TEST_ASSERT_TRUE(RyanJsonDeleteByKey(obj, key));
+	}
+	for (uint32_t i = 0; i < 400; i++)
+	{
+		char key[16];
+		RyanJsonSnprintf(key, sizeof(key), "new%" PRIu32, i);
+		TEST_ASSERT_TRUE(RyanJsonAddIntToObject(obj, key, (int32_t)i));
+	}
+	assertLookupMatchesLinear(obj, "dev150");
+
+	RyanJsonDelete(obj);
+}
+
+static void testKeyHashIndexDuplicateKeys(void)
+{
+	RyanJson_t obj = createKeyHashIndexDoc();
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKey(obj, "missing"));
+
+#if true == RyanJsonStrictObjectKeyCheck
+	TEST_ASSERT_FALSE(RyanJsonInsert(obj, 0, RyanJsonCreateInt("dev5", -1)));
+	TEST_ASSERT_FALSE(RyanJsonChangeKey(RyanJsonGetObjectByKey(obj, "dev6"), "dev7"));
+	assertLookupMatchesLinear(obj, NULL);
+#else
+	// 非严格模式：重复 key 始终命中链表中的首个节点
+	TEST_ASSERT_TRUE(RyanJsonInsert(obj, 0, RyanJsonCreateInt("dev5", -1)));
+	TEST_ASSERT_EQUAL_INT(-1, RyanJsonGetIntValue(RyanJsonGetObjectByKey(obj, "dev5")));
+	assertLookupMatchesLinear(obj, NULL);
+
+	TEST_ASSERT_TRUE(RyanJsonDeleteByIndex(obj, 0));
+	TEST_ASSERT_EQUAL_INT(5, RyanJsonGetIntValue(RyanJsonGetObjectByKey(obj, "dev5")));
+
+	RyanJson_t node = RyanJsonGetObjectByKey(obj, "dev7");
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(node, "dev6"));
+	TEST_ASSERT_EQUAL_INT(6, RyanJsonGetIntValue(RyanJsonGetObjectByKey(obj, "dev6")));
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKey(obj, "dev7"));
+	assertLookupMatchesLinear(obj, "dev7");
+
+	// 删除首个重复节点后，第二个节点重新可见
+	TEST_ASSERT_TRUE(RyanJsonDeleteByKey(obj, "dev6"));
+	TEST_ASSERT_EQUAL_PTR(node, RyanJsonGetObjectByKey(obj, "dev6"));
+	assertLookupMatchesLinear(obj, NULL);
+#endif
+
+	RyanJsonDelete(obj);
+}
+
+static void testKeyHashIndexOomFallback(void)
+{
+	RyanJson_t obj = createKeyHashIndexDoc();
+
+	// 建立索引失败只退回线性扫描，查找结果不受影响
+	UNITY_TEST_OOM_BEGIN(0);
+	RyanJson_t missing = RyanJsonGetObjectByKey(obj, "missing");
+	RyanJson_t hit = RyanJsonGetObjectByKey(obj, "dev200");
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_NULL(missing);
+	TEST_ASSERT_NOT_NULL(hit);
+	TEST_ASSERT_EQUAL_INT(200, RyanJsonGetIntValue(hit));
+
+	// 扩容失败时丢弃索引，新成员仍可查到
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKey(obj, "missing"));
+	uint32_t added = 0;
+	for (uint32_t i = 0; i < 200; i++)
+	{
+		char key[16];
+		RyanJsonSnprintf(key, sizeof(key), "oom%" PRIu32, i);
+		RyanJson_t item = RyanJsonCreateInt(key, (int32_t)i);
+		TEST_ASSERT_NOT_NULL(item);
+		UNITY_TEST_OOM_BEGIN(0);
+		RyanJsonBool_e ok = RyanJsonInsert(obj, UINT32_MAX, item);
+		UNITY_TEST_OOM_END();
+		if (RyanJsonTrue == ok) { added++; }
+	}
+	TEST_ASSERT_TRUE(added > 0);
+	assertLookupMatchesLinear(obj, "missing");
+
+	RyanJsonDelete(obj);
+}
+
+void testKeyHashIndexRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+	RUN_TEST(testKeyHashIndexLookup);
+	RUN_TEST(testKeyHashIndexMutation);
+	RUN_TEST(testKeyHashIndexDuplicateKeys);
+	RUN_TEST(testKeyHashIndexOomFallback);
+}
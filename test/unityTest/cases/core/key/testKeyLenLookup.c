@@ -0,0 +1,91 @@
+#include "testBase.h"
+
+static void testKeyLenLookupBorrowedToken(void)
+{
+	RyanJson_t root = RyanJsonParse("{\"id\":1,\"idx\":2,\"i\":3,\"\":4}");
+	TEST_ASSERT_NOT_NULL(root);
+
+	// key 来自未以 '\0' 结尾的输入片段
+	const char *token = "idxyz";
+	TEST_ASSERT_EQUAL_INT(3, RyanJsonGetIntValue(RyanJsonGetObjectByKeyLen(root, token, 1)));
+	TEST_ASSERT_EQUAL_INT(1, RyanJsonGetIntValue(RyanJsonGetObjectByKeyLen(root, token, 2)));
+	TEST_ASSERT_EQUAL_INT(2, RyanJsonGetIntValue(RyanJsonGetObjectByKeyLen(root, token, 3)));
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKeyLen(root, token, 4));
+	TEST_ASSERT_TRUE(RyanJsonHasObjectByKeyLen(root, token, 3));
+	TEST_ASSERT_FALSE(RyanJsonHasObjectByKeyLen(root, token, 5));
+
+	// 空 key：长度为 0 时 key 可为 NULL
+	TEST_ASSERT_EQUAL_INT(4, RyanJsonGetIntValue(RyanJsonGetObjectByKeyLen(root, NULL, 0)));
+	TEST_ASSERT_EQUAL_INT(4, RyanJsonGetIntValue(RyanJsonGetObjectByKeyLen(root, token, 0)));
+
+	// 内嵌 '\0' 的查询不会命中（节点 key 不含 '\0'）
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKeyLen(root, "id\0x", 4));
+
+	// 参数与类型校验
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKeyLen(NULL, token, 2));
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKeyLen(root, NULL, 2));
+	RyanJson_t arr = RyanJsonCreateArray();
+	TEST_ASSERT_NOT_NULL(arr);
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKeyLen(arr, token, 2));
+	RyanJsonDelete(arr);
+
+	RyanJsonDelete(root);
+}
+
+static void testKeyLenLookupLongKeysSameLength(void)
+{
+	// 长 key 走 ptr 模式：长度相同、仅末尾不同的兄弟需要靠指纹/字节比较区分
+	char key[64];
+	RyanJson_t root = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(root);
+	for (uint32_t i = 0; i < 64; i++)
+	{
+		RyanJsonSnprintf(key, sizeof(key), "sensor/channel/temperature/%04" PRIu32, i);
+		TEST_ASSERT_TRUE(RyanJsonAddIntToObject(root, key, (int32_t)i));
+	}
+
+	for (uint32_t i = 0; i < 64; i++)
+	{
+		RyanJsonSnprintf(key, sizeof(key), "sensor/channel/temperature/%04" PRIu32, i);
+		RyanJson_t item = RyanJsonGetObjectByKeyLen(root, key, (uint32_t)strlen(key));
+		TEST_ASSERT_NOT_NULL(item);
+		TEST_ASSERT_EQUAL_INT((int32_t)i, RyanJsonGetIntValue(item));
+		TEST_ASSERT_EQUAL_PTR(item, RyanJsonGetObjectByKey(root, key));
+	}
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKey(root, "sensor/channel/temperature/0064"));
+
+	// 改 key（ptr -> inline -> ptr）后旧 key 不再命中，新 key 立即可查
+	RyanJson_t node = RyanJsonGetObjectByKey(root, "sensor/channel/temperature/0007");
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(node, "t7"));
+	TEST_ASSERT_NULL(RyanJsonGetObjectByKey(root, "sensor/channel/temperature/0007"));
+	TEST_ASSERT_EQUAL_PTR(node, RyanJsonGetObjectByKeyLen(root, "t7", 2));
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(node, "sensor/channel/humidity/00007"));
+	TEST_ASSERT_EQUAL_PTR(node, RyanJsonGetObjectByKey(root, "sensor/channel/humidity/00007"));
+
+	// 只改 String 值（inline -> ptr）不影响 key 查找
+	TEST_ASSERT_TRUE(RyanJsonAddStringToObject(root, "s", "v"));
+	RyanJson_t str = RyanJsonGetObjectByKey(root, "s");
+	TEST_ASSERT_TRUE(RyanJsonChangeStringValue(str, "a string value that no longer fits inline storage"));
+	TEST_ASSERT_EQUAL_PTR(str, RyanJsonGetObjectByKey(root, "s"));
+
+	// 对象比较按 key 对齐，乱序文档仍相等
+	RyanJson_t dup = RyanJsonDuplicate(root);
+	TEST_ASSERT_NOT_NULL(dup);
+	RyanJson_t moved = RyanJsonDetachByKey(dup, "sensor/channel/temperature/0000");
+	TEST_ASSERT_NOT_NULL(moved);
+	TEST_ASSERT_TRUE(RyanJsonInsert(dup, UINT32_MAX, moved));
+	TEST_ASSERT_TRUE(RyanJsonCompare(root, dup));
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(RyanJsonGetObjectByKey(dup, "sensor/channel/temperature/0001"),
+					   "sensor/channel/temperature/9999"));
+	TEST_ASSERT_FALSE(RyanJsonCompare(root, dup));
+	RyanJsonDelete(dup);
+
+	RyanJsonDelete(root);
+}
+
+void testKeyLenLookupRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+	RUN_TEST(testKeyLenLookupBorrowedToken);
+	RUN_TEST(testKeyLenLookupLongKeysSameLength);
+}
@@ -0,0 +1,311 @@
+#include "testBase.h"
+
+static const char *binaryTestText = "{\"name\":\"sensor\\u00e9\\n\",\"id\":-42,\"big\":4294967296,\"ratio\":0.25,\"on\":true,\"off\":false,"
+				    "\"none\":null,\"empty\":{},\"list\":[],\"nested\":{\"deep\":[1,[2,[3,{\"k\":\"v\"}]],\"tail\"]},"
+				    "\"description\":\"a string value long enough to be stored out of line\",\"last\":[true,null,1.5e3]}";
+
+/**
+ * @brief 改写镜像内容后重新计算校验和，用于构造“校验和正确但结构损坏”的镜像
+ */
+static void binaryResign(uint8_t *image)
+{
+	RyanJsonBinaryHead_t head;
+	memcpy(&head, image, sizeof(head));
+	head.checksum = RyanJsonInternalBinaryChecksum(image + sizeof(head), head.totalSize - (uint32_t)sizeof(head));
+	memcpy(image, &head, sizeof(head));
+}
+
+static RyanJsonTapeEntry_t *binaryEntries(uint8_t *image)
+{
+	return RyanJsonTapeEntries(image + sizeof(RyanJsonBinaryHead_t));
+}
+
+static void testBinaryRelocate(void)
+{
+	RyanJson_t tree = RyanJsonParse(binaryTestText);
+	TEST_ASSERT_NOT_NULL(tree);
+
+	uint32_t len = 0;
+	uint8_t *image = RyanJsonSaveBinary(tree, &len);
+	TEST_ASSERT_NOT_NULL(image);
+	TEST_ASSERT_TRUE(len > sizeof(RyanJsonBinaryHead_t));
+
+	// 搬到另一块内存（模拟写入 flash 后重启映射），原镜像释放后仍可使用
+	uint8_t *flash = (uint8_t *)malloc(len);
+	TEST_ASSERT_NOT_NULL(flash);
+	memcpy(flash, image, len);
+	RyanJsonFree(image);
+
+	RyanJsonTape_t tape = RyanJsonLoadBinary(flash, len);
+	TEST_ASSERT_NOT_NULL(tape);
+	RyanJsonTapeVal_t root = RyanJsonTapeGetRoot(tape);
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonGetSize(tree), RyanJsonTapeGetSize(root));
+	TEST_ASSERT_EQUAL_STRING("sensor\xc3\xa9\n", RyanJsonTapeGetStringValue(RyanJsonTapeGetObjectByKey(root, "name")));
+	TEST_ASSERT_EQUAL_INT(-42, RyanJsonTapeGetIntValue(RyanJsonTapeGetObjectByKey(root, "id")));
+	TEST_ASSERT_EQUAL_DOUBLE(4294967296.0, RyanJsonTapeGetDoubleValue(RyanJsonTapeGetObjectByKey(root, "big")));
+	RyanJsonTapeVal_t deep = RyanJsonTapeGetObjectByKey(RyanJsonTapeGetObjectByKey(root, "nested"), "deep");
+	TEST_ASSERT_EQUAL_STRING("tail", RyanJsonTapeGetStringValue(RyanJsonTapeGetObjectByIndex(deep, 2)));
+
+	// 转为可修改的树后与原树一致，打印结果相同
+	RyanJson_t loaded = RyanJsonTapeToTree(root);
+	TEST_ASSERT_NOT_NULL(loaded);
+	TEST_ASSERT_TRUE(RyanJsonCompare(tree, loaded));
+	char *expect = RyanJsonPrint(tree, 256, RyanJsonFalse, NULL);
+	char *actual = RyanJsonPrint(loaded, 256, RyanJsonFalse, NULL);
+	TEST_ASSERT_EQUAL_STRING(expect, actual);
+	RyanJsonFree(expect);
+	RyanJsonFree(actual);
+	TEST_ASSERT_TRUE(RyanJsonAddIntToObject(loaded, "added", 1));
+	RyanJsonDelete(loaded);
+
+	// 镜像后附带多余字节（如整个 flash 分区）时照常加载
+	uint8_t *larger = (uint8_t *)malloc(len + 64U);
+	TEST_ASSERT_NOT_NULL(larger);
+	memcpy(larger, flash, len);
+	memset(larger + len, 0xFF, 64U);
+	TEST_ASSERT_NOT_NULL(RyanJsonLoadBinary(larger, len + 64U));
+	free(larger);
+	free(flash);
+
+	// 子树与标量根节点，子树保留自身 key
+	image = RyanJsonSaveBinary(RyanJsonGetObjectByKey(tree, "nested"), &len);
+	TEST_ASSERT_NOT_NULL(image);
+	tape = RyanJsonLoadBinary(image, len);
+	TEST_ASSERT_NOT_NULL(tape);
+	TEST_ASSERT_EQUAL_STRING("nested", RyanJsonTapeGetKey(RyanJsonTapeGetRoot(tape)));
+	loaded = RyanJsonTapeToTree(RyanJsonTapeGetRoot(tape));
+	TEST_ASSERT_TRUE(RyanJsonCompare(RyanJsonGetObjectByKey(tree, "nested"), loaded));
+	RyanJsonDelete(loaded);
+	RyanJsonFree(image);
+
+	image = RyanJsonSaveBinary(RyanJsonGetObjectByKey(tree, "ratio"), &len);
+	TEST_ASSERT_NOT_NULL(image);
+	tape = RyanJsonLoadBinary(image, len);
+	TEST_ASSERT_NOT_NULL(tape);
+	TEST_ASSERT_EQUAL_DOUBLE(0.25, RyanJsonTapeGetDoubleValue(RyanJsonTapeGetRoot(tape)));
+	TEST_ASSERT_NULL(RyanJsonTapeGetNext(RyanJsonTapeGetRoot(tape)));
+	RyanJsonFree(image);
+	RyanJsonDelete(tree);
+
+	// 重复的 key 与字符串值在镜像中只存一份
+	tree = RyanJsonParse("[{\"mode\":\"AUTOMATIC\",\"id\":1},{\"mode\":\"AUTOMATIC\",\"id\":2}]");
+	TEST_ASSERT_NOT_NULL(tree);
+	image = RyanJsonSaveBinary(tree, &len);
+	TEST_ASSERT_NOT_NULL(image);
+	tape = RyanJsonLoadBinary(image, len);
+	TEST_ASSERT_NOT_NULL(tape);
+	RyanJsonTapeVal_t first = RyanJsonTapeGetObjectByKey(RyanJsonTapeGetObjectByIndex(RyanJsonTapeGetRoot(tape), 0), "mode");
+	RyanJsonTapeVal_t second = RyanJsonTapeGetObjectByKey(RyanJsonTapeGetObjectByIndex(RyanJsonTapeGetRoot(tape), 1), "mode");
+	TEST_ASSERT_TRUE(RyanJsonTapeGetKey(first) == RyanJsonTapeGetKey(second));
+	TEST_ASSERT_TRUE(RyanJsonTapeGetStringValue(first) == RyanJsonTapeGetStringValue(second));
+	loaded = RyanJsonTapeToTree(RyanJsonTapeGetRoot(tape));
+	TEST_ASSERT_TRUE(RyanJsonCompare(tree, loaded));
+	RyanJsonDelete(loaded);
+	RyanJsonFree(image);
+	RyanJsonDelete(tree);
+}
+
+static void testBinaryRejectsDamage(void)
+{
+	RyanJson_t tree = RyanJsonParse(binaryTestText);
+	TEST_ASSERT_NOT_NULL(tree);
+	uint32_t len = 0;
+	uint8_t *image = RyanJsonSaveBinary(tree, &len);
+	TEST_ASSERT_NOT_NULL(image);
+	RyanJsonDelete(tree);
+
+	uint8_t *copy = (uint8_t *)malloc(len + 8U);
+	TEST_ASSERT_NOT_NULL(copy);
+
+	// 任一字节被改写都会被头部或校验和拒绝
+	for (uint32_t i = 0; i < len; i++)
+	{
+		memcpy(copy, image, len);
+		copy[i] ^= 0x5AU;
+		TEST_ASSERT_NULL(RyanJsonLoadBinary(copy, len));
+	}
+
+	// 截断、未对齐、版本不符
+	memcpy(copy, image, len);
+	TEST_ASSERT_NOT_NULL(RyanJsonLoadBinary(copy, len));
+	TEST_ASSERT_NULL(RyanJsonLoadBinary(copy, len - 1U));
+	TEST_ASSERT_NULL(RyanJsonLoadBinary(copy, (uint32_t)sizeof(RyanJsonBinaryHead_t)));
+	TEST_ASSERT_NULL(RyanJsonLoadBinary(NULL, len));
+	memmove(copy + 2, copy, len);
+	TEST_ASSERT_NULL(RyanJsonLoadBinary(copy + 2, len));
+
+	RyanJsonBinaryHead_t head;
+	memcpy(copy, image, len);
+	memcpy(&head, copy, sizeof(head));
+	head.version ^= 1U;
+	memcpy(copy, &head, sizeof(head));
+	TEST_ASSERT_NULL(RyanJsonLoadBinary(copy, len));
+
+	// 校验和正确但结构损坏：span、子节点数、字符串偏移、key 长度
+	RyanJsonTape_t tape = (RyanJsonTape_t)(void *)(image + sizeof(RyanJsonBinaryHead_t));
+	uint32_t lastContainer = 0;
+	uint32_t firstString = 0;
+	for (uint32_t i = tape->entryCount - 1U; i-- > 0;)
+	{
+		uint32_t type = RyanJsonTapeEntryType(&binaryEntries(image)[i]);
+		if (RyanJsonTypeString == type) { firstString = i; }
+		if (0U == lastContainer && i > 0U && (RyanJsonTypeArray == type || RyanJsonTypeObject == type)) { lastContainer = i; }
+	}
+	TEST_ASSERT_TRUE(0U != lastContainer && 0U != firstString);
+
+	const uint32_t caseCount = 6;
+	for (uint32_t c = 0; c < caseCount; c++)
+	{
+		memcpy(copy, image, len);
+		RyanJsonTapeEntry_t *entries = binaryEntries(copy);
+		switch (c)
+		{
+		case 0: entries[0].value.container.span--; break;
+		case 1: entries[lastContainer].value.container.span++; break;
+		case 2: entries[lastContainer].value.container.count++; break;
+		case 3: entries[firstString].value.str.off += 4096U; break;
+		case 4: entries[firstString].value.str.len++; break;
+		default: entries[1].tag += 1U << RyanJsonTapeTagKeyLenShift; break;
+		}
+		binaryResign(copy);
+		TEST_ASSERT_NULL_MESSAGE(RyanJsonLoadBinary(copy, len), "结构损坏的镜像应被拒绝");
+	}
+
+	free(copy);
+	RyanJsonFree(image);
+
+	// 伪造“无需转义”标记：含引号的字符串若被整段打印会输出非法 Json，加载时应拒绝
+	tree = RyanJsonParse("{\"q\":\"say \\\"hi\\\"\",\"ok\":\"plain\"}");
+	TEST_ASSERT_NOT_NULL(tree);
+	image = RyanJsonSaveBinary(tree, &len);
+	TEST_ASSERT_NOT_NULL(image);
+	RyanJsonDelete(tree);
+	RyanJsonTapeEntry_t *entries = binaryEntries(image);
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonTypeString, RyanJsonTapeEntryType(&entries[1]));
+	TEST_ASSERT_EQUAL_UINT32(0, entries[1].tag & RyanJsonTapeTagFlag);
+	RyanJsonTape_t forged = RyanJsonLoadBinary(image, len);
+	TEST_ASSERT_NOT_NULL(forged);
+	tree = RyanJsonTapeToTree(RyanJsonTapeGetRoot(forged));
+	TEST_ASSERT_NOT_NULL(tree);
+	char *printed = RyanJsonPrint(tree, 64, RyanJsonFalse, NULL);
+	TEST_ASSERT_EQUAL_STRING("{\"q\":\"say \\\"hi\\\"\",\"ok\":\"plain\"}", printed);
+	RyanJsonFree(printed);
+	RyanJsonDelete(tree);
+
+	entries[1].tag |= RyanJsonTapeTagFlag;
+	binaryResign(image);
+	TEST_ASSERT_NULL(RyanJsonLoadBinary(image, len));
+	RyanJsonFree(image);
+}
+
+#if true == RyanJsonPackedArray
+static void testBinaryPacked(void)
+{
+	const int32_t ids[] = {3, -1, 7, 1000000};
+	const double weights[] = {0.5, -2.25, 1e100};
+	const float temps[] = {1.5F, -3.25F};
+	const char *const keys[] = {"id", "temp"};
+	const RyanJsonPackedType_e types[] = {RyanJsonPackedTypeInt, RyanJsonPackedTypeFloat};
+	const int32_t tableIds[] = {1, 2};
+	const void *const columns[] = {tableIds, temps};
+
+	RyanJson_t tree = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(tree);
+	TEST_ASSERT_TRUE(RyanJsonAddItemToObject(tree, "ids", RyanJsonCreatePackedIntArray(ids, 4)));
+	TEST_ASSERT_TRUE(RyanJsonAddItemToObject(tree, "weights", RyanJsonCreatePackedDoubleArray(weights, 3)));
+	TEST_ASSERT_TRUE(RyanJsonAddItemToObject(tree, "rows", RyanJsonCreatePackedTable(keys, types, columns, 2, 2)));
+
+	uint32_t len = 0;
+	uint8_t *image = RyanJsonSaveBinary(tree, &len);
+	TEST_ASSERT_NOT_NULL(image);
+	TEST_ASSERT_TRUE(RyanJsonIsPackedArray(RyanJsonGetObjectByKey(tree, "ids")));
+
+	// 紧凑数组按等价普通 Array 写出
+	RyanJsonTape_t tape = RyanJsonLoadBinary(image, len);
+	TEST_ASSERT_NOT_NULL(tape);
+	RyanJsonTapeVal_t root = RyanJsonTapeGetRoot(tape);
+	TEST_ASSERT_EQUAL_INT(1000000, RyanJsonTapeGetIntValue(RyanJsonTapeGetObjectByIndex(RyanJsonTapeGetObjectByKey(root, "ids"), 3)));
+	RyanJsonTapeVal_t weightsVal = RyanJsonTapeGetObjectByKey(root, "weights");
+	TEST_ASSERT_EQUAL_DOUBLE(1e100, RyanJsonTapeGetDoubleValue(RyanJsonTapeGetObjectByIndex(weightsVal, 2)));
+	RyanJsonTapeVal_t row = RyanJsonTapeGetObjectByIndex(RyanJsonTapeGetObjectByKey(root, "rows"), 1);
+	TEST_ASSERT_EQUAL_INT(2, RyanJsonTapeGetIntValue(RyanJsonTapeGetObjectByKey(row, "id")));
+	TEST_ASSERT_EQUAL_DOUBLE(-3.25, RyanJsonTapeGetDoubleValue(RyanJsonTapeGetObjectByKey(row, "temp")));
+	TEST_ASSERT_TRUE(RyanJsonTapeGetKey(row + 1) == RyanJsonTapeGetKey(RyanJsonTapeGetObjectValue(RyanJsonTapeGetObjectValue(
+								       RyanJsonTapeGetObjectByKey(root, "rows")))));
+
+	RyanJson_t loaded = RyanJsonTapeToTree(root);
+	TEST_ASSERT_NOT_NULL(loaded);
+	TEST_ASSERT_TRUE(RyanJsonCompare(tree, loaded));
+	RyanJsonDelete(loaded);
+
+	RyanJsonFree(image);
+	RyanJsonDelete(tree);
+}
+#endif
+
+static void testBinaryDeepAndOom(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	// 深层嵌套：保存与校验都不使用递归
+	const uint32_t depth = 3000;
+	RyanJson_t deep = RyanJsonCreateArray();
+	TEST_ASSERT_NOT_NULL(deep);
+	TEST_ASSERT_TRUE(RyanJsonAddIntToArray(deep, 7));
+	for (uint32_t i = 0; i < depth; i++)
+	{
+		RyanJson_t arr = RyanJsonCreateArray();
+		TEST_ASSERT_NOT_NULL(arr);
+		TEST_ASSERT_TRUE(RyanJsonAddItemToArray(arr, deep));
+		deep = arr;
+	}
+	uint32_t len = 0;
+	uint8_t *image = RyanJsonSaveBinary(deep, &len);
+	TEST_ASSERT_NOT_NULL(image);
+	RyanJsonTape_t tape = RyanJsonLoadBinary(image, len);
+	TEST_ASSERT_NOT_NULL(tape);
+	RyanJson_t loaded = RyanJsonTapeToTree(RyanJsonTapeGetRoot(tape));
+	TEST_ASSERT_TRUE(RyanJsonCompare(deep, loaded));
+	RyanJsonDelete(loaded);
+	RyanJsonFree(image);
+	RyanJsonDelete(deep);
+
+	// 逐步注入 OOM：保存失败不泄漏，加载不申请内存
+	RyanJson_t tree = RyanJsonParse(binaryTestText);
+	TEST_ASSERT_NOT_NULL(tree);
+	for (uint32_t mode = 0; mode < 2U; mode++)
+	{
+		image = NULL;
+		for (uint32_t budget = 0; NULL == image; budget++)
+		{
+			TEST_ASSERT_TRUE_MESSAGE(budget < 64U, "镜像保存在有限次分配内应成功");
+			if (0U == mode) { UNITY_TEST_OOM_BEGIN(budget); }
+			else
+			{
+				UNITY_TEST_OOM_BEGIN_NO_REALLOC(budget);
+			}
+			image = RyanJsonSaveBinary(tree, &len);
+			UNITY_TEST_OOM_END();
+		}
+
+		UNITY_TEST_OOM_BEGIN(0);
+		tape = RyanJsonLoadBinary(image, len);
+		UNITY_TEST_OOM_END();
+		TEST_ASSERT_NOT_NULL(tape);
+		RyanJsonFree(image);
+	}
+	RyanJsonDelete(tree);
+
+	unityTestLeakScopeEnd(scope, "镜像保存失败路径不应泄漏");
+}
+
+void testBinaryRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+	RUN_TEST(testBinaryRelocate);
+	RUN_TEST(testBinaryRejectsDamage);
+#if true == RyanJsonPackedArray
+	RUN_TEST(testBinaryPacked);
+#endif
+	RUN_TEST(testBinaryDeepAndOom);
+}
@@ -0,0 +1,313 @@
+#include "testBase.h"
+
+/**
+ * @brief 断言 Blob 节点内容与期望字节一致
+ */
+static void blobAssertValue(RyanJson_t pJson, const void *expect, uint32_t expectLen)
+{
+	TEST_ASSERT_TRUE(RyanJsonIsBlob(pJson));
+	uint32_t len = UINT32_MAX;
+	const uint8_t *data = RyanJsonGetBlobValue(pJson, &len);
+	TEST_ASSERT_EQUAL_UINT32(expectLen, len);
+	if (expectLen > 0U) { TEST_ASSERT_EQUAL_HEX8_ARRAY(expect, data, expectLen); }
+}
+
+static void blobAssertPrint(RyanJson_t pJson, const char *expect)
+{
+	char *actual = RyanJsonPrint(pJson, 64, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(actual);
+	TEST_ASSERT_EQUAL_STRING(expect, actual);
+	RyanJsonFree(actual);
+}
+
+static void testBlobCreateAndPrint(void)
+{
+	// RFC 4648 第 10 节测试向量
+	static const char *vectors[][2] = {
+		{"", "\"\""},
+		{"f", "\"Zg==\""},
+		{"fo", "\"Zm8=\""},
+		{"foo", "\"Zm9v\""},
+		{"foob", "\"Zm9vYg==\""},
+		{"fooba", "\"Zm9vYmE=\""},
+		{"foobar", "\"Zm9vYmFy\""},
+	};
+	for (uint32_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++)
+	{
+		uint32_t len = (uint32_t)strlen(vectors[i][0]);
+		RyanJson_t blob = RyanJsonCreateBlob(NULL, vectors[i][0], len);
+		TEST_ASSERT_NOT_NULL(blob);
+		blobAssertValue(blob, vectors[i][0], len);
+		TEST_ASSERT_FALSE(RyanJsonIsString(blob));
+		blobAssertPrint(blob, vectors[i][1]);
+		RyanJsonDelete(blob);
+	}
+
+	// 空数据允许 data 为 NULL；任意字节（含 0 与高位）都按原样保存
+	RyanJson_t root = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(root);
+	TEST_ASSERT_TRUE(RyanJsonAddBlobToObject(root, "empty", NULL, 0));
+	const uint8_t raw[] = {0x00, 0xff, 0xfe, 0x10, 0x80};
+	RyanJson_t list = RyanJsonCreateArray();
+	TEST_ASSERT_NOT_NULL(list);
+	TEST_ASSERT_TRUE(RyanJsonAddBlobToArray(list, raw, sizeof(raw)));
+	TEST_ASSERT_TRUE(RyanJsonAddItemToObject(root, "list", list));
+	blobAssertValue(RyanJsonGetObjectByKey(root, "empty"), NULL, 0);
+	blobAssertValue(RyanJsonGetObjectByIndex(RyanJsonGetObjectByKey(root, "list"), 0), raw, sizeof(raw));
+	TEST_ASSERT_TRUE(RyanJsonIsKey(RyanJsonGetObjectByKey(root, "empty")));
+
+	// 非 Blob 节点取值返回 NULL 且长度为 0
+	uint32_t len = 99;
+	TEST_ASSERT_NULL(RyanJsonGetBlobValue(root, &len));
+	TEST_ASSERT_EQUAL_UINT32(0, len);
+	TEST_ASSERT_NULL(RyanJsonCreateBlob(NULL, NULL, 3));
+	RyanJsonDelete(root);
+}
+
+static void testBlobDecodeBase64(void)
+{
+	RyanJson_t root = RyanJsonParse("{\"ota\":{\"chunk\":\"AP/+EIA=\",\"name\":\"fw\"},\"list\":[\"Zm9vYmFy\",1]}");
+	TEST_ASSERT_NOT_NULL(root);
+	char *before = RyanJsonPrint(root, 128, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(before);
+
+	// 原地转换：节点地址、key 与所在位置不变，序列化结果不变
+	RyanJson_t chunk = RyanJsonGetObjectToKey(root, "ota", "chunk");
+	TEST_ASSERT_TRUE(RyanJsonDecodeBase64ToKey(root, "ota", "chunk"));
+	TEST_ASSERT_TRUE(chunk == RyanJsonGetObjectToKey(root, "ota", "chunk"));
+	const uint8_t raw[] = {0x00, 0xff, 0xfe, 0x10, 0x80};
+	blobAssertValue(chunk, raw, sizeof(raw));
+	TEST_ASSERT_EQUAL_STRING("chunk", RyanJsonGetKey(chunk));
+	TEST_ASSERT_EQUAL_STRING("fw", RyanJsonGetStringValue(RyanJsonGetObjectToKey(root, "ota", "name")));
+
+	RyanJson_t item = RyanJsonGetObjectByIndex(RyanJsonGetObjectByKey(root, "list"), 0);
+	TEST_ASSERT_TRUE(RyanJsonDecodeBase64(item));
+	blobAssertValue(item, "foobar", 6);
+	TEST_ASSERT_TRUE(item == RyanJsonGetObjectByIndex(RyanJsonGetObjectByKey(root, "list"), 0));
+
+	char *after = RyanJsonPrint(root, 128, RyanJsonFalse, NULL);
+	TEST_ASSERT_EQUAL_STRING(before, after);
+	RyanJsonFree(before);
+	RyanJsonFree(after);
+
+	// 已是 Blob、非 String、路径不存在均失败
+	TEST_ASSERT_FALSE(RyanJsonDecodeBase64(chunk));
+	TEST_ASSERT_FALSE(RyanJsonDecodeBase64(RyanJsonGetObjectByIndex(RyanJsonGetObjectByKey(root, "list"), 1)));
+	TEST_ASSERT_FALSE(RyanJsonDecodeBase64ToKey(root, "ota", "missing"));
+	TEST_ASSERT_FALSE(RyanJsonDecodeBase64(NULL));
+	RyanJsonDelete(root);
+}
+
+static void testBlobRejectNonCanonical(void)
+{
+	// 只接受规范形式，保证重新编码后与原文逐字节一致
+	static const char *texts[] = {
+		"Zg=",        // 长度不是 4 的倍数
+		"Zh==",       // 填充前的多余位不为 0
+		"Zm8/Zm9v!",  // 非法字符
+		"Zm9v!A==",   // 非法字符
+		"Z=g=",       // 填充位于中间
+		"Zm9v====",   // 填充过多
+		"Zm9 v",      // 含空白
+		"Zm9v\nYmFy", // 含换行
+		"=Zm9",       // 以填充开头
+	};
+	for (uint32_t i = 0; i < sizeof(texts) / sizeof(texts[0]); i++)
+	{
+		RyanJson_t str = RyanJsonCreateString("k", texts[i]);
+		TEST_ASSERT_NOT_NULL(str);
+		TEST_ASSERT_FALSE_MESSAGE(RyanJsonDecodeBase64(str), texts[i]);
+		TEST_ASSERT_TRUE(RyanJsonIsString(str));
+		TEST_ASSERT_EQUAL_STRING(texts[i], RyanJsonGetStringValue(str));
+		TEST_ASSERT_EQUAL_STRING("k", RyanJsonGetKey(str));
+		RyanJsonDelete(str);
+	}
+
+	// 空字符串是合法的空数据
+	RyanJson_t empty = RyanJsonCreateString(NULL, "");
+	TEST_ASSERT_TRUE(RyanJsonDecodeBase64(empty));
+	blobAssertValue(empty, NULL, 0);
+	blobAssertPrint(empty, "\"\"");
+	RyanJsonDelete(empty);
+}
+
+static void testBlobChangeAndCompare(void)
+{
+	RyanJson_t root = RyanJsonParse("{\"a\":1,\"bin\":\"Zm9v\",\"z\":true}");
+	TEST_ASSERT_NOT_NULL(root);
+	RyanJson_t bin = RyanJsonGetObjectByKey(root, "bin");
+	TEST_ASSERT_TRUE(RyanJsonDecodeBase64(bin));
+
+	// 修改数据与 key 后节点仍是 Blob，原数据不受影响
+	TEST_ASSERT_TRUE(RyanJsonChangeBlobValue(bin, "foobar", 6));
+	blobAssertValue(bin, "foobar", 6);
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(bin, "payloadKeyLongerThanInline"));
+	blobAssertValue(bin, "foobar", 6);
+	TEST_ASSERT_TRUE(bin == RyanJsonGetObjectByKey(root, "payloadKeyLongerThanInline"));
+	blobAssertPrint(root, "{\"a\":1,\"payloadKeyLongerThanInline\":\"Zm9vYmFy\",\"z\":true}");
+	TEST_ASSERT_TRUE(RyanJsonChangeBlobValue(bin, NULL, 0));
+	blobAssertValue(bin, NULL, 0);
+	TEST_ASSERT_TRUE(RyanJsonChangeBlobValue(bin, "foobar", 6));
+	TEST_ASSERT_FALSE(RyanJsonChangeBlobValue(RyanJsonGetObjectByKey(root, "a"), "x", 1));
+
+	// 复制后内容相等；Blob 与同文本的 String 不相等
+	RyanJson_t copy = RyanJsonDuplicate(root);
+	TEST_ASSERT_NOT_NULL(copy);
+	TEST_ASSERT_TRUE(RyanJsonCompare(root, copy));
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(root), RyanJsonHash(copy));
+	RyanJson_t copyBin = RyanJsonGetObjectByKey(copy, "payloadKeyLongerThanInline");
+	TEST_ASSERT_TRUE(RyanJsonChangeBlobValue(copyBin, "foobaz", 6));
+	blobAssertValue(bin, "foobar", 6);
+	TEST_ASSERT_FALSE(RyanJsonCompare(root, copy));
+	TEST_ASSERT_TRUE(RyanJsonCompareOnlyKey(root, copy));
+
+	RyanJson_t text = RyanJsonParse("{\"a\":1,\"payloadKeyLongerThanInline\":\"Zm9vYmFy\",\"z\":true}");
+	TEST_ASSERT_NOT_NULL(text);
+	TEST_ASSERT_FALSE(RyanJsonCompare(root, text));
+	TEST_ASSERT_TRUE(RyanJsonDecodeBase64ToKey(text, "payloadKeyLongerThanInline"));
+	TEST_ASSERT_TRUE(RyanJsonCompare(root, text));
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(root), RyanJsonHash(text));
+
+	RyanJsonDelete(text);
+	RyanJsonDelete(copy);
+	RyanJsonDelete(root);
+}
+
+static void testBlobCodec(void)
+{
+	const uint8_t raw[] = {'a', 'b', 'c'};
+	RyanJson_t root = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(root);
+	TEST_ASSERT_TRUE(RyanJsonAddBlobToObject(root, "b", raw, sizeof(raw)));
+
+	// Blob 编码为字节串，解码后仍为 Blob
+	static const uint8_t cbor[] = {0xa1, 0x61, 'b', 0x43, 'a', 'b', 'c'};
+	static const uint8_t msgPack[] = {0x81, 0xa1, 'b', 0xc4, 0x03, 'a', 'b', 'c'};
+	const uint8_t *expect[] = {cbor, msgPack};
+	const uint32_t expectLen[] = {sizeof(cbor), sizeof(msgPack)};
+	for (uint32_t codec = RyanJsonCodecCbor; codec <= RyanJsonCodecMsgPack; codec++)
+	{
+		uint32_t len = 0;
+		uint8_t *data = RyanJsonPrintCodec(root, (RyanJsonCodec_e)codec, 0, &len);
+		TEST_ASSERT_NOT_NULL(data);
+		TEST_ASSERT_EQUAL_UINT32(expectLen[codec - RyanJsonCodecCbor], len);
+		TEST_ASSERT_EQUAL_HEX8_ARRAY(expect[codec - RyanJsonCodecCbor], data, len);
+		RyanJson_t decoded = RyanJsonParseCodec(data, len, (RyanJsonCodec_e)codec, NULL);
+		TEST_ASSERT_NOT_NULL(decoded);
+		blobAssertValue(RyanJsonGetObjectByKey(decoded, "b"), raw, sizeof(raw));
+		TEST_ASSERT_TRUE(RyanJsonCompare(root, decoded));
+		RyanJsonDelete(decoded);
+		RyanJsonFree(data);
+	}
+
+	// 长度跨越 bin8/bin16 边界
+	uint8_t big[300];
+	for (uint32_t i = 0; i < sizeof(big); i++) { big[i] = (uint8_t)i; }
+	TEST_ASSERT_TRUE(RyanJsonChangeBlobValue(RyanJsonGetObjectByKey(root, "b"), big, sizeof(big)));
+	uint32_t len = 0;
+	uint8_t *data = RyanJsonPrintCodec(root, RyanJsonCodecMsgPack, 0, &len);
+	TEST_ASSERT_NOT_NULL(data);
+	TEST_ASSERT_EQUAL_HEX8(0xc5, data[3]);
+	RyanJson_t decoded = RyanJsonParseCodec(data, len, RyanJsonCodecMsgPack, NULL);
+	blobAssertValue(RyanJsonGetObjectByKey(decoded, "b"), big, sizeof(big));
+	RyanJsonDelete(decoded);
+	RyanJsonFree(data);
+	RyanJsonDelete(root);
+}
+
+static void testBlobBinaryImage(void)
+{
+	RyanJson_t root = RyanJsonParse("{\"bin\":\"Zm9vYmFy\",\"n\":1}");
+	TEST_ASSERT_NOT_NULL(root);
+	TEST_ASSERT_TRUE(RyanJsonDecodeBase64ToKey(root, "bin"));
+
+	// 镜像中 Blob 以 base64 字符串保存
+	uint32_t len = 0;
+	uint8_t *image = RyanJsonSaveBinary(root, &len);
+	TEST_ASSERT_NOT_NULL(image);
+	RyanJsonTape_t tape = RyanJsonLoadBinary(image, len);
+	TEST_ASSERT_NOT_NULL(tape);
+	RyanJsonTapeVal_t tapeRoot = RyanJsonTapeGetRoot(tape);
+	TEST_ASSERT_EQUAL_STRING("Zm9vYmFy", RyanJsonTapeGetStringValue(RyanJsonTapeGetObjectByKey(tapeRoot, "bin")));
+
+	RyanJson_t loaded = RyanJsonTapeToTree(tapeRoot);
+	TEST_ASSERT_NOT_NULL(loaded);
+	TEST_ASSERT_TRUE(RyanJsonDecodeBase64ToKey(loaded, "bin"));
+	TEST_ASSERT_TRUE(RyanJsonCompare(root, loaded));
+	RyanJsonDelete(loaded);
+	RyanJsonFree(image);
+	RyanJsonDelete(root);
+}
+
+static void testBlobOom(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	RyanJson_t root = RyanJsonParse("{\"a\":\"Zm9vYmFy\",\"b\":[\"AP/+EIA=\"]}");
+	TEST_ASSERT_NOT_NULL(root);
+
+	// 分配失败时节点保持 String 不变，重试后成功
+	RyanJsonBool_e ok = RyanJsonFalse;
+	for (uint32_t budget = 0; RyanJsonFalse == ok; budget++)
+	{
+		TEST_ASSERT_TRUE_MESSAGE(budget < 8U, "转换在有限次分配内应成功");
+		UNITY_TEST_OOM_BEGIN(budget);
+		ok = RyanJsonDecodeBase64ToKey(root, "a");
+		UNITY_TEST_OOM_END();
+		if (RyanJsonFalse == ok)
+		{
+			TEST_ASSERT_TRUE(RyanJsonIsString(RyanJsonGetObjectByKey(root, "a")));
+			TEST_ASSERT_EQUAL_STRING("Zm9vYmFy", RyanJsonGetStringValue(RyanJsonGetObjectByKey(root, "a")));
+		}
+	}
+	TEST_ASSERT_TRUE(RyanJsonDecodeBase64(RyanJsonGetObjectByIndex(RyanJsonGetObjectByKey(root, "b"), 0)));
+
+	RyanJson_t copy = NULL;
+	for (uint32_t budget = 0; NULL == copy; budget++)
+	{
+		TEST_ASSERT_TRUE_MESSAGE(budget < 16U, "复制在有限次分配内应成功");
+		UNITY_TEST_OOM_BEGIN(budget);
+		copy = RyanJsonDuplicate(root);
+		UNITY_TEST_OOM_END();
+	}
+	TEST_ASSERT_TRUE(RyanJsonCompare(root, copy));
+
+	char *text = NULL;
+	for (uint32_t budget = 0; NULL == text; budget++)
+	{
+		TEST_ASSERT_TRUE_MESSAGE(budget < 16U, "打印在有限次分配内应成功");
+		UNITY_TEST_OOM_BEGIN(budget);
+		text = RyanJsonPrint(copy, 4, RyanJsonFalse, NULL);
+		UNITY_TEST_OOM_END();
+	}
+	TEST_ASSERT_EQUAL_STRING("{\"a\":\"Zm9vYmFy\",\"b\":[\"AP/+EIA=\"]}", text);
+	RyanJsonFree(text);
+
+	ok = RyanJsonFalse;
+	for (uint32_t budget = 0; RyanJsonFalse == ok; budget++)
+	{
+		TEST_ASSERT_TRUE_MESSAGE(budget < 8U, "修改在有限次分配内应成功");
+		UNITY_TEST_OOM_BEGIN(budget);
+		ok = RyanJsonChangeBlobValue(RyanJsonGetObjectByKey(copy, "a"), "xyz", 3);
+		UNITY_TEST_OOM_END();
+		if (RyanJsonFalse == ok) { blobAssertValue(RyanJsonGetObjectByKey(copy, "a"), "foobar", 6); }
+	}
+	blobAssertValue(RyanJsonGetObjectByKey(copy, "a"), "xyz", 3);
+	blobAssertValue(RyanJsonGetObjectByKey(root, "a"), "foobar", 6);
+
+	RyanJsonDelete(copy);
+	RyanJsonDelete(root);
+	unityTestLeakScopeEnd(scope, "Blob 失败路径不应泄漏");
+}
+
+void testBlobRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+	RUN_TEST(testBlobCreateAndPrint);
+	RUN_TEST(testBlobDecodeBase64);
+	RUN_TEST(testBlobRejectNonCanonical);
+	RUN_TEST(testBlobChangeAndCompare);
+	RUN_TEST(testBlobCodec);
+	RUN_TEST(testBlobBinaryImage);
+	RUN_TEST(testBlobOom);
+}
@@ -0,0 +1,356 @@
+#include "testBase.h"
+
+static const char *codecTestText = "{\"name\":\"sensor\\u00e9\\n\",\"id\":-42,\"big\":4294967296,\"ratio\":0.25,\"pi\":3.141592653589793,"
+				   "\"on\":true,\"off\":false,\"none\":null,\"empty\":{},\"list\":[],"
+				   "\"ints\":[0,23,24,255,256,65535,65536,2147483647,-1,-32,-33,-128,-129,-32768,-32769,-2147483648],"
+				   "\"nested\":{\"deep\":[1,[2,[3,{\"k\":\"v\"}]],\"tail\"]},"
+				   "\"description\":\"a string value long enough to need a two byte length prefix in both formats, "
+				   "which is longer than thirty one bytes\",\"last\":[true,null,1.5e3]}";
+
+static void codecAssertBytes(const uint8_t *expect, uint32_t expectLen, const uint8_t *actual, uint32_t actualLen)
+{
+	TEST_ASSERT_EQUAL_UINT32(expectLen, actualLen);
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(expect, actual, expectLen);
+}
+
+/**
+ * @brief 按格式编码文本对应的树并与期望字节比较
+ */
+static void codecAssertEncode(const char *text, RyanJsonCodec_e codec, const uint8_t *expect, uint32_t expectLen)
+{
+	RyanJson_t json = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(json);
+	uint32_t len = 0;
+	uint8_t *data = RyanJsonPrintCodec(json, codec, 0, &len);
+	TEST_ASSERT_NOT_NULL(data);
+	codecAssertBytes(expect, expectLen, data, len);
+	RyanJsonFree(data);
+	RyanJsonDelete(json);
+}
+
+static void testCodecRoundtrip(void)
+{
+	RyanJson_t tree = RyanJsonParse(codecTestText);
+	TEST_ASSERT_NOT_NULL(tree);
+	char *expect = RyanJsonPrint(tree, 256, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(expect);
+
+	for (uint32_t codec = RyanJsonCodecCbor; codec <= RyanJsonCodecMsgPack; codec++)
+	{
+		uint32_t len = 0;
+		uint8_t *data = RyanJsonPrintCodec(tree, (RyanJsonCodec_e)codec, 0, &len);
+		TEST_ASSERT_NOT_NULL(data);
+		TEST_ASSERT_TRUE_MESSAGE(len < (uint32_t)strlen(expect), "二进制编码应比紧凑文本更短");
+
+		// 解码后与原树一致，Int/Double 类型保持不变
+		uint32_t used = 0;
+		RyanJson_t decoded = RyanJsonParseCodec(data, len, (RyanJsonCodec_e)codec, &used);
+		TEST_ASSERT_NOT_NULL(decoded);
+		TEST_ASSERT_EQUAL_UINT32(len, used);
+		TEST_ASSERT_TRUE(RyanJsonCompare(tree, decoded));
+		TEST_ASSERT_TRUE(RyanJsonIsDouble(RyanJsonGetObjectByKey(decoded, "big")));
+		TEST_ASSERT_EQUAL_DOUBLE(3.141592653589793, RyanJsonGetDoubleValue(RyanJsonGetObjectByKey(decoded, "pi")));
+		TEST_ASSERT_TRUE(RyanJsonIsInt(RyanJsonGetObjectByIndex(RyanJsonGetObjectByKey(decoded, "ints"), 15)));
+		char *actual = RyanJsonPrint(decoded, 256, RyanJsonFalse, NULL);
+		TEST_ASSERT_EQUAL_STRING(expect, actual);
+		RyanJsonFree(actual);
+		TEST_ASSERT_TRUE(RyanJsonAddIntToObject(decoded, "added", 1));
+		RyanJsonDelete(decoded);
+
+		// 预分配缓冲：恰好够用时成功，少一个字节即失败
+		uint8_t *buffer = (uint8_t *)malloc(len);
+		TEST_ASSERT_NOT_NULL(buffer);
+		uint32_t preLen = 0;
+		TEST_ASSERT_TRUE(buffer == RyanJsonPrintCodecPreallocated(tree, (RyanJsonCodec_e)codec, buffer, len, &preLen));
+		codecAssertBytes(data, len, buffer, preLen);
+		TEST_ASSERT_NULL(RyanJsonPrintCodecPreallocated(tree, (RyanJsonCodec_e)codec, buffer, len - 1U, NULL));
+		free(buffer);
+
+		// 子树作为根编码时不输出自身 key
+		RyanJsonFree(data);
+		data = RyanJsonPrintCodec(RyanJsonGetObjectByKey(tree, "nested"), (RyanJsonCodec_e)codec, 0, &len);
+		TEST_ASSERT_NOT_NULL(data);
+		decoded = RyanJsonParseCodec(data, len, (RyanJsonCodec_e)codec, NULL);
+		TEST_ASSERT_NOT_NULL(decoded);
+		TEST_ASSERT_FALSE(RyanJsonIsKey(decoded));
+		TEST_ASSERT_TRUE(RyanJsonCompare(RyanJsonGetObjectByKey(tree, "nested"), decoded));
+		RyanJsonDelete(decoded);
+		RyanJsonFree(data);
+	}
+
+	RyanJsonFree(expect);
+	RyanJsonDelete(tree);
+}
+
+static void testCodecEncodeBytes(void)
+{
+	// RFC 8949 附录 A 中的整数与最短长度编码
+	const char *ints = "[0,23,24,100,1000,1000000,-1,-10,-100,-1000]";
+	const uint8_t cborInts[] = {0x8a, 0x00, 0x17, 0x18, 0x18, 0x18, 0x64, 0x19, 0x03, 0xe8, 0x1a, 0x00, 0x0f,
+				    0x42, 0x40, 0x20, 0x29, 0x38, 0x63, 0x39, 0x03, 0xe7};
+	codecAssertEncode(ints, RyanJsonCodecCbor, cborInts, sizeof(cborInts));
+	const uint8_t msgPackInts[] = {0x9a, 0x00, 0x17, 0x18, 0x64, 0xcd, 0x03, 0xe8, 0xce, 0x00, 0x0f, 0x42,
+				       0x40, 0xff, 0xf6, 0xd0, 0x9c, 0xd1, 0xfc, 0x18};
+	codecAssertEncode(ints, RyanJsonCodecMsgPack, msgPackInts, sizeof(msgPackInts));
+
+	// 标量、字符串、容器；能无损放入 float32 的 Double 使用 4 字节形式
+	const char *mixed = "{\"a\":1.5,\"b\":[1.1,true,null],\"c\":\"xy\",\"d\":{}}";
+	const uint8_t cborMixed[] = {0xa4, 0x61, 0x61, 0xfa, 0x3f, 0xc0, 0x00, 0x00, 0x61, 0x62, 0x83, 0xfb, 0x3f, 0xf1, 0x99, 0x99, 0x99,
+				     0x99, 0x99, 0x9a, 0xf5, 0xf6, 0x61, 0x63, 0x62, 0x78, 0x79, 0x61, 0x64, 0xa0};
+	codecAssertEncode(mixed, RyanJsonCodecCbor, cborMixed, sizeof(cborMixed));
+	const uint8_t msgPackMixed[] = {0x84, 0xa1, 0x61, 0xca, 0x3f, 0xc0, 0x00, 0x00, 0xa1, 0x62, 0x93, 0xcb, 0x3f, 0xf1, 0x99,
+					0x99, 0x99, 0x99, 0x99, 0x9a, 0xc3, 0xc0, 0xa1, 0x63, 0xa2, 0x78, 0x79, 0xa1, 0x64, 0x80};
+	codecAssertEncode(mixed, RyanJsonCodecMsgPack, msgPackMixed, sizeof(msgPackMixed));
+}
+
+static void testCodecDecodeForeign(void)
+{
+	// CBOR：半精度浮点、64 位整数、tag、不定长容器
+	const uint8_t cborHalf[] = {0x84, 0xf9, 0x3c, 0x00, 0xf9, 0x80, 0x00, 0xf9, 0x00, 0x01, 0xf9, 0x7b, 0xff};
+	RyanJson_t json = RyanJsonParseCodec(cborHalf, sizeof(cborHalf), RyanJsonCodecCbor, NULL);
+	TEST_ASSERT_NOT_NULL(json);
+	TEST_ASSERT_EQUAL_DOUBLE(1.0, RyanJsonGetDoubleValue(RyanJsonGetObjectByIndex(json, 0)));
+	TEST_ASSERT_TRUE(signbit(RyanJsonGetDoubleValue(RyanJsonGetObjectByIndex(json, 1))));
+	TEST_ASSERT_EQUAL_DOUBLE(5.960464477539063e-8, RyanJsonGetDoubleValue(RyanJsonGetObjectByIndex(json, 2)));
+	TEST_ASSERT_EQUAL_DOUBLE(65504.0, RyanJsonGetDoubleValue(RyanJsonGetObjectByIndex(json, 3)));
+	RyanJsonDelete(json);
+
+	const uint8_t cborWide[] = {0x84, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x7f, 0xff, 0xff, 0xff,
+				    0xc1, 0x1a, 0x51, 0x4b, 0x67, 0xb0, 0xd8, 0x20, 0x61, 0x75};
+	json = RyanJsonParseCodec(cborWide, sizeof(cborWide), RyanJsonCodecCbor, NULL);
+	TEST_ASSERT_NOT_NULL(json);
+	TEST_ASSERT_EQUAL_DOUBLE(4294967296.0, RyanJsonGetDoubleValue(RyanJsonGetObjectByIndex(json, 0)));
+	TEST_ASSERT_TRUE(RyanJsonIsInt(RyanJsonGetObjectByIndex(json, 1)));
+	TEST_ASSERT_EQUAL_INT32(INT32_MIN, RyanJsonGetIntValue(RyanJsonGetObjectByIndex(json, 1)));
+	TEST_ASSERT_EQUAL_INT32(1363896240, RyanJsonGetIntValue(RyanJsonGetObjectByIndex(json, 2)));
+	TEST_ASSERT_EQUAL_STRING("u", RyanJsonGetStringValue(RyanJsonGetObjectByIndex(json, 3)));
+	RyanJsonDelete(json);
+
+	const uint8_t cborIndefinite[] = {0xbf, 0x61, 0x61, 0x01, 0x61, 0x62, 0x9f, 0x02, 0x9f, 0xff, 0x83, 0x03, 0x04, 0x05, 0xff, 0xff};
+	json = RyanJsonParseCodec(cborIndefinite, sizeof(cborIndefinite), RyanJsonCodecCbor, NULL);
+	TEST_ASSERT_NOT_NULL(json);
+	RyanJson_t expect = RyanJsonParse("{\"a\":1,\"b\":[2,[],[3,4,5]]}");
+	TEST_ASSERT_TRUE(RyanJsonCompare(expect, json));
+	RyanJsonDelete(json);
+
+	// MessagePack：64 位整数、8/16 位长度前缀
+	const uint8_t msgPackWide[] = {0xde, 0x00, 0x02, 0xd9, 0x01, 0x61, 0x01, 0xa1, 0x62, 0xdc, 0x00, 0x03, 0xd3, 0xff, 0xff, 0xff,
+				       0xff, 0xff, 0xff, 0xff, 0xfe, 0xcf, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x80,
+				       0x00, 0x00, 0x00};
+	json = RyanJsonParseCodec(msgPackWide, sizeof(msgPackWide), RyanJsonCodecMsgPack, NULL);
+	TEST_ASSERT_NOT_NULL(json);
+	RyanJson_t list = RyanJsonGetObjectByKey(json, "b");
+	TEST_ASSERT_EQUAL_INT(1, RyanJsonGetIntValue(RyanJsonGetObjectByKey(json, "a")));
+	TEST_ASSERT_EQUAL_INT32(-2, RyanJsonGetIntValue(RyanJsonGetObjectByIndex(list, 0)));
+	TEST_ASSERT_EQUAL_DOUBLE(4294967296.0, RyanJsonGetDoubleValue(RyanJsonGetObjectByIndex(list, 1)));
+	TEST_ASSERT_EQUAL_INT32(INT32_MIN, RyanJsonGetIntValue(RyanJsonGetObjectByIndex(list, 2)));
+	RyanJsonDelete(json);
+
+	// 首尾相接的多个数据项，借助 usedLen 依次解码
+	const uint8_t stream[] = {0xa1, 0x61, 0x61, 0x01, 0x82, 0xf5, 0xf4};
+	uint32_t used = 0;
+	json = RyanJsonParseCodec(stream, sizeof(stream), RyanJsonCodecCbor, &used);
+	TEST_ASSERT_NOT_NULL(json);
+	TEST_ASSERT_EQUAL_UINT32(4, used);
+	RyanJsonDelete(json);
+	json = RyanJsonParseCodec(stream + used, (uint32_t)sizeof(stream) - used, RyanJsonCodecCbor, &used);
+	TEST_ASSERT_NOT_NULL(json);
+	TEST_ASSERT_EQUAL_UINT32(3, used);
+	TEST_ASSERT_EQUAL_UINT32(2, RyanJsonGetArraySize(json));
+	RyanJsonDelete(json);
+	TEST_ASSERT_NULL_MESSAGE(RyanJsonParseCodec(stream, sizeof(stream), RyanJsonCodecCbor, NULL), "未要求 usedLen 时不允许尾随数据");
+
+	RyanJsonDelete(expect);
+}
+
+static void testCodecRejects(void)
+{
+	// 每个前缀都不是完整数据项
+	RyanJson_t tree = RyanJsonParse(codecTestText);
+	TEST_ASSERT_NOT_NULL(tree);
+	for (uint32_t codec = RyanJsonCodecCbor; codec <= RyanJsonCodecMsgPack; codec++)
+	{
+		uint32_t len = 0;
+		uint8_t *data = RyanJsonPrintCodec(tree, (RyanJsonCodec_e)codec, 0, &len);
+		TEST_ASSERT_NOT_NULL(data);
+		for (uint32_t i = 0; i < len; i++)
+		{
+			uint32_t used = 0;
+			TEST_ASSERT_NULL(RyanJsonParseCodec(data, i, (RyanJsonCodec_e)codec, &used));
+		}
+		RyanJsonFree(data);
+	}
+	RyanJsonDelete(tree);
+
+	// 无法映射为 Json 的数据与非法编码
+	static const struct
+	{
+		RyanJsonCodec_e codec;
+		uint8_t len;
+		uint8_t bytes[10];
+	} cases[] = {
+		{RyanJsonCodecCbor, 2, {0x42, 0x00}},                                         // 字节串长度超出数据
+		{RyanJsonCodecCbor, 4, {0x5f, 0x41, 0x00, 0xff}},                             // 不定长字节串
+		{RyanJsonCodecCbor, 3, {0xa1, 0x01, 0x02}},                                   // 非字符串 key
+		{RyanJsonCodecCbor, 3, {0x62, 0x61, 0x00}},                                   // 字符串含 '\0'
+		{RyanJsonCodecCbor, 1, {0xf7}},                                               // undefined
+		{RyanJsonCodecCbor, 1, {0xff}},                                               // 孤立的 break
+		{RyanJsonCodecCbor, 2, {0x82, 0xff}},                                         // 定长容器中的 break
+		{RyanJsonCodecCbor, 1, {0x1c}},                                               // 保留的参数长度
+		{RyanJsonCodecCbor, 3, {0x7f, 0x61, 0x61}},                                   // 不定长字符串
+		{RyanJsonCodecCbor, 4, {0xbf, 0x61, 0x61, 0xff}},                             // Map 缺少 value
+		{RyanJsonCodecCbor, 9, {0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}}, // 成员数超过数据长度
+		{RyanJsonCodecMsgPack, 1, {0xc1}},                                            // 保留字节
+		{RyanJsonCodecMsgPack, 3, {0xc4, 0x02, 0x00}},                                // bin 长度超出数据
+		{RyanJsonCodecMsgPack, 3, {0xd4, 0x01, 0x00}},                                // fixext
+		{RyanJsonCodecMsgPack, 3, {0x81, 0x01, 0x02}},                                // 非字符串 key
+		{RyanJsonCodecMsgPack, 5, {0xdd, 0x00, 0x01, 0x00, 0x00}},                    // 成员数超过数据长度
+	};
+	for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+	{
+		TEST_ASSERT_NULL_MESSAGE(RyanJsonParseCodec(cases[i].bytes, cases[i].len, cases[i].codec, NULL), "非法数据应被拒绝");
+	}
+
+	const uint8_t one[] = {0x01};
+	TEST_ASSERT_NULL(RyanJsonParseCodec(NULL, 1, RyanJsonCodecCbor, NULL));
+	TEST_ASSERT_NULL(RyanJsonParseCodec(one, 1, (RyanJsonCodec_e)7, NULL));
+	RyanJson_t json = RyanJsonCreateObject();
+	TEST_ASSERT_NULL(RyanJsonPrintCodec(json, (RyanJsonCodec_e)7, 0, NULL));
+	TEST_ASSERT_NULL(RyanJsonPrintCodec(NULL, RyanJsonCodecCbor, 0, NULL));
+	RyanJsonDelete(json);
+
+	// 重复 key 与文本解析的处理一致
+	const uint8_t duplicate[] = {0xa2, 0x61, 0x61, 0x01, 0x61, 0x61, 0x02};
+	json = RyanJsonParseCodec(duplicate, sizeof(duplicate), RyanJsonCodecCbor, NULL);
+#if true == RyanJsonStrictObjectKeyCheck
+	TEST_ASSERT_NULL(json);
+#else
+	TEST_ASSERT_NOT_NULL(json);
+	TEST_ASSERT_EQUAL_UINT32(2, RyanJsonGetSize(json));
+	RyanJsonDelete(json);
+#endif
+}
+
+#if true == RyanJsonPackedArray
+static void testCodecPacked(void)
+{
+	const int32_t ids[] = {1, -200, 70000, 4};
+	const double weights[] = {0.5, 1.1, -3.0};
+	const int32_t col0[] = {10, 20};
+	const float col1[] = {0.25F, 1.5F};
+	const char *const keys[] = {"id", "w"};
+	const RyanJsonPackedType_e types[] = {RyanJsonPackedTypeInt, RyanJsonPackedTypeFloat};
+	const void *const columns[] = {col0, col1};
+
+	RyanJson_t tree = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(tree);
+	TEST_ASSERT_TRUE(RyanJsonAddItemToObject(tree, "ids", RyanJsonCreatePackedIntArray(ids, 4)));
+	TEST_ASSERT_TRUE(RyanJsonAddItemToObject(tree, "weights", RyanJsonCreatePackedDoubleArray(weights, 3)));
+	TEST_ASSERT_TRUE(RyanJsonAddItemToObject(tree, "rows", RyanJsonCreatePackedTable(keys, types, columns, 2, 2)));
+
+	// 与等价普通树的编码逐字节一致，且编码不展开紧凑数组
+	char *text = RyanJsonPrint(tree, 256, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(text);
+	for (uint32_t codec = RyanJsonCodecCbor; codec <= RyanJsonCodecMsgPack; codec++)
+	{
+		uint32_t len = 0;
+		uint8_t *data = RyanJsonPrintCodec(tree, (RyanJsonCodec_e)codec, 0, &len);
+		TEST_ASSERT_NOT_NULL(data);
+		TEST_ASSERT_TRUE(RyanJsonIsPackedArray(RyanJsonGetObjectByKey(tree, "ids")));
+		TEST_ASSERT_TRUE(RyanJsonIsPackedTable(RyanJsonGetObjectByKey(tree, "rows")));
+
+		RyanJson_t plain = RyanJsonParse(text);
+		TEST_ASSERT_NOT_NULL(plain);
+		TEST_ASSERT_TRUE(RyanJsonExpandPackedArray(RyanJsonGetObjectByKey(plain, "ids")));
+		TEST_ASSERT_TRUE(RyanJsonExpandPackedArray(RyanJsonGetObjectByKey(plain, "weights")));
+		uint32_t plainLen = 0;
+		uint8_t *plainData = RyanJsonPrintCodec(plain, (RyanJsonCodec_e)codec, 0, &plainLen);
+		TEST_ASSERT_NOT_NULL(plainData);
+		codecAssertBytes(plainData, plainLen, data, len);
+		RyanJsonFree(plainData);
+		RyanJsonDelete(plain);
+
+		RyanJson_t decoded = RyanJsonParseCodec(data, len, (RyanJsonCodec_e)codec, NULL);
+		TEST_ASSERT_NOT_NULL(decoded);
+		TEST_ASSERT_TRUE(RyanJsonCompare(tree, decoded));
+		RyanJsonDelete(decoded);
+		RyanJsonFree(data);
+	}
+	RyanJsonFree(text);
+	RyanJsonDelete(tree);
+}
+#endif
+
+static void testCodecDeepAndOom(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	// 深层嵌套：编码与解码都不使用递归，解码记录的层级超出栈上数组后转为堆内存
+	const uint32_t depth = 3000;
+	RyanJson_t deep = RyanJsonCreateArray();
+	TEST_ASSERT_NOT_NULL(deep);
+	TEST_ASSERT_TRUE(RyanJsonAddIntToArray(deep, 7));
+	for (uint32_t i = 0; i < depth; i++)
+	{
+		RyanJson_t arr = RyanJsonCreateArray();
+		TEST_ASSERT_NOT_NULL(arr);
+		TEST_ASSERT_TRUE(RyanJsonAddItemToArray(arr, deep));
+		deep = arr;
+	}
+	for (uint32_t codec = RyanJsonCodecCbor; codec <= RyanJsonCodecMsgPack; codec++)
+	{
+		uint32_t len = 0;
+		uint8_t *data = RyanJsonPrintCodec(deep, (RyanJsonCodec_e)codec, 0, &len);
+		TEST_ASSERT_NOT_NULL(data);
+		TEST_ASSERT_EQUAL_UINT32(depth + 2U, len);
+		RyanJson_t decoded = RyanJsonParseCodec(data, len, (RyanJsonCodec_e)codec, NULL);
+		TEST_ASSERT_TRUE(RyanJsonCompare(deep, decoded));
+		RyanJsonDelete(decoded);
+		RyanJsonFree(data);
+	}
+	RyanJsonDelete(deep);
+
+	// 逐步注入 OOM：编码与解码失败都不泄漏
+	RyanJson_t tree = RyanJsonParse(codecTestText);
+	TEST_ASSERT_NOT_NULL(tree);
+	for (uint32_t codec = RyanJsonCodecCbor; codec <= RyanJsonCodecMsgPack; codec++)
+	{
+		uint8_t *data = NULL;
+		uint32_t len = 0;
+		for (uint32_t budget = 0; NULL == data; budget++)
+		{
+			TEST_ASSERT_TRUE_MESSAGE(budget < 16U, "编码在有限次分配内应成功");
+			UNITY_TEST_OOM_BEGIN(budget);
+			data = RyanJsonPrintCodec(tree, (RyanJsonCodec_e)codec, 0, &len);
+			UNITY_TEST_OOM_END();
+		}
+
+		RyanJson_t decoded = NULL;
+		for (uint32_t budget = 0; NULL == decoded; budget++)
+		{
+			TEST_ASSERT_TRUE_MESSAGE(budget < 256U, "解码在有限次分配内应成功");
+			UNITY_TEST_OOM_BEGIN(budget);
+			decoded = RyanJsonParseCodec(data, len, (RyanJsonCodec_e)codec, NULL);
+			UNITY_TEST_OOM_END();
+		}
+		TEST_ASSERT_TRUE(RyanJsonCompare(tree, decoded));
+		RyanJsonDelete(decoded);
+		RyanJsonFree(data);
+	}
+	RyanJsonDelete(tree);
+
+	unityTestLeakScopeEnd(scope, "二进制编解码失败路径不应泄漏");
+}
+
+void testCodecRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+	RUN_TEST(testCodecRoundtrip);
+	RUN_TEST(testCodecEncodeBytes);
+	RUN_TEST(testCodecDecodeForeign);
+	RUN_TEST(testCodecRejects);
+#if true == RyanJsonPackedArray
+	RUN_TEST(testCodecPacked);
+#endif
+	RUN_TEST(testCodecDeepAndOom);
+}
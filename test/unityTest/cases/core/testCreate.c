@@ -721,6 +721,127 @@ static void testCreateInsertUsingAddPositionMacro(void)
 	RyanJsonDelete(arr);
 }
 
+static void testAppenderOrderAndStaleTail(void)
+{
+	// 追加器始终尾插，结果与输入顺序一致（不受 AddAtHead 影响）
+	RyanJson_t arr = RyanJsonParse("[1]");
+	TEST_ASSERT_NOT_NULL(arr);
+
+	RyanJsonAppender_t appender;
+	TEST_ASSERT_TRUE(RyanJsonAppenderInit(&appender, arr));
+	TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, RyanJsonCreateInt(NULL, 2)));
+	TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, RyanJsonCreateString(NULL, "three")));
+	TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, RyanJsonCreateObject()));
+
+	// 其他接口改动尾部后，追加器重新定位尾节点
+	TEST_ASSERT_TRUE(RyanJsonInsert(arr, UINT32_MAX, RyanJsonCreateInt(NULL, 5)));
+	TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, RyanJsonCreateInt(NULL, 6)));
+	RyanJsonDelete(RyanJsonDetachByIndex(arr, 5));
+	TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, RyanJsonCreateInt(NULL, 7)));
+
+	RyanJson_t expect = RyanJsonParse("[1,2,\"three\",{},5,7]");
+	TEST_ASSERT_NOT_NULL(expect);
+	TEST_ASSERT_TRUE_MESSAGE(RyanJsonCompare(arr, expect), "Appender 追加顺序错误");
+	RyanJsonDelete(expect);
+
+	// 清空后再追加
+	while (RyanJsonGetArraySize(arr) > 0)
+	{
+		TEST_ASSERT_TRUE(RyanJsonDeleteByIndex(arr, 0));
+	}
+	TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, RyanJsonCreateNull(NULL)));
+	TEST_ASSERT_EQUAL_UINT32(1, RyanJsonGetArraySize(arr));
+	TEST_ASSERT_TRUE(RyanJsonIsNull(RyanJsonGetObjectByIndex(arr, 0)));
+
+	RyanJsonDelete(arr);
+}
+
+static void testAppenderObjectAndGuards(void)
+{
+	RyanJson_t obj = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(obj);
+
+	RyanJsonAppender_t appender;
+	TEST_ASSERT_FALSE(RyanJsonAppenderInit(NULL, obj));
+	TEST_ASSERT_FALSE(RyanJsonAppenderInit(&appender, NULL));
+	RyanJson_t scalar = RyanJsonCreateInt(NULL, 1);
+	TEST_ASSERT_FALSE(RyanJsonAppenderInit(&appender, scalar));
+	RyanJsonDelete(scalar);
+
+	TEST_ASSERT_TRUE(RyanJsonAppenderInit(&appender, obj));
+	TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, RyanJsonCreateInt("a", 1)));
+	TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, RyanJsonCreateString("b", "x")));
+
+	// Object 要求 item 携带 key；游离 item 失败时由接口释放
+	TEST_ASSERT_FALSE(RyanJsonAppenderAdd(&appender, RyanJsonCreateInt(NULL, 2)));
+	TEST_ASSERT_FALSE(RyanJsonAppenderAdd(&appender, NULL));
+	TEST_ASSERT_FALSE(RyanJsonAppenderAdd(NULL, RyanJsonCreateInt("c", 3)));
+
+	// 已挂载节点不会被接管，也不会被释放
+	TEST_ASSERT_FALSE(RyanJsonAppenderAdd(&appender, RyanJsonGetObjectByKey(obj, "a")));
+
+#if true == RyanJsonStrictObjectKeyCheck
+	TEST_ASSERT_FALSE(RyanJsonAppenderAdd(&appender, RyanJsonCreateInt("a", 9)));
+#endif
+
+	RyanJson_t expect = RyanJsonParse("{\"a\":1,\"b\":\"x\"}");
+	TEST_ASSERT_NOT_NULL(expect);
+	TEST_ASSERT_TRUE(RyanJsonCompare(obj, expect));
+	RyanJsonDelete(expect);
+
+	// OOM 下追加失败，容器保持不变
+	UNITY_TEST_OOM_BEGIN(0);
+	RyanJsonBool_e ok = RyanJsonAppenderAdd(&appender, RyanJsonCreateInt("c", 3));
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_FALSE(ok);
+	TEST_ASSERT_EQUAL_UINT32(2, RyanJsonGetSize(obj));
+
+	RyanJsonDelete(obj);
+}
+
+static void testCreateTypedArrayLargeKeepsOrder(void)
+{
+	// 批量构造整体 O(N)，元素顺序遵循 AddPosition
+	const uint32_t count = 20000;
+	int32_t *numbers = (int32_t *)malloc(count * sizeof(int32_t));
+	TEST_ASSERT_NOT_NULL(numbers);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		numbers[i] = (int32_t)i;
+	}
+
+	RyanJson_t arr = RyanJsonCreateIntArray(numbers, count);
+	free(numbers);
+	TEST_ASSERT_NOT_NULL(arr);
+	TEST_ASSERT_EQUAL_UINT32(count, RyanJsonGetArraySize(arr));
+
+#if true == RyanJsonDefaultAddAtHead
+	int32_t expected = (int32_t)count - 1;
+	const int32_t step = -1;
+	const char *expectText = "[\"c\",\"b\",\"a\"]";
+#else
+	int32_t expected = 0;
+	const int32_t step = 1;
+	const char *expectText = "[\"a\",\"b\",\"c\"]";
+#endif
+	RyanJson_t item = NULL;
+	RyanJsonArrayForEach(arr, item)
+	{
+		TEST_ASSERT_EQUAL_INT(expected, RyanJsonGetIntValue(item));
+		expected += step;
+	}
+	RyanJsonDelete(arr);
+
+	const char *strings[] = {"a", "b", "c"};
+	RyanJson_t strArr = RyanJsonCreateStringArray(strings, 3);
+	TEST_ASSERT_NOT_NULL(strArr);
+	RyanJson_t expect = RyanJsonParse(expectText);
+	TEST_ASSERT_NOT_NULL(expect);
+	TEST_ASSERT_TRUE(RyanJsonCompare(strArr, expect));
+	RyanJsonDelete(expect);
+	RyanJsonDelete(strArr);
+}
+
 void testCreateRunner(void)
 {
 	UnitySetTestFile(__FILE__);
@@ -745,4 +866,7 @@ void testCreateRunner(void)
 	RUN_TEST(testAddItemObjectLongKeyWrapRoundtrip);
 	RUN_TEST(testCreateDetachedReuseAndContainerAssembleChain);
 	RUN_TEST(testCreateAddItemToArrayRejectScalarThenRecover);
+	RUN_TEST(testAppenderOrderAndStaleTail);
+	RUN_TEST(testAppenderObjectAndGuards);
+	RUN_TEST(testCreateTypedArrayLargeKeepsOrder);
 }
@@ -346,6 +346,67 @@ static void testDuplicateOomRecoveryAndSourceImmutability(void)
 	RyanJsonDelete(root);
 }
 
+static void testDuplicateNodeBytesAndPtrBuffer(void)
+{
+	// 覆盖按字节复制的各类节点：内联/ptr 模式 key 与 strValue、Int/Double/Bool/Null、空容器，
+	// 并逐步注入 OOM，验证任一步失败都能完整回滚。
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	const char *source = "{\"k\":\"v\",\"deviceSerialNumberIdentifier\":\"STATUS_OPERATIONAL_NOMINAL_AND_STABLE\","
+			     "\"i\":-7,\"d\":2.5,\"b\":true,\"n\":null,\"e\":{},\"a\":[\"longStringElementWithoutKey\",[],1]}";
+	RyanJson_t root = RyanJsonParse(source);
+	TEST_ASSERT_NOT_NULL(root);
+
+	RyanJson_t dup = NULL;
+	for (uint32_t budget = 0; NULL == dup; budget++)
+	{
+		TEST_ASSERT_TRUE_MESSAGE(budget < 64U, "Duplicate 在有限次分配内应成功");
+		UNITY_TEST_OOM_BEGIN(budget);
+		dup = RyanJsonDuplicate(root);
+		UNITY_TEST_OOM_END();
+	}
+	TEST_ASSERT_TRUE(RyanJsonCompare(root, dup));
+
+	RyanJson_t srcLong = RyanJsonGetObjectByKey(root, "deviceSerialNumberIdentifier");
+	RyanJson_t dupLong = RyanJsonGetObjectByKey(dup, "deviceSerialNumberIdentifier");
+	TEST_ASSERT_NOT_NULL(dupLong);
+	TEST_ASSERT_EQUAL_STRING("STATUS_OPERATIONAL_NOMINAL_AND_STABLE", RyanJsonGetStringValue(dupLong));
+#if true != RyanJsonStringIntern
+	// 未启用驻留时 ptr 模式缓冲各自独立
+	TEST_ASSERT_TRUE(RyanJsonGetStringValue(srcLong) != RyanJsonGetStringValue(dupLong));
+#endif
+	TEST_ASSERT_EQUAL_DOUBLE(2.5, RyanJsonGetDoubleValue(RyanJsonGetObjectByKey(dup, "d")));
+	TEST_ASSERT_EQUAL_INT(-7, RyanJsonGetIntValue(RyanJsonGetObjectByKey(dup, "i")));
+
+	// 副本可独立修改 key/strValue 并继续挂接子节点
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(dupLong, "serial"));
+	TEST_ASSERT_TRUE(RyanJsonChangeStringValue(dupLong, "x"));
+	TEST_ASSERT_TRUE(RyanJsonAddIntToObject(RyanJsonGetObjectByKey(dup, "e"), "added", 1));
+	TEST_ASSERT_EQUAL_STRING("deviceSerialNumberIdentifier", RyanJsonGetKey(srcLong));
+	TEST_ASSERT_EQUAL_STRING("STATUS_OPERATIONAL_NOMINAL_AND_STABLE", RyanJsonGetStringValue(srcLong));
+	TEST_ASSERT_EQUAL_UINT32(0, RyanJsonGetSize(RyanJsonGetObjectByKey(root, "e")));
+
+	// 根节点与副本均为游离节点，可直接挂到其他容器
+	RyanJson_t holder = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(holder);
+	TEST_ASSERT_TRUE(RyanJsonInsert(holder, 0, RyanJsonDuplicate(RyanJsonGetObjectByKey(root, "a"))));
+	TEST_ASSERT_TRUE(RyanJsonCompare(RyanJsonGetObjectByIndex(holder, 0), RyanJsonGetObjectByKey(root, "a")));
+
+	// 非法类型无法确定节点大小，复制必须失败而不是按错误大小拷贝
+	RyanJson_t broken = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(broken);
+	RyanJsonSetType(broken, 0);
+	TEST_ASSERT_NULL_MESSAGE(RyanJsonDuplicate(broken), "非法类型节点的 Duplicate 应失败");
+	RyanJsonSetType(broken, RyanJsonTypeObject);
+
+	RyanJsonDelete(broken);
+	RyanJsonDelete(holder);
+	RyanJsonDelete(dup);
+	RyanJsonDelete(root);
+
+	unityTestLeakScopeEnd(scope, "Duplicate 失败回滚与副本释放不应泄漏");
+}
+
 void testDuplicateRunner(void)
 {
 	UnitySetTestFile(__FILE__);
@@ -356,4 +417,5 @@ void testDuplicateRunner(void)
 	RUN_TEST(testDuplicateCrossContainerMoveIsolationChain);
 	RUN_TEST(testDuplicateDetachedNodeDualAttachWithoutAlias);
 	RUN_TEST(testDuplicateOomRecoveryAndSourceImmutability);
+	RUN_TEST(testDuplicateNodeBytesAndPtrBuffer);
 }
@@ -0,0 +1,171 @@
+#include "testBase.h"
+
+static RyanJson_t pointerGet(RyanJson_t pJson, const char *pointer)
+{
+	RyanJsonPath_t path = RyanJsonPathCompile(pointer);
+	TEST_ASSERT_NOT_NULL_MESSAGE(path, pointer);
+	RyanJson_t item = RyanJsonPathGet(pJson, path);
+	RyanJsonPathDelete(path);
+	return item;
+}
+
+static void testJsonPointerRfcExamples(void)
+{
+	// RFC 6901 第 5 节示例文档
+	RyanJson_t root = RyanJsonParse("{\"foo\":[\"bar\",\"baz\"],\"\":0,\"a/b\":1,\"c%d\":2,\"e^f\":3,\"g|h\":4,"
+					"\"i\\\\j\":5,\"k\\\"l\":6,\" \":7,\"m~n\":8}");
+	TEST_ASSERT_NOT_NULL(root);
+
+	TEST_ASSERT_EQUAL_PTR(root, pointerGet(root, ""));
+	TEST_ASSERT_EQUAL_PTR(RyanJsonGetObjectByKey(root, "foo"), pointerGet(root, "/foo"));
+	TEST_ASSERT_EQUAL_STRING("bar", RyanJsonGetStringValue(pointerGet(root, "/foo/0")));
+	TEST_ASSERT_EQUAL_STRING("baz", RyanJsonGetStringValue(pointerGet(root, "/foo/1")));
+
+	static const struct
+	{
+		const char *pointer;
+		int32_t value;
+	} cases[] = {
+		{"/", 0},     {"/a~1b", 1}, {"/c%d", 2}, {"/e^f", 3},  {"/g|h", 4},
+		{"/i\\j", 5}, {"/k\"l", 6}, {"/ ", 7},   {"/m~0n", 8},
+	};
+	for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+	{
+		RyanJson_t item = pointerGet(root, cases[i].pointer);
+		TEST_ASSERT_NOT_NULL_MESSAGE(item, cases[i].pointer);
+		TEST_ASSERT_EQUAL_INT32_MESSAGE(cases[i].value, RyanJsonGetIntValue(item), cases[i].pointer);
+	}
+
+	RyanJsonDelete(root);
+}
+
+static void testJsonPointerSyntax(void)
+{
+	// 非空路径必须以 '/' 开头，'~' 只能后接 0 或 1
+	static const char *const invalid[] = {"foo", "/~", "/~2", "/a~", "/a/~b", "#/foo"};
+	for (uint32_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+	{
+		TEST_ASSERT_NULL_MESSAGE(RyanJsonPathCompile(invalid[i]), invalid[i]);
+	}
+	TEST_ASSERT_NULL(RyanJsonPathCompile(NULL));
+
+	RyanJsonPath_t path = RyanJsonPathCompile("");
+	TEST_ASSERT_NOT_NULL(path);
+	TEST_ASSERT_EQUAL_UINT32(0, RyanJsonPathGetCount(path));
+	RyanJsonPathDelete(path);
+
+	path = RyanJsonPathCompile("/a//b/");
+	TEST_ASSERT_NOT_NULL(path);
+	TEST_ASSERT_EQUAL_UINT32(4, RyanJsonPathGetCount(path));
+	RyanJsonPathDelete(path);
+
+	TEST_ASSERT_EQUAL_UINT32(0, RyanJsonPathGetCount(NULL));
+	TEST_ASSERT_NULL(RyanJsonPathGet(NULL, NULL));
+	RyanJsonPathDelete(NULL);
+}
+
+static void testJsonPointerMiss(void)
+{
+	RyanJson_t root = RyanJsonParse("{\"list\":[\"a\",\"b\",\"c\"],\"01\":\"key\",\"~1\":\"tilde\",\"s\":\"text\",\"n\":null}");
+	TEST_ASSERT_NOT_NULL(root);
+
+	// 越界、"-"、前导零、非数字与超出 uint32 的下标，以及向标量下钻均不命中
+	static const char *const miss[] = {
+		"/list/3", "/list/-", "/list/01", "/list/+1", "/list/ 1", "/list/1a", "/list/",
+		"/list/4294967295", "/list/99999999999", "/s/0", "/n/x", "/missing", "/list/0/x",
+	};
+	for (uint32_t i = 0; i < sizeof(miss) / sizeof(miss[0]); i++)
+	{
+		TEST_ASSERT_NULL_MESSAGE(pointerGet(root, miss[i]), miss[i]);
+	}
+
+	// Object 一律按 key 匹配，数字样式的 key 也不例外；~01 解码为 "~1" 而非 "/"
+	TEST_ASSERT_EQUAL_STRING("key", RyanJsonGetStringValue(pointerGet(root, "/01")));
+	TEST_ASSERT_EQUAL_STRING("tilde", RyanJsonGetStringValue(pointerGet(root, "/~01")));
+	TEST_ASSERT_EQUAL_STRING("c", RyanJsonGetStringValue(pointerGet(root, "/list/2")));
+
+	RyanJsonDelete(root);
+}
+
+static void testJsonPointerReuse(void)
+{
+	static const char *const docs[] = {
+		"{\"cfg\":{\"net\":[{\"ip\":\"10.0.0.1\"},{\"ip\":\"10.0.0.2\"}],\"name\":\"a\"}}",
+		"{\"other\":1,\"cfg\":{\"name\":\"b\",\"net\":[{\"mask\":24,\"ip\":\"192.168.1.1\"}]}}",
+		"{\"cfg\":{\"net\":{\"0\":{\"ip\":\"object-key\"}}}}",
+		"{\"cfg\":{\"net\":[]}}",
+	};
+	static const char *const expect[] = {"10.0.0.1", "192.168.1.1", "object-key", NULL};
+
+	RyanJsonPath_t path = RyanJsonPathCompile("/cfg/net/0/ip");
+	TEST_ASSERT_NOT_NULL(path);
+	TEST_ASSERT_EQUAL_UINT32(4, RyanJsonPathGetCount(path));
+
+	for (uint32_t i = 0; i < sizeof(docs) / sizeof(docs[0]); i++)
+	{
+		RyanJson_t root = RyanJsonParse(docs[i]);
+		TEST_ASSERT_NOT_NULL(root);
+
+		// 求值不申请内存
+		UNITY_TEST_OOM_BEGIN(0);
+		RyanJson_t item = RyanJsonPathGet(root, path);
+		UNITY_TEST_OOM_END();
+
+		if (NULL == expect[i]) { TEST_ASSERT_NULL(item); }
+		else
+		{
+			TEST_ASSERT_EQUAL_STRING(expect[i], RyanJsonGetStringValue(item));
+			TEST_ASSERT_TRUE(RyanJsonHasPath(root, path));
+		}
+		RyanJsonDelete(root);
+	}
+
+	RyanJsonPathDelete(path);
+}
+
+static void testJsonPointerLongKey(void)
+{
+	// 超出内联长度的 key 与仅末字节不同的 key，确保按长度、哈希与字节完整比较
+	RyanJson_t root = RyanJsonParse("{\"a fairly long key that lives out of line x\":1,\"a fairly long key that lives out of line y\":"
+					"{\"nested/key\":[true,{\"~\":\"deep\"}]}}");
+	TEST_ASSERT_NOT_NULL(root);
+
+	TEST_ASSERT_EQUAL_INT32(1, RyanJsonGetIntValue(pointerGet(root, "/a fairly long key that lives out of line x")));
+	RyanJson_t deep = pointerGet(root, "/a fairly long key that lives out of line y/nested~1key/1/~0");
+	TEST_ASSERT_EQUAL_STRING("deep", RyanJsonGetStringValue(deep));
+	TEST_ASSERT_TRUE(RyanJsonGetBoolValue(pointerGet(root, "/a fairly long key that lives out of line y/nested~1key/0")));
+	TEST_ASSERT_NULL(pointerGet(root, "/a fairly long key that lives out of line z"));
+	TEST_ASSERT_NULL(pointerGet(root, "/a fairly long key that lives out of line"));
+
+	RyanJsonDelete(root);
+}
+
+static void testJsonPointerOom(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	// 编译只申请一次内存，失败时返回 NULL 且不泄漏
+	UNITY_TEST_OOM_BEGIN(0);
+	RyanJsonPath_t path = RyanJsonPathCompile("/cfg/net/0/ip");
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_NULL(path);
+
+	UNITY_TEST_OOM_BEGIN(1);
+	path = RyanJsonPathCompile("/cfg/net/0/ip");
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_NOT_NULL(path);
+	RyanJsonPathDelete(path);
+
+	unityTestLeakScopeEnd(scope, "路径编译失败路径不应泄漏");
+}
+
+void testJsonPointerRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+	RUN_TEST(testJsonPointerRfcExamples);
+	RUN_TEST(testJsonPointerSyntax);
+	RUN_TEST(testJsonPointerMiss);
+	RUN_TEST(testJsonPointerReuse);
+	RUN_TEST(testJsonPointerLongKey);
+	RUN_TEST(testJsonPointerOom);
+}
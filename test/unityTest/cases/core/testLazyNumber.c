@@ -0,0 +1,368 @@
+#include "testBase.h"
+
+static RyanJson_t lazyParse(const char *text)
+{
+	return RyanJsonParseWithFlags(text, (uint32_t)strlen(text), RyanJsonTrue, RyanJsonParseFlagLazyNumber, NULL);
+}
+
+static void lazyAssertPrint(RyanJson_t pJson, const char *expect)
+{
+	char *actual = RyanJsonPrint(pJson, 64, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(actual);
+	TEST_ASSERT_EQUAL_STRING(expect, actual);
+	RyanJsonFree(actual);
+}
+
+static void testLazyNumberParseAndGet(void)
+{
+	static const char text[] = "{\"i\":-17,\"d\":-2.50,\"big\":12345678901234567890123,\"e\":1E2,"
+				   "\"list\":[0,-0,3000000000,2147483647]}";
+	RyanJson_t root = lazyParse(text);
+	TEST_ASSERT_NOT_NULL(root);
+
+	// 打印逐字节保留源文本（含尾随 0、大写指数与超出 Double 精度的整数）
+	lazyAssertPrint(root, text);
+
+	// 类型即 Number，Int/Double 判定与普通解析一致
+	RyanJson_t i = RyanJsonGetObjectByKey(root, "i");
+	TEST_ASSERT_EQUAL_INT(RyanJsonTypeNumber, RyanJsonGetType(i));
+	TEST_ASSERT_TRUE(RyanJsonIsNumber(i));
+	TEST_ASSERT_FALSE(RyanJsonIsRaw(i));
+	TEST_ASSERT_TRUE(RyanJsonIsInt(i));
+	TEST_ASSERT_FALSE(RyanJsonIsDouble(i));
+	TEST_ASSERT_EQUAL_INT32(-17, RyanJsonGetIntValue(i));
+
+	RyanJson_t d = RyanJsonGetObjectByKey(root, "d");
+	TEST_ASSERT_TRUE(RyanJsonIsDouble(d));
+	TEST_ASSERT_EQUAL_DOUBLE(-2.5, RyanJsonGetDoubleValue(d));
+	TEST_ASSERT_TRUE(RyanJsonIsDouble(RyanJsonGetObjectByKey(root, "e")));
+	TEST_ASSERT_EQUAL_DOUBLE(100.0, RyanJsonGetDoubleValue(RyanJsonGetObjectByKey(root, "e")));
+
+	RyanJson_t list = RyanJsonGetObjectByKey(root, "list");
+	TEST_ASSERT_TRUE(RyanJsonIsInt(RyanJsonGetObjectByIndex(list, 0)));
+	TEST_ASSERT_TRUE(RyanJsonIsInt(RyanJsonGetObjectByIndex(list, 1)));
+	TEST_ASSERT_TRUE(RyanJsonIsDouble(RyanJsonGetObjectByIndex(list, 2)));
+	TEST_ASSERT_EQUAL_DOUBLE(3000000000.0, RyanJsonGetDoubleValue(RyanJsonGetObjectByIndex(list, 2)));
+	TEST_ASSERT_EQUAL_INT32(INT32_MAX, RyanJsonGetIntValue(RyanJsonGetObjectByIndex(list, 3)));
+
+	RyanJson_t big = RyanJsonGetObjectByKey(root, "big");
+	TEST_ASSERT_EQUAL_INT(RyanJsonTypeNumber, RyanJsonGetType(big));
+	TEST_ASSERT_FALSE(RyanJsonIsRaw(big));
+	TEST_ASSERT_FALSE(RyanJsonIsBlob(big));
+	TEST_ASSERT_TRUE(RyanJsonIsDouble(big));
+	TEST_ASSERT_EQUAL_DOUBLE(12345678901234567890123.0, RyanJsonGetDoubleValue(big));
+	TEST_ASSERT_EQUAL_STRING("big", RyanJsonGetKey(big));
+
+	// 标量根与尾部位置
+	const char *end = NULL;
+	static const char scalar[] = " 6.0250 ,";
+	RyanJson_t number = RyanJsonParseWithFlags(scalar, (uint32_t)strlen(scalar), RyanJsonFalse, RyanJsonParseFlagLazyNumber, &end);
+	TEST_ASSERT_NOT_NULL(number);
+	TEST_ASSERT_EQUAL_PTR(scalar + 7, end);
+	lazyAssertPrint(number, "6.0250");
+	RyanJsonDelete(number);
+	TEST_ASSERT_NULL(RyanJsonParseWithFlags(scalar, (uint32_t)strlen(scalar), RyanJsonTrue, RyanJsonParseFlagLazyNumber, NULL));
+
+	// 不带标志时与 RyanJsonParseOptions 一致
+	RyanJson_t eager = RyanJsonParseWithFlags(text, (uint32_t)strlen(text), RyanJsonTrue, RyanJsonParseFlagNone, NULL);
+	TEST_ASSERT_NOT_NULL(eager);
+	TEST_ASSERT_TRUE(_checkType(RyanJsonGetObjectByKey(eager, "i"), RyanJsonTypeNumber));
+	TEST_ASSERT_FALSE(RyanJsonIsRaw(RyanJsonGetObjectByKey(eager, "i")));
+	RyanJsonDelete(eager);
+	RyanJsonDelete(root);
+}
+
+static void testLazyNumberConvertOnce(void)
+{
+	static const char text[] = "[-2.50,7,1E2]";
+	RyanJson_t root = lazyParse(text);
+	TEST_ASSERT_NOT_NULL(root);
+	RyanJson_t d = RyanJsonGetObjectByIndex(root, 0);
+	RyanJson_t i = RyanJsonGetObjectByIndex(root, 1);
+
+	// 判型为 Number 与打印不触发转换
+	TEST_ASSERT_TRUE(RyanJsonIsNumber(d));
+	TEST_ASSERT_EQUAL_INT(RyanJsonTypeNumber, RyanJsonGetType(i));
+	lazyAssertPrint(root, text);
+	TEST_ASSERT_TRUE(RyanJsonInternalIsLazyNumber(d));
+	TEST_ASSERT_TRUE(RyanJsonInternalIsLazyNumber(i));
+
+	// 判断 Int/Double 只读源文本；首次取值时原地转换为普通 Double/Int，值区保存转换结果
+	TEST_ASSERT_TRUE(RyanJsonIsDouble(d));
+	TEST_ASSERT_FALSE(RyanJsonIsInt(d));
+	TEST_ASSERT_TRUE(RyanJsonIsInt(i));
+	TEST_ASSERT_TRUE(RyanJsonInternalIsLazyNumber(d));
+	TEST_ASSERT_TRUE(RyanJsonInternalIsLazyNumber(i));
+	TEST_ASSERT_EQUAL_DOUBLE(-2.5, RyanJsonGetDoubleValue(d));
+	TEST_ASSERT_FALSE(RyanJsonInternalIsLazyNumber(d));
+	double doubleValue;
+	RyanJsonMemcpy(&doubleValue, RyanJsonInternalGetValue(d), sizeof(doubleValue));
+	TEST_ASSERT_EQUAL_DOUBLE(-2.5, doubleValue);
+
+	TEST_ASSERT_EQUAL_INT32(7, RyanJsonGetIntValue(i));
+	TEST_ASSERT_FALSE(RyanJsonInternalIsLazyNumber(i));
+	TEST_ASSERT_FALSE(RyanJsonGetPayloadNumberIsDoubleByFlag(i));
+
+	// 之后不再读取源文本：改写闲置的源文本不影响取值
+	RyanJsonInternalGetLazyNumberText(d)[0] = '9';
+	RyanJsonInternalGetLazyNumberText(i)[0] = '9';
+	TEST_ASSERT_EQUAL_DOUBLE(-2.5, RyanJsonGetDoubleValue(d));
+	TEST_ASSERT_TRUE(RyanJsonIsInt(i));
+	TEST_ASSERT_EQUAL_INT32(7, RyanJsonGetIntValue(i));
+
+	// 已转换的按普通 Number 打印，未访问的仍原样输出
+	lazyAssertPrint(root, "[-2.5,7,1E2]");
+	RyanJsonDelete(root);
+
+	// 普通 Double 写入与标记同位型的 NaN 时统一为 NAN，不会被误认作懒数值
+	uint64_t tagBits = RyanJsonLazyNumberTag;
+	double tagged;
+	RyanJsonMemcpy(&tagged, &tagBits, sizeof(tagged));
+	RyanJson_t nan = RyanJsonCreateDouble(NULL, tagged);
+	TEST_ASSERT_NOT_NULL(nan);
+	TEST_ASSERT_FALSE(RyanJsonInternalIsLazyNumber(nan));
+	TEST_ASSERT_TRUE(isnan(RyanJsonGetDoubleValue(nan)));
+	RyanJsonDelete(nan);
+}
+
+static void testLazyNumberSyntax(void)
+{
+	// 只扫描语法，但语法错误与普通解析同样拒绝
+	static const char *invalid[] = {"[01]", "[-]", "[1.]", "[.5]", "[1e]", "[1e+]",
+					"[+1]", "[-01]", "[1.e2]", "[0x10]", "{\"a\":1.2.3}"};
+	for (uint32_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+	{
+		TEST_ASSERT_NULL_MESSAGE(lazyParse(invalid[i]), invalid[i]);
+		TEST_ASSERT_NULL_MESSAGE(RyanJsonParse(invalid[i]), invalid[i]);
+	}
+
+	static const char *valid[] = {"[0]", "[-0.0]", "[1e-5]", "[1E+05]", "[0.000001]", "[-9.99e99]"};
+	for (uint32_t i = 0; i < sizeof(valid) / sizeof(valid[0]); i++)
+	{
+		RyanJson_t lazy = lazyParse(valid[i]);
+		RyanJson_t eager = RyanJsonParse(valid[i]);
+		TEST_ASSERT_NOT_NULL_MESSAGE(lazy, valid[i]);
+		TEST_ASSERT_NOT_NULL_MESSAGE(eager, valid[i]);
+		lazyAssertPrint(lazy, valid[i]);
+		TEST_ASSERT_TRUE_MESSAGE(RyanJsonCompare(lazy, eager), valid[i]);
+		RyanJsonDelete(eager);
+		RyanJsonDelete(lazy);
+	}
+
+	// 数值范围与普通解析一致：超出 Double 范围或指数超出 int32（正负皆然）同样拒绝，临界值照常接受
+	static const char *range[] = {"[1e400]", "[-1e309]", "[1.8e308]", "[0e400]", "[1e308]", "[1.7976931348623157e308]",
+				      "[1e-400]", "[0.1e309]", "[123456789e300]", "[1e-2147483647]", "[-5e-350]", "[1e2147483648]"};
+	for (uint32_t i = 0; i < sizeof(range) / sizeof(range[0]); i++)
+	{
+		RyanJson_t lazy = lazyParse(range[i]);
+		RyanJson_t eager = RyanJsonParse(range[i]);
+		TEST_ASSERT_EQUAL_MESSAGE(NULL == eager, NULL == lazy, range[i]);
+		if (NULL == eager) { continue; }
+		TEST_ASSERT_TRUE_MESSAGE(RyanJsonCompare(lazy, eager), range[i]);
+		RyanJsonDelete(eager);
+		RyanJsonDelete(lazy);
+	}
+	static const char *hugeExponent[] = {"[1e-2147483648]", "[1e-22147483647]", "[0.000001e-99999999999]"};
+	for (uint32_t i = 0; i < sizeof(hugeExponent) / sizeof(hugeExponent[0]); i++)
+	{
+		TEST_ASSERT_NULL_MESSAGE(RyanJsonParse(hugeExponent[i]), hugeExponent[i]);
+		TEST_ASSERT_NULL_MESSAGE(lazyParse(hugeExponent[i]), hugeExponent[i]);
+	}
+
+	// 超过 Double 上限的长整数写法同样拒绝
+	static char longDigits[400];
+	longDigits[0] = '[';
+	memset(longDigits + 1, '9', sizeof(longDigits) - 3);
+	longDigits[sizeof(longDigits) - 2] = ']';
+	longDigits[sizeof(longDigits) - 1] = '\0';
+	TEST_ASSERT_NULL(RyanJsonParse(longDigits));
+	TEST_ASSERT_NULL(lazyParse(longDigits));
+}
+
+static void testLazyNumberCompareAndChange(void)
+{
+	static const char text[] = "{\"a\":1,\"b\":2.50,\"c\":[3,4.0]}";
+	RyanJson_t lazy = lazyParse(text);
+	RyanJson_t eager = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(lazy);
+	TEST_ASSERT_NOT_NULL(eager);
+
+	// 复制与修改 key 不触发转换，源文本随节点保留
+	RyanJson_t copy = RyanJsonDuplicate(lazy);
+	TEST_ASSERT_NOT_NULL(copy);
+	TEST_ASSERT_TRUE(RyanJsonInternalIsLazyNumber(RyanJsonGetObjectByKey(copy, "b")));
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(RyanJsonGetObjectByKey(copy, "a"), "renamedKeyLongerThanInline"));
+	RyanJson_t a = RyanJsonGetObjectByKey(copy, "renamedKeyLongerThanInline");
+	TEST_ASSERT_TRUE(RyanJsonInternalIsLazyNumber(a));
+	lazyAssertPrint(copy, "{\"renamedKeyLongerThanInline\":1,\"b\":2.50,\"c\":[3,4.0]}");
+
+	// 与普通解析结果按数值比较，哈希一致
+	TEST_ASSERT_TRUE(RyanJsonCompare(lazy, eager));
+	TEST_ASSERT_TRUE(RyanJsonCompare(eager, lazy));
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(eager), RyanJsonHash(lazy));
+
+	// 写法不同但数值相同视为相等；Int 与 Double 不相等
+	RyanJson_t other = lazyParse("{\"c\":[3,4.00],\"b\":25e-1,\"a\":1}");
+	TEST_ASSERT_NOT_NULL(other);
+	TEST_ASSERT_TRUE(RyanJsonCompare(lazy, other));
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(lazy), RyanJsonHash(other));
+	RyanJsonDelete(other);
+	other = lazyParse("{\"a\":1.0,\"b\":2.5,\"c\":[3,4.0]}");
+	TEST_ASSERT_NOT_NULL(other);
+	TEST_ASSERT_FALSE(RyanJsonCompare(lazy, other));
+	RyanJsonDelete(other);
+
+	// 修改直接写入为普通 Number，不申请内存；种类不符时失败
+	RyanJson_t b = RyanJsonGetObjectByKey(copy, "b");
+	UNITY_TEST_OOM_BEGIN(0);
+	RyanJsonBool_e changedInt = RyanJsonChangeIntValue(a, -123456);
+	RyanJsonBool_e changedDouble = RyanJsonChangeDoubleValue(b, 0.5);
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_TRUE(changedInt);
+	TEST_ASSERT_TRUE(changedDouble);
+	TEST_ASSERT_FALSE(RyanJsonInternalIsLazyNumber(a));
+	TEST_ASSERT_FALSE(RyanJsonInternalIsLazyNumber(b));
+	TEST_ASSERT_FALSE(RyanJsonChangeIntValue(b, 1));
+	TEST_ASSERT_FALSE(RyanJsonChangeDoubleValue(a, 1.5));
+	TEST_ASSERT_EQUAL_INT32(-123456, RyanJsonGetIntValue(a));
+	TEST_ASSERT_EQUAL_DOUBLE(0.5, RyanJsonGetDoubleValue(b));
+	lazyAssertPrint(copy, "{\"renamedKeyLongerThanInline\":-123456,\"b\":0.5,\"c\":[3,4.0]}");
+	TEST_ASSERT_FALSE(RyanJsonCompare(lazy, copy));
+
+	// 比较与哈希不转换，源文本原样保留
+	lazyAssertPrint(lazy, text);
+
+	RyanJsonDelete(copy);
+	RyanJsonDelete(eager);
+	RyanJsonDelete(lazy);
+}
+
+static void testLazyNumberReadOnlyKeepsText(void)
+{
+	static const char text[] = "{\"big\":123456789012345678901234567890,\"i\":-0,\"d\":1.50E+2,\"s\":[7,2e0]}";
+	RyanJson_t lazy = lazyParse(text);
+	RyanJson_t eager = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(lazy);
+	TEST_ASSERT_NOT_NULL(eager);
+
+	// 比较、哈希、判型与编码只在局部解析，节点保持懒状态，打印仍与输入逐字节一致
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(eager), RyanJsonHash(lazy));
+	TEST_ASSERT_TRUE(RyanJsonCompare(lazy, eager));
+	TEST_ASSERT_TRUE(RyanJsonCompare(eager, lazy));
+	TEST_ASSERT_TRUE(RyanJsonIsDouble(RyanJsonGetObjectByKey(lazy, "big")));
+	TEST_ASSERT_TRUE(RyanJsonIsInt(RyanJsonGetObjectByKey(lazy, "i")));
+	uint32_t len = 0;
+	uint8_t *cbor = RyanJsonPrintCodec(lazy, RyanJsonCodecCbor, 64, &len);
+	TEST_ASSERT_NOT_NULL(cbor);
+	RyanJsonFree(cbor);
+	lazyAssertPrint(lazy, text);
+	TEST_ASSERT_TRUE(RyanJsonInternalIsLazyNumber(RyanJsonGetObjectByKey(lazy, "big")));
+
+	RyanJsonDelete(eager);
+	RyanJsonDelete(lazy);
+}
+
+static void testLazyNumberBinaryFormats(void)
+{
+	static const char text[] = "{\"n\":[1,-70000,2.5,1e2],\"s\":\"x\"}";
+	RyanJson_t lazy = lazyParse(text);
+	RyanJson_t eager = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(lazy);
+	TEST_ASSERT_NOT_NULL(eager);
+
+	// 编码结果与普通 Number 逐字节一致
+	for (uint32_t codec = RyanJsonCodecCbor; codec <= RyanJsonCodecMsgPack; codec++)
+	{
+		uint32_t lazyLen = 0;
+		uint32_t eagerLen = 0;
+		uint8_t *lazyData = RyanJsonPrintCodec(lazy, (RyanJsonCodec_e)codec, 0, &lazyLen);
+		uint8_t *eagerData = RyanJsonPrintCodec(eager, (RyanJsonCodec_e)codec, 0, &eagerLen);
+		TEST_ASSERT_NOT_NULL(lazyData);
+		TEST_ASSERT_NOT_NULL(eagerData);
+		TEST_ASSERT_EQUAL_UINT32(eagerLen, lazyLen);
+		TEST_ASSERT_EQUAL_HEX8_ARRAY(eagerData, lazyData, lazyLen);
+		RyanJsonFree(eagerData);
+		RyanJsonFree(lazyData);
+	}
+
+	// 二进制镜像中按 Number 条目保存
+	uint32_t len = 0;
+	uint8_t *image = RyanJsonSaveBinary(lazy, &len);
+	TEST_ASSERT_NOT_NULL(image);
+	RyanJsonTape_t tape = RyanJsonLoadBinary(image, len);
+	TEST_ASSERT_NOT_NULL(tape);
+	RyanJsonTapeVal_t list = RyanJsonTapeGetObjectByKey(RyanJsonTapeGetRoot(tape), "n");
+	TEST_ASSERT_TRUE(RyanJsonTapeIsInt(RyanJsonTapeGetObjectByIndex(list, 1)));
+	TEST_ASSERT_EQUAL_INT32(-70000, RyanJsonTapeGetIntValue(RyanJsonTapeGetObjectByIndex(list, 1)));
+	TEST_ASSERT_TRUE(RyanJsonTapeIsDouble(RyanJsonTapeGetObjectByIndex(list, 3)));
+	RyanJson_t loaded = RyanJsonTapeToTree(RyanJsonTapeGetRoot(tape));
+	TEST_ASSERT_NOT_NULL(loaded);
+	TEST_ASSERT_TRUE(RyanJsonCompare(eager, loaded));
+	RyanJsonDelete(loaded);
+	RyanJsonFree(image);
+
+	// 懒数值数组保留源文本，不转为紧凑存储
+	static const char many[] = "[1.50,2.50,3.50,4.50,5.50,6.50,7.50,8.50,9.50,10.50,11.50,12.50,13.50,14.50,15.50,16.50]";
+	RyanJson_t manyJson = lazyParse(many);
+	TEST_ASSERT_NOT_NULL(manyJson);
+	lazyAssertPrint(manyJson, many);
+	RyanJsonDelete(manyJson);
+
+	RyanJsonDelete(eager);
+	RyanJsonDelete(lazy);
+}
+
+static void testLazyNumberOom(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+	static const char text[] = "{\"sensor\":[1,2.25,-3,123456789012345678901234567890],\"keyLongerThanInlineStorage\":42}";
+
+	RyanJson_t root = NULL;
+	for (uint32_t budget = 0; NULL == root; budget++)
+	{
+		TEST_ASSERT_TRUE_MESSAGE(budget < 32U, "解析在有限次分配内应成功");
+		UNITY_TEST_OOM_BEGIN(budget);
+		root = lazyParse(text);
+		UNITY_TEST_OOM_END();
+	}
+	lazyAssertPrint(root, text);
+
+	// 判型与转换不申请内存；修改只剩普通 Number 的开销（启用增量跟踪时需记录）
+	RyanJson_t item = RyanJsonGetObjectByKey(root, "keyLongerThanInlineStorage");
+	UNITY_TEST_OOM_BEGIN(0);
+	RyanJsonBool_e isInt = RyanJsonIsInt(item);
+	int32_t intValue = RyanJsonGetIntValue(item);
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_TRUE(isInt);
+	TEST_ASSERT_EQUAL_INT32(42, intValue);
+	TEST_ASSERT_FALSE(RyanJsonInternalIsLazyNumber(item));
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(item, 1234567));
+	TEST_ASSERT_EQUAL_INT32(1234567, RyanJsonGetIntValue(item));
+
+	// 复制连同未转换的源文本一起拷贝，失败时不泄漏
+	RyanJson_t copy = NULL;
+	for (uint32_t budget = 0; NULL == copy; budget++)
+	{
+		TEST_ASSERT_TRUE_MESSAGE(budget < 32U, "复制在有限次分配内应成功");
+		UNITY_TEST_OOM_BEGIN(budget);
+		copy = RyanJsonDuplicate(root);
+		UNITY_TEST_OOM_END();
+	}
+	lazyAssertPrint(copy, "{\"sensor\":[1,2.25,-3,123456789012345678901234567890],\"keyLongerThanInlineStorage\":1234567}");
+
+	RyanJsonDelete(copy);
+	RyanJsonDelete(root);
+	unityTestLeakScopeEnd(scope, "懒数值失败路径不应泄漏");
+}
+
+void testLazyNumberRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+	RUN_TEST(testLazyNumberParseAndGet);
+	RUN_TEST(testLazyNumberConvertOnce);
+	RUN_TEST(testLazyNumberSyntax);
+	RUN_TEST(testLazyNumberCompareAndChange);
+	RUN_TEST(testLazyNumberReadOnlyKeepsText);
+	RUN_TEST(testLazyNumberBinaryFormats);
+	RUN_TEST(testLazyNumberOom);
+}
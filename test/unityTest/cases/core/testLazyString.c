@@ -0,0 +1,302 @@
+#include "testBase.h"
+
+static RyanJson_t lazyParse(const char *text)
+{
+	return RyanJsonParseWithFlags(text, (uint32_t)strlen(text), RyanJsonTrue, RyanJsonParseFlagLazyString, NULL);
+}
+
+static void lazyAssertPrint(RyanJson_t pJson, const char *expect)
+{
+	char *actual = RyanJsonPrint(pJson, 64, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(actual);
+	TEST_ASSERT_EQUAL_STRING(expect, actual);
+	RyanJsonFree(actual);
+}
+
+#if true != RyanJsonStringIntern
+
+static void testLazyStringParseAndGet(void)
+{
+	static const char text[] = "{\"k\\u0065y\":\"a\\/b\",\"plain\":\"xyz\",\"cjk\":\"\\u4e2d\\u6587\\ud83d\\ude00\","
+				   "\"long\":\"line1\\nline2\\tcolumn \\\"quoted\\\" text that does not fit inline \\u00e9\"}";
+	RyanJson_t root = lazyParse(text);
+	TEST_ASSERT_NOT_NULL(root);
+
+	// 解码前打印逐字节保留源文本；key 仍在解析时解码
+	lazyAssertPrint(root, "{\"key\":\"a\\/b\",\"plain\":\"xyz\",\"cjk\":\"\\u4e2d\\u6587\\ud83d\\ude00\","
+			      "\"long\":\"line1\\nline2\\tcolumn \\\"quoted\\\" text that does not fit inline \\u00e9\"}");
+	RyanJson_t shortItem = RyanJsonGetObjectByKey(root, "key");
+	TEST_ASSERT_NOT_NULL(shortItem);
+	TEST_ASSERT_TRUE(RyanJsonIsString(shortItem));
+
+	// 首次读取时原地解码，地址不变
+	char *before = RyanJsonGetStringValue(shortItem);
+	TEST_ASSERT_EQUAL_STRING("a/b", before);
+	TEST_ASSERT_EQUAL_PTR(before, RyanJsonGetStringValue(shortItem));
+	TEST_ASSERT_EQUAL_UINT32(3, RyanJsonGetStringLength(shortItem));
+	TEST_ASSERT_EQUAL_STRING("xyz", RyanJsonGetStringValue(RyanJsonGetObjectByKey(root, "plain")));
+
+	RyanJson_t cjk = RyanJsonGetObjectByKey(root, "cjk");
+	TEST_ASSERT_EQUAL_UINT32(10, RyanJsonGetStringLength(cjk));
+	TEST_ASSERT_EQUAL_STRING("\xE4\xB8\xAD\xE6\x96\x87\xF0\x9F\x98\x80", RyanJsonGetStringValue(cjk));
+
+	RyanJson_t longItem = RyanJsonGetObjectByKey(root, "long");
+	static const char longValue[] = "line1\nline2\tcolumn \"quoted\" text that does not fit inline \xC3\xA9";
+	TEST_ASSERT_EQUAL_STRING(longValue, RyanJsonGetStringValue(longItem));
+	TEST_ASSERT_EQUAL_UINT32(sizeof(longValue) - 1U, RyanJsonGetStringLength(longItem));
+
+	// 解码后打印结果与普通解析等价（启用 RyanJsonPrintCache 时可能仍是缓存的源文本）
+	char *printed = RyanJsonPrint(root, 64, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(printed);
+	RyanJson_t reparsed = RyanJsonParse(printed);
+	RyanJson_t eager = RyanJsonParse(text);
+	TEST_ASSERT_TRUE(RyanJsonCompare(eager, reparsed));
+	RyanJsonDelete(eager);
+	RyanJsonDelete(reparsed);
+	RyanJsonFree(printed);
+
+	// 与普通解析一致：\u0000 处截断
+	RyanJson_t nul = lazyParse("[\"ab\\u0000cd\"]");
+	TEST_ASSERT_NOT_NULL(nul);
+	TEST_ASSERT_EQUAL_STRING("ab", RyanJsonGetStringValue(RyanJsonGetObjectByIndex(nul, 0)));
+	TEST_ASSERT_EQUAL_UINT32(2, RyanJsonGetStringLength(RyanJsonGetObjectByIndex(nul, 0)));
+	RyanJsonDelete(nul);
+
+	// 标量根与尾部位置
+	const char *end = NULL;
+	static const char scalar[] = " \"\\t\" ,";
+	RyanJson_t str = RyanJsonParseWithFlags(scalar, (uint32_t)strlen(scalar), RyanJsonFalse, RyanJsonParseFlagLazyString, &end);
+	TEST_ASSERT_NOT_NULL(str);
+	TEST_ASSERT_EQUAL_PTR(scalar + 5, end);
+	lazyAssertPrint(str, "\"\\t\"");
+	TEST_ASSERT_EQUAL_STRING("\t", RyanJsonGetStringValue(str));
+	RyanJsonDelete(str);
+
+	RyanJsonDelete(root);
+}
+
+static void testLazyStringSyntax(void)
+{
+	// 只校验不解码，但非法文本与普通解析同样拒绝
+	static const char *invalid[] = {"[\"\\x\"]",         "[\"\\u12G4\"]",       "[\"\\u12\"]",   "[\"\\ud800\"]",
+					"[\"\\udc00\\u0041\"]", "[\"\\ud800\\u0041\"]", "[\"a\\\"]",     "[\"\\ud800\\n\"]",
+					"[\"tab\t\"]",         "{\"a\":\"\\q\"}"};
+	for (uint32_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+	{
+		TEST_ASSERT_NULL_MESSAGE(lazyParse(invalid[i]), invalid[i]);
+		TEST_ASSERT_NULL_MESSAGE(RyanJsonParse(invalid[i]), invalid[i]);
+	}
+
+	static const char *valid[] = {"[\"\\\\\"]", "[\"\\b\\f\\n\\r\\t\"]", "[\"\\u0041\\u00DF\\u20AC\"]", "[\"\\uD834\\uDD1E\"]",
+				      "[\"\\\"\\/\"]"};
+	for (uint32_t i = 0; i < sizeof(valid) / sizeof(valid[0]); i++)
+	{
+		RyanJson_t lazy = lazyParse(valid[i]);
+		RyanJson_t eager = RyanJsonParse(valid[i]);
+		TEST_ASSERT_NOT_NULL_MESSAGE(lazy, valid[i]);
+		TEST_ASSERT_NOT_NULL_MESSAGE(eager, valid[i]);
+		lazyAssertPrint(lazy, valid[i]);
+		TEST_ASSERT_EQUAL_STRING_MESSAGE(RyanJsonGetStringValue(RyanJsonGetObjectByIndex(eager, 0)),
+						 RyanJsonGetStringValue(RyanJsonGetObjectByIndex(lazy, 0)), valid[i]);
+		RyanJsonDelete(eager);
+		RyanJsonDelete(lazy);
+	}
+}
+
+static void testLazyStringReadOnlyKeepsText(void)
+{
+	static const char text[] = "{\"a\":\"\\u0041\\n\\ud83d\\ude00\",\"b\":\"x\\\\y long enough to leave the inline area\","
+				   "\"c\":\"ab\\u0000cd\"}";
+	RyanJson_t lazy = lazyParse(text);
+	RyanJson_t eager = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(lazy);
+	TEST_ASSERT_NOT_NULL(eager);
+
+	// 比较、哈希与取长度流式解码，不改动节点，打印仍与输入逐字节一致
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(eager), RyanJsonHash(lazy));
+	TEST_ASSERT_TRUE(RyanJsonCompare(lazy, eager));
+	TEST_ASSERT_TRUE(RyanJsonCompare(eager, lazy));
+	RyanJson_t a = RyanJsonGetObjectByKey(lazy, "a");
+	TEST_ASSERT_EQUAL_UINT32(6, RyanJsonGetStringLength(a));
+	TEST_ASSERT_EQUAL_UINT32(2, RyanJsonGetStringLength(RyanJsonGetObjectByKey(lazy, "c")));
+	TEST_ASSERT_TRUE(RyanJsonInternalIsLazyString(a));
+	lazyAssertPrint(lazy, text);
+
+	// 解码结果不同时比较失败，前缀相同也不例外
+	TEST_ASSERT_TRUE(RyanJsonChangeStringValue(RyanJsonGetObjectByKey(eager, "a"), "A\n"));
+	TEST_ASSERT_FALSE(RyanJsonCompare(lazy, eager));
+	TEST_ASSERT_FALSE(RyanJsonCompare(eager, lazy));
+	lazyAssertPrint(lazy, text);
+
+	RyanJsonDelete(eager);
+	RyanJsonDelete(lazy);
+}
+
+static void testLazyStringCompareAndChange(void)
+{
+	static const char text[] = "{\"a\":\"\\u0041\\/\",\"b\":[\"x\\ty\",\"plain\"],\"c\":\"escaped \\\"long\\\" value beyond inline size\"}";
+	RyanJson_t lazy = lazyParse(text);
+	RyanJson_t eager = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(lazy);
+	TEST_ASSERT_NOT_NULL(eager);
+
+	// 源文本相同的懒字符串直接比较，无需解码
+	RyanJson_t same = lazyParse(text);
+	TEST_ASSERT_NOT_NULL(same);
+	TEST_ASSERT_TRUE(RyanJsonCompare(lazy, same));
+	lazyAssertPrint(lazy, text);
+	lazyAssertPrint(same, text);
+	RyanJsonDelete(same);
+
+	// 写法不同但值相同视为相等，哈希一致
+	RyanJson_t other = lazyParse("{\"a\":\"A/\",\"b\":[\"x\\u0009y\",\"plain\"],\"c\":\"escaped \\\"long\\\" value beyond inline size\"}");
+	TEST_ASSERT_NOT_NULL(other);
+	TEST_ASSERT_TRUE(RyanJsonCompare(other, lazy));
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(other), RyanJsonHash(lazy));
+	RyanJsonDelete(other);
+	TEST_ASSERT_TRUE(RyanJsonCompare(lazy, eager));
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(eager), RyanJsonHash(lazy));
+	RyanJsonDelete(lazy);
+
+	// 复制与改 key 保持未解码，副本独立解码
+	lazy = lazyParse(text);
+	TEST_ASSERT_NOT_NULL(lazy);
+	RyanJson_t copy = RyanJsonDuplicate(lazy);
+	TEST_ASSERT_NOT_NULL(copy);
+	lazyAssertPrint(copy, text);
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(RyanJsonGetObjectByKey(copy, "c"), "renamedKeyLongerThanInline"));
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(RyanJsonGetObjectByKey(copy, "a"), "z"));
+	lazyAssertPrint(copy, "{\"z\":\"\\u0041\\/\",\"b\":[\"x\\ty\",\"plain\"],"
+			      "\"renamedKeyLongerThanInline\":\"escaped \\\"long\\\" value beyond inline size\"}");
+	TEST_ASSERT_EQUAL_STRING("escaped \"long\" value beyond inline size",
+				 RyanJsonGetStringValue(RyanJsonGetObjectByKey(copy, "renamedKeyLongerThanInline")));
+	lazyAssertPrint(lazy, text);
+
+	// 修改后为普通 String
+	RyanJson_t a = RyanJsonGetObjectByKey(lazy, "a");
+	TEST_ASSERT_TRUE(RyanJsonChangeStringValue(a, "\\u0041"));
+	TEST_ASSERT_EQUAL_STRING("\\u0041", RyanJsonGetStringValue(a));
+	lazyAssertPrint(a, "\"\\\\u0041\"");
+
+	RyanJsonDelete(copy);
+	RyanJsonDelete(eager);
+	RyanJsonDelete(lazy);
+}
+
+static void testLazyStringBinaryFormats(void)
+{
+	static const char text[] = "{\"s\":[\"\\u00e9\\n\",\"plain\"],\"blob\":\"AAEC\\/w==\"}";
+	RyanJson_t lazy = lazyParse(text);
+	RyanJson_t eager = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(lazy);
+	TEST_ASSERT_NOT_NULL(eager);
+
+	// 编码前解码，结果与普通解析逐字节一致
+	for (uint32_t codec = RyanJsonCodecCbor; codec <= RyanJsonCodecMsgPack; codec++)
+	{
+		RyanJson_t fresh = lazyParse(text);
+		TEST_ASSERT_NOT_NULL(fresh);
+		uint32_t lazyLen = 0;
+		uint32_t eagerLen = 0;
+		uint8_t *lazyData = RyanJsonPrintCodec(fresh, (RyanJsonCodec_e)codec, 0, &lazyLen);
+		uint8_t *eagerData = RyanJsonPrintCodec(eager, (RyanJsonCodec_e)codec, 0, &eagerLen);
+		TEST_ASSERT_NOT_NULL(lazyData);
+		TEST_ASSERT_NOT_NULL(eagerData);
+		TEST_ASSERT_EQUAL_UINT32(eagerLen, lazyLen);
+		TEST_ASSERT_EQUAL_HEX8_ARRAY(eagerData, lazyData, lazyLen);
+		RyanJsonFree(eagerData);
+		RyanJsonFree(lazyData);
+		RyanJsonDelete(fresh);
+	}
+
+	// 二进制镜像保存解码后的值
+	uint32_t len = 0;
+	uint8_t *image = RyanJsonSaveBinary(lazy, &len);
+	TEST_ASSERT_NOT_NULL(image);
+	RyanJsonTape_t tape = RyanJsonLoadBinary(image, len);
+	TEST_ASSERT_NOT_NULL(tape);
+	RyanJsonTapeVal_t first = RyanJsonTapeGetObjectByIndex(RyanJsonTapeGetObjectByKey(RyanJsonTapeGetRoot(tape), "s"), 0);
+	TEST_ASSERT_EQUAL_STRING("\xC3\xA9\n", RyanJsonTapeGetStringValue(first));
+	RyanJson_t loaded = RyanJsonTapeToTree(RyanJsonTapeGetRoot(tape));
+	TEST_ASSERT_NOT_NULL(loaded);
+	TEST_ASSERT_TRUE(RyanJsonCompare(eager, loaded));
+	RyanJsonDelete(loaded);
+	RyanJsonFree(image);
+	RyanJsonDelete(lazy);
+
+	// base64 中常见的 "\/" 转义先解码再转换
+	lazy = lazyParse(text);
+	TEST_ASSERT_NOT_NULL(lazy);
+	RyanJson_t blob = RyanJsonGetObjectByKey(lazy, "blob");
+	TEST_ASSERT_TRUE(RyanJsonDecodeBase64(blob));
+	uint32_t blobLen = 0;
+	const uint8_t *data = RyanJsonGetBlobValue(blob, &blobLen);
+	static const uint8_t expectData[] = {0x00, 0x01, 0x02, 0xFF};
+	TEST_ASSERT_EQUAL_UINT32(sizeof(expectData), blobLen);
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(expectData, data, blobLen);
+
+	RyanJsonDelete(eager);
+	RyanJsonDelete(lazy);
+}
+
+static void testLazyStringOom(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+	static const char text[] = "{\"escapedKey\\u0021\":[\"\\u4e2d\",\"a \\\"long\\\" escaped value stored out of line\"],\"n\":1}";
+
+	RyanJson_t root = NULL;
+	for (uint32_t budget = 0; NULL == root; budget++)
+	{
+		TEST_ASSERT_TRUE_MESSAGE(budget < 32U, "解析在有限次分配内应成功");
+		UNITY_TEST_OOM_BEGIN(budget);
+		root = lazyParse(text);
+		UNITY_TEST_OOM_END();
+	}
+	lazyAssertPrint(root, "{\"escapedKey!\":[\"\\u4e2d\",\"a \\\"long\\\" escaped value stored out of line\"],\"n\":1}");
+
+	// 解码不申请内存
+	RyanJson_t list = RyanJsonGetObjectByKey(root, "escapedKey!");
+	TEST_ASSERT_NOT_NULL(list);
+	UNITY_TEST_OOM_BEGIN(0);
+	char *first = RyanJsonGetStringValue(RyanJsonGetObjectByIndex(list, 0));
+	char *second = RyanJsonGetStringValue(RyanJsonGetObjectByIndex(list, 1));
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_EQUAL_STRING("\xE4\xB8\xAD", first);
+	TEST_ASSERT_EQUAL_STRING("a \"long\" escaped value stored out of line", second);
+
+	RyanJsonDelete(root);
+	unityTestLeakScopeEnd(scope, "懒字符串失败路径不应泄漏");
+}
+
+#else
+
+static void testLazyStringIgnoredWithIntern(void)
+{
+	// 驻留缓冲可能共享，标志不生效，结果与普通解析一致
+	static const char text[] = "[\"\\u0041\\/\",\"escaped \\\"long\\\" value beyond inline size\"]";
+	RyanJson_t lazy = lazyParse(text);
+	RyanJson_t eager = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(lazy);
+	TEST_ASSERT_NOT_NULL(eager);
+	lazyAssertPrint(lazy, "[\"A/\",\"escaped \\\"long\\\" value beyond inline size\"]");
+	TEST_ASSERT_TRUE(RyanJsonCompare(lazy, eager));
+	RyanJsonDelete(eager);
+	RyanJsonDelete(lazy);
+}
+
+#endif
+
+void testLazyStringRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+#if true != RyanJsonStringIntern
+	RUN_TEST(testLazyStringParseAndGet);
+	RUN_TEST(testLazyStringSyntax);
+	RUN_TEST(testLazyStringReadOnlyKeepsText);
+	RUN_TEST(testLazyStringCompareAndChange);
+	RUN_TEST(testLazyStringBinaryFormats);
+	RUN_TEST(testLazyStringOom);
+#else
+	RUN_TEST(testLazyStringIgnoredWithIntern);
+#endif
+}
@@ -0,0 +1,580 @@
+#include "testBase.h"
+
+#if true == RyanJsonPackedArray
+
+// 不小于 RyanJsonPackedArrayParseMinSize，解析时会被转为紧凑存储
+#define packedArrayTestCount (32U)
+
+/**
+ * @brief 按自然顺序逐个追加，构造与紧凑数组等价的普通 Array（不受 RyanJsonDefaultAddAtHead 影响）
+ */
+static RyanJson_t createPlainIntArray(const int32_t *numbers, uint32_t count)
+{
+	RyanJson_t arr = RyanJsonCreateArray();
+	TEST_ASSERT_NOT_NULL(arr);
+
+	RyanJsonAppender_t appender;
+	TEST_ASSERT_TRUE(RyanJsonAppenderInit(&appender, arr));
+	for (uint32_t i = 0; i < count; i++)
+	{
+		TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, RyanJsonCreateInt(NULL, numbers[i])));
+	}
+	return arr;
+}
+
+static RyanJson_t createPlainDoubleArray(const double *numbers, uint32_t count)
+{
+	RyanJson_t arr = RyanJsonCreateArray();
+	TEST_ASSERT_NOT_NULL(arr);
+
+	RyanJsonAppender_t appender;
+	TEST_ASSERT_TRUE(RyanJsonAppenderInit(&appender, arr));
+	for (uint32_t i = 0; i < count; i++)
+	{
+		TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, RyanJsonCreateDouble(NULL, numbers[i])));
+	}
+	return arr;
+}
+
+/**
+ * @brief 紧凑数组与普通 Array 的紧凑/格式化输出必须逐字节一致
+ */
+static void assertSamePrint(RyanJson_t packed, RyanJson_t plain)
+{
+	for (uint32_t format = 0; format < 2; format++)
+	{
+		char *packedStr = RyanJsonPrint(packed, 64, (RyanJsonBool_e)format, NULL);
+		char *plainStr = RyanJsonPrint(plain, 64, (RyanJsonBool_e)format, NULL);
+		TEST_ASSERT_NOT_NULL(packedStr);
+		TEST_ASSERT_NOT_NULL(plainStr);
+		TEST_ASSERT_EQUAL_STRING(plainStr, packedStr);
+		RyanJsonFree(packedStr);
+		RyanJsonFree(plainStr);
+	}
+}
+
+static void testPackedArrayCreateAndPrint(void)
+{
+	int32_t ints[packedArrayTestCount];
+	double doubles[packedArrayTestCount];
+	float floats[4] = {0.5f, -2.25f, 1024.0f, 0.1f};
+	double floatsAsDouble[4];
+	for (uint32_t i = 0; i < packedArrayTestCount; i++)
+	{
+		ints[i] = (int32_t)(i * 37U) - 500;
+		doubles[i] = (double)i * 1.5 - 3.25;
+	}
+	ints[0] = INT32_MIN;
+	ints[1] = INT32_MAX;
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		floatsAsDouble[i] = (double)floats[i];
+	}
+
+	RyanJson_t packed = RyanJsonCreatePackedIntArray(ints, packedArrayTestCount);
+	RyanJson_t plain = createPlainIntArray(ints, packedArrayTestCount);
+	TEST_ASSERT_TRUE(RyanJsonIsPackedArray(packed));
+	TEST_ASSERT_FALSE(RyanJsonIsPackedArray(plain));
+	TEST_ASSERT_TRUE(RyanJsonIsArray(packed));
+	TEST_ASSERT_EQUAL_UINT32(packedArrayTestCount, RyanJsonGetSize(packed));
+	assertSamePrint(packed, plain);
+
+	// 连续数据可直接读取
+	RyanJsonPackedType_e elemType = RyanJsonPackedTypeDouble;
+	uint32_t count = 0;
+	const int32_t *data = (const int32_t *)RyanJsonGetPackedArrayData(packed, &elemType, &count);
+	TEST_ASSERT_NOT_NULL(data);
+	TEST_ASSERT_EQUAL_INT(RyanJsonPackedTypeInt, elemType);
+	TEST_ASSERT_EQUAL_UINT32(packedArrayTestCount, count);
+	TEST_ASSERT_EQUAL_INT32_ARRAY(ints, data, packedArrayTestCount);
+	TEST_ASSERT_NULL(RyanJsonGetPackedArrayData(plain, NULL, NULL));
+	RyanJsonDelete(packed);
+	RyanJsonDelete(plain);
+
+	packed = RyanJsonCreatePackedDoubleArray(doubles, packedArrayTestCount);
+	plain = createPlainDoubleArray(doubles, packedArrayTestCount);
+	assertSamePrint(packed, plain);
+	RyanJsonDelete(packed);
+	RyanJsonDelete(plain);
+
+	packed = RyanJsonCreatePackedFloatArray(floats, 4);
+	plain = createPlainDoubleArray(floatsAsDouble, 4);
+	TEST_ASSERT_EQUAL_UINT32(4, RyanJsonGetSize(packed));
+	assertSamePrint(packed, plain);
+	TEST_ASSERT_TRUE(RyanJsonCompare(packed, plain));
+	RyanJsonDelete(packed);
+	RyanJsonDelete(plain);
+
+	// 空数组退化为普通空 Array；非法参数失败
+	packed = RyanJsonCreatePackedIntArray(ints, 0);
+	TEST_ASSERT_NOT_NULL(packed);
+	TEST_ASSERT_FALSE(RyanJsonIsPackedArray(packed));
+	TEST_ASSERT_EQUAL_UINT32(0, RyanJsonGetSize(packed));
+	RyanJsonDelete(packed);
+	TEST_ASSERT_NULL(RyanJsonCreatePackedIntArray(NULL, 4));
+	TEST_ASSERT_FALSE(RyanJsonIsPackedArray(NULL));
+}
+
+static void testPackedArrayNestedPrintCompareDuplicate(void)
+{
+	int32_t ints[packedArrayTestCount];
+	for (uint32_t i = 0; i < packedArrayTestCount; i++)
+	{
+		ints[i] = (int32_t)i;
+	}
+
+	RyanJson_t packedRoot = RyanJsonCreateObject();
+	RyanJson_t plainRoot = RyanJsonCreateObject();
+	TEST_ASSERT_TRUE(RyanJsonAddItemToObject(packedRoot, "samples", RyanJsonCreatePackedIntArray(ints, packedArrayTestCount)));
+	TEST_ASSERT_TRUE(RyanJsonAddItemToObject(plainRoot, "samples", createPlainIntArray(ints, packedArrayTestCount)));
+	TEST_ASSERT_TRUE(RyanJsonAddIntToObject(packedRoot, "id", 7));
+	TEST_ASSERT_TRUE(RyanJsonAddIntToObject(plainRoot, "id", 7));
+
+	// 挂到 Object 下（需要 key）后仍保持紧凑
+	RyanJson_t samples = RyanJsonGetObjectByKey(packedRoot, "samples");
+	TEST_ASSERT_TRUE(RyanJsonIsPackedArray(samples));
+	assertSamePrint(packedRoot, plainRoot);
+
+	// 紧凑与普通、紧凑与紧凑的比较
+	TEST_ASSERT_TRUE(RyanJsonCompare(packedRoot, plainRoot));
+	TEST_ASSERT_TRUE(RyanJsonCompare(plainRoot, packedRoot));
+	TEST_ASSERT_TRUE(RyanJsonCompareOnlyKey(packedRoot, plainRoot));
+
+	RyanJson_t dup = RyanJsonDuplicate(packedRoot);
+	TEST_ASSERT_NOT_NULL(dup);
+	TEST_ASSERT_TRUE(RyanJsonIsPackedArray(RyanJsonGetObjectByKey(dup, "samples")));
+	TEST_ASSERT_TRUE(RyanJsonCompare(packedRoot, dup));
+
+	RyanJsonDelete(dup);
+
+	// 值不同：Compare 失败，CompareOnlyKey 仍成功
+	ints[5] = -5;
+	RyanJson_t other = RyanJsonCreatePackedIntArray(ints, packedArrayTestCount);
+	TEST_ASSERT_FALSE(RyanJsonCompare(samples, other));
+	TEST_ASSERT_TRUE(RyanJsonCompareOnlyKey(samples, other));
+	RyanJsonDelete(other);
+	ints[5] = 5;
+
+	// 修改普通侧元素
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByIndex(RyanJsonGetObjectByKey(plainRoot, "samples"), 3), 99));
+	TEST_ASSERT_FALSE(RyanJsonCompare(packedRoot, plainRoot));
+
+	// Int 与 Double 种类不同时值比较失败
+	double doubles[packedArrayTestCount];
+	for (uint32_t i = 0; i < packedArrayTestCount; i++)
+	{
+		doubles[i] = (double)i;
+	}
+	RyanJson_t packedDouble = RyanJsonCreatePackedDoubleArray(doubles, packedArrayTestCount);
+	TEST_ASSERT_FALSE(RyanJsonCompare(samples, packedDouble));
+	TEST_ASSERT_TRUE(RyanJsonCompareOnlyKey(samples, packedDouble));
+	RyanJsonDelete(packedDouble);
+
+	// 改 key 不影响数据块
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(samples, "renamedSamplesKeyLongerThanInline"));
+	TEST_ASSERT_TRUE(RyanJsonIsPackedArray(samples));
+	TEST_ASSERT_EQUAL_UINT32(packedArrayTestCount, RyanJsonGetSize(samples));
+
+	RyanJsonDelete(packedRoot);
+	RyanJsonDelete(plainRoot);
+}
+
+static void testPackedArrayExpandOnAccess(void)
+{
+	int32_t ints[packedArrayTestCount];
+	for (uint32_t i = 0; i < packedArrayTestCount; i++)
+	{
+		ints[i] = (int32_t)(i * 3U);
+	}
+
+	// ForEach 自动展开
+	RyanJson_t arr = RyanJsonCreatePackedIntArray(ints, packedArrayTestCount);
+	uint32_t i = 0;
+	RyanJson_t item = NULL;
+	RyanJsonArrayForEach(arr, item)
+	{
+		TEST_ASSERT_EQUAL_INT32(ints[i], RyanJsonGetIntValue(item));
+		i++;
+	}
+	TEST_ASSERT_EQUAL_UINT32(packedArrayTestCount, i);
+	TEST_ASSERT_FALSE(RyanJsonIsPackedArray(arr));
+	RyanJsonDelete(arr);
+
+	// 按索引访问与插入
+	arr = RyanJsonCreatePackedIntArray(ints, packedArrayTestCount);
+	TEST_ASSERT_EQUAL_INT32(ints[10], RyanJsonGetIntValue(RyanJsonGetObjectByIndex(arr, 10)));
+	TEST_ASSERT_FALSE(RyanJsonIsPackedArray(arr));
+	RyanJsonDelete(arr);
+
+	arr = RyanJsonCreatePackedIntArray(ints, packedArrayTestCount);
+	TEST_ASSERT_TRUE(RyanJsonInsert(arr, 0, RyanJsonCreateString(NULL, "head")));
+	TEST_ASSERT_EQUAL_UINT32(packedArrayTestCount + 1U, RyanJsonGetSize(arr));
+	TEST_ASSERT_EQUAL_STRING("head", RyanJsonGetStringValue(RyanJsonGetObjectByIndex(arr, 0)));
+	TEST_ASSERT_EQUAL_INT32(ints[packedArrayTestCount - 1U], RyanJsonGetIntValue(RyanJsonGetObjectByIndex(arr, packedArrayTestCount)));
+	RyanJsonDelete(arr);
+
+	// 追加器初始化时展开
+	arr = RyanJsonCreatePackedIntArray(ints, packedArrayTestCount);
+	RyanJsonAppender_t appender;
+	TEST_ASSERT_TRUE(RyanJsonAppenderInit(&appender, arr));
+	TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, RyanJsonCreateInt(NULL, -1)));
+	TEST_ASSERT_EQUAL_INT32(-1, RyanJsonGetIntValue(RyanJsonGetObjectByIndex(arr, packedArrayTestCount)));
+	RyanJsonDelete(arr);
+
+	// 显式展开，普通 Array 直接成功
+	arr = RyanJsonCreatePackedIntArray(ints, packedArrayTestCount);
+	RyanJson_t plain = createPlainIntArray(ints, packedArrayTestCount);
+	TEST_ASSERT_TRUE(RyanJsonExpandPackedArray(arr));
+	TEST_ASSERT_TRUE(RyanJsonExpandPackedArray(arr));
+	TEST_ASSERT_FALSE(RyanJsonExpandPackedArray(NULL));
+	TEST_ASSERT_TRUE(RyanJsonCompare(arr, plain));
+	assertSamePrint(arr, plain);
+	RyanJsonDelete(arr);
+	RyanJsonDelete(plain);
+}
+
+static void testPackedArrayExpandOom(void)
+{
+	int32_t ints[packedArrayTestCount];
+	for (uint32_t i = 0; i < packedArrayTestCount; i++)
+	{
+		ints[i] = (int32_t)i;
+	}
+
+	RyanJson_t arr = RyanJsonCreatePackedIntArray(ints, packedArrayTestCount);
+	TEST_ASSERT_NOT_NULL(arr);
+
+	// 展开中途失败：回滚已建节点，保持紧凑存储
+	UNITY_TEST_OOM_BEGIN(5);
+	RyanJsonBool_e expanded = RyanJsonExpandPackedArray(arr);
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_FALSE(expanded);
+	TEST_ASSERT_TRUE(RyanJsonIsPackedArray(arr));
+	TEST_ASSERT_EQUAL_UINT32(packedArrayTestCount, RyanJsonGetSize(arr));
+
+	// 插入时展开失败：插入失败且 item 被释放
+	RyanJson_t item = RyanJsonCreateInt(NULL, 1);
+	TEST_ASSERT_NOT_NULL(item);
+	UNITY_TEST_OOM_BEGIN(0);
+	RyanJsonBool_e inserted = RyanJsonInsert(arr, 0, item);
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_FALSE(inserted);
+	TEST_ASSERT_TRUE(RyanJsonIsPackedArray(arr));
+
+	// 访问时展开失败视为无子节点
+	UNITY_TEST_OOM_BEGIN(0);
+	RyanJson_t hit = RyanJsonGetObjectByIndex(arr, 0);
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_NULL(hit);
+
+	// 复制数据块失败
+	UNITY_TEST_OOM_BEGIN(1);
+	RyanJson_t dup = RyanJsonDuplicate(arr);
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_NULL(dup);
+
+	TEST_ASSERT_EQUAL_INT32(ints[31], RyanJsonGetIntValue(RyanJsonGetObjectByIndex(arr, 31)));
+	RyanJsonDelete(arr);
+}
+
+static void testPackedArrayParse(void)
+{
+	// 足够长且元素同类的数组解析后为紧凑存储，输出与输入一致
+	char text[512];
+	uint32_t len = 0;
+	len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, "{\"ints\":[");
+	for (uint32_t i = 0; i < RyanJsonPackedArrayParseMinSize; i++)
+	{
+		len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, "%s%" PRIu32, 0 == i ? "" : ",", i);
+	}
+	len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, "],\"doubles\":[");
+	for (uint32_t i = 0; i < RyanJsonPackedArrayParseMinSize; i++)
+	{
+		len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, "%s%" PRIu32 ".5", 0 == i ? "" : ",", i);
+	}
+	len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, "],\"mixed\":[1,2.5],\"short\":[1,2,3],\"nested\":[[%s]]}",
+					  "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17");
+	TEST_ASSERT_TRUE(len < sizeof(text));
+
+	RyanJson_t json = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(json);
+	TEST_ASSERT_TRUE(RyanJsonIsPackedArray(RyanJsonGetObjectByKey(json, "ints")));
+	TEST_ASSERT_TRUE(RyanJsonIsPackedArray(RyanJsonGetObjectByKey(json, "doubles")));
+	TEST_ASSERT_FALSE(RyanJsonIsPackedArray(RyanJsonGetObjectByKey(json, "mixed")));
+	TEST_ASSERT_FALSE(RyanJsonIsPackedArray(RyanJsonGetObjectByKey(json, "short")));
+
+	RyanJson_t nested = RyanJsonGetObjectByKey(json, "nested");
+	TEST_ASSERT_FALSE(RyanJsonIsPackedArray(nested));
+	TEST_ASSERT_TRUE(RyanJsonIsPackedArray(RyanJsonGetObjectByIndex(nested, 0)));
+
+	char *out = RyanJsonPrint(json, 256, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(out);
+	TEST_ASSERT_EQUAL_STRING(text, out);
+	RyanJsonFree(out);
+
+	// 与完全展开后的树比较
+	RyanJson_t expanded = RyanJsonDuplicate(json);
+	TEST_ASSERT_NOT_NULL(expanded);
+	TEST_ASSERT_TRUE(RyanJsonExpandPackedArray(RyanJsonGetObjectByKey(expanded, "ints")));
+	TEST_ASSERT_TRUE(RyanJsonExpandPackedArray(RyanJsonGetObjectByKey(expanded, "doubles")));
+	TEST_ASSERT_TRUE(RyanJsonCompare(json, expanded));
+	RyanJsonDelete(expanded);
+
+	// 解析根数组
+	RyanJson_t root = RyanJsonParse("[1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16]");
+	TEST_ASSERT_NOT_NULL(root);
+	TEST_ASSERT_TRUE(RyanJsonIsPackedArray(root));
+	TEST_ASSERT_EQUAL_UINT32(16, RyanJsonGetSize(root));
+	RyanJsonDelete(root);
+
+	RyanJsonDelete(json);
+}
+
+#define packedTableTestRows (20U)
+
+typedef struct
+{
+	int32_t t[packedTableTestRows];
+	double v[packedTableTestRows];
+	float q[packedTableTestRows];
+} packedTableColumns_t;
+
+static void fillTableColumns(packedTableColumns_t *columns)
+{
+	for (uint32_t i = 0; i < packedTableTestRows; i++)
+	{
+		columns->t[i] = (int32_t)(1000U + i);
+		columns->v[i] = (double)i * 0.25 - 1.0;
+		columns->q[i] = (float)i * 0.5f;
+	}
+}
+
+static RyanJson_t createTable(const packedTableColumns_t *columns)
+{
+	const char *keys[] = {"t", "v", "q"};
+	RyanJsonPackedType_e types[] = {RyanJsonPackedTypeInt, RyanJsonPackedTypeDouble, RyanJsonPackedTypeFloat};
+	const void *data[] = {columns->t, columns->v, columns->q};
+	RyanJson_t table = RyanJsonCreatePackedTable(keys, types, data, 3, packedTableTestRows);
+	TEST_ASSERT_NOT_NULL(table);
+	return table;
+}
+
+/**
+ * @brief 构造等价的普通 Array；reversed 为 true 时每行 key 逆序（Object 比较与顺序无关）
+ */
+static RyanJson_t createPlainTable(const packedTableColumns_t *columns, RyanJsonBool_e reversed)
+{
+	RyanJson_t arr = RyanJsonCreateArray();
+	TEST_ASSERT_NOT_NULL(arr);
+
+	RyanJsonAppender_t rows;
+	TEST_ASSERT_TRUE(RyanJsonAppenderInit(&rows, arr));
+	for (uint32_t i = 0; i < packedTableTestRows; i++)
+	{
+		RyanJson_t row = RyanJsonCreateObject();
+		TEST_ASSERT_NOT_NULL(row);
+
+		RyanJson_t fields[3] = {RyanJsonCreateInt("t", columns->t[i]), RyanJsonCreateDouble("v", columns->v[i]),
+					RyanJsonCreateDouble("q", (double)columns->q[i])};
+		RyanJsonAppender_t appender;
+		TEST_ASSERT_TRUE(RyanJsonAppenderInit(&appender, row));
+		for (uint32_t j = 0; j < 3; j++)
+		{
+			TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&appender, fields[reversed ? 2U - j : j]));
+		}
+		TEST_ASSERT_TRUE(RyanJsonAppenderAdd(&rows, row));
+	}
+	return arr;
+}
+
+static void testPackedTableCreatePrintCompare(void)
+{
+	static packedTableColumns_t columns;
+	fillTableColumns(&columns);
+
+	RyanJson_t table = createTable(&columns);
+	RyanJson_t plain = createPlainTable(&columns, RyanJsonFalse);
+	TEST_ASSERT_TRUE(RyanJsonIsPackedArray(table));
+	TEST_ASSERT_TRUE(RyanJsonIsPackedTable(table));
+	TEST_ASSERT_FALSE(RyanJsonIsPackedTable(plain));
+	TEST_ASSERT_NULL(RyanJsonGetPackedArrayData(table, NULL, NULL));
+	TEST_ASSERT_EQUAL_UINT32(packedTableTestRows, RyanJsonGetSize(table));
+	assertSamePrint(table, plain);
+
+	// 列数据可直接读取
+	RyanJsonPackedType_e elemType;
+	uint32_t count = 0;
+	const double *v = (const double *)RyanJsonGetPackedTableColumn(table, "v", &elemType, &count);
+	TEST_ASSERT_NOT_NULL(v);
+	TEST_ASSERT_EQUAL_INT(RyanJsonPackedTypeDouble, elemType);
+	TEST_ASSERT_EQUAL_UINT32(packedTableTestRows, count);
+	TEST_ASSERT_EQUAL_DOUBLE_ARRAY(columns.v, v, packedTableTestRows);
+	TEST_ASSERT_NULL(RyanJsonGetPackedTableColumn(table, "missing", NULL, NULL));
+	TEST_ASSERT_NULL(RyanJsonGetPackedTableColumn(plain, "v", NULL, NULL));
+
+	// 与普通 Array（含行内 key 逆序）比较
+	RyanJson_t reversed = createPlainTable(&columns, RyanJsonTrue);
+	TEST_ASSERT_TRUE(RyanJsonCompare(table, plain));
+	TEST_ASSERT_TRUE(RyanJsonCompare(reversed, table));
+	TEST_ASSERT_TRUE(RyanJsonCompareOnlyKey(table, reversed));
+	RyanJsonDelete(reversed);
+
+	// 与列顺序不同的列存表比较
+	const char *otherKeys[] = {"q", "t", "v"};
+	RyanJsonPackedType_e otherTypes[] = {RyanJsonPackedTypeFloat, RyanJsonPackedTypeInt, RyanJsonPackedTypeDouble};
+	const void *otherData[] = {columns.q, columns.t, columns.v};
+	RyanJson_t other = RyanJsonCreatePackedTable(otherKeys, otherTypes, otherData, 3, packedTableTestRows);
+	TEST_ASSERT_TRUE(RyanJsonCompare(table, other));
+	RyanJsonDelete(other);
+
+	// 值不同 / key 不同
+	columns.t[7] = -7;
+	other = createTable(&columns);
+	TEST_ASSERT_FALSE(RyanJsonCompare(table, other));
+	TEST_ASSERT_TRUE(RyanJsonCompareOnlyKey(table, other));
+	RyanJsonDelete(other);
+	otherKeys[0] = "x";
+	other = RyanJsonCreatePackedTable(otherKeys, otherTypes, otherData, 3, packedTableTestRows);
+	TEST_ASSERT_FALSE(RyanJsonCompareOnlyKey(table, other));
+	RyanJsonDelete(other);
+
+	// 复制保持列存
+	RyanJson_t dup = RyanJsonDuplicate(table);
+	TEST_ASSERT_TRUE(RyanJsonIsPackedTable(dup));
+	TEST_ASSERT_TRUE(RyanJsonCompare(dup, plain));
+	assertSamePrint(dup, plain);
+	RyanJsonDelete(dup);
+
+	// 非法参数
+	const char *dupKeys[] = {"t", "t"};
+	RyanJsonPackedType_e dupTypes[] = {RyanJsonPackedTypeInt, RyanJsonPackedTypeInt};
+	const void *dupData[] = {columns.t, columns.t};
+	TEST_ASSERT_NULL(RyanJsonCreatePackedTable(dupKeys, dupTypes, dupData, 2, 4));
+	RyanJsonPackedType_e badTypes[] = {RyanJsonPackedTypeInt, (RyanJsonPackedType_e)7};
+	dupKeys[1] = "u";
+	TEST_ASSERT_NULL(RyanJsonCreatePackedTable(dupKeys, badTypes, dupData, 2, 4));
+	TEST_ASSERT_NULL(RyanJsonCreatePackedTable(otherKeys, otherTypes, otherData, 0, 4));
+	TEST_ASSERT_NULL(RyanJsonCreatePackedTable(NULL, otherTypes, otherData, 3, 4));
+
+	RyanJsonDelete(table);
+	RyanJsonDelete(plain);
+}
+
+static void testPackedTableExpand(void)
+{
+	static packedTableColumns_t columns;
+	fillTableColumns(&columns);
+
+	// 按索引访问时展开为同形 Object
+	RyanJson_t table = createTable(&columns);
+	RyanJson_t row = RyanJsonGetObjectByIndex(table, 5);
+	TEST_ASSERT_NOT_NULL(row);
+	TEST_ASSERT_FALSE(RyanJsonIsPackedArray(table));
+	TEST_ASSERT_TRUE(RyanJsonIsObject(row));
+	TEST_ASSERT_EQUAL_UINT32(3, RyanJsonGetSize(row));
+	TEST_ASSERT_EQUAL_INT32(columns.t[5], RyanJsonGetIntValue(RyanJsonGetObjectByKey(row, "t")));
+	TEST_ASSERT_EQUAL_DOUBLE(columns.v[5], RyanJsonGetDoubleValue(RyanJsonGetObjectByKey(row, "v")));
+	TEST_ASSERT_EQUAL_DOUBLE((double)columns.q[5], RyanJsonGetDoubleValue(RyanJsonGetObjectByKey(row, "q")));
+
+	RyanJson_t plain = createPlainTable(&columns, RyanJsonFalse);
+	TEST_ASSERT_TRUE(RyanJsonCompare(table, plain));
+	assertSamePrint(table, plain);
+	RyanJsonDelete(plain);
+	RyanJsonDelete(table);
+
+	// 展开中途（行内）内存不足：回滚并保持列存
+	table = createTable(&columns);
+	UNITY_TEST_OOM_BEGIN(10);
+	RyanJsonBool_e expanded = RyanJsonExpandPackedArray(table);
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_FALSE(expanded);
+	TEST_ASSERT_TRUE(RyanJsonIsPackedTable(table));
+
+	uint32_t rows = 0;
+	RyanJson_t item = NULL;
+	RyanJsonArrayForEach(table, item)
+	{
+		TEST_ASSERT_EQUAL_INT32(columns.t[rows], RyanJsonGetIntValue(RyanJsonGetObjectByKey(item, "t")));
+		rows++;
+	}
+	TEST_ASSERT_EQUAL_UINT32(packedTableTestRows, rows);
+	RyanJsonDelete(table);
+}
+
+static void testPackedTableParse(void)
+{
+	char text[1024];
+	uint32_t len = 0;
+	len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, "{\"rows\":[");
+	for (uint32_t i = 0; i < RyanJsonPackedArrayParseMinSize; i++)
+	{
+		len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, "%s{\"t\":%" PRIu32 ",\"v\":%" PRIu32 ".5,\"a\\\"b\":-1}",
+						  0 == i ? "" : ",", i, i);
+	}
+	len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, "]}");
+	TEST_ASSERT_TRUE(len < sizeof(text));
+
+	RyanJson_t json = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(json);
+	RyanJson_t rows = RyanJsonGetObjectByKey(json, "rows");
+	TEST_ASSERT_TRUE(RyanJsonIsPackedTable(rows));
+	TEST_ASSERT_NOT_NULL(RyanJsonGetPackedTableColumn(rows, "a\"b", NULL, NULL));
+
+	char *out = RyanJsonPrint(json, 256, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(out);
+	TEST_ASSERT_EQUAL_STRING(text, out);
+	RyanJsonFree(out);
+
+	RyanJson_t expanded = RyanJsonDuplicate(json);
+	TEST_ASSERT_TRUE(RyanJsonExpandPackedArray(RyanJsonGetObjectByKey(expanded, "rows")));
+	TEST_ASSERT_TRUE(RyanJsonCompare(json, expanded));
+	RyanJsonDelete(expanded);
+	RyanJsonDelete(json);
+
+	// 形状不一致（key 顺序、成员数、Int/Double、非 Number 值）时保持普通 Array
+	static const char *const shapeBreakers[] = {
+		"{\"v\":0,\"t\":0}",
+		"{\"t\":0}",
+		"{\"t\":0.5,\"v\":0}",
+		"{\"t\":\"s\",\"v\":0}",
+		"{\"t\":0,\"v\":{}}",
+	};
+	for (uint32_t k = 0; k < sizeof(shapeBreakers) / sizeof(shapeBreakers[0]); k++)
+	{
+		len = 0;
+		len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, "[");
+		for (uint32_t i = 0; i < RyanJsonPackedArrayParseMinSize; i++)
+		{
+			const char *rowText = (RyanJsonPackedArrayParseMinSize - 1U == i) ? shapeBreakers[k] : "{\"t\":1,\"v\":2}";
+			len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, "%s%s", 0 == i ? "" : ",", rowText);
+		}
+		len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, "]");
+		TEST_ASSERT_TRUE(len < sizeof(text));
+
+		json = RyanJsonParse(text);
+		TEST_ASSERT_NOT_NULL(json);
+		TEST_ASSERT_FALSE(RyanJsonIsPackedArray(json));
+		out = RyanJsonPrint(json, 256, RyanJsonFalse, NULL);
+		TEST_ASSERT_NOT_NULL(out);
+		TEST_ASSERT_EQUAL_STRING(text, out);
+		RyanJsonFree(out);
+		RyanJsonDelete(json);
+	}
+}
+
+#endif
+
+void testPackedArrayRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+#if true == RyanJsonPackedArray
+	RUN_TEST(testPackedArrayCreateAndPrint);
+	RUN_TEST(testPackedArrayNestedPrintCompareDuplicate);
+	RUN_TEST(testPackedArrayExpandOnAccess);
+	RUN_TEST(testPackedArrayExpandOom);
+	RUN_TEST(testPackedArrayParse);
+	RUN_TEST(testPackedTableCreatePrintCompare);
+	RUN_TEST(testPackedTableExpand);
+	RUN_TEST(testPackedTableParse);
+#endif
+}
@@ -0,0 +1,386 @@
+#include "testBase.h"
+
+static void testQuerySyntax(void)
+{
+	// 缺少 '$'、空成员名、未闭合的括号/引号、非法转义与下标、负步长、过滤缺少 '@' 或字面量非法
+	static const char *const invalid[] = {
+		"", "a", "$$", "$.", "$..", "$.a.", "$.a b", "$.*a", "$[", "$[]", "$[*", "$['a'", "$['a\\x']", "$[1", "$[a]",
+		"$[-]", "$[1:2:-1]", "$[2147483648]", "$[?]", "$[?a]", "$[?@.]", "$[?@.a ==]", "$[?@.a == x]", "$[?(@.a == 1]",
+		"$[?@.a == 01]", "$[?@.a == 1.]", "$[?@.a == tru]", "$[?@.a = 1]",
+	};
+	for (uint32_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+	{
+		TEST_ASSERT_NULL_MESSAGE(RyanJsonQueryCompile(invalid[i]), invalid[i]);
+	}
+	TEST_ASSERT_NULL(RyanJsonQueryCompile(NULL));
+
+	// 段数上限
+	char expr[4 + RyanJsonQueryMaxSteps * 2 + 2];
+	uint32_t len = 0;
+	expr[len++] = '$';
+	for (uint32_t i = 0; i < RyanJsonQueryMaxSteps; i++)
+	{
+		expr[len++] = '.';
+		expr[len++] = 'a';
+	}
+	expr[len] = '\0';
+	RyanJsonQuery_t query = RyanJsonQueryCompile(expr);
+	TEST_ASSERT_NOT_NULL(query);
+	RyanJsonQueryDelete(query);
+	expr[len++] = '.';
+	expr[len++] = 'a';
+	expr[len] = '\0';
+	TEST_ASSERT_NULL(RyanJsonQueryCompile(expr));
+
+	// 参数非法
+	RyanJsonQueryIter_t iter;
+	TEST_ASSERT_FALSE(RyanJsonQueryIterInit(NULL, NULL, NULL));
+	TEST_ASSERT_FALSE(RyanJsonQueryIterInit(&iter, NULL, NULL));
+	TEST_ASSERT_NULL(RyanJsonQueryIterNext(&iter));
+	TEST_ASSERT_NULL(RyanJsonQueryIterNext(NULL));
+	TEST_ASSERT_NULL(RyanJsonQueryFirst(NULL, NULL));
+	TEST_ASSERT_EQUAL_UINT32(0, RyanJsonQueryEach(NULL, NULL, NULL, NULL));
+	RyanJsonQueryDelete(NULL);
+}
+
+#if RyanJsonQueryMaxSteps >= 4
+// 以下用例的查询最多 4 段
+
+// Goessner 示例文档
+static const char bookstore[] = "{\"store\":{\"book\":["
+				"{\"category\":\"reference\",\"author\":\"Nigel Rees\",\"title\":\"Sayings of the Century\","
+				"\"price\":8.95},"
+				"{\"category\":\"fiction\",\"author\":\"Evelyn Waugh\",\"title\":\"Sword of Honour\",\"price\":12.99},"
+				"{\"category\":\"fiction\",\"author\":\"Herman Melville\",\"title\":\"Moby Dick\","
+				"\"isbn\":\"0-553-21311-3\",\"price\":8.99},"
+				"{\"category\":\"fiction\",\"author\":\"J. R. R. Tolkien\",\"title\":\"The Lord of the Rings\","
+				"\"isbn\":\"0-395-19395-8\",\"price\":22.99}],"
+				"\"bicycle\":{\"color\":\"red\",\"price\":19.95}},\"limit\":10}";
+
+typedef struct
+{
+	char buf[256];
+	uint32_t len;
+} queryOutput_t;
+
+/**
+ * @brief 回调：把命中节点按 "a,b,c" 形式追加到输出（String 输出内容，数值按 %g，其余输出类型名）
+ */
+static RyanJsonBool_e queryAppend(RyanJson_t item, void *userData)
+{
+	queryOutput_t *out = (queryOutput_t *)userData;
+	char value[64];
+	if (RyanJsonIsString(item)) { snprintf(value, sizeof(value), "%s", RyanJsonGetStringValue(item)); }
+	else if (RyanJsonIsInt(item)) { snprintf(value, sizeof(value), "%" PRId32, RyanJsonGetIntValue(item)); }
+	else if (RyanJsonIsDouble(item)) { snprintf(value, sizeof(value), "%g", RyanJsonGetDoubleValue(item)); }
+	else if (RyanJsonIsArray(item)) { snprintf(value, sizeof(value), "array"); }
+	else if (RyanJsonIsObject(item)) { snprintf(value, sizeof(value), "object"); }
+	else if (RyanJsonIsBool(item)) { snprintf(value, sizeof(value), "%s", RyanJsonGetBoolValue(item) ? "true" : "false"); }
+	else
+	{
+		snprintf(value, sizeof(value), "null");
+	}
+
+	int written = snprintf(out->buf + out->len, sizeof(out->buf) - out->len, "%s%s", (0 == out->len) ? "" : ",", value);
+	TEST_ASSERT_TRUE(written > 0 && (uint32_t)written < sizeof(out->buf) - out->len);
+	out->len += (uint32_t)written;
+	return RyanJsonTrue;
+}
+
+static void queryAssert(RyanJson_t root, const char *expr, const char *expect)
+{
+	RyanJsonQuery_t query = RyanJsonQueryCompile(expr);
+	TEST_ASSERT_NOT_NULL_MESSAGE(query, expr);
+
+	queryOutput_t out;
+	memset(&out, 0, sizeof(out));
+	uint32_t count = RyanJsonQueryEach(root, query, queryAppend, &out);
+	TEST_ASSERT_EQUAL_STRING_MESSAGE(expect, out.buf, expr);
+
+	// 迭代器与回调结果一致
+	RyanJsonQueryIter_t iter;
+	RyanJson_t item;
+	uint32_t iterCount = 0;
+	RyanJsonQueryForEach(iter, root, query, item)
+	{
+		iterCount++;
+	}
+	TEST_ASSERT_EQUAL_UINT32_MESSAGE(count, iterCount, expr);
+	TEST_ASSERT_NULL(RyanJsonQueryIterNext(&iter));
+
+	RyanJsonQueryDelete(query);
+}
+
+static uint32_t queryCount(RyanJson_t root, const char *expr)
+{
+	RyanJsonQuery_t query = RyanJsonQueryCompile(expr);
+	TEST_ASSERT_NOT_NULL_MESSAGE(query, expr);
+	RyanJsonQueryIter_t iter;
+	RyanJson_t item;
+	uint32_t count = 0;
+	RyanJsonQueryForEach(iter, root, query, item)
+	{
+		count++;
+	}
+	RyanJsonQueryDelete(query);
+	return count;
+}
+
+static void testQueryChild(void)
+{
+	RyanJson_t root = RyanJsonParse(bookstore);
+	TEST_ASSERT_NOT_NULL(root);
+
+	queryAssert(root, "$", "object");
+	queryAssert(root, "$.limit", "10");
+	queryAssert(root, "$['store']['bicycle'].color", "red");
+	queryAssert(root, "$[\"store\"].bicycle[\"color\"]", "red");
+	queryAssert(root, "$.store.*", "array,object");
+	queryAssert(root, "$.store.bicycle[*]", "red,19.95");
+	queryAssert(root, "$.store.book[*].author", "Nigel Rees,Evelyn Waugh,Herman Melville,J. R. R. Tolkien");
+	queryAssert(root, "$.store.book[2].title", "Moby Dick");
+	queryAssert(root, "$.store.book[-1].title", "The Lord of the Rings");
+	queryAssert(root, " $ .store .book [ 0 ] .price ", "8.95");
+
+	// 未命中：不存在的 key、越界下标、对 Object 用下标、对标量取成员
+	queryAssert(root, "$.missing", "");
+	queryAssert(root, "$.store.book[4]", "");
+	queryAssert(root, "$.store.book[-5]", "");
+	queryAssert(root, "$.store[0]", "");
+	queryAssert(root, "$.limit.x", "");
+	queryAssert(root, "$.limit[*]", "");
+
+	RyanJsonDelete(root);
+}
+
+static void testQuerySlice(void)
+{
+	RyanJson_t root = RyanJsonParse("{\"a\":[0,1,2,3,4,5,6],\"o\":{\"x\":1}}");
+	TEST_ASSERT_NOT_NULL(root);
+
+	queryAssert(root, "$.a[1:3]", "1,2");
+	queryAssert(root, "$.a[:2]", "0,1");
+	queryAssert(root, "$.a[5:]", "5,6");
+	queryAssert(root, "$.a[-2:]", "5,6");
+	queryAssert(root, "$.a[:-5]", "0,1");
+	queryAssert(root, "$.a[::3]", "0,3,6");
+	queryAssert(root, "$.a[1:6:2]", "1,3,5");
+	queryAssert(root, "$.a[1:7:4]", "1,5");
+	queryAssert(root, "$.a[-100:100:100]", "0");
+	queryAssert(root, "$.a[:]", "0,1,2,3,4,5,6");
+	queryAssert(root, "$.a[3:3]", "");
+	queryAssert(root, "$.a[4:2]", "");
+	queryAssert(root, "$.a[7:]", "");
+	queryAssert(root, "$.a[0:5:0]", "");
+	queryAssert(root, "$.o[0:1]", "");
+	RyanJsonDelete(root);
+
+	// 足够长的同类数值数组在 RyanJsonPackedArray 下为紧凑存储，选择器按需展开，结果与普通数组一致
+	root = RyanJsonParse("{\"big\":[0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19]}");
+	TEST_ASSERT_NOT_NULL(root);
+	queryAssert(root, "$.big[17:]", "17,18,19");
+	queryAssert(root, "$.big[-1]", "19");
+	queryAssert(root, "$..[?@ > 17]", "18,19");
+	TEST_ASSERT_EQUAL_UINT32(21, queryCount(root, "$..*"));
+	RyanJsonDelete(root);
+}
+
+static void testQueryDescendant(void)
+{
+	RyanJson_t root = RyanJsonParse(bookstore);
+	TEST_ASSERT_NOT_NULL(root);
+
+	queryAssert(root, "$..author", "Nigel Rees,Evelyn Waugh,Herman Melville,J. R. R. Tolkien");
+	queryAssert(root, "$.store..price", "8.95,12.99,8.99,22.99,19.95");
+	queryAssert(root, "$..book[2].title", "Moby Dick");
+	queryAssert(root, "$..book[:2].category", "reference,fiction");
+	queryAssert(root, "$..['color']", "red");
+	queryAssert(root, "$..[0].author", "Nigel Rees");
+	TEST_ASSERT_EQUAL_UINT32(28, queryCount(root, "$..*"));
+	TEST_ASSERT_EQUAL_UINT32(22, queryCount(root, "$.store.book..*"));
+
+	// 递归下降按 RFC 9535 对每个输入分别求值，嵌套的 .. 会产出重复节点
+	RyanJson_t nested = RyanJsonParse("{\"a\":{\"a\":{\"a\":1}}}");
+	TEST_ASSERT_NOT_NULL(nested);
+	queryAssert(nested, "$..a..a", "object,1,1");
+	RyanJsonDelete(nested);
+
+	RyanJsonDelete(root);
+}
+
+static void testQueryFilter(void)
+{
+	RyanJson_t root = RyanJsonParse(bookstore);
+	TEST_ASSERT_NOT_NULL(root);
+
+	queryAssert(root, "$..book[?(@.isbn)].title", "Moby Dick,The Lord of the Rings");
+	queryAssert(root, "$..book[?(@.price < 10)].title", "Sayings of the Century,Moby Dick");
+	queryAssert(root, "$..book[?@.price<=8.99].price", "8.95,8.99");
+	queryAssert(root, "$..book[?@.price > 20].author", "J. R. R. Tolkien");
+	queryAssert(root, "$..book[?@.price >= 12.99].price", "12.99,22.99");
+	queryAssert(root, "$.store.book[?@.category == 'reference'].author", "Nigel Rees");
+	queryAssert(root, "$.store.book[?@.category != \"fiction\"].author", "Nigel Rees");
+	queryAssert(root, "$.store.book[?@.author > 'I'].author", "Nigel Rees,J. R. R. Tolkien");
+	queryAssert(root, "$.store[?@.color].price", "19.95");
+
+	// 缺失字段与类型不同时只有 != 成立
+	queryAssert(root, "$.store.book[?@.isbn != 'x'].title", "Sayings of the Century,Sword of Honour,Moby Dick,The Lord of the Rings");
+	queryAssert(root, "$.store.book[?@.price == '8.95'].title", "");
+	queryAssert(root, "$.store.book[?@.price.x == 1].title", "");
+	RyanJsonDelete(root);
+
+	RyanJson_t devices = RyanJsonParse("{\"fleet\":[{\"id\":1,\"on\":true,\"cfg\":{\"mode\":\"a\",\"lvl\":3}},"
+					   "{\"id\":2,\"on\":false,\"cfg\":{\"mode\":\"b\",\"lvl\":10.0}},"
+					   "{\"id\":3,\"on\":null,\"cfg\":{\"m\\\"x\":1}},{\"id\":4}],\"nums\":[1,5,2,8]}");
+	TEST_ASSERT_NOT_NULL(devices);
+	queryAssert(devices, "$.fleet[?@.on == true].id", "1");
+	queryAssert(devices, "$.fleet[?@.on == false].id", "2");
+	queryAssert(devices, "$.fleet[?@.on == null].id", "3");
+	queryAssert(devices, "$.fleet[?@.on <= true].id", "1");
+	queryAssert(devices, "$.fleet[?@.on < true].id", "");
+	queryAssert(devices, "$.fleet[?@.cfg.lvl == 10].id", "2");
+	queryAssert(devices, "$.fleet[?@.cfg.lvl > 2.5].cfg.mode", "a,b");
+	queryAssert(devices, "$.fleet[?@.cfg.lvl < 1e1].id", "1");
+	queryAssert(devices, "$.fleet[?@['cfg'][\"m\\\"x\"]].id", "3");
+	queryAssert(devices, "$.nums[?@ > 3]", "5,8");
+	queryAssert(devices, "$.nums[?(@ == -0.0)]", "");
+	queryAssert(devices, "$..[?@.mode == 'b'].lvl", "10");
+	RyanJsonDelete(devices);
+}
+
+static RyanJsonBool_e queryStopAtTwo(RyanJson_t item, void *userData)
+{
+	(void)item;
+	uint32_t *seen = (uint32_t *)userData;
+	(*seen)++;
+	return RyanJsonMakeBool(*seen < 2);
+}
+
+static void testQueryIterate(void)
+{
+	RyanJson_t root = RyanJsonParse(bookstore);
+	TEST_ASSERT_NOT_NULL(root);
+	RyanJsonQuery_t query = RyanJsonQueryCompile("$..price");
+	TEST_ASSERT_NOT_NULL(query);
+
+	// 回调返回 false 时停止
+	uint32_t seen = 0;
+	TEST_ASSERT_EQUAL_UINT32(2, RyanJsonQueryEach(root, query, queryStopAtTwo, &seen));
+	TEST_ASSERT_EQUAL_UINT32(2, seen);
+
+	TEST_ASSERT_EQUAL_DOUBLE(8.95, RyanJsonGetDoubleValue(RyanJsonQueryFirst(root, query)));
+
+	// 同一查询可被多个迭代器交错使用，求值不申请内存
+	RyanJsonQueryIter_t left;
+	RyanJsonQueryIter_t right;
+	TEST_ASSERT_TRUE(RyanJsonQueryIterInit(&left, root, query));
+	TEST_ASSERT_TRUE(RyanJsonQueryIterInit(&right, root, query));
+	uint32_t count = 0;
+	UNITY_TEST_OOM_BEGIN(0);
+	RyanJson_t ahead = RyanJsonQueryIterNext(&left);
+	RyanJson_t lastPrice = NULL;
+	while (NULL != (lastPrice = RyanJsonQueryIterNext(&right)))
+	{
+		count++;
+		TEST_ASSERT_EQUAL_PTR(ahead, lastPrice);
+		ahead = RyanJsonQueryIterNext(&left);
+	}
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_NULL(ahead);
+	TEST_ASSERT_EQUAL_UINT32(5, count);
+
+	// 查询结果可直接修改值
+	RyanJsonQuery_t cheap = RyanJsonQueryCompile("$..book[?@.price < 10].price");
+	TEST_ASSERT_NOT_NULL(cheap);
+	RyanJsonQueryIter_t iter;
+	RyanJson_t item;
+	RyanJsonQueryForEach(iter, root, cheap, item)
+	{
+		TEST_ASSERT_TRUE(RyanJsonChangeDoubleValue(item, 9.5));
+	}
+	RyanJsonQueryDelete(cheap);
+	queryAssert(root, "$.store.book[*].price", "9.5,12.99,9.5,22.99");
+
+	RyanJsonQueryDelete(query);
+	RyanJsonDelete(root);
+}
+
+static void testQueryDeep(void)
+{
+	// 深层嵌套：求值沿线索链表回溯，不随深度递归
+	enum
+	{
+		depth = 200
+	};
+	char text[depth * 6 + 16];
+	uint32_t len = 0;
+	for (uint32_t i = 0; i < depth; i++)
+	{
+		memcpy(text + len, "{\"n\":", 5);
+		len += 5;
+	}
+	memcpy(text + len, "{\"x\":7}", 7);
+	len += 7;
+	for (uint32_t i = 0; i < depth; i++)
+	{
+		text[len++] = '}';
+	}
+	text[len] = '\0';
+
+	RyanJson_t root = RyanJsonParse(text);
+	if (NULL == root) { TEST_IGNORE_MESSAGE("解析器嵌套深度不足"); }
+	queryAssert(root, "$..x", "7");
+	TEST_ASSERT_EQUAL_UINT32(depth + 1, queryCount(root, "$..*"));
+	RyanJsonDelete(root);
+}
+
+static void testQueryOom(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	// 编译只申请一次内存
+	static const char expr[] = "$.store.book[?(@.category == 'fiction')].title";
+	UNITY_TEST_OOM_BEGIN(0);
+	RyanJsonQuery_t query = RyanJsonQueryCompile(expr);
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_NULL(query);
+
+	UNITY_TEST_OOM_BEGIN(1);
+	query = RyanJsonQueryCompile(expr);
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_NOT_NULL(query);
+
+	RyanJson_t root = RyanJsonParse(bookstore);
+	TEST_ASSERT_NOT_NULL(root);
+	uint32_t count = 0;
+	RyanJsonQueryIter_t iter;
+	RyanJson_t item;
+	UNITY_TEST_OOM_BEGIN(0);
+	RyanJsonQueryForEach(iter, root, query, item)
+	{
+		count++;
+	}
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_EQUAL_UINT32(3, count);
+
+	RyanJsonDelete(root);
+	RyanJsonQueryDelete(query);
+	unityTestLeakScopeEnd(scope, "查询编译失败路径不应泄漏");
+}
+
+#endif
+
+void testQueryRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+	RUN_TEST(testQuerySyntax);
+#if RyanJsonQueryMaxSteps >= 4
+	RUN_TEST(testQueryChild);
+	RUN_TEST(testQuerySlice);
+	RUN_TEST(testQueryDescendant);
+	RUN_TEST(testQueryFilter);
+	RUN_TEST(testQueryIterate);
+	RUN_TEST(testQueryDeep);
+	RUN_TEST(testQueryOom);
+#endif
+}
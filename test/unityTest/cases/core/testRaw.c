@@ -0,0 +1,427 @@
+#include "testBase.h"
+
+#define rawIoVecScratchSize (256U)
+#define rawIoVecCap         (16U)
+
+/**
+ * @brief 断言 Raw 节点文本与期望一致
+ */
+static void rawAssertValue(RyanJson_t pJson, const char *expect)
+{
+	TEST_ASSERT_TRUE(RyanJsonIsRaw(pJson));
+	TEST_ASSERT_EQUAL_INT(RyanJsonTypeRaw, RyanJsonGetType(pJson));
+	TEST_ASSERT_FALSE(RyanJsonIsBlob(pJson));
+	TEST_ASSERT_FALSE(RyanJsonIsString(pJson));
+	uint32_t len = UINT32_MAX;
+	const char *text = RyanJsonGetRawValue(pJson, &len);
+	TEST_ASSERT_NOT_NULL(text);
+	TEST_ASSERT_EQUAL_UINT32((uint32_t)strlen(expect), len);
+	TEST_ASSERT_EQUAL_STRING(expect, text);
+}
+
+static void rawAssertPrint(RyanJson_t pJson, RyanJsonBool_e format, const char *expect)
+{
+	char *actual = RyanJsonPrint(pJson, 64, format, NULL);
+	TEST_ASSERT_NOT_NULL(actual);
+	TEST_ASSERT_EQUAL_STRING(expect, actual);
+	RyanJsonFree(actual);
+}
+
+static void testRawCreateAndPrint(void)
+{
+	// 各类合法值均原样保存，首尾空白不保存
+	static const char *texts[][2] = {
+		{"null", "null"},
+		{" true ", "true"},
+		{"-1.5e3", "-1.5e3"},
+		{"\"a\\u00e9\\n\"", "\"a\\u00e9\\n\""},
+		{"\r\n[1, 2 ,{\"k\" : [ ]}]\t", "[1, 2 ,{\"k\" : [ ]}]"},
+		{"{ }", "{ }"},
+		{"{\"emoji\":\"\\ud83d\\ude00\",\"deep\":[[[{}]]]}", "{\"emoji\":\"\\ud83d\\ude00\",\"deep\":[[[{}]]]}"},
+	};
+	for (uint32_t i = 0; i < sizeof(texts) / sizeof(texts[0]); i++)
+	{
+		RyanJson_t raw = RyanJsonCreateRaw(NULL, texts[i][0], (uint32_t)strlen(texts[i][0]));
+		TEST_ASSERT_NOT_NULL_MESSAGE(raw, texts[i][0]);
+		rawAssertValue(raw, texts[i][1]);
+		rawAssertPrint(raw, RyanJsonFalse, texts[i][1]);
+		RyanJsonDelete(raw);
+	}
+
+	// 只使用给定长度，text 无需 '\0' 结尾
+	RyanJson_t part = RyanJsonCreateRaw(NULL, "[1,2]trailing", 5);
+	TEST_ASSERT_NOT_NULL(part);
+	rawAssertValue(part, "[1,2]");
+	RyanJsonDelete(part);
+
+	// 嵌入文档：紧凑与格式化模式下 Raw 文本都不重新排版
+	static const char payload[] = "{\"temp\": 21.5,\"list\":[1,2]}";
+	RyanJson_t root = RyanJsonParse("{\"id\":7,\"list\":[]}");
+	TEST_ASSERT_NOT_NULL(root);
+	TEST_ASSERT_TRUE(RyanJsonInsert(root, 1, RyanJsonCreateRaw("payload", payload, (uint32_t)strlen(payload))));
+	TEST_ASSERT_TRUE(RyanJsonAddRawToArray(RyanJsonGetObjectByKey(root, "list"), "1e2", 3));
+	rawAssertValue(RyanJsonGetObjectByKey(root, "payload"), payload);
+	TEST_ASSERT_TRUE(RyanJsonIsKey(RyanJsonGetObjectByKey(root, "payload")));
+	rawAssertPrint(root, RyanJsonFalse, "{\"id\":7,\"payload\":{\"temp\": 21.5,\"list\":[1,2]},\"list\":[1e2]}");
+
+	char *formatted = RyanJsonPrint(root, 64, RyanJsonTrue, NULL);
+	TEST_ASSERT_NOT_NULL(formatted);
+	TEST_ASSERT_NOT_NULL(strstr(formatted, payload));
+	RyanJsonFree(formatted);
+
+	// 输出可被重新解析，结构与展开后的文档一致
+	char *text = RyanJsonPrint(root, 64, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(text);
+	RyanJson_t reparsed = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(reparsed);
+	TEST_ASSERT_TRUE(RyanJsonIsObject(RyanJsonGetObjectByKey(reparsed, "payload")));
+	TEST_ASSERT_EQUAL_INT(2, RyanJsonGetIntValue(RyanJsonGetObjectByIndex(RyanJsonGetObjectToKey(reparsed, "payload", "list"), 1)));
+	RyanJsonDelete(reparsed);
+	RyanJsonFree(text);
+
+	// 按需访问内部结构：交给解析接口
+	uint32_t len = 0;
+	const char *rawText = RyanJsonGetRawValue(RyanJsonGetObjectByKey(root, "payload"), &len);
+	RyanJson_t lazy = RyanJsonParseOptions(rawText, len, RyanJsonTrue, NULL);
+	TEST_ASSERT_NOT_NULL(lazy);
+	TEST_ASSERT_EQUAL_DOUBLE(21.5, RyanJsonGetDoubleValue(RyanJsonGetObjectByKey(lazy, "temp")));
+	RyanJsonDelete(lazy);
+
+	// 非 Raw 节点取值返回 NULL 且长度为 0
+	len = 99;
+	TEST_ASSERT_NULL(RyanJsonGetRawValue(root, &len));
+	TEST_ASSERT_EQUAL_UINT32(0, len);
+	TEST_ASSERT_NULL(RyanJsonGetRawValue(RyanJsonGetObjectByKey(root, "id"), NULL));
+	TEST_ASSERT_FALSE(RyanJsonIsRaw(NULL));
+	RyanJsonDelete(root);
+}
+
+/**
+ * @brief 按 RyanJsonGetType 分派的典型业务代码
+ */
+static const char *rawTypeName(RyanJson_t pJson)
+{
+	switch (RyanJsonGetType(pJson))
+	{
+	case RyanJsonTypeBlob: return "blob";
+	case RyanJsonTypeRaw: return "raw";
+	case RyanJsonTypeString: return "string";
+	default: return "other";
+	}
+}
+
+static void testRawGetType(void)
+{
+	static const uint8_t bytes[] = {0x00, 0x7B, 0xFF};
+	RyanJson_t root = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(root);
+	TEST_ASSERT_TRUE(RyanJsonAddBlobToObject(root, "blob", bytes, sizeof(bytes)));
+	TEST_ASSERT_TRUE(RyanJsonAddRawToObject(root, "raw", "{\"a\":1}", 7));
+	TEST_ASSERT_TRUE(RyanJsonAddStringToObject(root, "str", "{\"a\":1}"));
+
+	// Raw 与 Blob 共用存储类型，但 RyanJsonGetType 对外区分，switch 不会把 Raw 当作 Blob
+	RyanJson_t blob = RyanJsonGetObjectByKey(root, "blob");
+	RyanJson_t raw = RyanJsonGetObjectByKey(root, "raw");
+	TEST_ASSERT_EQUAL_INT(RyanJsonTypeBlob, RyanJsonGetType(blob));
+	TEST_ASSERT_EQUAL_INT(RyanJsonTypeRaw, RyanJsonGetType(raw));
+	TEST_ASSERT_EQUAL_STRING("blob", rawTypeName(blob));
+	TEST_ASSERT_EQUAL_STRING("raw", rawTypeName(raw));
+	TEST_ASSERT_EQUAL_STRING("string", rawTypeName(RyanJsonGetObjectByKey(root, "str")));
+	TEST_ASSERT_TRUE(RyanJsonIsBlob(blob) && !RyanJsonIsRaw(blob));
+
+	// 类型不同的节点比较不相等，复制后类型不变
+	RyanJson_t copy = RyanJsonDuplicate(raw);
+	TEST_ASSERT_NOT_NULL(copy);
+	TEST_ASSERT_EQUAL_INT(RyanJsonTypeRaw, RyanJsonGetType(copy));
+	TEST_ASSERT_TRUE(RyanJsonCompare(raw, copy));
+	TEST_ASSERT_FALSE(RyanJsonCompare(raw, blob));
+	RyanJsonDelete(copy);
+	RyanJsonDelete(root);
+}
+
+static void testRawRejectInvalid(void)
+{
+	// 必须恰为一个合法 Json 值
+	static const char *texts[] = {
+		"",                  // 空文本
+		"   ",               // 只有空白
+		"[1,2",              // 未闭合
+		"[}",                // 括号不匹配
+		"{\"a\":1]",         // 括号不匹配
+		"{\"a\" 1}",         // 缺少冒号
+		"{1:2}",             // key 不是字符串
+		"[1,]",              // 尾随逗号
+		"{\"a\":1,}",        // 尾随逗号
+		"1 2",               // 多个值
+		"{} x",              // 尾随内容
+		"tru",               // 字面量不完整
+		"nul1",              // 字面量错误
+		"01",                // 前导零
+		"-",                 // 数字不完整
+		"\"abc",             // 字符串未结束
+		"\"a\\x\"",          // 非法转义
+		"\"\\u12g4\"",       // 非法十六进制
+		"\"\\ud83d\"",       // 孤立代理项
+		"\"\\ude00\"",       // 孤立低代理项
+		"\"tab\there\"",     // 未转义控制字符
+		"[\"ok\",\"\\q\"]", // 嵌套中的非法转义
+	};
+	for (uint32_t i = 0; i < sizeof(texts) / sizeof(texts[0]); i++)
+	{
+		TEST_ASSERT_NULL_MESSAGE(RyanJsonCreateRaw("k", texts[i], (uint32_t)strlen(texts[i])), texts[i]);
+	}
+	TEST_ASSERT_NULL(RyanJsonCreateRaw(NULL, NULL, 0));
+
+	// 文本中的 '\0' 不属于合法 Json
+	static const char withNul[] = {'[', '1', '\0', ']'};
+	TEST_ASSERT_NULL(RyanJsonCreateRaw(NULL, withNul, sizeof(withNul)));
+}
+
+static void testRawDeepNesting(void)
+{
+	// 超过栈上层级记录后改用堆记录，Array/Object 交替嵌套以覆盖类型记录
+	const uint32_t depth = 600U;
+	char *text = (char *)malloc(depth * 6U + 8U);
+	TEST_ASSERT_NOT_NULL(text);
+	uint32_t pos = 0;
+	for (uint32_t i = 0; i < depth; i++)
+	{
+		if (0U == (i & 1U)) { text[pos++] = '['; }
+		else
+		{
+			memcpy(text + pos, "{\"k\":", 5);
+			pos += 5U;
+		}
+	}
+	text[pos++] = '0';
+	for (uint32_t i = depth; i > 0U; i--) { text[pos++] = (0U == ((i - 1U) & 1U)) ? ']' : '}'; }
+
+	RyanJson_t raw = RyanJsonCreateRaw(NULL, text, pos);
+	TEST_ASSERT_NOT_NULL(raw);
+	uint32_t len = 0;
+	TEST_ASSERT_NOT_NULL(RyanJsonGetRawValue(raw, &len));
+	TEST_ASSERT_EQUAL_UINT32(pos, len);
+	RyanJsonDelete(raw);
+
+	// 深层处闭合符号类型错误同样拒绝
+	text[pos - 1U] = '}';
+	TEST_ASSERT_NULL(RyanJsonCreateRaw(NULL, text, pos));
+	text[pos - 1U] = ']';
+	text[pos - 300U] = (']' == text[pos - 300U]) ? '}' : ']';
+	TEST_ASSERT_NULL(RyanJsonCreateRaw(NULL, text, pos));
+	free(text);
+}
+
+static void testRawChangeAndCompare(void)
+{
+	static const char payload[] = "{\"b\":[1,2],\"a\":\"x\"}";
+	RyanJson_t root = RyanJsonParse("{\"n\":1,\"z\":true}");
+	TEST_ASSERT_NOT_NULL(root);
+	TEST_ASSERT_TRUE(RyanJsonAddRawToObject(root, "raw", payload, (uint32_t)strlen(payload)));
+	RyanJson_t raw = RyanJsonGetObjectByKey(root, "raw");
+
+	// 修改 key 后文本不变
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(raw, "rawKeyLongerThanInlineStorage"));
+	raw = RyanJsonGetObjectByKey(root, "rawKeyLongerThanInlineStorage");
+	rawAssertValue(raw, payload);
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(raw, "r"));
+	raw = RyanJsonGetObjectByKey(root, "r");
+	rawAssertValue(raw, payload);
+
+	// 复制后内容相等，哈希一致
+	RyanJson_t copy = RyanJsonDuplicate(root);
+	TEST_ASSERT_NOT_NULL(copy);
+	TEST_ASSERT_TRUE(RyanJsonCompare(root, copy));
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonHash(root), RyanJsonHash(copy));
+	rawAssertValue(RyanJsonGetObjectByKey(copy, "r"), payload);
+	TEST_ASSERT_TRUE(RyanJsonGetRawValue(raw, NULL) != RyanJsonGetRawValue(RyanJsonGetObjectByKey(copy, "r"), NULL));
+
+	// 比较按文本进行：等价但写法不同的文本不相等
+	static const char reordered[] = "{\"a\":\"x\",\"b\":[1,2]}";
+	RyanJson_t other = RyanJsonCreateRaw("r", reordered, (uint32_t)strlen(reordered));
+	TEST_ASSERT_NOT_NULL(other);
+	TEST_ASSERT_TRUE(RyanJsonReplaceByKey(copy, "r", other));
+	TEST_ASSERT_FALSE(RyanJsonCompare(root, copy));
+	TEST_ASSERT_TRUE(RyanJsonCompareOnlyKey(root, copy));
+
+	// Raw 与同文本的 String、Blob 以及展开后的结构都不相等
+	RyanJson_t str = RyanJsonCreateString(NULL, "\"x\"");
+	RyanJson_t rawStr = RyanJsonCreateRaw(NULL, "\"x\"", 3);
+	RyanJson_t blob = RyanJsonCreateBlob(NULL, "\"x\"", 3);
+	RyanJson_t rawNum = RyanJsonCreateRaw(NULL, "1", 1);
+	RyanJson_t num = RyanJsonCreateInt(NULL, 1);
+	TEST_ASSERT_NOT_NULL(str);
+	TEST_ASSERT_NOT_NULL(rawStr);
+	TEST_ASSERT_NOT_NULL(blob);
+	TEST_ASSERT_NOT_NULL(rawNum);
+	TEST_ASSERT_NOT_NULL(num);
+	TEST_ASSERT_FALSE(RyanJsonCompare(rawStr, str));
+	TEST_ASSERT_FALSE(RyanJsonCompare(rawStr, blob));
+	TEST_ASSERT_FALSE(RyanJsonCompare(blob, rawStr));
+	TEST_ASSERT_FALSE(RyanJsonCompare(rawNum, num));
+	TEST_ASSERT_TRUE(RyanJsonHash(rawStr) != RyanJsonHash(str));
+	TEST_ASSERT_TRUE(RyanJsonHash(rawNum) != RyanJsonHash(num));
+	RyanJsonDelete(num);
+	RyanJsonDelete(rawNum);
+	RyanJsonDelete(blob);
+	RyanJsonDelete(rawStr);
+	RyanJsonDelete(str);
+
+	RyanJsonDelete(copy);
+	RyanJsonDelete(root);
+}
+
+static void testRawIoVec(void)
+{
+	// 超过引用阈值的文本直接引用节点存储
+	char longText[RyanJsonPrintIoVecRefMinSize + 16U];
+	longText[0] = '[';
+	uint32_t pos = 1;
+	while (pos + 3U < sizeof(longText))
+	{
+		longText[pos++] = '1';
+		longText[pos++] = ',';
+	}
+	longText[pos++] = '1';
+	longText[pos++] = ']';
+
+	RyanJson_t root = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(root);
+	TEST_ASSERT_TRUE(RyanJsonAddRawToObject(root, "long", longText, pos));
+	TEST_ASSERT_TRUE(RyanJsonAddRawToObject(root, "short", "[2]", 3));
+
+	char scratch[rawIoVecScratchSize];
+	RyanJsonIoVec_t iov[rawIoVecCap];
+	uint32_t iovCount = 0;
+	TEST_ASSERT_TRUE(RyanJsonPrintIoVec(root, scratch, sizeof(scratch), RyanJsonFalse, iov, rawIoVecCap, &iovCount));
+
+	const char *stored = RyanJsonGetRawValue(RyanJsonGetObjectByKey(root, "long"), NULL);
+	uint32_t refCount = 0;
+	size_t totalLen = 0;
+	for (uint32_t i = 0; i < iovCount; i++)
+	{
+		if (iov[i].base == stored) { refCount++; }
+		totalLen += iov[i].len;
+	}
+	TEST_ASSERT_EQUAL_UINT32(1, refCount);
+
+	char *expected = RyanJsonPrint(root, 64, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(expected);
+	TEST_ASSERT_EQUAL_UINT32((uint32_t)strlen(expected), (uint32_t)totalLen);
+	size_t offset = 0;
+	for (uint32_t i = 0; i < iovCount; i++)
+	{
+		TEST_ASSERT_EQUAL_MEMORY(expected + offset, iov[i].base, iov[i].len);
+		offset += iov[i].len;
+	}
+	RyanJsonFree(expected);
+	RyanJsonDelete(root);
+}
+
+static void testRawUnsupportedFormats(void)
+{
+	RyanJson_t root = RyanJsonParse("{\"n\":1}");
+	TEST_ASSERT_NOT_NULL(root);
+	TEST_ASSERT_TRUE(RyanJsonAddRawToObject(root, "raw", "[1]", 3));
+
+	// 二进制格式与镜像无法表示未展开的文本
+	uint32_t len = 99;
+	for (uint32_t codec = RyanJsonCodecCbor; codec <= RyanJsonCodecMsgPack; codec++)
+	{
+		TEST_ASSERT_NULL(RyanJsonPrintCodec(root, (RyanJsonCodec_e)codec, 0, &len));
+	}
+	TEST_ASSERT_NULL(RyanJsonSaveBinary(root, &len));
+
+	// 删除 Raw 后恢复正常
+	TEST_ASSERT_TRUE(RyanJsonDeleteByKey(root, "raw"));
+	uint8_t *image = RyanJsonSaveBinary(root, &len);
+	TEST_ASSERT_NOT_NULL(image);
+	RyanJsonFree(image);
+	RyanJsonDelete(root);
+}
+
+static void testRawOom(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	// 超过栈上层级记录的文本在校验时需要堆内存
+	char deep[600];
+	memset(deep, '[', 300);
+	memset(deep + 300, ']', 300);
+	static const char payload[] = "{\"sensor\":\"a-long-sensor-name\",\"values\":[1,2,3]}";
+
+	RyanJson_t raw = NULL;
+	for (uint32_t budget = 0; NULL == raw; budget++)
+	{
+		TEST_ASSERT_TRUE_MESSAGE(budget < 8U, "创建在有限次分配内应成功");
+		UNITY_TEST_OOM_BEGIN(budget);
+		raw = RyanJsonCreateRaw("payloadKeyLongerThanInline", payload, (uint32_t)strlen(payload));
+		UNITY_TEST_OOM_END();
+	}
+	RyanJson_t deepRaw = NULL;
+	for (uint32_t budget = 0; NULL == deepRaw; budget++)
+	{
+		TEST_ASSERT_TRUE_MESSAGE(budget < 8U, "深层文本创建在有限次分配内应成功");
+		UNITY_TEST_OOM_BEGIN(budget);
+		deepRaw = RyanJsonCreateRaw(NULL, deep, sizeof(deep));
+		UNITY_TEST_OOM_END();
+	}
+
+	RyanJson_t root = RyanJsonCreateArray();
+	TEST_ASSERT_NOT_NULL(root);
+	TEST_ASSERT_TRUE(RyanJsonInsert(root, 0, deepRaw));
+	RyanJson_t obj = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(obj);
+	TEST_ASSERT_TRUE(RyanJsonInsert(obj, 0, raw));
+	TEST_ASSERT_TRUE(RyanJsonInsert(root, 1, obj));
+
+	RyanJson_t copy = NULL;
+	for (uint32_t budget = 0; NULL == copy; budget++)
+	{
+		TEST_ASSERT_TRUE_MESSAGE(budget < 16U, "复制在有限次分配内应成功");
+		UNITY_TEST_OOM_BEGIN(budget);
+		copy = RyanJsonDuplicate(root);
+		UNITY_TEST_OOM_END();
+	}
+	TEST_ASSERT_TRUE(RyanJsonCompare(root, copy));
+
+	char *text = NULL;
+	for (uint32_t budget = 0; NULL == text; budget++)
+	{
+		TEST_ASSERT_TRUE_MESSAGE(budget < 16U, "打印在有限次分配内应成功");
+		UNITY_TEST_OOM_BEGIN(budget);
+		text = RyanJsonPrint(copy, 4, RyanJsonFalse, NULL);
+		UNITY_TEST_OOM_END();
+	}
+	TEST_ASSERT_EQUAL_UINT32(sizeof(deep) + strlen(payload) + strlen("[,{\"payloadKeyLongerThanInline\":}]"), (uint32_t)strlen(text));
+	RyanJsonFree(text);
+
+	RyanJsonBool_e ok = RyanJsonFalse;
+	RyanJson_t copyRaw = RyanJsonGetObjectByKey(RyanJsonGetObjectByIndex(copy, 1), "payloadKeyLongerThanInline");
+	for (uint32_t budget = 0; RyanJsonFalse == ok; budget++)
+	{
+		TEST_ASSERT_TRUE_MESSAGE(budget < 8U, "修改 key 在有限次分配内应成功");
+		UNITY_TEST_OOM_BEGIN(budget);
+		ok = RyanJsonChangeKey(copyRaw, "p");
+		UNITY_TEST_OOM_END();
+		if (RyanJsonFalse == ok) { rawAssertValue(copyRaw, payload); }
+	}
+	rawAssertValue(RyanJsonGetObjectByKey(RyanJsonGetObjectByIndex(copy, 1), "p"), payload);
+
+	RyanJsonDelete(copy);
+	RyanJsonDelete(root);
+	unityTestLeakScopeEnd(scope, "Raw 失败路径不应泄漏");
+}
+
+void testRawRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+	RUN_TEST(testRawCreateAndPrint);
+	RUN_TEST(testRawGetType);
+	RUN_TEST(testRawRejectInvalid);
+	RUN_TEST(testRawDeepNesting);
+	RUN_TEST(testRawChangeAndCompare);
+	RUN_TEST(testRawIoVec);
+	RUN_TEST(testRawUnsupportedFormats);
+	RUN_TEST(testRawOom);
+}
@@ -0,0 +1,159 @@
+#include "testBase.h"
+
+#if true == RyanJsonSnapshotShare
+
+static void testSnapshotShareUntilChange(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	RyanJson_t live = RyanJsonParse("{\"net\":{\"ip\":\"10.0.0.1\",\"port\":80},\"tags\":[\"a\",\"b\"]}");
+	TEST_ASSERT_NOT_NULL(live);
+
+	// 未修改时多次快照共享同一份副本
+	RyanJson_t s1 = RyanJsonSnapshot(live);
+	RyanJson_t s2 = RyanJsonSnapshot(live);
+	TEST_ASSERT_NOT_NULL(s1);
+	TEST_ASSERT_TRUE(s1 == s2);
+	TEST_ASSERT_TRUE(s1 != live);
+	TEST_ASSERT_TRUE(RyanJsonCompare(live, s1));
+
+	// 对快照再取快照只增加引用
+	RyanJson_t s3 = RyanJsonSnapshot(s1);
+	TEST_ASSERT_TRUE(s1 == s3);
+
+	// 修改任意后代后解除共享，旧快照保持原内容
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectToKey(live, "net", "port"), 8080));
+	RyanJson_t s4 = RyanJsonSnapshot(live);
+	TEST_ASSERT_NOT_NULL(s4);
+	TEST_ASSERT_TRUE(s4 != s1);
+	TEST_ASSERT_EQUAL_INT(80, RyanJsonGetIntValue(RyanJsonGetObjectToKey(s1, "net", "port")));
+	TEST_ASSERT_EQUAL_INT(8080, RyanJsonGetIntValue(RyanJsonGetObjectToKey(s4, "net", "port")));
+
+	// 子容器快照只在该子树被修改时失效
+	RyanJson_t tags = RyanJsonGetObjectByKey(live, "tags");
+	RyanJson_t t1 = RyanJsonSnapshot(tags);
+	TEST_ASSERT_TRUE(RyanJsonChangeStringValue(RyanJsonGetObjectToKey(live, "net", "ip"), "10.0.0.2"));
+	TEST_ASSERT_TRUE(t1 == RyanJsonSnapshot(tags));
+	RyanJsonSnapshotRelease(t1);
+	TEST_ASSERT_TRUE(RyanJsonInsert(tags, UINT32_MAX, RyanJsonCreateString(NULL, "c")));
+	RyanJson_t t2 = RyanJsonSnapshot(tags);
+	TEST_ASSERT_TRUE(t1 != t2);
+	TEST_ASSERT_EQUAL_UINT32(2, RyanJsonGetSize(t1));
+	TEST_ASSERT_EQUAL_UINT32(3, RyanJsonGetSize(t2));
+
+	// 修改 key 同样解除共享（快照根保留取快照时的 key）
+	RyanJson_t net = RyanJsonGetObjectByKey(live, "net");
+	RyanJson_t n1 = RyanJsonSnapshot(net);
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(net, "network"));
+	RyanJson_t n2 = RyanJsonSnapshot(net);
+	TEST_ASSERT_TRUE(n1 != n2);
+	TEST_ASSERT_EQUAL_STRING("net", RyanJsonGetKey(n1));
+	TEST_ASSERT_EQUAL_STRING("network", RyanJsonGetKey(n2));
+
+	// 源树先删除，快照仍然可用
+	RyanJsonDelete(live);
+	TEST_ASSERT_EQUAL_STRING("10.0.0.1", RyanJsonGetStringValue(RyanJsonGetObjectToKey(s1, "net", "ip")));
+	TEST_ASSERT_EQUAL_STRING("c", RyanJsonGetStringValue(RyanJsonGetObjectByIndex(t2, 2)));
+
+	RyanJsonSnapshotRelease(s1);
+	RyanJsonSnapshotRelease(s2);
+	RyanJsonSnapshotRelease(s3);
+	RyanJsonSnapshotRelease(s4);
+	RyanJsonSnapshotRelease(t1);
+	RyanJsonSnapshotRelease(t2);
+	RyanJsonSnapshotRelease(n1);
+	RyanJsonSnapshotRelease(n2);
+
+	unityTestLeakScopeEnd(scope, "最后一个引用释放后快照副本应被删除");
+}
+
+static void testSnapshotRejectsMutation(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	static const char text[] = "{\"net\":{\"ip\":\"10.0.0.1\",\"port\":80},\"tags\":[\"a\"],\"on\":true}";
+	RyanJson_t live = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(live);
+	RyanJson_t snapshot = RyanJsonSnapshot(live);
+	TEST_ASSERT_NOT_NULL(snapshot);
+
+	// 快照内任意层级的修改都在运行时失败，不依赖断言
+	RyanJson_t net = RyanJsonGetObjectByKey(snapshot, "net");
+	RyanJson_t tags = RyanJsonGetObjectByKey(snapshot, "tags");
+	TEST_ASSERT_FALSE(RyanJsonChangeIntValue(RyanJsonGetObjectByKey(net, "port"), 1));
+	TEST_ASSERT_FALSE(RyanJsonChangeStringValue(RyanJsonGetObjectByKey(net, "ip"), "x"));
+	TEST_ASSERT_FALSE(RyanJsonChangeBoolValue(RyanJsonGetObjectByKey(snapshot, "on"), RyanJsonFalse));
+	TEST_ASSERT_FALSE(RyanJsonChangeKey(net, "network"));
+	TEST_ASSERT_FALSE(RyanJsonChangeKey(snapshot, "root"));
+	TEST_ASSERT_FALSE(RyanJsonInsert(tags, UINT32_MAX, RyanJsonCreateString(NULL, "b")));
+	TEST_ASSERT_FALSE(RyanJsonAddIntToObject(snapshot, "added", 1));
+	RyanJson_t item = RyanJsonCreateInt("port", 1);
+	TEST_ASSERT_FALSE(RyanJsonReplaceByKey(net, "port", item));
+	TEST_ASSERT_FALSE(RyanJsonReplaceByIndex(net, 0, item));
+	RyanJsonDelete(item);
+	TEST_ASSERT_NULL(RyanJsonDetachByKey(snapshot, "net"));
+	TEST_ASSERT_NULL(RyanJsonDetachByIndex(tags, 0));
+	TEST_ASSERT_FALSE(RyanJsonDeleteByKey(snapshot, "on"));
+
+	// 快照不能直接删除或挂到其他容器
+	RyanJsonDelete(snapshot);
+	TEST_ASSERT_FALSE(RyanJsonIsDetachedItem(snapshot));
+	TEST_ASSERT_FALSE(RyanJsonAddItemToObject(live, "copy", snapshot));
+
+	// 以上操作均未改变快照；源树仍可修改，旧快照保持原内容
+	RyanJson_t expect = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(expect);
+	TEST_ASSERT_TRUE(RyanJsonCompare(expect, snapshot));
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectToKey(live, "net", "port"), 8080));
+	TEST_ASSERT_TRUE(RyanJsonCompare(expect, snapshot));
+	RyanJsonDelete(expect);
+
+	RyanJsonSnapshotRelease(snapshot);
+	RyanJsonDelete(live);
+	unityTestLeakScopeEnd(scope, "被拒绝的修改不应泄漏");
+}
+
+static void testSnapshotOom(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	RyanJson_t live = RyanJsonParse("{\"a\":[1,2,3],\"b\":{\"c\":\"longStringValueStoredOutOfLine\"}}");
+	TEST_ASSERT_NOT_NULL(live);
+
+	// 逐步放宽分配次数：失败时不泄漏，成功后再次快照应共享（记录失败时可能不共享）
+	RyanJson_t snapshot = NULL;
+	for (uint32_t budget = 0; NULL == snapshot; budget++)
+	{
+		TEST_ASSERT_TRUE_MESSAGE(budget < 64U, "快照在有限次分配内应成功");
+		UNITY_TEST_OOM_BEGIN(budget);
+		snapshot = RyanJsonSnapshot(live);
+		UNITY_TEST_OOM_END();
+	}
+	TEST_ASSERT_TRUE(RyanJsonCompare(live, snapshot));
+
+	RyanJson_t again = RyanJsonSnapshot(live);
+	TEST_ASSERT_NOT_NULL(again);
+	TEST_ASSERT_TRUE(RyanJsonCompare(snapshot, again));
+	RyanJsonSnapshotRelease(again);
+
+	// 非容器与 NULL 不支持快照
+	TEST_ASSERT_NULL(RyanJsonSnapshot(NULL));
+	TEST_ASSERT_NULL(RyanJsonSnapshot(RyanJsonGetObjectToIndex(RyanJsonGetObjectByKey(live, "a"), 0)));
+
+	RyanJsonSnapshotRelease(snapshot);
+	RyanJsonDelete(live);
+
+	unityTestLeakScopeEnd(scope, "快照申请失败路径不应泄漏");
+}
+
+#endif
+
+void testSnapshotRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+#if true == RyanJsonSnapshotShare
+	RUN_TEST(testSnapshotShareUntilChange);
+	RUN_TEST(testSnapshotRejectsMutation);
+	RUN_TEST(testSnapshotOom);
+#endif
+}
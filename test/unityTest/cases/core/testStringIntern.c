@@ -0,0 +1,149 @@
+#include "testBase.h"
+
+#if true == RyanJsonStringIntern
+
+// 均超过内联区容量，走 ptr 模式存储
+#define internTestKey      "deviceSerialNumberIdentifier"
+#define internTestValue    "STATUS_OPERATIONAL_NOMINAL"
+#define internTestRowCount (20U)
+
+static void testStringInternShare(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	RyanJson_t a = RyanJsonCreateString(internTestKey, internTestValue);
+	RyanJson_t b = RyanJsonCreateString(internTestKey, internTestValue);
+	TEST_ASSERT_NOT_NULL(a);
+	TEST_ASSERT_NOT_NULL(b);
+
+	// 内容相同的节点共享同一块缓冲
+	TEST_ASSERT_TRUE(RyanJsonGetKey(a) == RyanJsonGetKey(b));
+	TEST_ASSERT_TRUE(RyanJsonGetStringValue(a) == RyanJsonGetStringValue(b));
+	TEST_ASSERT_TRUE(RyanJsonCompare(a, b));
+
+	// 修改其中一个只影响自身
+	TEST_ASSERT_TRUE(RyanJsonChangeStringValue(b, "STATUS_MAINTENANCE_REQUIRED_NOW"));
+	TEST_ASSERT_EQUAL_STRING(internTestValue, RyanJsonGetStringValue(a));
+	TEST_ASSERT_EQUAL_STRING("STATUS_MAINTENANCE_REQUIRED_NOW", RyanJsonGetStringValue(b));
+	TEST_ASSERT_FALSE(RyanJsonCompare(a, b));
+
+	// 改回原值后重新共享
+	TEST_ASSERT_TRUE(RyanJsonChangeStringValue(b, internTestValue));
+	TEST_ASSERT_TRUE(RyanJsonGetStringValue(a) == RyanJsonGetStringValue(b));
+
+	// 改 key 后 strValue 随新缓冲一起迁移
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(b, "deviceSerialNumberIdentifierBackup"));
+	TEST_ASSERT_EQUAL_STRING("deviceSerialNumberIdentifierBackup", RyanJsonGetKey(b));
+	TEST_ASSERT_EQUAL_STRING(internTestValue, RyanJsonGetStringValue(b));
+	TEST_ASSERT_EQUAL_STRING(internTestKey, RyanJsonGetKey(a));
+
+	// 删除一方不影响另一方
+	RyanJson_t c = RyanJsonDuplicate(a);
+	TEST_ASSERT_NOT_NULL(c);
+	TEST_ASSERT_TRUE(RyanJsonGetKey(a) == RyanJsonGetKey(c));
+	RyanJsonDelete(a);
+	TEST_ASSERT_EQUAL_STRING(internTestKey, RyanJsonGetKey(c));
+	TEST_ASSERT_EQUAL_STRING(internTestValue, RyanJsonGetStringValue(c));
+	RyanJsonDelete(c);
+	RyanJsonDelete(b);
+
+	unityTestLeakScopeEnd(scope, "驻留缓冲与驻留表应随最后一个引用释放");
+}
+
+static void testStringInternParseDuplicate(void)
+{
+	char text[2048];
+	uint32_t len = 0;
+	len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, "[");
+	for (uint32_t i = 0; i < internTestRowCount; i++)
+	{
+		const char *mode = (0 == i % 2U) ? "AUTOMATIC_REGULATION_MODE" : "MANUAL_OVERRIDE_MODE";
+		len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len,
+						  "%s{\"sensorTemperatureCelsius\":%" PRIu32 ",\"operatingModeDescription\":\"%s\"}",
+						  (0 == i) ? "" : ",", i, mode);
+	}
+	len += (uint32_t)RyanJsonSnprintf(text + len, sizeof(text) - len, "]");
+	TEST_ASSERT_TRUE(len < sizeof(text));
+
+	RyanJson_t json = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(json);
+
+	// 每行重复的长 key 与枚举式 strValue 都指向同一份缓冲
+	RyanJson_t first = RyanJsonGetObjectByIndex(json, 0);
+	RyanJson_t second = RyanJsonGetObjectByIndex(json, 1);
+	RyanJson_t row = NULL;
+	uint32_t index = 0;
+	RyanJsonArrayForEach(json, row)
+	{
+		RyanJson_t sample = (0 == index % 2U) ? first : second;
+		TEST_ASSERT_TRUE(RyanJsonGetKey(RyanJsonGetObjectByKey(row, "sensorTemperatureCelsius")) ==
+				 RyanJsonGetKey(RyanJsonGetObjectByKey(first, "sensorTemperatureCelsius")));
+		TEST_ASSERT_TRUE(RyanJsonGetStringValue(RyanJsonGetObjectByKey(row, "operatingModeDescription")) ==
+				 RyanJsonGetStringValue(RyanJsonGetObjectByKey(sample, "operatingModeDescription")));
+		index++;
+	}
+	TEST_ASSERT_EQUAL_UINT32(internTestRowCount, index);
+
+	// Duplicate 直接复用原文档的缓冲
+	RyanJson_t dup = RyanJsonDuplicate(json);
+	TEST_ASSERT_NOT_NULL(dup);
+	TEST_ASSERT_TRUE(RyanJsonGetStringValue(RyanJsonGetObjectByKey(RyanJsonGetObjectByIndex(dup, 3), "operatingModeDescription")) ==
+			 RyanJsonGetStringValue(RyanJsonGetObjectByKey(second, "operatingModeDescription")));
+	TEST_ASSERT_TRUE(RyanJsonCompare(json, dup));
+	RyanJsonDelete(json);
+
+	char *out = RyanJsonPrint(dup, 256, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(out);
+	TEST_ASSERT_EQUAL_STRING(text, out);
+	RyanJsonFree(out);
+	RyanJsonDelete(dup);
+}
+
+static void testStringInternOom(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	// 驻留表建立失败时缓冲照常可用，只是不参与去重
+	UNITY_TEST_OOM_BEGIN(2);
+	RyanJson_t unlisted = RyanJsonCreateString(internTestKey, internTestValue);
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_NOT_NULL(unlisted);
+
+	RyanJson_t a = RyanJsonCreateString(internTestKey, internTestValue);
+	TEST_ASSERT_NOT_NULL(a);
+	TEST_ASSERT_TRUE(RyanJsonGetStringValue(a) != RyanJsonGetStringValue(unlisted));
+	TEST_ASSERT_TRUE(RyanJsonCompare(a, unlisted));
+	RyanJsonDelete(unlisted);
+
+	// 命中已有缓冲无需申请内存，只有节点本身需要一次申请
+	UNITY_TEST_OOM_BEGIN(1);
+	RyanJson_t b = RyanJsonCreateString(internTestKey, internTestValue);
+	RyanJson_t c = RyanJsonCreateString(internTestKey, "STATUS_MAINTENANCE_REQUIRED_NOW");
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_NOT_NULL(b);
+	TEST_ASSERT_NULL(c);
+	TEST_ASSERT_TRUE(RyanJsonGetStringValue(a) == RyanJsonGetStringValue(b));
+
+	// 修改失败时保留原缓冲
+	UNITY_TEST_OOM_BEGIN(0);
+	TEST_ASSERT_FALSE(RyanJsonChangeStringValue(b, "STATUS_MAINTENANCE_REQUIRED_NOW"));
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_TRUE(RyanJsonGetStringValue(a) == RyanJsonGetStringValue(b));
+
+	RyanJsonDelete(a);
+	RyanJsonDelete(b);
+
+	unityTestLeakScopeEnd(scope, "OOM 路径不应泄漏驻留缓冲");
+}
+
+#endif
+
+void testStringInternRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+#if true == RyanJsonStringIntern
+	RUN_TEST(testStringInternShare);
+	RUN_TEST(testStringInternParseDuplicate);
+	RUN_TEST(testStringInternOom);
+#endif
+}
@@ -0,0 +1,195 @@
+#include "testBase.h"
+
+static const char *tapeTestText = "{\"name\":\"sensor\\u00e9\\n\",\"id\":-42,\"big\":4294967296,\"ratio\":0.25,\"on\":true,\"off\":false,"
+				  "\"none\":null,\"empty\":{},\"list\":[],\"nested\":{\"deep\":[1,[2,[3,{\"k\":\"v\"}]],\"tail\"]},"
+				  "\"description\":\"a string value long enough to be stored out of line\",\"last\":[true,null,1.5e3]}";
+
+static void testTapeMatchesTree(void)
+{
+	RyanJson_t tree = RyanJsonParse(tapeTestText);
+	RyanJsonTape_t tape = RyanJsonParseTape(tapeTestText);
+	TEST_ASSERT_NOT_NULL(tree);
+	TEST_ASSERT_NOT_NULL(tape);
+
+	// 转回树后与直接解析的结果一致
+	RyanJson_t converted = RyanJsonTapeToTree(RyanJsonTapeGetRoot(tape));
+	TEST_ASSERT_NOT_NULL(converted);
+	TEST_ASSERT_TRUE(RyanJsonCompare(tree, converted));
+	char *expect = RyanJsonPrint(tree, 256, RyanJsonFalse, NULL);
+	char *actual = RyanJsonPrint(converted, 256, RyanJsonFalse, NULL);
+	TEST_ASSERT_EQUAL_STRING(expect, actual);
+	RyanJsonFree(expect);
+	RyanJsonFree(actual);
+	RyanJsonDelete(converted);
+
+	RyanJsonTapeVal_t root = RyanJsonTapeGetRoot(tape);
+	TEST_ASSERT_EQUAL_INT(RyanJsonTypeObject, RyanJsonTapeGetType(root));
+	TEST_ASSERT_NULL(RyanJsonTapeGetKey(root));
+	TEST_ASSERT_NULL(RyanJsonTapeGetNext(root));
+	TEST_ASSERT_EQUAL_UINT32(RyanJsonGetSize(tree), RyanJsonTapeGetSize(root));
+
+	// 同层遍历顺序、key 与树一致，跨过嵌套子树
+	RyanJson_t treeItem = RyanJsonGetObjectValue(tree);
+	RyanJsonTapeVal_t item;
+	RyanJsonTapeForEach(root, item)
+	{
+		TEST_ASSERT_NOT_NULL(treeItem);
+		TEST_ASSERT_EQUAL_STRING(RyanJsonGetKey(treeItem), RyanJsonTapeGetKey(item));
+		TEST_ASSERT_EQUAL_UINT32(RyanJsonGetKeyLength(treeItem), RyanJsonTapeGetKeyLength(item));
+		TEST_ASSERT_EQUAL_INT(RyanJsonGetType(treeItem), RyanJsonTapeGetType(item));
+		treeItem = RyanJsonGetNext(treeItem);
+	}
+	TEST_ASSERT_NULL(treeItem);
+
+	RyanJsonTapeVal_t name = RyanJsonTapeGetObjectByKey(root, "name");
+	TEST_ASSERT_EQUAL_STRING("sensor\xc3\xa9\n", RyanJsonTapeGetStringValue(name));
+	TEST_ASSERT_EQUAL_UINT32(9, RyanJsonTapeGetStringLength(name));
+	TEST_ASSERT_TRUE(RyanJsonTapeIsInt(RyanJsonTapeGetObjectByKey(root, "id")));
+	TEST_ASSERT_EQUAL_INT(-42, RyanJsonTapeGetIntValue(RyanJsonTapeGetObjectByKey(root, "id")));
+	TEST_ASSERT_TRUE(RyanJsonTapeIsDouble(RyanJsonTapeGetObjectByKey(root, "big")));
+	TEST_ASSERT_EQUAL_DOUBLE(4294967296.0, RyanJsonTapeGetDoubleValue(RyanJsonTapeGetObjectByKey(root, "big")));
+	TEST_ASSERT_EQUAL_DOUBLE(0.25, RyanJsonTapeGetDoubleValue(RyanJsonTapeGetObjectByKey(root, "ratio")));
+	TEST_ASSERT_TRUE(RyanJsonTapeGetBoolValue(RyanJsonTapeGetObjectByKey(root, "on")));
+	TEST_ASSERT_FALSE(RyanJsonTapeGetBoolValue(RyanJsonTapeGetObjectByKey(root, "off")));
+	TEST_ASSERT_EQUAL_INT(RyanJsonTypeNull, RyanJsonTapeGetType(RyanJsonTapeGetObjectByKey(root, "none")));
+	TEST_ASSERT_NULL(RyanJsonTapeGetObjectValue(RyanJsonTapeGetObjectByKey(root, "empty")));
+	TEST_ASSERT_EQUAL_UINT32(0, RyanJsonTapeGetSize(RyanJsonTapeGetObjectByKey(root, "list")));
+	TEST_ASSERT_NULL(RyanJsonTapeGetObjectByKey(root, "nam"));
+	TEST_ASSERT_NULL(RyanJsonTapeGetObjectByKey(RyanJsonTapeGetObjectByKey(root, "list"), "name"));
+
+	// 按索引与嵌套路径访问
+	RyanJsonTapeVal_t deep = RyanJsonTapeGetObjectByKey(RyanJsonTapeGetObjectByKey(root, "nested"), "deep");
+	TEST_ASSERT_EQUAL_UINT32(3, RyanJsonTapeGetSize(deep));
+	TEST_ASSERT_EQUAL_STRING("tail", RyanJsonTapeGetStringValue(RyanJsonTapeGetObjectByIndex(deep, 2)));
+	TEST_ASSERT_NULL(RyanJsonTapeGetObjectByIndex(deep, 3));
+	RyanJsonTapeVal_t inner = RyanJsonTapeGetObjectByIndex(RyanJsonTapeGetObjectByIndex(deep, 1), 1);
+	TEST_ASSERT_EQUAL_INT(3, RyanJsonTapeGetIntValue(RyanJsonTapeGetObjectByIndex(inner, 0)));
+	RyanJsonTapeVal_t k = RyanJsonTapeGetObjectByKey(RyanJsonTapeGetObjectByIndex(inner, 1), "k");
+	TEST_ASSERT_EQUAL_STRING("v", RyanJsonTapeGetStringValue(k));
+	TEST_ASSERT_NULL(RyanJsonTapeGetNext(k));
+
+	// 子树转换保留自身 key
+	RyanJson_t sub = RyanJsonTapeToTree(RyanJsonTapeGetObjectByKey(root, "nested"));
+	TEST_ASSERT_NOT_NULL(sub);
+	TEST_ASSERT_EQUAL_STRING("nested", RyanJsonGetKey(sub));
+	TEST_ASSERT_TRUE(RyanJsonCompare(RyanJsonGetObjectByKey(tree, "nested"), sub));
+	RyanJsonDelete(sub);
+
+	// 标量根节点
+	RyanJsonTape_t scalar = RyanJsonParseTape("  \"only\"  ");
+	TEST_ASSERT_NOT_NULL(scalar);
+	TEST_ASSERT_EQUAL_STRING("only", RyanJsonTapeGetStringValue(RyanJsonTapeGetRoot(scalar)));
+	TEST_ASSERT_NULL(RyanJsonTapeGetNext(RyanJsonTapeGetRoot(scalar)));
+	TEST_ASSERT_EQUAL_UINT32(1, RyanJsonTapeGetSize(RyanJsonTapeGetRoot(scalar)));
+	RyanJsonTapeDelete(scalar);
+
+	RyanJsonTapeDelete(tape);
+	RyanJsonDelete(tree);
+}
+
+static void testTapeAcceptsSameTextAsTree(void)
+{
+	// 接受/拒绝的文本与树解析一致
+	const char *texts[] = {
+		"", "{", "[1,]", "{\"a\":1,}", "{\"a\" 1}", "[1 2]", "{\"a\":1}}", "\"abc", "\"\\x\"", "\"\\ud800\"", "nul", "tru",
+		"-", "1e", "[\"\\u00zz\"]", "{1:2}", "{\"a\":1,\"a\":2}", "[[[]]]", "  [ 1 , { \"x\" : [ ] } ]  ", "-0.0e+1",
+	};
+	for (uint32_t i = 0; i < sizeof(texts) / sizeof(texts[0]); i++)
+	{
+		RyanJson_t tree = RyanJsonParse(texts[i]);
+		RyanJsonTape_t tape = RyanJsonParseTape(texts[i]);
+		TEST_ASSERT_EQUAL_MESSAGE(NULL == tree, NULL == tape, texts[i]);
+		if (NULL != tape)
+		{
+			RyanJson_t converted = RyanJsonTapeToTree(RyanJsonTapeGetRoot(tape));
+			TEST_ASSERT_TRUE_MESSAGE(RyanJsonCompare(tree, converted), texts[i]);
+			RyanJsonDelete(converted);
+		}
+		RyanJsonDelete(tree);
+		RyanJsonTapeDelete(tape);
+	}
+
+	// 尾部校验与结束位置
+	const char *text = "[1,2] tail";
+	const char *end = NULL;
+	TEST_ASSERT_NULL(RyanJsonParseTapeOptions(text, (uint32_t)strlen(text), RyanJsonTrue, &end));
+	TEST_ASSERT_NULL(end);
+	RyanJsonTape_t tape = RyanJsonParseTapeOptions(text, (uint32_t)strlen(text), RyanJsonFalse, &end);
+	TEST_ASSERT_NOT_NULL(tape);
+	TEST_ASSERT_EQUAL_STRING(" tail", end);
+	RyanJsonTapeDelete(tape);
+
+	TEST_ASSERT_NULL(RyanJsonParseTape(NULL));
+	TEST_ASSERT_NULL(RyanJsonTapeGetRoot(NULL));
+	RyanJsonTapeDelete(NULL);
+}
+
+static void testTapeDeepAndOom(void)
+{
+	unityTestLeakScope_t scope = unityTestLeakScopeBegin();
+
+	// 深层嵌套：解析与转换都不使用递归
+	const uint32_t depth = 3000;
+	char *deepText = (char *)malloc(depth * 2U + 8U);
+	TEST_ASSERT_NOT_NULL(deepText);
+	uint32_t len = 0;
+	for (uint32_t i = 0; i < depth; i++)
+	{
+		deepText[len++] = '[';
+	}
+	deepText[len++] = '7';
+	for (uint32_t i = 0; i < depth; i++)
+	{
+		deepText[len++] = ']';
+	}
+	deepText[len] = '\0';
+
+	RyanJsonTape_t deepTape = RyanJsonParseTape(deepText);
+	RyanJson_t deepTree = RyanJsonParse(deepText);
+	free(deepText);
+	TEST_ASSERT_NOT_NULL(deepTape);
+	TEST_ASSERT_NOT_NULL(deepTree);
+	RyanJson_t deepConverted = RyanJsonTapeToTree(RyanJsonTapeGetRoot(deepTape));
+	TEST_ASSERT_TRUE(RyanJsonCompare(deepTree, deepConverted));
+	RyanJsonDelete(deepConverted);
+	RyanJsonDelete(deepTree);
+	RyanJsonTapeDelete(deepTape);
+
+	// 逐步注入 OOM：解析与转换失败都不泄漏
+	for (uint32_t mode = 0; mode < 2U; mode++)
+	{
+		RyanJsonTape_t tape = NULL;
+		for (uint32_t budget = 0; NULL == tape; budget++)
+		{
+			TEST_ASSERT_TRUE_MESSAGE(budget < 64U, "tape 解析在有限次分配内应成功");
+			if (0U == mode) { UNITY_TEST_OOM_BEGIN(budget); }
+			else
+			{
+				UNITY_TEST_OOM_BEGIN_NO_REALLOC(budget);
+			}
+			tape = RyanJsonParseTape(tapeTestText);
+			UNITY_TEST_OOM_END();
+		}
+
+		RyanJson_t tree = NULL;
+		for (uint32_t budget = 0; NULL == tree; budget++)
+		{
+			TEST_ASSERT_TRUE_MESSAGE(budget < 128U, "tape 转树在有限次分配内应成功");
+			UNITY_TEST_OOM_BEGIN(budget);
+			tree = RyanJsonTapeToTree(RyanJsonTapeGetRoot(tape));
+			UNITY_TEST_OOM_END();
+		}
+		RyanJsonDelete(tree);
+		RyanJsonTapeDelete(tape);
+	}
+
+	unityTestLeakScopeEnd(scope, "tape 解析/转换失败路径不应泄漏");
+}
+
+void testTapeRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+	RUN_TEST(testTapeMatchesTree);
+	RUN_TEST(testTapeAcceptsSameTextAsTree);
+	RUN_TEST(testTapeDeepAndOom);
+}
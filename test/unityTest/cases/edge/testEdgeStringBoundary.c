@@ -45,6 +45,7 @@ static void assertStringNodeMode(RyanJson_t node, const char *expect, uint32_t e
 	TEST_ASSERT_NOT_NULL(node);
 	TEST_ASSERT_TRUE(RyanJsonIsString(node));
 	TEST_ASSERT_EQUAL_UINT32(expectLen, (uint32_t)strlen(RyanJsonGetStringValue(node)));
+	TEST_ASSERT_EQUAL_UINT32_MESSAGE(expectLen, RyanJsonGetStringLength(node), "GetStringLength 与 strlen 不一致");
 	TEST_ASSERT_EQUAL_MEMORY(expect, RyanJsonGetStringValue(node), expectLen);
 	TEST_ASSERT_EQUAL_UINT8((uint8_t)expectPtrMode, (uint8_t)RyanJsonGetPayloadStrIsPtrByFlag(node));
 }
@@ -274,6 +275,60 @@ static void testEdgeStringParsePtrBoundaryEscaped(void)
 	free(escaped);
 }
 
+static void testEdgeStringLengthMetaKeepsEscapeState(void)
+{
+	// 复杂链路：
+	// Create(ptr 模式含转义) -> Print -> ChangeKey -> Print -> ChangeStringValue(无转义) -> Print。
+	// 目标：验证 ptr 模式缓存的长度/转义标记随修改同步，打印结果始终正确。
+	uint32_t longLen = RyanJsonInlineStringSize + 8U;
+	char *longVal = allocPatternString(longLen, 'v');
+	TEST_ASSERT_NOT_NULL(longVal);
+	longVal[3] = '"';
+
+	RyanJson_t obj = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(obj);
+	TEST_ASSERT_TRUE(RyanJsonAddStringToObject(obj, "key", longVal));
+	RyanJson_t node = RyanJsonGetObjectByKey(obj, "key");
+	assertStringNodeMode(node, longVal, longLen, RyanJsonTrue);
+	TEST_ASSERT_EQUAL_UINT32(3U, RyanJsonGetKeyLength(node));
+
+	char *printed = RyanJsonPrint(obj, 0, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(printed);
+	TEST_ASSERT_EQUAL_STRING_LEN("{\"key\":\"vvv\\\"vv", printed, 15);
+	RyanJsonFree(printed);
+
+	// 改 key 后 strValue 不变，转义标记必须保留
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(node, "longerKeyName"));
+	TEST_ASSERT_EQUAL_UINT32(13U, RyanJsonGetKeyLength(node));
+	assertStringNodeMode(node, longVal, longLen, RyanJsonTrue);
+	printed = RyanJsonPrint(obj, 0, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(printed);
+	TEST_ASSERT_EQUAL_STRING_LEN("{\"longerKeyName\":\"vvv\\\"vv", printed, 25);
+	RyanJsonFree(printed);
+
+	// 换成无需转义的长字符串后，走整段拷贝路径
+	longVal[3] = 'v';
+	TEST_ASSERT_TRUE(RyanJsonChangeStringValue(node, longVal));
+	assertStringNodeMode(node, longVal, longLen, RyanJsonTrue);
+	RyanJson_t roundtrip = NULL;
+	printed = RyanJsonPrint(obj, 0, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(printed);
+	roundtrip = RyanJsonParse(printed);
+	TEST_ASSERT_NOT_NULL(roundtrip);
+	TEST_ASSERT_TRUE(RyanJsonCompare(obj, roundtrip));
+	assertStringNodeMode(RyanJsonGetObjectByKey(roundtrip, "longerKeyName"), longVal, longLen, RyanJsonTrue);
+
+	TEST_ASSERT_EQUAL_UINT32(0U, RyanJsonGetKeyLength(obj));
+	TEST_ASSERT_EQUAL_UINT32(0U, RyanJsonGetStringLength(obj));
+	TEST_ASSERT_EQUAL_UINT32(0U, RyanJsonGetStringLength(NULL));
+	TEST_ASSERT_EQUAL_UINT32(0U, RyanJsonGetKeyLength(NULL));
+
+	RyanJsonDelete(roundtrip);
+	RyanJsonFree(printed);
+	RyanJsonDelete(obj);
+	free(longVal);
+}
+
 void testEdgeStringBoundaryRunner(void)
 {
 	UnitySetTestFile(__FILE__);
@@ -287,4 +342,5 @@ void testEdgeStringBoundaryRunner(void)
 	RUN_TEST(testEdgeStringParsePtrBoundaryPlain);
 	RUN_TEST(testEdgeStringParseInlineBoundaryEscaped);
 	RUN_TEST(testEdgeStringParsePtrBoundaryEscaped);
+	RUN_TEST(testEdgeStringLengthMetaKeepsEscapeState);
 }
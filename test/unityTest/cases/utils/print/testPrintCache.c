@@ -0,0 +1,182 @@
+#include "testBase.h"
+
+// 片段足够长，保证各子容器都会超过 RyanJsonPrintCacheMinSize
+static const char *gPrintCacheDoc =
+	"{\"meta\":{\"name\":\"print-cache-document\",\"version\":3,\"enabled\":true,\"ratio\":0.5},"
+	"\"list\":[{\"id\":1,\"tag\":\"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\"},{\"id\":2,\"tag\":\"bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb\"},"
+	"{\"id\":3,\"tag\":\"cccccccccccccccccccccccccccccccc\"}],"
+	"\"tail\":{\"note\":\"dddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddddd\",\"flag\":null}}";
+
+/**
+ * @brief 创建测试文档
+ * @note 根节点额外挂一个长字符串，使根片段超过 RyanJsonPrintCacheMaxSize，覆盖“根不缓存、子容器缓存”的路径。
+ */
+static RyanJson_t createPrintCacheDoc(void)
+{
+	RyanJson_t json = RyanJsonParse(gPrintCacheDoc);
+	TEST_ASSERT_NOT_NULL(json);
+
+	char pad[1100];
+	memset(pad, 'p', sizeof(pad) - 1U);
+	pad[sizeof(pad) - 1U] = '\0';
+	TEST_ASSERT_TRUE(RyanJsonAddStringToObject(json, "pad", pad));
+	return json;
+}
+
+/**
+ * @brief 紧凑打印结果应与“从未打印过的等价树”一致
+ * @note Duplicate 得到的新树不带任何缓存，可作为基准。
+ */
+static void assertPrintMatchesFresh(RyanJson_t json)
+{
+	RyanJson_t fresh = RyanJsonDuplicate(json);
+	TEST_ASSERT_NOT_NULL(fresh);
+
+	char *expected = RyanJsonPrint(fresh, 0, RyanJsonFalse, NULL);
+	char *actual = RyanJsonPrint(json, 0, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(expected);
+	TEST_ASSERT_NOT_NULL(actual);
+	TEST_ASSERT_EQUAL_STRING_MESSAGE(expected, actual, "修改后的打印结果与基准不一致");
+
+	RyanJsonFree(expected);
+	RyanJsonFree(actual);
+	RyanJsonDelete(fresh);
+}
+
+static void testPrintCacheRepeatStable(void)
+{
+	RyanJson_t json = createPrintCacheDoc();
+
+	uint32_t len1 = 0;
+	uint32_t len2 = 0;
+	char *first = RyanJsonPrint(json, 0, RyanJsonFalse, &len1);
+	char *second = RyanJsonPrint(json, 0, RyanJsonFalse, &len2);
+	TEST_ASSERT_NOT_NULL(first);
+	TEST_ASSERT_NOT_NULL(second);
+	TEST_ASSERT_EQUAL_UINT32(len1, len2);
+	TEST_ASSERT_EQUAL_STRING_MESSAGE(first, second, "重复打印结果应一致");
+
+	// 子树单独打印也应命中同样的片段
+	char *listText = RyanJsonPrint(RyanJsonGetObjectByKey(json, "list"), 0, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(listText);
+	TEST_ASSERT_NOT_NULL(strstr(first, listText));
+
+	// 格式化打印不受紧凑缓存影响
+	char *formatted = RyanJsonPrint(json, 0, RyanJsonTrue, NULL);
+	TEST_ASSERT_NOT_NULL(formatted);
+	TEST_ASSERT_NOT_NULL(strchr(formatted, '\n'));
+
+	RyanJsonFree(first);
+	RyanJsonFree(second);
+	RyanJsonFree(listText);
+	RyanJsonFree(formatted);
+	RyanJsonDelete(json);
+}
+
+static void testPrintCacheInvalidateOnChange(void)
+{
+	RyanJson_t json = createPrintCacheDoc();
+	char *warm = RyanJsonPrint(json, 0, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(warm);
+	RyanJsonFree(warm);
+
+	RyanJson_t meta = RyanJsonGetObjectByKey(json, "meta");
+	TEST_ASSERT_TRUE(RyanJsonChangeStringValue(RyanJsonGetObjectByKey(meta, "name"), "renamed"));
+	assertPrintMatchesFresh(json);
+
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByKey(meta, "version"), 4));
+	assertPrintMatchesFresh(json);
+
+	TEST_ASSERT_TRUE(RyanJsonChangeBoolValue(RyanJsonGetObjectByKey(meta, "enabled"), RyanJsonFalse));
+	assertPrintMatchesFresh(json);
+
+	TEST_ASSERT_TRUE(RyanJsonChangeDoubleValue(RyanJsonGetObjectByKey(meta, "ratio"), 0.25));
+	assertPrintMatchesFresh(json);
+
+	// 深层节点修改需要沿父链一路失效到根
+	RyanJson_t item = RyanJsonGetObjectByKey(RyanJsonGetObjectByIndex(RyanJsonGetObjectByKey(json, "list"), 2), "tag");
+	TEST_ASSERT_NOT_NULL(item);
+	TEST_ASSERT_TRUE(RyanJsonChangeStringValue(item, "changed"));
+	assertPrintMatchesFresh(json);
+
+	// key 属于父容器的输出
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(item, "label"));
+	assertPrintMatchesFresh(json);
+
+	RyanJsonDelete(json);
+}
+
+static void testPrintCacheInvalidateOnStructure(void)
+{
+	RyanJson_t json = createPrintCacheDoc();
+	char *warm = RyanJsonPrint(json, 0, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(warm);
+	RyanJsonFree(warm);
+
+	RyanJson_t list = RyanJsonGetObjectByKey(json, "list");
+	TEST_ASSERT_TRUE(RyanJsonInsert(list, 0, RyanJsonCreateInt(NULL, 0)));
+	assertPrintMatchesFresh(json);
+
+	TEST_ASSERT_TRUE(RyanJsonReplaceByIndex(list, 0, RyanJsonCreateString(NULL, "head")));
+	assertPrintMatchesFresh(json);
+
+	TEST_ASSERT_TRUE(RyanJsonReplaceByKey(json, "meta", RyanJsonCreateNull(NULL)));
+	assertPrintMatchesFresh(json);
+
+	// 分离出来的子树保留自身缓存，挂到新位置后输出仍然正确
+	RyanJson_t tail = RyanJsonDetachByKey(json, "tail");
+	TEST_ASSERT_NOT_NULL(tail);
+	assertPrintMatchesFresh(json);
+	assertPrintMatchesFresh(tail);
+	TEST_ASSERT_TRUE(RyanJsonAddItemToObject(RyanJsonGetObjectByIndex(list, 1), "tail", tail));
+	assertPrintMatchesFresh(json);
+
+	TEST_ASSERT_TRUE(RyanJsonDeleteByIndex(list, 1));
+	assertPrintMatchesFresh(json);
+
+	RyanJsonDelete(json);
+}
+
+#if true == RyanJsonPrintCache
+static void testPrintCacheStoreOomKeepsOutput(void)
+{
+	RyanJson_t json = createPrintCacheDoc();
+
+	uint32_t expectedLen = 0;
+	RyanJson_t fresh = RyanJsonDuplicate(json);
+	TEST_ASSERT_NOT_NULL(fresh);
+	char *expected = RyanJsonPrint(fresh, 0, RyanJsonFalse, &expectedLen);
+	TEST_ASSERT_NOT_NULL(expected);
+	RyanJsonDelete(fresh);
+
+	// 预分配输出：缓冲区本身不需要申请，缓存/扩展信息申请失败只能放弃缓存
+	char *buf = (char *)malloc((size_t)expectedLen + 1U);
+	TEST_ASSERT_NOT_NULL(buf);
+	UNITY_TEST_OOM_BEGIN(0);
+	char *out = RyanJsonPrintPreallocated(json, buf, expectedLen + 1U, RyanJsonFalse, NULL);
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_NOT_NULL_MESSAGE(out, "缓存申请失败不应影响打印结果");
+	TEST_ASSERT_EQUAL_STRING(expected, out);
+
+	// 之后正常打印仍可建立缓存并保持一致
+	assertPrintMatchesFresh(json);
+	out = RyanJsonPrintPreallocated(json, buf, expectedLen + 1U, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL(out);
+	TEST_ASSERT_EQUAL_STRING(expected, out);
+
+	free(buf);
+	RyanJsonFree(expected);
+	RyanJsonDelete(json);
+}
+#endif
+
+void testPrintCacheRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+	RUN_TEST(testPrintCacheRepeatStable);
+	RUN_TEST(testPrintCacheInvalidateOnChange);
+	RUN_TEST(testPrintCacheInvalidateOnStructure);
+#if true == RyanJsonPrintCache
+	RUN_TEST(testPrintCacheStoreOomKeepsOutput);
+#endif
+}
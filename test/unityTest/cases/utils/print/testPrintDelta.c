@@ -0,0 +1,391 @@
+#include "testBase.h"
+
+#if true == RyanJsonDeltaTracking
+static const char *gPrintDeltaDoc = "{\"a\":1,\"b\":{\"c\":\"x\",\"d\":2,\"e\":{\"f\":false}},\"list\":[1,2,{\"g\":3}],\"h\":true}";
+
+static RyanJson_t createPrintDeltaDoc(void)
+{
+	RyanJson_t json = RyanJsonParse(gPrintDeltaDoc);
+	TEST_ASSERT_NOT_NULL(json);
+	return json;
+}
+
+/**
+ * @brief 增量打印结果应与期望文本一致
+ */
+static void assertPrintDelta(RyanJson_t json, const char *expected)
+{
+	uint32_t len = 0;
+	char *delta = RyanJsonPrintDelta(json, 0, &len);
+	TEST_ASSERT_NOT_NULL(delta);
+	TEST_ASSERT_EQUAL_STRING(expected, delta);
+	TEST_ASSERT_EQUAL_UINT32((uint32_t)strlen(expected), len);
+	RyanJsonFree(delta);
+}
+
+static void testPrintDeltaNoChange(void)
+{
+	RyanJson_t json = createPrintDeltaDoc();
+	assertPrintDelta(json, "{}");
+
+	// 检查点对无记录的树是空操作
+	RyanJsonCheckpoint(json);
+	assertPrintDelta(json, "{}");
+
+	TEST_ASSERT_NULL(RyanJsonPrintDelta(NULL, 0, NULL));
+	RyanJsonCheckpoint(NULL);
+	RyanJsonDelete(json);
+}
+
+static void testPrintDeltaScalarAndNested(void)
+{
+	RyanJson_t json = createPrintDeltaDoc();
+	RyanJson_t b = RyanJsonGetObjectByKey(json, "b");
+
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByKey(json, "a"), 5));
+	TEST_ASSERT_TRUE(RyanJsonChangeStringValue(RyanJsonGetObjectByKey(b, "c"), "y"));
+	TEST_ASSERT_TRUE(RyanJsonChangeBoolValue(RyanJsonGetObjectByKeys(json, "b", "e", "f", NULL), RyanJsonTrue));
+	assertPrintDelta(json, "{\"a\":5,\"b\":{\"c\":\"y\",\"e\":{\"f\":true}}}");
+
+	// 同一成员重复修改只输出一次
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByKey(json, "a"), 6));
+	assertPrintDelta(json, "{\"a\":6,\"b\":{\"c\":\"y\",\"e\":{\"f\":true}}}");
+
+	// 子树可单独作为增量打印根
+	assertPrintDelta(b, "{\"c\":\"y\",\"e\":{\"f\":true}}");
+
+	RyanJsonCheckpoint(json);
+	assertPrintDelta(json, "{}");
+	assertPrintDelta(b, "{}");
+
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByKey(b, "d"), 3));
+	assertPrintDelta(json, "{\"b\":{\"d\":3}}");
+
+	RyanJsonDelete(json);
+}
+
+static void testPrintDeltaStructure(void)
+{
+	RyanJson_t json = createPrintDeltaDoc();
+
+	TEST_ASSERT_TRUE(RyanJsonAddIntToObject(json, "n", 7));
+	assertPrintDelta(json, "{\"n\":7}");
+
+	TEST_ASSERT_TRUE(RyanJsonDeleteByKey(json, "a"));
+	assertPrintDelta(json, "{\"n\":7,\"a\":null}");
+
+	// 改名等价于删除旧 key 并以新 key 整体写入
+	TEST_ASSERT_TRUE(RyanJsonChangeKey(RyanJsonGetObjectByKey(json, "h"), "k"));
+	assertPrintDelta(json, "{\"n\":7,\"k\":true,\"a\":null,\"h\":null}");
+
+	// 同名 key 重新加入后不再输出 null
+	TEST_ASSERT_TRUE(RyanJsonAddStringToObject(json, "a", "back"));
+	assertPrintDelta(json, "{\"n\":7,\"k\":true,\"a\":\"back\",\"h\":null}");
+
+	// 替换整体输出新值；新增后又删除只剩删除记录
+	TEST_ASSERT_TRUE(RyanJsonReplaceByKey(json, "b", RyanJsonCreateString("b", "new")));
+	assertPrintDelta(json, "{\"n\":7,\"k\":true,\"a\":\"back\",\"b\":\"new\",\"h\":null}");
+	TEST_ASSERT_TRUE(RyanJsonDeleteByKey(json, "n"));
+	assertPrintDelta(json, "{\"b\":\"new\",\"k\":true,\"a\":\"back\",\"h\":null,\"n\":null}");
+
+	RyanJsonCheckpoint(json);
+	assertPrintDelta(json, "{}");
+	RyanJsonDelete(json);
+}
+
+static void testPrintDeltaArrayWhole(void)
+{
+	RyanJson_t json = createPrintDeltaDoc();
+	RyanJson_t list = RyanJsonGetObjectByKey(json, "list");
+
+	// Merge Patch 无法寻址数组元素：数组内部任意位置变化都按最外层数组整体输出
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByKey(RyanJsonGetObjectByIndex(list, 2), "g"), 4));
+	assertPrintDelta(json, "{\"list\":[1,2,{\"g\":4}]}");
+
+	RyanJsonCheckpoint(json);
+	TEST_ASSERT_TRUE(RyanJsonDeleteByIndex(list, 0));
+	TEST_ASSERT_TRUE(RyanJsonInsert(list, 0, RyanJsonCreateInt(NULL, 9)));
+	assertPrintDelta(json, "{\"list\":[9,2,{\"g\":4}]}");
+
+	// 非 Object 根只能整体替换
+	RyanJsonCheckpoint(json);
+	RyanJson_t detached = RyanJsonDetachByKey(json, "list");
+	TEST_ASSERT_NOT_NULL(detached);
+	assertPrintDelta(detached, "[9,2,{\"g\":4}]");
+	assertPrintDelta(json, "{\"list\":null}");
+
+	RyanJsonDelete(detached);
+	RyanJsonDelete(json);
+}
+
+static void testPrintDeltaDeepPath(void)
+{
+	enum
+	{
+		depth = 200
+	};
+	static char text[depth * 6 + 16];
+	static char expected[depth * 6 + 16];
+	uint32_t len = 0;
+	uint32_t expectedLen = 0;
+	for (uint32_t i = 0; i < depth; i++)
+	{
+		memcpy(text + len, "{\"n\":", 5);
+		len += 5;
+		memcpy(expected + expectedLen, "{\"n\":", 5);
+		expectedLen += 5;
+	}
+	memcpy(text + len, "{\"v\":1,\"w\":0}", 13);
+	len += 13;
+	memcpy(expected + expectedLen, "{\"v\":2}", 7);
+	expectedLen += 7;
+	for (uint32_t i = 0; i < depth; i++)
+	{
+		text[len++] = '}';
+		expected[expectedLen++] = '}';
+	}
+	text[len] = '\0';
+	expected[expectedLen] = '\0';
+
+	RyanJson_t json = RyanJsonParse(text);
+	TEST_ASSERT_NOT_NULL(json);
+	RyanJson_t mid = json;
+	RyanJson_t leaf = json;
+	for (uint32_t i = 0; i < depth; i++)
+	{
+		leaf = RyanJsonGetObjectByKey(leaf, "n");
+		if (depth / 2 == i) { mid = leaf; }
+	}
+	TEST_ASSERT_NOT_NULL(leaf);
+
+	// 祖先只打标记，记录只落在直接所属的 Object 上，占用与深度无关
+	int32_t used = unityTestGetUse();
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByKey(leaf, "v"), 2));
+	TEST_ASSERT_TRUE(unityTestGetUse() - used < 512);
+	assertPrintDelta(json, expected);
+
+	// 对子树建立检查点后，祖先上的标记随之撤销
+	RyanJsonCheckpoint(mid);
+	assertPrintDelta(json, "{}");
+
+	// 标记撤销后再次修改，路径重新标记
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByKey(leaf, "w"), 3));
+	expected[depth * 5 + 2] = 'w';
+	expected[depth * 5 + 5] = '3';
+	assertPrintDelta(json, expected);
+	RyanJsonDelete(json);
+}
+
+/**
+ * @brief 按 RFC 7396 把 Object 补丁合并到 Object 目标上
+ */
+static void applyMergePatch(RyanJson_t target, RyanJson_t patch)
+{
+	for (RyanJson_t item = RyanJsonGetObjectValue(patch); NULL != item; item = RyanJsonGetNext(item))
+	{
+		const char *key = RyanJsonGetKey(item);
+		if (RyanJsonIsNull(item))
+		{
+			(void)RyanJsonDeleteByKey(target, key);
+			continue;
+		}
+		if (RyanJsonIsObject(item))
+		{
+			RyanJson_t sub = RyanJsonDetachByKey(target, key);
+			if (NULL == sub || RyanJsonFalse == RyanJsonIsObject(sub))
+			{
+				if (NULL != sub) { RyanJsonDelete(sub); }
+				sub = RyanJsonCreateObject();
+				TEST_ASSERT_NOT_NULL(sub);
+			}
+			applyMergePatch(sub, item);
+			TEST_ASSERT_TRUE(RyanJsonAddItemToObject(target, key, sub));
+			continue;
+		}
+		(void)RyanJsonDeleteByKey(target, key);
+		TEST_ASSERT_TRUE(RyanJsonInsert(target, RyanJsonAddPosition, RyanJsonDuplicate(item)));
+	}
+}
+
+/**
+ * @brief 增量应用到检查点副本后应与当前树一致
+ */
+static void assertDeltaApplies(RyanJson_t base, RyanJson_t json)
+{
+	char *delta = RyanJsonPrintDelta(json, 0, NULL);
+	TEST_ASSERT_NOT_NULL(delta);
+	RyanJson_t patch = RyanJsonParse(delta);
+	TEST_ASSERT_NOT_NULL_MESSAGE(patch, delta);
+
+	RyanJson_t applied = RyanJsonDuplicate(base);
+	TEST_ASSERT_NOT_NULL(applied);
+	applyMergePatch(applied, patch);
+	TEST_ASSERT_TRUE_MESSAGE(RyanJsonCompare(applied, json), delta);
+
+	RyanJsonDelete(applied);
+	RyanJsonDelete(patch);
+	RyanJsonFree(delta);
+}
+
+static void testPrintDeltaReplaceObject(void)
+{
+	RyanJson_t json = createPrintDeltaDoc();
+	RyanJson_t base = RyanJsonDuplicate(json);
+	TEST_ASSERT_NOT_NULL(base);
+
+	// Object 替换 Object 在 Merge Patch 中是合并：原有而新值没有的 key 必须输出 null
+	TEST_ASSERT_TRUE(RyanJsonReplaceByKey(json, "b", RyanJsonParse("{\"c\":\"x\",\"z\":1}")));
+	assertPrintDelta(RyanJsonGetObjectByKey(json, "b"), "{}");
+	char *delta = RyanJsonPrintDelta(json, 0, NULL);
+	TEST_ASSERT_NOT_NULL(delta);
+	TEST_ASSERT_NOT_NULL(strstr(delta, "\"d\":null"));
+	TEST_ASSERT_NOT_NULL(strstr(delta, "\"e\":null"));
+	RyanJsonFree(delta);
+	assertDeltaApplies(base, json);
+
+	// 再次替换时基线仍为检查点时的结构
+	TEST_ASSERT_TRUE(RyanJsonReplaceByKey(json, "b", RyanJsonParse("{\"e\":{\"g\":1}}")));
+	assertDeltaApplies(base, json);
+
+	// 分离后以同名 Object 重新加入，嵌套 Object 同样补 null
+	RyanJsonCheckpoint(json);
+	RyanJsonDelete(base);
+	base = RyanJsonDuplicate(json);
+	RyanJsonDelete(RyanJsonDetachByKey(json, "b"));
+	TEST_ASSERT_TRUE(RyanJsonAddItemToObject(json, "b", RyanJsonParse("{\"e\":{\"h\":2}}")));
+	assertPrintDelta(json, "{\"b\":{\"e\":{\"g\":null,\"h\":2}}}");
+	assertDeltaApplies(base, json);
+
+	// 替换前在原 Object 内部已删除的 key 也属于检查点结构
+	RyanJsonCheckpoint(json);
+	RyanJsonDelete(base);
+	base = RyanJsonDuplicate(json);
+	TEST_ASSERT_TRUE(RyanJsonAddIntToObject(RyanJsonGetObjectByKeys(json, "b", "e", NULL), "i", 3));
+	TEST_ASSERT_TRUE(RyanJsonDeleteByKey(RyanJsonGetObjectByKeys(json, "b", "e", NULL), "h"));
+	TEST_ASSERT_TRUE(RyanJsonReplaceByKey(json, "b", RyanJsonParse("{\"e\":{}}")));
+	assertPrintDelta(json, "{\"b\":{\"e\":{\"i\":null,\"h\":null}}}");
+	assertDeltaApplies(base, json);
+
+	// 新值不是 Object 时整体替换，无需补 null
+	TEST_ASSERT_TRUE(RyanJsonReplaceByKey(json, "b", RyanJsonCreateInt("b", 1)));
+	assertPrintDelta(json, "{\"b\":1}");
+	assertDeltaApplies(base, json);
+
+	RyanJsonCheckpoint(json);
+	assertPrintDelta(json, "{}");
+	RyanJsonDelete(base);
+	RyanJsonDelete(json);
+}
+
+static void testPrintDeltaNullValue(void)
+{
+	RyanJson_t json = createPrintDeltaDoc();
+
+	// Merge Patch 中 "k":null 表示删除，写入 null 值无法表示，增量打印返回 NULL
+	TEST_ASSERT_TRUE(RyanJsonAddNullToObject(json, "n"));
+	TEST_ASSERT_NULL(RyanJsonPrintDelta(json, 0, NULL));
+	RyanJsonCheckpoint(json);
+	assertPrintDelta(json, "{}");
+
+	TEST_ASSERT_TRUE(RyanJsonReplaceByKey(json, "a", RyanJsonCreateNull("a")));
+	TEST_ASSERT_NULL(RyanJsonPrintDelta(json, 0, NULL));
+	RyanJsonCheckpoint(json);
+
+	// 写入的 Object 内含 null 成员同样无法表示，深层修改也不例外
+	TEST_ASSERT_TRUE(RyanJsonReplaceByKey(json, "b", RyanJsonParse("{\"c\":\"x\",\"e\":{\"z\":null}}")));
+	TEST_ASSERT_NULL(RyanJsonPrintDelta(json, 0, NULL));
+	RyanJsonCheckpoint(json);
+	TEST_ASSERT_TRUE(RyanJsonAddNullToObject(RyanJsonGetObjectByKeys(json, "b", "e", NULL), "y"));
+	TEST_ASSERT_NULL(RyanJsonPrintDelta(json, 0, NULL));
+	RyanJsonCheckpoint(json);
+
+	// 数组整体替换，其中的 null 不受影响，补丁可正确应用
+	RyanJson_t base = RyanJsonDuplicate(json);
+	TEST_ASSERT_NOT_NULL(base);
+	TEST_ASSERT_TRUE(RyanJsonReplaceByKey(json, "list", RyanJsonParse("[null,{\"k\":null}]")));
+	TEST_ASSERT_TRUE(RyanJsonReplaceByKey(json, "a", RyanJsonCreateInt("a", 3)));
+	assertPrintDelta(json, "{\"list\":[null,{\"k\":null}],\"a\":3}");
+	assertDeltaApplies(base, json);
+
+	RyanJsonDelete(base);
+	RyanJsonDelete(json);
+}
+
+static void testPrintDeltaKeylessMember(void)
+{
+	RyanJson_t json = createPrintDeltaDoc();
+
+	// ReplaceByKey 传入无 key 标量时包装为 Object，其唯一成员不带 key
+	TEST_ASSERT_TRUE(RyanJsonReplaceByKey(json, "a", RyanJsonCreateInt(NULL, 5)));
+	RyanJson_t wrapper = RyanJsonGetObjectByKey(json, "a");
+	TEST_ASSERT_TRUE(RyanJsonIsObject(wrapper));
+	TEST_ASSERT_FALSE(RyanJsonIsKey(RyanJsonGetObjectValue(wrapper)));
+	RyanJsonCheckpoint(json);
+
+	// 整体删除时骨架照常生成，外层 key 可正常输出
+	RyanJson_t detached = RyanJsonDetachByKey(json, "a");
+	TEST_ASSERT_NOT_NULL(detached);
+	RyanJsonDelete(detached);
+	assertPrintDelta(json, "{\"a\":null}");
+
+	// 骨架转为同名 Object 的基线后含无 key 成员，Merge Patch 无法寻址，增量打印返回 NULL
+	TEST_ASSERT_TRUE(RyanJsonAddItemToObject(json, "a", RyanJsonParse("{\"x\":1}")));
+	TEST_ASSERT_NULL(RyanJsonPrintDelta(json, 0, NULL));
+	RyanJsonCheckpoint(json);
+	assertPrintDelta(json, "{}");
+
+	// 直接移除无 key 成员同样只能返回 NULL
+	TEST_ASSERT_TRUE(RyanJsonReplaceByKey(json, "h", RyanJsonCreateBool(NULL, RyanJsonFalse)));
+	RyanJsonCheckpoint(json);
+	detached = RyanJsonDetachByIndex(RyanJsonGetObjectByKey(json, "h"), 0);
+	TEST_ASSERT_NOT_NULL(detached);
+	RyanJsonDelete(detached);
+	TEST_ASSERT_NULL(RyanJsonPrintDelta(json, 0, NULL));
+	RyanJsonCheckpoint(json);
+	assertPrintDelta(json, "{}");
+
+	RyanJsonDelete(json);
+}
+
+static void testPrintDeltaRecordOom(void)
+{
+	RyanJson_t json = createPrintDeltaDoc();
+
+	// 记录所需内存申请失败时接口整体失败，树与记录均保持不变
+	UNITY_TEST_OOM_BEGIN(0);
+	RyanJsonBool_e ok = RyanJsonChangeIntValue(RyanJsonGetObjectByKeys(json, "b", "d", NULL), 8);
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_FALSE(ok);
+	TEST_ASSERT_EQUAL_INT(2, RyanJsonGetIntValue(RyanJsonGetObjectByKeys(json, "b", "d", NULL)));
+	assertPrintDelta(json, "{}");
+
+	UNITY_TEST_OOM_BEGIN(0);
+	RyanJson_t detached = RyanJsonDetachByKey(json, "a");
+	UNITY_TEST_OOM_END();
+	TEST_ASSERT_NULL(detached);
+	TEST_ASSERT_NOT_NULL(RyanJsonGetObjectByKey(json, "a"));
+	assertPrintDelta(json, "{}");
+
+	// 失败后再次修改仍可正常记录
+	TEST_ASSERT_TRUE(RyanJsonChangeIntValue(RyanJsonGetObjectByKeys(json, "b", "d", NULL), 8));
+	assertPrintDelta(json, "{\"b\":{\"d\":8}}");
+
+	RyanJsonDelete(json);
+}
+#endif
+
+void testPrintDeltaRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+#if true == RyanJsonDeltaTracking
+	RUN_TEST(testPrintDeltaNoChange);
+	RUN_TEST(testPrintDeltaScalarAndNested);
+	RUN_TEST(testPrintDeltaStructure);
+	RUN_TEST(testPrintDeltaArrayWhole);
+	RUN_TEST(testPrintDeltaDeepPath);
+	RUN_TEST(testPrintDeltaReplaceObject);
+	RUN_TEST(testPrintDeltaNullValue);
+	RUN_TEST(testPrintDeltaKeylessMember);
+	RUN_TEST(testPrintDeltaRecordOom);
+#endif
+}
@@ -306,6 +306,48 @@ static void testPrintPreallocatedArgGuards(void)
 	RyanJsonDelete(obj);
 }
 
+static void testPrintStringEscapeRunsExactFit(void)
+{
+	// 覆盖单遍转义：普通字节段 + 各类转义 + 控制字符 + '/' 不转义，且预分配按最终长度即可成功
+	char value[300];
+	uint32_t pos = 0;
+	for (uint32_t i = 0; i < 200; i++)
+	{
+		value[pos++] = (char)('a' + (i % 26));
+	}
+	const char *tail = "\"\\/\b\f\n\r\t\x01\x1F end";
+	memcpy(value + pos, tail, strlen(tail) + 1U);
+
+	RyanJson_t obj = RyanJsonCreateObject();
+	TEST_ASSERT_NOT_NULL(obj);
+	TEST_ASSERT_TRUE(RyanJsonAddStringToObject(obj, "k\n", value));
+
+	uint32_t len = 0;
+	char *printed = RyanJsonPrint(obj, 0, RyanJsonFalse, &len);
+	TEST_ASSERT_NOT_NULL(printed);
+
+	const char *expectTail = "\\\"\\\\/\\b\\f\\n\\r\\t\\u0001\\u001F end\"}";
+	TEST_ASSERT_EQUAL_UINT32(8U + 200U + (uint32_t)strlen(expectTail), len);
+	TEST_ASSERT_EQUAL_STRING_LEN_MESSAGE("{\"k\\n\":\"abc", printed, 11, "转义 key 输出不一致");
+	TEST_ASSERT_EQUAL_STRING_MESSAGE(expectTail, printed + len - strlen(expectTail), "转义序列输出不一致");
+
+	char *exactBuf = (char *)malloc((size_t)len + 1U);
+	TEST_ASSERT_NOT_NULL(exactBuf);
+	char *out = RyanJsonPrintPreallocated(obj, exactBuf, len + 1U, RyanJsonFalse, NULL);
+	TEST_ASSERT_NOT_NULL_MESSAGE(out, "含转义字符串预分配刚好够用应成功");
+	TEST_ASSERT_EQUAL_STRING(printed, out);
+	TEST_ASSERT_NULL_MESSAGE(RyanJsonPrintPreallocated(obj, exactBuf, len, RyanJsonFalse, NULL), "预分配少 1 字节应失败");
+
+	RyanJson_t roundtrip = RyanJsonParse(printed);
+	TEST_ASSERT_NOT_NULL(roundtrip);
+	TEST_ASSERT_EQUAL_STRING(value, RyanJsonGetStringValue(RyanJsonGetObjectToKey(roundtrip, "k\n")));
+
+	RyanJsonDelete(roundtrip);
+	free(exactBuf);
+	RyanJsonFree(printed);
+	RyanJsonDelete(obj);
+}
+
 static void testPrintOom(void)
 {
 	RyanJson_t obj = RyanJsonCreateObject();
@@ -375,6 +417,7 @@ void testPrintGeneralRunner(void)
 	RUN_TEST(testPrintDoubleFixedPointBoundary);
 	RUN_TEST(testPrintTinyDoubleNotZeroed);
 	RUN_TEST(testPrintPreallocatedArgGuards);
+	RUN_TEST(testPrintStringEscapeRunsExactFit);
 	RUN_TEST(testPrintOom);
 	RUN_TEST(testPrintFinalAppendOom);
 	RUN_TEST(testPrintExpandFallbackWithoutRealloc);
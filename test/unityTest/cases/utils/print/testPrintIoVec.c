@@ -0,0 +1,157 @@
+#include "testBase.h"
+
+#define printIoVecScratchSize (512U)
+#define printIoVecCap         (16U)
+
+/**
+ * @brief 创建测试文档：包含可引用的长字符串、需转义的长字符串与普通标量
+ */
+static RyanJson_t createPrintIoVecDoc(char *blob, uint32_t blobSize)
+{
+	memset(blob, 'b', blobSize - 1U);
+	blob[blobSize - 1U] = '\0';
+
+	RyanJson_t json = RyanJsonParse("{\"id\":7,\"ratio\":0.5,\"tags\":[\"short\",true,null],\"escaped\":\"line\\n\"}");
+	TEST_ASSERT_NOT_NULL(json);
+	TEST_ASSERT_TRUE(RyanJsonAddStringToObject(json, "blob", blob));
+	TEST_ASSERT_TRUE(RyanJsonAddStringToArray(RyanJsonGetObjectByKey(json, "tags"), blob));
+
+	// 超过引用阈值但需要转义：只能写入暂存区
+	blob[0] = '"';
+	TEST_ASSERT_TRUE(RyanJsonAddStringToObject(json, "quoted", blob));
+	blob[0] = 'b';
+	return json;
+}
+
+/**
+ * @brief 拼接全部片段并与普通打印结果比较
+ */
+static void assertIoVecMatchesPrint(RyanJson_t json, const RyanJsonIoVec_t *iov, uint32_t iovCount, RyanJsonBool_e format)
+{
+	uint32_t expectedLen = 0;
+	char *expected = RyanJsonPrint(json, 0, format, &expectedLen);
+	TEST_ASSERT_NOT_NULL(expected);
+
+	size_t totalLen = 0;
+	for (uint32_t i = 0; i < iovCount; i++)
+	{
+		TEST_ASSERT_NOT_NULL(iov[i].base);
+		TEST_ASSERT_TRUE(iov[i].len > 0);
+		totalLen += iov[i].len;
+	}
+	TEST_ASSERT_EQUAL_UINT32(expectedLen, (uint32_t)totalLen);
+
+	char *joined = (char *)malloc(totalLen + 1U);
+	TEST_ASSERT_NOT_NULL(joined);
+	size_t offset = 0;
+	for (uint32_t i = 0; i < iovCount; i++)
+	{
+		memcpy(joined + offset, iov[i].base, iov[i].len);
+		offset += iov[i].len;
+	}
+	joined[totalLen] = '\0';
+	TEST_ASSERT_EQUAL_STRING(expected, joined);
+
+	free(joined);
+	RyanJsonFree(expected);
+}
+
+static uint32_t countIoVecRef(const RyanJsonIoVec_t *iov, uint32_t iovCount, const char *strValue)
+{
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < iovCount; i++)
+	{
+		if (iov[i].base == (const void *)strValue) { count++; }
+	}
+	return count;
+}
+
+static void testPrintIoVecReferencesLongStrings(void)
+{
+	char blob[300];
+	RyanJson_t json = createPrintIoVecDoc(blob, sizeof(blob));
+
+	char scratch[printIoVecScratchSize];
+	RyanJsonIoVec_t iov[printIoVecCap];
+	uint32_t iovCount = 0;
+
+	TEST_ASSERT_TRUE(RyanJsonPrintIoVec(json, scratch, sizeof(scratch), RyanJsonFalse, iov, printIoVecCap, &iovCount));
+	assertIoVecMatchesPrint(json, iov, iovCount, RyanJsonFalse);
+
+	// 无需转义的长字符串直接引用节点存储，暂存区不包含其内容
+	const char *objBlob = RyanJsonGetStringValue(RyanJsonGetObjectByKey(json, "blob"));
+	const char *arrBlob = NULL;
+	RyanJson_t item = NULL;
+	RyanJsonArrayForEach(RyanJsonGetObjectByKey(json, "tags"), item)
+	{
+		if (RyanJsonIsString(item) && strlen(RyanJsonGetStringValue(item)) > 100U) { arrBlob = RyanJsonGetStringValue(item); }
+	}
+	TEST_ASSERT_NOT_NULL(arrBlob);
+	TEST_ASSERT_EQUAL_UINT32(1, countIoVecRef(iov, iovCount, objBlob));
+	TEST_ASSERT_EQUAL_UINT32(1, countIoVecRef(iov, iovCount, arrBlob));
+	TEST_ASSERT_EQUAL_UINT32(0, countIoVecRef(iov, iovCount, RyanJsonGetStringValue(RyanJsonGetObjectByKey(json, "quoted"))));
+
+	// 格式化输出同样适用
+	TEST_ASSERT_TRUE(RyanJsonPrintIoVec(json, scratch, sizeof(scratch), RyanJsonTrue, iov, printIoVecCap, &iovCount));
+	assertIoVecMatchesPrint(json, iov, iovCount, RyanJsonTrue);
+	TEST_ASSERT_EQUAL_UINT32(1, countIoVecRef(iov, iovCount, objBlob));
+
+	RyanJsonDelete(json);
+}
+
+static void testPrintIoVecScalarRoot(void)
+{
+	char scratch[32];
+	RyanJsonIoVec_t iov[printIoVecCap];
+	uint32_t iovCount = 0;
+
+	RyanJson_t num = RyanJsonCreateInt(NULL, -42);
+	TEST_ASSERT_NOT_NULL(num);
+	TEST_ASSERT_TRUE(RyanJsonPrintIoVec(num, scratch, sizeof(scratch), RyanJsonFalse, iov, printIoVecCap, &iovCount));
+	TEST_ASSERT_EQUAL_UINT32(1, iovCount);
+	assertIoVecMatchesPrint(num, iov, iovCount, RyanJsonFalse);
+	RyanJsonDelete(num);
+
+	// 根节点就是可引用的长字符串：引号在暂存区，内容为独立片段
+	char blob[200];
+	memset(blob, 's', sizeof(blob) - 1U);
+	blob[sizeof(blob) - 1U] = '\0';
+	RyanJson_t str = RyanJsonCreateString(NULL, blob);
+	TEST_ASSERT_NOT_NULL(str);
+	TEST_ASSERT_TRUE(RyanJsonPrintIoVec(str, scratch, sizeof(scratch), RyanJsonFalse, iov, printIoVecCap, &iovCount));
+	TEST_ASSERT_EQUAL_UINT32(3, iovCount);
+	TEST_ASSERT_EQUAL_PTR(RyanJsonGetStringValue(str), iov[1].base);
+	assertIoVecMatchesPrint(str, iov, iovCount, RyanJsonFalse);
+	RyanJsonDelete(str);
+}
+
+static void testPrintIoVecCapacityAndGuards(void)
+{
+	char blob[300];
+	RyanJson_t json = createPrintIoVecDoc(blob, sizeof(blob));
+
+	char scratch[printIoVecScratchSize];
+	RyanJsonIoVec_t iov[printIoVecCap];
+	uint32_t iovCount = 0;
+
+	TEST_ASSERT_FALSE(RyanJsonPrintIoVec(NULL, scratch, sizeof(scratch), RyanJsonFalse, iov, printIoVecCap, &iovCount));
+	TEST_ASSERT_FALSE(RyanJsonPrintIoVec(json, NULL, sizeof(scratch), RyanJsonFalse, iov, printIoVecCap, &iovCount));
+	TEST_ASSERT_FALSE(RyanJsonPrintIoVec(json, scratch, 0, RyanJsonFalse, iov, printIoVecCap, &iovCount));
+	TEST_ASSERT_FALSE(RyanJsonPrintIoVec(json, scratch, sizeof(scratch), RyanJsonFalse, NULL, printIoVecCap, &iovCount));
+	TEST_ASSERT_FALSE(RyanJsonPrintIoVec(json, scratch, sizeof(scratch), RyanJsonFalse, iov, 0, &iovCount));
+	TEST_ASSERT_FALSE(RyanJsonPrintIoVec(json, scratch, sizeof(scratch), RyanJsonFalse, iov, printIoVecCap, NULL));
+
+	// 片段数组或暂存区容量不足都应失败
+	TEST_ASSERT_FALSE(RyanJsonPrintIoVec(json, scratch, sizeof(scratch), RyanJsonFalse, iov, 2, &iovCount));
+	TEST_ASSERT_FALSE(RyanJsonPrintIoVec(json, scratch, 64, RyanJsonFalse, iov, printIoVecCap, &iovCount));
+
+	RyanJsonDelete(json);
+}
+
+void testPrintIoVecRunner(void)
+{
+	UnitySetTestFile(__FILE__);
+	RUN_TEST(testPrintIoVecReferencesLongStrings);
+	RUN_TEST(testPrintIoVecScalarRoot);
+	RUN_TEST(testPrintIoVecCapacityAndGuards);
+}
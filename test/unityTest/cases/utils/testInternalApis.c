@@ -51,8 +51,12 @@ static void testInternalStrPtrModeBufSwap(void)
 	char *expect = allocRepeatChar('y', valueLen);
 	TEST_ASSERT_EQUAL_STRING(expect, RyanJsonGetStringValue(node));
 
+	// 还原节点自身的缓冲后再删除（启用 RyanJsonStringIntern 时 ptr 缓冲带引用计数头，不能与裸缓冲混用）
+	RyanJsonInternalSetStrPtrModeBuf(node, oldBuf);
+	TEST_ASSERT_EQUAL_STRING(value, RyanJsonGetStringValue(node));
+
 	free(expect);
-	jsonFree(oldBuf);
+	jsonFree(newBuf);
 	RyanJsonDelete(node);
 	free(value);
 }
@@ -197,17 +201,20 @@ static void testInternalChangeObjectValueWithPreparedChild(void)
 static void testInternalParseDoubleRawNonNullTerminated(void)
 {
 	double number = 0.0;
+	RyanJsonBool_e isInt = RyanJsonFalse;
 
 	const uint8_t bufInt[] = {'1', '2', '3', '4'};
-	TEST_ASSERT_TRUE(RyanJsonInternalParseDoubleRaw(bufInt, (uint32_t)sizeof(bufInt), &number));
+	TEST_ASSERT_TRUE(RyanJsonInternalParseDoubleRaw(bufInt, (uint32_t)sizeof(bufInt), &number, &isInt));
 	TEST_ASSERT_TRUE(RyanJsonCompareDouble(1234.0, number));
+	TEST_ASSERT_TRUE(isInt);
 
 	const uint8_t bufFrac[] = {'-', '1', '2', '.', '5'};
-	TEST_ASSERT_TRUE(RyanJsonInternalParseDoubleRaw(bufFrac, (uint32_t)sizeof(bufFrac), &number));
+	TEST_ASSERT_TRUE(RyanJsonInternalParseDoubleRaw(bufFrac, (uint32_t)sizeof(bufFrac), &number, &isInt));
 	TEST_ASSERT_TRUE(RyanJsonCompareDouble(-12.5, number));
+	TEST_ASSERT_FALSE(isInt);
 
 	const uint8_t bufExp[] = {'1', 'e', '2'};
-	TEST_ASSERT_TRUE(RyanJsonInternalParseDoubleRaw(bufExp, (uint32_t)sizeof(bufExp), &number));
+	TEST_ASSERT_TRUE(RyanJsonInternalParseDoubleRaw(bufExp, (uint32_t)sizeof(bufExp), &number, NULL));
 	TEST_ASSERT_TRUE(RyanJsonCompareDouble(100.0, number));
 }
 
@@ -6,6 +6,9 @@
 #if defined(RyanJsonTestPlatformQemu)
 #define unitTlsfPoolSize (600U * 1024U)
 #define unitTlsfPoolMin  (512U * 1024U)
+#elif true == RyanJsonContainerExtEnable
+// 容器扩展槽使每个 Array/Object 节点多一个指针，深层嵌套用例需要更大的池
+#define unitTlsfPoolSize (2048U * 1024U)
 #else
 #define unitTlsfPoolSize (1024U * 1024U)
 #endif
@@ -24,6 +24,23 @@ local function setupRyanJsonTarget(isFuzz)
     local strictObjectKeyCheck = getBooleanEnvDefineValue("RYANJSON_STRICT_OBJECT_KEY_CHECK", "false")
     local defaultAddAtHead = getBooleanEnvDefineValue("RYANJSON_DEFAULT_ADD_AT_HEAD", "false")
     local snprintfSupportScientific = getBooleanEnvDefineValue("RYANJSON_SNPRINTF_SUPPORT_SCIENTIFIC", "false")
+    -- 可选特性宏（默认关闭）：
+    --   RYANJSON_PRINT_CACHE
+    --   RYANJSON_DELTA_TRACKING
+    --   RYANJSON_OBJECT_HASH_INDEX
+    --   RYANJSON_ARRAY_INDEX
+    --   RYANJSON_PACKED_ARRAY
+    --   RYANJSON_STRING_INTERN
+    --   RYANJSON_HASH_CACHE
+    --   RYANJSON_SNAPSHOT_SHARE
+    local printCache = getBooleanEnvDefineValue("RYANJSON_PRINT_CACHE", "false")
+    local deltaTracking = getBooleanEnvDefineValue("RYANJSON_DELTA_TRACKING", "false")
+    local objectHashIndex = getBooleanEnvDefineValue("RYANJSON_OBJECT_HASH_INDEX", "false")
+    local arrayIndex = getBooleanEnvDefineValue("RYANJSON_ARRAY_INDEX", "false")
+    local packedArray = getBooleanEnvDefineValue("RYANJSON_PACKED_ARRAY", "false")
+    local stringIntern = getBooleanEnvDefineValue("RYANJSON_STRING_INTERN", "false")
+    local hashCache = getBooleanEnvDefineValue("RYANJSON_HASH_CACHE", "false")
+    local snapshotShare = getBooleanEnvDefineValue("RYANJSON_SNAPSHOT_SHARE", "false")
     local unitOnlyMemory = getBooleanEnvDefineValue("RYANJSON_UNIT_ONLY_MEMORY", "false")
     local unitOnlyRfc8259 = getBooleanEnvDefineValue("RYANJSON_UNIT_ONLY_RFC8259", "false")
 
@@ -31,6 +48,14 @@ local function setupRyanJsonTarget(isFuzz)
     add_defines("RyanJsonDefaultAddAtHead=" .. defaultAddAtHead)
     -- 声明 snprintf 支持科学计数法，影响 double 序列化策略
     add_defines("RyanJsonSnprintfSupportScientific=" .. snprintfSupportScientific)
+    add_defines("RyanJsonPrintCache=" .. printCache)
+    add_defines("RyanJsonDeltaTracking=" .. deltaTracking)
+    add_defines("RyanJsonObjectHashIndex=" .. objectHashIndex)
+    add_defines("RyanJsonArrayIndex=" .. arrayIndex)
+    add_defines("RyanJsonPackedArray=" .. packedArray)
+    add_defines("RyanJsonStringIntern=" .. stringIntern)
+    add_defines("RyanJsonHashCache=" .. hashCache)
+    add_defines("RyanJsonSnapshotShare=" .. snapshotShare)
     if "true" == unitOnlyMemory then
         add_defines("RyanJsonUnitOnlyMemory")
     end